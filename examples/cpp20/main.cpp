@@ -0,0 +1,88 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <cstdio>
+#include <future>
+#include <thread>
+#include "l8w8jwt/l8w8jwt.hpp"
+
+static const char KEY[] = "test key";
+
+// Runs every piece of work on a thread of its own (a real server would hand it to its thread pool instead).
+struct thread_executor
+{
+    template <typename F>
+    void execute(F&& f)
+    {
+        std::thread([f = std::forward<F>(f)]() mutable {
+            f();
+            l8w8jwt_thread_cleanup();
+        }).detach();
+    }
+};
+
+// The smallest possible coroutine type: runs eagerly and reports completion through a promise.
+struct task
+{
+    struct promise_type
+    {
+        task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+static task sign_and_verify(thread_executor& pool, std::promise<void>& done)
+{
+    const l8w8jwt::signer<l8w8jwt::alg::hs256> signer(KEY);
+
+    l8w8jwt::verifier<l8w8jwt::alg::hs256> verifier(KEY);
+    verifier.expect_iss("Black Mesa").expect_sub("Gordon Freeman").validate_exp(60).validate_iat(60);
+
+    l8w8jwt::payload payload;
+    payload.iss = "Black Mesa";
+    payload.sub = "Gordon Freeman";
+    payload.iat = l8w8jwt_time(nullptr);
+    payload.exp = payload.iat + 600;
+
+    const l8w8jwt::token token = co_await signer.sign(pool, payload);
+
+    const l8w8jwt::verification verification = co_await verifier.verify(pool, token);
+
+    std::printf("\n%s\n\nValid: %s\n\n", token.c_str(), verification.valid() ? "yes" : "no");
+
+    for (const l8w8jwt::claim_view claim : verification.claims)
+    {
+        std::printf("%.*s: %.*s\n", (int)claim.key().size(), claim.key().data(), (int)claim.value().size(), claim.value().data());
+    }
+
+    done.set_value();
+}
+
+int main()
+{
+    thread_executor pool;
+
+    std::promise<void> done;
+    std::future<void> finished = done.get_future();
+
+    sign_and_verify(pool, done);
+    finished.wait();
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file allocator.h
+ *  @author Raphael Beck
+ *  @brief Per-call allocators: let a single encode/decode call allocate from e.g. a request-scoped arena instead of the global heap.
+ */
+
+#ifndef L8W8JWT_ALLOCATOR_H
+#define L8W8JWT_ALLOCATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+#include <stddef.h>
+
+struct l8w8jwt_claim;
+
+/**
+ * An allocator that a single encode or decode call allocates its memory from
+ * (see {@link #l8w8jwt_encoding_params::allocator} and {@link #l8w8jwt_decoding_params::allocator}). <p>
+ * All of the call's own buffers come from it: the decoded segments, claims and JSON token arrays, the base64 conversions and the string builders,
+ * as well as everything that the call hands out (the encoded token, the decoded claims, the raw header/payload/signature of {@link #l8w8jwt_decode_raw}).
+ * Free those with {@link #l8w8jwt_allocator_free} and {@link #l8w8jwt_allocator_free_claims} (or not at all, e.g. when the arena is reset as a whole). <p>
+ * Long-lived state that a call happens to update (verification cache entries, jti stores, per-thread scratch contexts, etc...) always lives on the global heap,
+ * and so does the memory that the crypto backends allocate internally (they have allocation hooks of their own, e.g. <code>MBEDTLS_PLATFORM_MEMORY</code>).
+ */
+struct l8w8jwt_allocator
+{
+    /**
+     * Allocates \p size bytes (suitably aligned for any type), or returns <code>NULL</code> if it can't.
+     */
+    void* (*alloc)(void* usr, size_t size);
+
+    /**
+     * Frees a block that was returned by {@link #alloc}. \p size is the size that it was allocated with (e.g. for <code>std::pmr::memory_resource::deallocate</code>).
+     */
+    void (*free)(void* usr, void* ptr, size_t size);
+
+    /**
+     * [OPTIONAL] Anything that the callbacks need (e.g. the arena), passed to them as their first argument.
+     */
+    void* usr;
+};
+
+/**
+ * Frees a buffer that a call with a per-call allocator handed out (e.g. an encoded token).
+ * @param allocator The allocator that was used for the call (<code>NULL</code> if there was none, in which case this is the same as {@link #l8w8jwt_free}).
+ * @param ptr The buffer to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_allocator_free(const struct l8w8jwt_allocator* allocator, void* ptr);
+
+/**
+ * Frees claims that a decode call with a per-call allocator handed out.
+ * @param allocator The allocator that was used for the call (<code>NULL</code> if there was none, in which case this is the same as {@link #l8w8jwt_free_claims}).
+ * @param claims The claims to free.
+ * @param claims_count The claims count.
+ */
+L8W8JWT_API void l8w8jwt_allocator_free_claims(const struct l8w8jwt_allocator* allocator, struct l8w8jwt_claim* claims, size_t claims_count);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_ALLOCATOR_H
@@ -0,0 +1,136 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file async.h
+ *  @author Raphael Beck
+ *  @brief Asynchronous token decoding on a pool of worker threads, with a completion queue that can wake up an event loop.
+ */
+
+#ifndef L8W8JWT_ASYNC_H
+#define L8W8JWT_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "decode.h"
+
+#ifndef L8W8JWT_ENABLE_ASYNC
+/**
+ * Set this pre-processor definition to \c 0 to build the library without the asynchronous decoder (and thus without a dependency on the platform's threading library).
+ */
+#define L8W8JWT_ENABLE_ASYNC 1
+#endif
+
+/**
+ * The outcome of an asynchronously decoded token.
+ */
+struct l8w8jwt_async_result
+{
+    /**
+     * The user data that the token was submitted with (e.g. the connection that it arrived on).
+     */
+    void* user_data;
+
+    /**
+     * The return code of the decode, as defined in retcodes.h
+     */
+    int r;
+
+    /**
+     * The validation result flags (0 means that the token is valid; <code>~L8W8JWT_VALID</code> if it couldn't be decoded at all).
+     */
+    enum l8w8jwt_validation_result validation_result;
+
+    /**
+     * The decoded claims (or <code>NULL</code> if decoding failed). The caller takes ownership: free them using {@link #l8w8jwt_allocator_free_claims} with {@link #allocator} once you're done.
+     */
+    struct l8w8jwt_claim* claims;
+
+    /**
+     * How many claims there are.
+     */
+    size_t claims_length;
+
+    /**
+     * The allocator that the token was submitted with (see {@link #l8w8jwt_decoding_params::allocator}), which the claims were allocated from (<code>NULL</code> for the global heap).
+     */
+    const struct l8w8jwt_allocator* allocator;
+};
+
+/**
+ * An asynchronous decoder: I/O threads submit tokens into a bounded queue, a pool of worker threads decodes and validates them with {@link #l8w8jwt_decode},
+ * and the results are picked up from a completion queue. <p>
+ * Any number of threads may submit tokens at the same time. The completion queue may be drained by any thread too, but it is meant to be drained by the event loop
+ * that the decoder signals through its event file descriptor.
+ */
+struct l8w8jwt_async_decoder;
+
+/**
+ * Creates an asynchronous decoder and starts its worker threads.
+ * @param worker_count How many worker threads to start (<code>0</code> starts one).
+ * @param queue_capacity The maximum number of tokens in flight: submitted, but whose result hasn't been picked up yet.
+ * @param event_fd [OPTIONAL] A file descriptor (e.g. from <code>eventfd()</code>) that the decoder writes an 8-byte <code>1</code> to whenever a result is completed into an empty completion queue,
+ * so that it can be watched with <code>epoll</code>/<code>poll</code>; pass <code>-1</code> for none (always <code>-1</code> on Windows). The decoder doesn't take ownership of it.
+ * @param out_decoder Where to write the newly allocated decoder into (free it using {@link #l8w8jwt_async_decoder_free} once you're done).
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_UNSUPPORTED_ALG</code> if the library was built without <code>L8W8JWT_ENABLE_ASYNC</code>).
+ */
+L8W8JWT_API int l8w8jwt_async_decoder_create(size_t worker_count, size_t queue_capacity, int event_fd, struct l8w8jwt_async_decoder** out_decoder);
+
+/**
+ * Submits a token for decoding. This never blocks on crypto: it only copies the token into the queue.
+ * @param decoder The decoder.
+ * @param params The parameters to decode and validate the token with. The struct and the token string are copied (so the caller's buffer can be reused right away),
+ * but everything else that the params point to (keys, caches, stores, allocators, etc...) must stay valid until the token's result is picked up.
+ * An allocator is called from the worker threads, so it must be thread-safe.
+ * Params with a {@link #l8w8jwt_decoding_params::key_set_reader} are rejected, since readers can't be shared between the worker threads.
+ * @param user_data [OPTIONAL] Anything that the result should carry back (see {@link #l8w8jwt_async_result::user_data}).
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_QUEUE_FULL</code> if the queue capacity is exhausted: pick up some results and try again).
+ */
+L8W8JWT_API int l8w8jwt_async_decoder_submit(struct l8w8jwt_async_decoder* decoder, const struct l8w8jwt_decoding_params* params, void* user_data);
+
+/**
+ * Picks up completed results without blocking. <p>
+ * When driven by the event file descriptor, read the descriptor first and then poll until this returns <code>0</code>: results that complete in between don't signal it again.
+ * @param decoder The decoder.
+ * @param out_results Where to write the results into (in completion order, which isn't necessarily the submission order).
+ * @param max_results How many results fit into \p out_results
+ * @return The number of results written into \p out_results
+ */
+L8W8JWT_API size_t l8w8jwt_async_decoder_poll(struct l8w8jwt_async_decoder* decoder, struct l8w8jwt_async_result* out_results, size_t max_results);
+
+/**
+ * Like {@link #l8w8jwt_async_decoder_poll}, but blocks until at least one result is available (unless there are no tokens in flight, in which case it returns <code>0</code> right away).
+ * @param decoder The decoder.
+ * @param out_results Where to write the results into.
+ * @param max_results How many results fit into \p out_results
+ * @return The number of results written into \p out_results
+ */
+L8W8JWT_API size_t l8w8jwt_async_decoder_wait(struct l8w8jwt_async_decoder* decoder, struct l8w8jwt_async_result* out_results, size_t max_results);
+
+/**
+ * Stops and joins the worker threads (tokens that are being decoded are finished first) and frees the decoder,
+ * including the queued tokens that weren't decoded yet and the results that weren't picked up.
+ * @param decoder The decoder to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_async_decoder_free(struct l8w8jwt_async_decoder* decoder);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_ASYNC_H
@@ -70,6 +70,65 @@ L8W8JWT_API int l8w8jwt_base64_encode(int url, const uint8_t* data, size_t data_
  */
 L8W8JWT_API int l8w8jwt_base64_decode(int url, const char* data, size_t data_length, uint8_t** out, size_t* out_length);
 
+/**
+ *  Gets the exact length of the unpadded base64url string that encoding \p data_length bytes would produce.
+ *  @param data_length The number of bytes to encode.
+ *  @return The base64url string length (without any NUL terminator).
+ */
+L8W8JWT_API size_t l8w8jwt_base64url_encoded_length(size_t data_length);
+
+/**
+ *  State of an incremental (streaming) base64url encoder
+ *  that writes its output straight into a caller-provided buffer. <p>
+ *  Input can be fed in arbitrarily sized chunks: up to 2 leftover bytes are carried over to the next write.
+ *  @see l8w8jwt_base64url_stream_init
+ */
+struct l8w8jwt_base64url_stream
+{
+    /**
+     * Where the base64url characters are written to.
+     */
+    char* out;
+
+    /**
+     * How many characters were written into {@link #out} so far.
+     */
+    size_t out_length;
+
+    /**
+     * Input bytes that did not yet form a full 3-byte group.
+     */
+    uint8_t pending[3];
+
+    /**
+     * How many bytes are currently held in {@link #pending}.
+     */
+    size_t pending_length;
+};
+
+/**
+ *  Initializes a streaming base64url encoder.
+ *  @note The stream does NOT bounds-check its output: make sure \p out is at least {@link #l8w8jwt_base64url_encoded_length} bytes big for the total amount of data you are going to feed into it!
+ *  @param stream The stream to initialize.
+ *  @param out Where to write the base64url encoded characters into.
+ */
+L8W8JWT_API void l8w8jwt_base64url_stream_init(struct l8w8jwt_base64url_stream* stream, char* out);
+
+/**
+ *  Feeds a chunk of bytes into a streaming base64url encoder.
+ *  @param stream The stream to write into.
+ *  @param data The bytes to encode.
+ *  @param data_length How many bytes to encode.
+ */
+L8W8JWT_API void l8w8jwt_base64url_stream_write(struct l8w8jwt_base64url_stream* stream, const uint8_t* data, size_t data_length);
+
+/**
+ *  Flushes any leftover bytes out of a streaming base64url encoder (no padding is written and no NUL terminator is appended).
+ *  @param stream The stream to finish.
+ *  @return The total amount of characters that were written into the stream's output buffer.
+ */
+L8W8JWT_API size_t l8w8jwt_base64url_stream_finish(struct l8w8jwt_base64url_stream* stream);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -129,6 +129,44 @@ L8W8JWT_API void l8w8jwt_free_claims(struct l8w8jwt_claim* claims, size_t claims
  */
 L8W8JWT_API int l8w8jwt_write_claims(struct chillbuff* stringbuilder, struct l8w8jwt_claim* claims, size_t claims_count);
 
+/**
+ * Callback that receives serialized claims JSON chunk by chunk, in order (see {@link #l8w8jwt_write_claims_to_sink}).
+ * @param usr The user pointer that was passed into {@link #l8w8jwt_write_claims_to_sink}.
+ * @param data The next chunk of JSON to append (NOT NUL-terminated).
+ * @param data_length Length of the chunk.
+ */
+typedef void (*l8w8jwt_claims_sink)(void* usr, const char* data, size_t data_length);
+
+/**
+ * JSON-escapes a string (e.g. a claim key or string value) into a sink (without surrounding double-quotes).
+ * @param sink The callback that receives the escaped string (chunk by chunk).
+ * @param usr [OPTIONAL] User pointer that is passed on to each \p sink invocation.
+ * @param string The string to escape.
+ * @param string_length Length of the string to escape.
+ */
+L8W8JWT_API void l8w8jwt_escape_claim_string_to_sink(l8w8jwt_claims_sink sink, void* usr, const char* string, size_t string_length);
+
+/**
+ * Writes a bunch of JWT claims into a custom sink instead of a chillbuff stringbuilder
+ * (e.g. directly into a pre-allocated buffer or a streaming encoder). <p>
+ * The exact same output as with {@link #l8w8jwt_write_claims} is produced:
+ * curly braces and trailing commas won't be written; only the "key":"value" pairs!
+ * @param sink The callback that receives the serialized claims.
+ * @param usr [OPTIONAL] User pointer that is passed on to each \p sink invocation.
+ * @param claims The l8w8jwt_claim array of claims to write.
+ * @param claims_count The claims array size.
+ * @return Return code as specified inside retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_write_claims_to_sink(l8w8jwt_claims_sink sink, void* usr, struct l8w8jwt_claim* claims, size_t claims_count);
+
+/**
+ * Gets the exact amount of characters that {@link #l8w8jwt_write_claims} would write for the given claims (escape sequences included).
+ * @param claims The l8w8jwt_claim array of claims to measure.
+ * @param claims_count The claims array size.
+ * @return The serialized claims' length; <code>0</code> if there is nothing to write (or if the passed arguments are invalid).
+ */
+L8W8JWT_API size_t l8w8jwt_get_claims_length(struct l8w8jwt_claim* claims, size_t claims_count);
+
 /**
  * Gets a claim by key from a l8w8jwt_claim array.
  * @param claims The array to look in.
@@ -28,7 +28,17 @@ extern "C" {
 #endif
 
 #include "algs.h"
+#include "allocator.h"
 #include "claim.h"
+#include "psa.h"
+#include "prefix.h"
+#include "verification_key.h"
+#include "verification_cache.h"
+#include "rejection_cache.h"
+#include "jti_store.h"
+#include "revocation.h"
+#include "key_set.h"
+#include "thread.h"
 #include "version.h"
 #include "retcodes.h"
 #include "timehelper.h"
@@ -91,7 +101,17 @@ enum l8w8jwt_validation_result {
     /**
      * The token's "typ" claim validation failed.
      */
-    L8W8JWT_TYP_FAILURE = (unsigned)1 << (unsigned)8
+    L8W8JWT_TYP_FAILURE = (unsigned)1 << (unsigned)8,
+
+    /**
+     * The token's JWT ID was seen before: it's being replayed (see {@link #l8w8jwt_decoding_params::jti_store}).
+     */
+    L8W8JWT_JTI_REPLAY = (unsigned)1 << (unsigned)9,
+
+    /**
+     * The token's JWT ID (or its issuer/subject pair) is on the revocation list (see {@link #l8w8jwt_decoding_params::revocation_filter}).
+     */
+    L8W8JWT_REVOKED = (unsigned)1 << (unsigned)10
 };
 
 /**
@@ -226,6 +246,71 @@ struct l8w8jwt_decoding_params
      * validate_typ string length.
      */
     size_t validate_typ_length;
+
+    /**
+     * [OPTIONAL] Cached hash midstate of the constant token prefix (base64url header + '.') for verifying the signature with less hashing work. <p>
+     * Only used if its alg (and for HS* algs, its key) match, and if the token actually starts with its prefix; otherwise it's ignored. Leave this at <code>NULL</code> if you don't need it.
+     * @see l8w8jwt_prefix_context_create_from_token
+     */
+    struct l8w8jwt_prefix_context* prefix_context;
+
+    /**
+     * [OPTIONAL] ID of a verification key in the PSA key store (see {@link #l8w8jwt_psa_import_key}). <p>
+     * If this is set (non-zero), the signature is verified through the PSA Crypto API and the verification_key field is ignored (it can be left at <code>NULL</code>). <p>
+     * Requires building l8w8jwt with <code>L8W8JWT_USE_PSA_CRYPTO</code>; otherwise decoding fails with <code>L8W8JWT_UNSUPPORTED_ALG</code>.
+     */
+    uint32_t psa_key_id;
+
+    /**
+     * [OPTIONAL] A verification key that was parsed ahead of time (see {@link #l8w8jwt_verification_key_create}), for not having to parse the PEM for every token. <p>
+     * If this is set (and {@link #psa_key_id} isn't), the signature is verified with it and the verification_key field is ignored (it can be left at <code>NULL</code>).
+     * Its alg must match {@link #alg}; otherwise decoding fails with <code>L8W8JWT_INVALID_ARG</code>.
+     */
+    struct l8w8jwt_verification_key* verification_key_object;
+
+    /**
+     * [OPTIONAL] A cache of tokens whose signature was verified already (see {@link #l8w8jwt_verification_cache_create}). <p>
+     * If this is set, {@link #l8w8jwt_decode} looks the token up first: a token that was decoded before (with the same alg and verification key)
+     * skips the signature verification and only has its cached claims validated again. Successfully verified tokens are added to it until their <code>exp</code>.
+     */
+    struct l8w8jwt_verification_cache* verification_cache;
+
+    /**
+     * [OPTIONAL] A cache of tokens whose signature failed to verify recently (see {@link #l8w8jwt_rejection_cache_create}). <p>
+     * If this is set, {@link #l8w8jwt_decode} flags tokens that are found in it with <code>L8W8JWT_SIGNATURE_VERIFICATION_FAILURE</code> without verifying their signature again,
+     * and adds every token whose signature doesn't verify to it.
+     */
+    struct l8w8jwt_rejection_cache* rejection_cache;
+
+    /**
+     * [OPTIONAL] A replay detection store for enforcing one-time use of tokens (see {@link #l8w8jwt_jti_store_create}). <p>
+     * If this is set, every token that passes all other validations has its <code>jti</code> recorded in the store until its <code>exp</code> (plus {@link #exp_tolerance_seconds}),
+     * and tokens whose <code>jti</code> is in there already are flagged with <code>L8W8JWT_JTI_REPLAY</code>.
+     * Tokens that lack a <code>jti</code> or an integer <code>exp</code> claim can't be tracked, so they're flagged with <code>L8W8JWT_JTI_FAILURE</code>.
+     * Set {@link #validate_exp} as well: otherwise expired tokens (which the store has forgotten about) would pass.
+     */
+    struct l8w8jwt_jti_store* jti_store;
+
+    /**
+     * [OPTIONAL] A memory-mapped revocation list (see {@link #l8w8jwt_revocation_filter_open}). <p>
+     * If this is set, tokens whose <code>jti</code> or whose <code>iss</code> and <code>sub</code> claims are on the list are flagged with <code>L8W8JWT_REVOKED</code>.
+     */
+    struct l8w8jwt_revocation_filter* revocation_filter;
+
+    /**
+     * [OPTIONAL] The calling thread's reader of a rotatable key set (see {@link #l8w8jwt_key_set_reader_create}). <p>
+     * If this is set, the token is verified with the key set's key whose kid and alg match the token's (the {@link #alg} field is still mandatory),
+     * and {@link #verification_key}, {@link #verification_key_object} and {@link #psa_key_id} are ignored.
+     * Tokens that no key in the set matches are flagged with <code>L8W8JWT_SIGNATURE_VERIFICATION_FAILURE</code>.
+     */
+    struct l8w8jwt_key_set_reader* key_set_reader;
+
+    /**
+     * [OPTIONAL] The allocator to allocate the decoded claims (and everything else that this call allocates) from, instead of the global heap (see allocator.h). <p>
+     * Free the claims using {@link #l8w8jwt_allocator_free_claims} (and the raw segments using {@link #l8w8jwt_allocator_free}) with this same allocator.
+     * Leave this at <code>NULL</code> to use the global heap.
+     */
+    const struct l8w8jwt_allocator* allocator;
 };
 
 /**
@@ -327,6 +412,86 @@ L8W8JWT_API int l8w8jwt_decode_raw(struct l8w8jwt_decoding_params* params, enum
  */
 L8W8JWT_API int l8w8jwt_decode_raw_no_validation(struct l8w8jwt_decoding_params* params, char** out_header, size_t* out_header_length, char** out_payload, size_t* out_payload_length, uint8_t** out_signature, size_t* out_signature_length);
 
+/**
+ * Decodes and validates many tokens that share the same alg, verification key and validation settings in one go. <p>
+ * For the SHA-256 based algs (HS256, RS256, PS256, ES256 and ES256K), the tokens' signing inputs are hashed together
+ * (on x86 CPUs with AVX-512, 16 tokens at a time in parallel SIMD lanes), and an RS/PS/ES verification key is parsed only once for the whole batch.
+ * Each token's signature is verified before its claims are validated, the same as in {@link #l8w8jwt_decode}. <p>
+ * All other algs simply go through {@link #l8w8jwt_decode} token by token, and so do PSA keys and decoding params with a {@link #l8w8jwt_decoding_params::jti_store},
+ * {@link #l8w8jwt_decoding_params::key_set_reader}, {@link #l8w8jwt_decoding_params::verification_cache}, {@link #l8w8jwt_decoding_params::rejection_cache} or {@link #l8w8jwt_decoding_params::prefix_context}
+ * (so that all of these are honoured exactly like for single tokens). <p>
+ * The decoded claims are not returned: this is for verifying, e.g. when draining a queue of incoming requests.
+ *
+ * @param params The parameters to use for decoding and validating the tokens (their jwt and jwt_length fields are ignored).
+ *
+ * @param jwts The (NUL-terminated) tokens to decode and validate.
+ *
+ * @param jwt_lengths The token string lengths.
+ *
+ * @param count How many tokens there are.
+ *
+ * @param out_validation_results Where to write each token's validation result flags into (<code>count</code> entries; 0 means that the token is valid). Tokens that can't be decoded at all get <code>~L8W8JWT_VALID</code>.
+ *
+ * @return <code>L8W8JWT_SUCCESS</code> if every token could be decoded; otherwise the first failure's return code as defined in retcodes.h (the remaining tokens are still decoded and validated).
+ */
+L8W8JWT_API int l8w8jwt_decode_batch(struct l8w8jwt_decoding_params* params, char* const* jwts, const size_t* jwt_lengths, size_t count, enum l8w8jwt_validation_result* out_validation_results);
+
+/**
+ * The state of a token that is decoded step by step (see {@link #l8w8jwt_decode_start}).
+ */
+struct l8w8jwt_decode_state;
+
+/**
+ * Starts decoding a token step by step, so that an event loop can verify it in slices of bounded duration instead of blocking for an entire ECDSA verification. <p>
+ * Nothing is decoded yet: call {@link #l8w8jwt_decode_step} until it stops returning <code>L8W8JWT_IN_PROGRESS</code>, then collect the outcome with {@link #l8w8jwt_decode_finish}. <p>
+ * ES256, ES256K, ES384 and ES512 signatures are verified step-wise by MbedTLS' generic ECDSA implementation, which requires MbedTLS to be built with <code>MBEDTLS_ECP_RESTARTABLE</code>
+ * (the <code>L8W8JWT_ENABLE_ECP_RESTARTABLE</code> CMake option does that for the bundled MbedTLS); the dedicated 256-bit curve engines are fast enough to verify in one step.
+ * Everything else (other algs, PSA keys, key sets and verification/rejection caches) is decoded in full by the first step.
+ *
+ * @param params The parameters to use for decoding and validating the token. They are copied, but the memory that they point to (the jwt, the keys, etc...) must stay valid until the state is freed.
+ *
+ * @param out_state Where to write the newly allocated decode state into (free it using {@link #l8w8jwt_decode_state_free} once you're done).
+ *
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_UNSUPPORTED_ALG</code> for ES* tokens whose crypto provider can't verify step-wise,
+ * e.g. MbedTLS without <code>MBEDTLS_ECP_RESTARTABLE</code> or OpenSSL: use {@link #l8w8jwt_decode} or the asynchronous decoder for those).
+ */
+L8W8JWT_API int l8w8jwt_decode_start(const struct l8w8jwt_decoding_params* params, struct l8w8jwt_decode_state** out_state);
+
+/**
+ * Performs the next slice of work of a step-wise decode. <p>
+ * Decode states can be stepped on different threads at the same time, but MbedTLS' operation budget is a process-wide setting: l8w8jwt serializes the steps around it
+ * (so a step may wait for another thread's step to finish) and resets it to unlimited after each one. Don't run restartable MbedTLS operations of your own concurrently with steps.
+ *
+ * @param state The decode state.
+ *
+ * @param max_ops The maximum number of basic elliptic curve operations to perform in this step (see <code>mbedtls_ecp_set_max_ops()</code>: one is roughly the cost of a point addition; <code>0</code> means no limit).
+ *
+ * @return <code>L8W8JWT_IN_PROGRESS</code> if the token isn't fully decoded yet; otherwise the return code that {@link #l8w8jwt_decode} would have returned (further calls keep returning it).
+ */
+L8W8JWT_API int l8w8jwt_decode_step(struct l8w8jwt_decode_state* state, unsigned int max_ops);
+
+/**
+ * Collects the outcome of a completed step-wise decode.
+ *
+ * @param state The decode state (after {@link #l8w8jwt_decode_step} returned <code>L8W8JWT_SUCCESS</code>).
+ *
+ * @param out_validation_result Where to write the validation result flags into (0 means success).
+ *
+ * @param out_claims [OPTIONAL] Where to write the decoded claims into (the caller takes ownership: free them using {@link #l8w8jwt_free_claims}, or {@link #l8w8jwt_allocator_free_claims} if the params had an allocator, once you're done). This can only be collected once.
+ *
+ * @param out_claims_length [OPTIONAL] Where to write the decoded claims count into.
+ *
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_IN_PROGRESS</code> if the decode isn't done yet, or the final step's failure code).
+ */
+L8W8JWT_API int l8w8jwt_decode_finish(struct l8w8jwt_decode_state* state, enum l8w8jwt_validation_result* out_validation_result, struct l8w8jwt_claim** out_claims, size_t* out_claims_length);
+
+/**
+ * Frees a decode state (whether it completed or not).
+ *
+ * @param state The decode state to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_decode_state_free(struct l8w8jwt_decode_state* state);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
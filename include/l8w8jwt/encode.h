@@ -28,11 +28,16 @@ extern "C" {
 #endif
 
 #include "algs.h"
+#include "allocator.h"
 #include "claim.h"
+#include "psa.h"
+#include "prefix.h"
+#include "thread.h"
 #include "version.h"
 #include "retcodes.h"
 #include "timehelper.h"
 #include <stddef.h>
+#include <stdint.h>
 
 #ifndef L8W8JWT_MAX_KEY_SIZE
 #define L8W8JWT_MAX_KEY_SIZE 8192
@@ -175,6 +180,35 @@ L8W8JWT_API struct l8w8jwt_encoding_params
      * Where the output token string length should be written into.
      */
     size_t* out_length;
+
+    /**
+     * [OPTIONAL] Cached hash midstate of the constant token prefix (base64url header + '.'), to save some hashing work per token. <p>
+     * Only used if its alg (and for HS* algs, its key) match, and if the token actually starts with its prefix; otherwise it's ignored. Leave this at <code>NULL</code> if you don't need it.
+     * @see l8w8jwt_prefix_context_create
+     * @see l8w8jwt_create_encoding_prefix_context
+     */
+    struct l8w8jwt_prefix_context* prefix_context;
+
+    /**
+     * [OPTIONAL] ID of a signing key in the PSA key store (see {@link #l8w8jwt_psa_import_key}). <p>
+     * If this is set (non-zero), the token is signed through the PSA Crypto API (and thus through whatever driver backs that key),
+     * and the secret_key and secret_key_pw fields are ignored (they can be left at <code>NULL</code>). <p>
+     * Requires building l8w8jwt with <code>L8W8JWT_USE_PSA_CRYPTO</code>; otherwise encoding fails with <code>L8W8JWT_UNSUPPORTED_ALG</code>.
+     */
+    uint32_t psa_key_id;
+
+    /**
+     * [OPTIONAL] Set this to a non-zero value to sign ES256, ES384, ES512 and ES256K tokens with deterministic nonces (RFC 6979) instead of randomized ones. <p>
+     * No entropy source is touched while signing, and the same header + payload signed with the same key always yields the very same token (handy for caching signed tokens by content). <p>
+     * Not available for PSA keys, nor with OpenSSL providers older than 3.2: in those cases, encoding fails with <code>L8W8JWT_UNSUPPORTED_ALG</code>. Other algs ignore this field.
+     */
+    int deterministic_ecdsa;
+
+    /**
+     * [OPTIONAL] The allocator to allocate the encoded token (and everything else that this call allocates) from, instead of the global heap (see allocator.h). <p>
+     * Free the token using {@link #l8w8jwt_allocator_free} with this same allocator (instead of {@link #l8w8jwt_free}). Leave this at <code>NULL</code> to use the global heap.
+     */
+    const struct l8w8jwt_allocator* allocator;
 };
 
 /**
@@ -199,6 +233,122 @@ L8W8JWT_API int l8w8jwt_validate_encoding_params(struct l8w8jwt_encoding_params*
  */
 L8W8JWT_API int l8w8jwt_encode(struct l8w8jwt_encoding_params* params);
 
+/**
+ * Gets the exact length of the token that {@link #l8w8jwt_encode_to_buffer} would write for the given parameters (excluding the NUL-terminator). <p>
+ * For the HS* algorithms this is computed without touching the heap; for all other algorithms the signing key needs to be parsed in order to know the signature size.
+ * @note The {@link #l8w8jwt_encoding_params::out} and {@link #l8w8jwt_encoding_params::out_length} fields are ignored by this function (you can leave them at <code>NULL</code>).
+ * @param params The token encoding parameters.
+ * @param out_length Where to write the token length into.
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_get_encoded_length(struct l8w8jwt_encoding_params* params, size_t* out_length);
+
+/**
+ * Creates, signs and encodes a Json-Web-Token directly into a caller-provided buffer (instead of malloc'ing the output string like {@link #l8w8jwt_encode} does). <p>
+ * The HS* algorithms do not allocate any heap memory this way; all the other algorithms allocate at most once (and only when building with <code>L8W8JWT_SMALL_STACK</code>), not counting MbedTLS-internal allocations for key parsing.
+ * @note The {@link #l8w8jwt_encoding_params::out} and {@link #l8w8jwt_encoding_params::out_length} fields are ignored by this function (you can leave them at <code>NULL</code>).
+ * @param params The token encoding parameters (e.g. "alg", "iss", "exp", etc...).
+ * @param out Where to write the NUL-terminated token into.
+ * @param out_size Size of the \p out buffer: must be at least the value returned by {@link #l8w8jwt_get_encoded_length} + 1 (for the NUL-terminator), otherwise <code>L8W8JWT_INSUFFICIENT_BUFFER_SIZE</code> is returned and nothing is written.
+ * @param out_length [OPTIONAL] Where to write the token length into (excluding the NUL-terminator).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_encode_to_buffer(struct l8w8jwt_encoding_params* params, char* out, size_t out_size, size_t* out_length);
+
+/**
+ * Creates a prefix context (see prefix.h) for the header that the passed encoding parameters produce
+ * (only the alg, the key and the additional header claims are relevant). <p>
+ * Assign it to {@link #l8w8jwt_encoding_params::prefix_context} for all the tokens you encode with that same header.
+ * @param params The token encoding parameters.
+ * @param out_prefix_context Where to write the newly allocated prefix context into (free it using <code>l8w8jwt_prefix_context_free()</code> once you're done).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_create_encoding_prefix_context(struct l8w8jwt_encoding_params* params, struct l8w8jwt_prefix_context** out_prefix_context);
+
+/**
+ * A compiled token template: the header, the signing key and all static payload claims are processed once,
+ * after which tokens can be minted by only supplying the values of the variable "slot" claims. <p>
+ * Create one using {@link #l8w8jwt_token_template_compile} and free it using {@link #l8w8jwt_token_template_free} once you're done.
+ * @note A template is NOT thread-safe: don't encode with the same template instance from multiple threads at the same time.
+ */
+struct l8w8jwt_token_template;
+
+/**
+ * Compiles a token template. <p>
+ * All the claims inside the passed {@link #l8w8jwt_encoding_params} (registered claims such as "iss" or "aud", as well as the additional header and payload claims) are static:
+ * they are serialized, escaped and baked into the template right away. <p>
+ * The variable claims are defined by the \p slots array: only the l8w8jwt_claim::key (+ l8w8jwt_claim::key_length) and l8w8jwt_claim::type fields of each slot are used (the values are supplied when encoding).
+ * Slots are appended to the payload after the static claims, in the order they are defined in. A slot can't have the same key as a static claim (e.g. an "exp" slot while {@link #l8w8jwt_encoding_params::exp} is set) or as another slot:
+ * that would make the payload contain the same key twice, so compiling fails with <code>L8W8JWT_INVALID_ARG</code>. <p>
+ * Typical slots would be "sub" (string) and time-based claims like "iat" and "exp" (integer).
+ * @note The {@link #l8w8jwt_encoding_params::out} and {@link #l8w8jwt_encoding_params::out_length} fields are ignored. The parameters and slots are not referenced anymore after this returns (the key is copied).
+ * @param params The static token encoding parameters (alg, key, static claims, etc...).
+ * @param slots [OPTIONAL] The variable claim slots (can be <code>NULL</code> if \p slots_count is <code>0</code>).
+ * @param slots_count How many slots there are.
+ * @param out_template Where to write the newly allocated template into.
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_token_template_compile(struct l8w8jwt_encoding_params* params, struct l8w8jwt_claim* slots, size_t slots_count, struct l8w8jwt_token_template** out_template);
+
+/**
+ * Frees a token template that was created using {@link #l8w8jwt_token_template_compile} (securely zeroing its key material).
+ * @param token_template The template to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_token_template_free(struct l8w8jwt_token_template* token_template);
+
+/**
+ * Mints a token from a compiled template by filling in its slots.
+ * @param token_template The template to use.
+ * @param values The slot values as C-strings, one per slot (in the same order as the slots were passed to {@link #l8w8jwt_token_template_compile}). String values are escaped for you; all other types are written out as they are.
+ * @param value_lengths [OPTIONAL] The length of each value. Pass <code>NULL</code> (or set single entries to <code>0</code>) to make the encoder use <code>strlen</code> instead.
+ * @param out Where to write the token into (will be malloc'ed, so make sure to <code>l8w8jwt_free()</code> this as soon as you're done using it!).
+ * @param out_length Where to write the token length into.
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_token_template_encode(struct l8w8jwt_token_template* token_template, const char* const* values, const size_t* value_lengths, char** out, size_t* out_length);
+
+/**
+ * Mints a token from a compiled template directly into a caller-provided buffer (see {@link #l8w8jwt_token_template_encode}).
+ * @param token_template The template to use.
+ * @param values The slot values as C-strings, one per slot.
+ * @param value_lengths [OPTIONAL] The length of each value (or <code>NULL</code> to use <code>strlen</code>).
+ * @param out Where to write the NUL-terminated token into.
+ * @param out_size Size of the \p out buffer. If it's too small, <code>L8W8JWT_INSUFFICIENT_BUFFER_SIZE</code> is returned and nothing is written.
+ * @param out_length [OPTIONAL] Where to write the token length into (excluding the NUL-terminator).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_token_template_encode_to_buffer(struct l8w8jwt_token_template* token_template, const char* const* values, const size_t* value_lengths, char* out, size_t out_size, size_t* out_length);
+
+/**
+ * Attaches a pool of ES256 presignatures to a token template. <p>
+ * Most of the cost of an ECDSA signature is computing <code>k * G</code> for the nonce <code>k</code>, which doesn't depend on the token at all:
+ * {@link #l8w8jwt_token_template_refill_presignatures} does that part ahead of time (e.g. at idle time, or from a background thread of yours),
+ * so that minting a token only has a few scalar multiplications left to do. Whenever the pool runs dry, tokens are signed normally. <p>
+ * Only available for ES256 templates with randomized nonces, signed through the MbedTLS crypto provider's P-256 engine (otherwise, <code>L8W8JWT_UNSUPPORTED_ALG</code> is returned).
+ * @param token_template The template (don't call this while another thread uses the template).
+ * @param capacity Maximum number of presignatures to keep around (rounded up to the next power of 2; every one of them takes 64 bytes).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_token_template_enable_presignatures(struct l8w8jwt_token_template* token_template, size_t capacity);
+
+/**
+ * Precomputes presignatures into a template's pool (see {@link #l8w8jwt_token_template_enable_presignatures}). <p>
+ * Unlike everything else about templates, this may be called from another thread while tokens are being minted from the template (the pool is a lock-free queue).
+ * If another thread is already refilling the same pool, this returns right away without adding anything.
+ * @param token_template The template.
+ * @param max_count Maximum number of presignatures to add (fewer are added if the pool fills up).
+ * @param out_added [OPTIONAL] Where to write the number of presignatures that were actually added into.
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_token_template_refill_presignatures(struct l8w8jwt_token_template* token_template, size_t max_count, size_t* out_added);
+
+/**
+ * Gets how many presignatures are left in a template's pool (<code>0</code> if it has none).
+ * @param token_template The template.
+ * @return The number of available presignatures.
+ */
+L8W8JWT_API size_t l8w8jwt_token_template_get_presignatures_count(struct l8w8jwt_token_template* token_template);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
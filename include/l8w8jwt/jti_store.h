@@ -0,0 +1,103 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file jti_store.h
+ *  @author Raphael Beck
+ *  @brief Replay detection store for one-time-use tokens, keyed by their "jti" claim.
+ */
+
+#ifndef L8W8JWT_JTI_STORE_H
+#define L8W8JWT_JTI_STORE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+#include "timehelper.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A jti store remembers every JWT ID that it has seen until the corresponding token expires, for rejecting tokens that are presented more than once. <p>
+ * Internally, the store is split into up to 16 shards (picked by the jti's hash), each with its own lock, its own open-addressing table of 128-bit jti fingerprints
+ * and its own timing wheel (1-second ticks) that drops the entries once their expiry time has passed. A check-and-insert costs a single SHA-256 block and a short probe. <p>
+ * All memory is allocated up front: when a shard is full, inserting into it fails with <code>L8W8JWT_OUT_OF_MEM</code> rather than forgetting JWT IDs that are still valid. <p>
+ * Assign it to {@link #l8w8jwt_decoding_params::jti_store} to have tokens that were seen before flagged with <code>L8W8JWT_JTI_REPLAY</code>.
+ */
+struct l8w8jwt_jti_store;
+
+/**
+ * jti store statistics (see {@link #l8w8jwt_jti_store_get_stats}).
+ */
+struct l8w8jwt_jti_store_stats
+{
+    /**
+     * How many JWT IDs are currently remembered.
+     */
+    uint64_t entries;
+
+    /**
+     * How many replays were detected.
+     */
+    uint64_t replays;
+
+    /**
+     * How many entries were dropped because their token expired.
+     */
+    uint64_t expirations;
+};
+
+/**
+ * Creates a jti store.
+ * @param max_entries How many (unexpired) JWT IDs the store needs to be able to hold at the same time.
+ * Each entry takes about 48 bytes; a few percent of headroom are added to make up for uneven shard loads.
+ * @param out_jti_store Where to write the newly allocated jti store into (free it using {@link #l8w8jwt_jti_store_free} once you're done).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_jti_store_create(size_t max_entries, struct l8w8jwt_jti_store** out_jti_store);
+
+/**
+ * Atomically checks whether a JWT ID was seen before, and remembers it if it wasn't.
+ * @param jti_store The jti store.
+ * @param jti The JWT ID.
+ * @param jti_length Length of the JWT ID.
+ * @param expires_at Until when the JWT ID needs to be remembered (typically the token's <code>exp</code> plus whatever tolerance is granted when validating it).
+ * @param out_replayed Where to write <code>1</code> into if the JWT ID was already in the store, or <code>0</code> if it was just inserted.
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_OUT_OF_MEM</code> if the store is full).
+ */
+L8W8JWT_API int l8w8jwt_jti_store_check_and_insert(struct l8w8jwt_jti_store* jti_store, const char* jti, size_t jti_length, l8w8jwt_time_t expires_at, int* out_replayed);
+
+/**
+ * Gets a jti store's statistics.
+ * @param jti_store The jti store.
+ * @param out_stats Where to write the statistics into.
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_jti_store_get_stats(struct l8w8jwt_jti_store* jti_store, struct l8w8jwt_jti_store_stats* out_stats);
+
+/**
+ * Frees a jti store.
+ * @param jti_store The jti store to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_jti_store_free(struct l8w8jwt_jti_store* jti_store);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_JTI_STORE_H
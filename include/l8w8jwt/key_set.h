@@ -0,0 +1,132 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file key_set.h
+ *  @author Raphael Beck
+ *  @brief Rotatable sets of pre-parsed verification keys that any number of threads can verify against without taking locks.
+ */
+
+#ifndef L8W8JWT_KEY_SET_H
+#define L8W8JWT_KEY_SET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+#include <stddef.h>
+
+/**
+ * One key of a key set.
+ */
+struct l8w8jwt_key_set_entry
+{
+    /**
+     * The key ID that tokens signed with this key carry in their header's "kid" claim (can be <code>NULL</code> for a key without ID).
+     */
+    const char* kid;
+
+    /**
+     * kid string length.
+     */
+    size_t kid_length;
+
+    /**
+     * The JWT alg that this key is for.
+     */
+    int alg;
+
+    /**
+     * The key, in the same format as the {@link #l8w8jwt_decoding_params::verification_key}: the HMAC secret for HS*,
+     * the PEM-formatted public key or X.509 certificate for RS*, PS* and ES*, or the hex-encoded public key for EdDSA.
+     */
+    const unsigned char* key;
+
+    /**
+     * Key length.
+     */
+    size_t key_length;
+};
+
+/**
+ * A key set holds the keys that tokens are currently accepted with, for example an issuer's signing keys while they're being rotated. <p>
+ * Keys are parsed once when they're published (see {@link #l8w8jwt_key_set_publish}); each publication replaces the entire set.
+ * Verifying threads keep using the previous set until they're done with the token at hand, and the previous set is freed once all of them are. <p>
+ * Threads don't use the key set directly but through a {@link #l8w8jwt_key_set_reader} each: readers take no locks and perform no atomic read-modify-write operations,
+ * so verifying against a key set scales across threads exactly like verifying against a {@link #l8w8jwt_verification_key} does.
+ */
+struct l8w8jwt_key_set;
+
+/**
+ * A thread's handle for verifying tokens against a {@link #l8w8jwt_key_set}. <p>
+ * Create one per thread (it must not be used by more than one thread at a time) and assign it to {@link #l8w8jwt_decoding_params::key_set_reader}.
+ */
+struct l8w8jwt_key_set_reader;
+
+/**
+ * Creates an (empty) key set.
+ * @param out_key_set Where to write the newly allocated key set into (free it using {@link #l8w8jwt_key_set_free} once you're done).
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_UNSUPPORTED_ALG</code> on compilers without C11 atomics).
+ */
+L8W8JWT_API int l8w8jwt_key_set_create(struct l8w8jwt_key_set** out_key_set);
+
+/**
+ * Replaces a key set's keys. <p>
+ * All keys are parsed (RS*, PS* and ES* keys into {@link #l8w8jwt_verification_key}s) before the new set is published; if any of them fails to parse, the current set stays in place.
+ * Once published, the call waits until no reader uses the previous set anymore and then frees it: this typically takes no longer than the verification of a single token. <p>
+ * Publications are serialized, so any number of threads may publish (but publishing from within a decode call is not allowed).
+ * @param key_set The key set.
+ * @param entries The new keys (the key set makes its own copy of them). Tokens are verified with the key whose kid and alg match theirs,
+ * or, if a token's header has no "kid" claim, with the first key of the token's alg.
+ * @param entries_count How many keys there are (can be <code>0</code>, in which case no token verifies until keys are published again).
+ * @param max_table_size Memory cap (in bytes) for the precomputed public key table of each key (see {@link #l8w8jwt_verification_key_create}).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_key_set_publish(struct l8w8jwt_key_set* key_set, const struct l8w8jwt_key_set_entry* entries, size_t entries_count, size_t max_table_size);
+
+/**
+ * Gets the number of keys in a key set.
+ * @param key_set The key set.
+ * @return The number of keys that were published last.
+ */
+L8W8JWT_API size_t l8w8jwt_key_set_get_key_count(struct l8w8jwt_key_set* key_set);
+
+/**
+ * Frees a key set. Free all of its readers first!
+ * @param key_set The key set to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_key_set_free(struct l8w8jwt_key_set* key_set);
+
+/**
+ * Creates a reader for a key set (one per verifying thread).
+ * @param key_set The key set to read.
+ * @param out_key_set_reader Where to write the newly allocated reader into (free it using {@link #l8w8jwt_key_set_reader_free} once the thread is done).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_key_set_reader_create(struct l8w8jwt_key_set* key_set, struct l8w8jwt_key_set_reader** out_key_set_reader);
+
+/**
+ * Frees a key set reader.
+ * @param key_set_reader The reader to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_key_set_reader_free(struct l8w8jwt_key_set_reader* key_set_reader);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_KEY_SET_H
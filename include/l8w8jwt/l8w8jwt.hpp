@@ -0,0 +1,888 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file l8w8jwt.hpp
+ *  @author Raphael Beck
+ *  @brief Header-only C++20 wrapper: move-only RAII types for tokens, claims and verification keys, algs fixed at compile time, and co_await-able sign/verify on a pluggable executor.
+ *
+ *  The wrapper adds no state and no allocations of its own: every type is exactly the C handle or buffer that it owns,
+ *  claims are exposed as <code>std::string_view</code>s into l8w8jwt's own claim buffers, and signers/verifiers are the C params structs, filled in once and reused for every call.
+ *  Errors that the C API reports through return codes are thrown as {@link #l8w8jwt::error}; validation outcomes are not errors and come back as part of a {@link #l8w8jwt::verification}.
+ */
+
+#ifndef L8W8JWT_HPP
+#define L8W8JWT_HPP
+
+#include "encode.h"
+#include "decode.h"
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <stdexcept>
+#include <coroutine>
+#include <exception>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
+
+namespace l8w8jwt
+{
+    /**
+     * The JWT algs, as a type-safe enum (the values are the <code>L8W8JWT_ALG_*</code> constants).
+     */
+    enum class alg : int
+    {
+        hs256 = L8W8JWT_ALG_HS256,
+        hs384 = L8W8JWT_ALG_HS384,
+        hs512 = L8W8JWT_ALG_HS512,
+        rs256 = L8W8JWT_ALG_RS256,
+        rs384 = L8W8JWT_ALG_RS384,
+        rs512 = L8W8JWT_ALG_RS512,
+        ps256 = L8W8JWT_ALG_PS256,
+        ps384 = L8W8JWT_ALG_PS384,
+        ps512 = L8W8JWT_ALG_PS512,
+        es256 = L8W8JWT_ALG_ES256,
+        es384 = L8W8JWT_ALG_ES384,
+        es512 = L8W8JWT_ALG_ES512,
+        es256k = L8W8JWT_ALG_ES256K,
+        ed25519 = L8W8JWT_ALG_ED25519
+    };
+
+    /**
+     * Whether an alg is one of the HMAC algs (whose keys are shared secrets).
+     */
+    constexpr bool is_hmac(const alg a) noexcept
+    {
+        return a == alg::hs256 || a == alg::hs384 || a == alg::hs512;
+    }
+
+    /**
+     * Whether an alg's verification keys can be parsed ahead of time into a {@link #l8w8jwt::verification_key} (RS*, PS* and ES*).
+     */
+    constexpr bool is_asymmetric_pem(const alg a) noexcept
+    {
+        return !is_hmac(a) && a != alg::ed25519;
+    }
+
+    /**
+     * The name that a token's header gives an alg (its "alg" header claim, as registered in RFC 7518 and RFC 8037).
+     */
+    constexpr std::string_view jwa_name(const alg a) noexcept
+    {
+        switch (a)
+        {
+            case alg::hs256:
+                return "HS256";
+            case alg::hs384:
+                return "HS384";
+            case alg::hs512:
+                return "HS512";
+            case alg::rs256:
+                return "RS256";
+            case alg::rs384:
+                return "RS384";
+            case alg::rs512:
+                return "RS512";
+            case alg::ps256:
+                return "PS256";
+            case alg::ps384:
+                return "PS384";
+            case alg::ps512:
+                return "PS512";
+            case alg::es256:
+                return "ES256";
+            case alg::es384:
+                return "ES384";
+            case alg::es512:
+                return "ES512";
+            case alg::es256k:
+                return "ES256K";
+            case alg::ed25519:
+                return "EdDSA";
+        }
+
+        return {};
+    }
+
+    /**
+     * A failed call into the C API. {@link #code} is the return code as defined in retcodes.h
+     */
+    class error : public std::runtime_error
+    {
+      public:
+        explicit error(const int code) : std::runtime_error("l8w8jwt call failed"), code_(code)
+        {
+        }
+
+        [[nodiscard]] int code() const noexcept
+        {
+            return code_;
+        }
+
+      private:
+        int code_;
+    };
+
+    namespace detail
+    {
+        inline void check(const int r)
+        {
+            if (r != L8W8JWT_SUCCESS)
+            {
+                throw error(r);
+            }
+        }
+
+        /*
+         * Empty views are passed on as NULL: l8w8jwt falls back to strlen() for strings whose length is 0,
+         * which would read past the end of an empty (but non-null) view that isn't NUL-terminated.
+         */
+        template <typename T>
+        inline const char* chars_or_null(T s) noexcept
+        {
+            return s.empty() ? nullptr : s.data();
+        }
+
+        template <typename T>
+        inline char* mutable_chars(T s) noexcept
+        {
+            return const_cast<char*>(chars_or_null(s));
+        }
+
+        template <typename T>
+        inline unsigned char* mutable_bytes(T s) noexcept
+        {
+            return reinterpret_cast<unsigned char*>(mutable_chars(s));
+        }
+    } // namespace detail
+
+    /**
+     * A non-owning view of a NUL-terminated string: l8w8jwt expects tokens to be terminated, which a plain <code>std::string_view</code> doesn't guarantee.
+     */
+    class cstring_view
+    {
+      public:
+        constexpr cstring_view(const char* s) noexcept : view_(s)
+        {
+        }
+
+        constexpr cstring_view(const char* s, const std::size_t length) noexcept : view_(s, length)
+        {
+        }
+
+        cstring_view(const std::string& s) noexcept : view_(s)
+        {
+        }
+
+        [[nodiscard]] constexpr const char* c_str() const noexcept
+        {
+            return view_.data();
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return view_.size();
+        }
+
+        [[nodiscard]] constexpr std::string_view view() const noexcept
+        {
+            return view_;
+        }
+
+      private:
+        std::string_view view_;
+    };
+
+    /**
+     * An encoded token (move-only; owns the string that l8w8jwt allocated for it, from the signer's allocator if it has one).
+     */
+    class token
+    {
+      public:
+        token() noexcept = default;
+
+        token(char* jwt, const std::size_t length, const l8w8jwt_allocator* allocator = nullptr) noexcept : jwt_(jwt), length_(length), allocator_(allocator)
+        {
+        }
+
+        token(token&& other) noexcept : jwt_(std::exchange(other.jwt_, nullptr)), length_(std::exchange(other.length_, 0)), allocator_(other.allocator_)
+        {
+        }
+
+        token& operator=(token&& other) noexcept
+        {
+            if (this != &other)
+            {
+                l8w8jwt_allocator_free(allocator_, jwt_);
+                jwt_ = std::exchange(other.jwt_, nullptr);
+                length_ = std::exchange(other.length_, 0);
+                allocator_ = other.allocator_;
+            }
+            return *this;
+        }
+
+        token(const token&) = delete;
+        token& operator=(const token&) = delete;
+
+        ~token()
+        {
+            l8w8jwt_allocator_free(allocator_, jwt_);
+        }
+
+        [[nodiscard]] std::string_view view() const noexcept
+        {
+            return { jwt_ != nullptr ? jwt_ : "", length_ };
+        }
+
+        [[nodiscard]] const char* c_str() const noexcept
+        {
+            return jwt_ != nullptr ? jwt_ : "";
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return length_;
+        }
+
+        operator cstring_view() const noexcept
+        {
+            return { c_str(), length_ };
+        }
+
+      private:
+        char* jwt_ = nullptr;
+        std::size_t length_ = 0;
+        const l8w8jwt_allocator* allocator_ = nullptr;
+    };
+
+    /**
+     * A view of a single decoded claim: key and value point into the owning {@link #l8w8jwt::claims}.
+     */
+    class claim_view
+    {
+      public:
+        explicit claim_view(const l8w8jwt_claim& claim) noexcept : claim_(&claim)
+        {
+        }
+
+        [[nodiscard]] std::string_view key() const noexcept
+        {
+            return { claim_->key, claim_->key_length };
+        }
+
+        /**
+         * The raw value: unescaped for strings, the JSON text for numbers, booleans, arrays and objects.
+         */
+        [[nodiscard]] std::string_view value() const noexcept
+        {
+            return { claim_->value, claim_->value_length };
+        }
+
+        /**
+         * One of the <code>L8W8JWT_CLAIM_TYPE_*</code> constants.
+         */
+        [[nodiscard]] int type() const noexcept
+        {
+            return claim_->type;
+        }
+
+      private:
+        const l8w8jwt_claim* claim_;
+    };
+
+    /**
+     * The decoded claims of a token (move-only; owns the claims array, which comes from the verifier's allocator if it has one).
+     */
+    class claims
+    {
+      public:
+        class iterator
+        {
+          public:
+            using value_type = claim_view;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() noexcept = default;
+
+            explicit iterator(const l8w8jwt_claim* claim) noexcept : claim_(claim)
+            {
+            }
+
+            claim_view operator*() const noexcept
+            {
+                return claim_view(*claim_);
+            }
+
+            iterator& operator++() noexcept
+            {
+                ++claim_;
+                return *this;
+            }
+
+            iterator operator++(int) noexcept
+            {
+                iterator it = *this;
+                ++claim_;
+                return it;
+            }
+
+            bool operator==(const iterator&) const noexcept = default;
+
+          private:
+            const l8w8jwt_claim* claim_ = nullptr;
+        };
+
+        claims() noexcept = default;
+
+        claims(l8w8jwt_claim* array, const std::size_t length, const l8w8jwt_allocator* allocator = nullptr) noexcept : array_(array), length_(length), allocator_(allocator)
+        {
+        }
+
+        claims(claims&& other) noexcept : array_(std::exchange(other.array_, nullptr)), length_(std::exchange(other.length_, 0)), allocator_(other.allocator_)
+        {
+        }
+
+        claims& operator=(claims&& other) noexcept
+        {
+            if (this != &other)
+            {
+                l8w8jwt_allocator_free_claims(allocator_, array_, length_);
+                array_ = std::exchange(other.array_, nullptr);
+                length_ = std::exchange(other.length_, 0);
+                allocator_ = other.allocator_;
+            }
+            return *this;
+        }
+
+        claims(const claims&) = delete;
+        claims& operator=(const claims&) = delete;
+
+        ~claims()
+        {
+            l8w8jwt_allocator_free_claims(allocator_, array_, length_);
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return length_;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return length_ == 0;
+        }
+
+        [[nodiscard]] iterator begin() const noexcept
+        {
+            return iterator(array_);
+        }
+
+        [[nodiscard]] iterator end() const noexcept
+        {
+            return iterator(array_ + length_);
+        }
+
+        /**
+         * Looks up a claim by key (header claims come first, then the payload's).
+         */
+        [[nodiscard]] std::optional<claim_view> find(const std::string_view key) const noexcept
+        {
+            const l8w8jwt_claim* claim = l8w8jwt_get_claim(array_, length_, detail::chars_or_null(key), key.size());
+            if (claim == nullptr)
+            {
+                return std::nullopt;
+            }
+            return claim_view(*claim);
+        }
+
+      private:
+        l8w8jwt_claim* array_ = nullptr;
+        std::size_t length_ = 0;
+        const l8w8jwt_allocator* allocator_ = nullptr;
+    };
+
+    /**
+     * Adapts a <code>std::pmr::memory_resource</code> (e.g. a request-scoped <code>std::pmr::monotonic_buffer_resource</code>) to a {@link #l8w8jwt_allocator}
+     * for {@link #l8w8jwt::verifier::use_allocator} and {@link #l8w8jwt::signer::use_allocator}. <p>
+     * Not copyable or movable: tokens and claims point to it, so it must outlive them (and the resource must outlive it).
+     */
+    class pmr_allocator
+    {
+      public:
+        explicit pmr_allocator(std::pmr::memory_resource& resource) noexcept : allocator_{ &allocate, &deallocate, &resource }
+        {
+        }
+
+        pmr_allocator(const pmr_allocator&) = delete;
+        pmr_allocator& operator=(const pmr_allocator&) = delete;
+
+        [[nodiscard]] const l8w8jwt_allocator* get() const noexcept
+        {
+            return &allocator_;
+        }
+
+      private:
+        static void* allocate(void* usr, const std::size_t size) noexcept
+        {
+            try
+            {
+                return static_cast<std::pmr::memory_resource*>(usr)->allocate(size, alignof(std::max_align_t));
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
+
+        static void deallocate(void* usr, void* ptr, const std::size_t size) noexcept
+        {
+            static_cast<std::pmr::memory_resource*>(usr)->deallocate(ptr, size, alignof(std::max_align_t));
+        }
+
+        l8w8jwt_allocator allocator_;
+    };
+
+    /**
+     * A pre-parsed RS*, PS* or ES* verification key (move-only; see {@link #l8w8jwt_verification_key_create}).
+     * It can be shared between any number of verifiers and threads.
+     */
+    template <alg A>
+    class verification_key
+    {
+        static_assert(is_asymmetric_pem(A), "Only RS*, PS* and ES* keys can be parsed ahead of time.");
+
+      public:
+        /**
+         * Parses a PEM-formatted public key or X.509 certificate.
+         * @param pem The PEM string.
+         * @param max_table_size Memory cap (in bytes) for the key's precomputed table (<code>0</code> for none).
+         */
+        explicit verification_key(const std::string_view pem, const std::size_t max_table_size = 0)
+        {
+            detail::check(l8w8jwt_verification_key_create(static_cast<int>(A), detail::mutable_bytes(pem), pem.size(), max_table_size, &key_));
+        }
+
+        verification_key(verification_key&& other) noexcept : key_(std::exchange(other.key_, nullptr))
+        {
+        }
+
+        verification_key& operator=(verification_key&& other) noexcept
+        {
+            if (this != &other)
+            {
+                l8w8jwt_verification_key_free(key_);
+                key_ = std::exchange(other.key_, nullptr);
+            }
+            return *this;
+        }
+
+        verification_key(const verification_key&) = delete;
+        verification_key& operator=(const verification_key&) = delete;
+
+        ~verification_key()
+        {
+            l8w8jwt_verification_key_free(key_);
+        }
+
+        [[nodiscard]] l8w8jwt_verification_key* get() const noexcept
+        {
+            return key_;
+        }
+
+      private:
+        l8w8jwt_verification_key* key_ = nullptr;
+    };
+
+    /**
+     * The outcome of a verification.
+     */
+    struct verification
+    {
+        /**
+         * The return code of the decode, as defined in retcodes.h (e.g. <code>L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT</code> for garbage input).
+         */
+        int code = L8W8JWT_SUCCESS;
+
+        /**
+         * The validation result flags (<code>L8W8JWT_VALID</code> means that the token is valid).
+         */
+        l8w8jwt_validation_result validation = static_cast<l8w8jwt_validation_result>(~L8W8JWT_VALID);
+
+        /**
+         * The decoded claims (empty if decoding failed).
+         */
+        l8w8jwt::claims claims;
+
+        /**
+         * Whether the token was decoded and passed all checks.
+         */
+        [[nodiscard]] bool valid() const noexcept
+        {
+            return code == L8W8JWT_SUCCESS && validation == L8W8JWT_VALID;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return valid();
+        }
+    };
+
+    /**
+     * An executor that {@link #l8w8jwt::verifier::verify} and {@link #l8w8jwt::signer::sign} can run on when they're <code>co_await</code>ed:
+     * anything with an <code>execute()</code> member that takes a nullary callable and eventually invokes it (once), e.g. on a thread pool.
+     */
+    template <typename E>
+    concept executor = requires(E& e) { e.execute([]() {}); };
+
+    /**
+     * Runs the work right away, on the awaiting thread.
+     */
+    struct inline_executor
+    {
+        template <typename F>
+        void execute(F&& f) const
+        {
+            std::forward<F>(f)();
+        }
+    };
+
+    /**
+     * The awaitable that the executor overloads of verify() and sign() return: <code>co_await</code>ing it suspends the coroutine,
+     * runs the work on the executor and resumes the coroutine on whichever thread the work ran on.
+     * It must be awaited right away (and only once): the arguments that it was created with are referenced, not copied.
+     */
+    template <executor E, typename F>
+    class [[nodiscard]] offloaded
+    {
+      public:
+        using result_type = std::invoke_result_t<F&>;
+
+        offloaded(E& ex, F work) noexcept(std::is_nothrow_move_constructible_v<F>) : ex_(ex), work_(std::move(work))
+        {
+        }
+
+        offloaded(const offloaded&) = delete;
+        offloaded& operator=(const offloaded&) = delete;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> awaiting)
+        {
+            ex_.execute([this, awaiting]() {
+                try
+                {
+                    result_.emplace(work_());
+                }
+                catch (...)
+                {
+                    exception_ = std::current_exception();
+                }
+                awaiting.resume();
+            });
+        }
+
+        result_type await_resume()
+        {
+            if (exception_)
+            {
+                std::rethrow_exception(exception_);
+            }
+            return std::move(*result_);
+        }
+
+      private:
+        E& ex_;
+        F work_;
+        std::optional<result_type> result_;
+        std::exception_ptr exception_;
+    };
+
+    /**
+     * Verifies tokens signed with alg \p A against one key and a fixed set of validation rules (move-only).
+     * It's a filled-in {@link #l8w8jwt_decoding_params} that each call copies and points at its token, so a verifier can be used from any number of threads at once
+     * (as long as nothing that it points to, like a key set reader, is per-thread). <p>
+     * The alg is part of the type: the key type is checked at compile time, and tokens whose header names any other alg (or none at all) fail with <code>L8W8JWT_SIGNATURE_VERIFICATION_FAILURE</code>,
+     * even if their signature matches the key.
+     * Everything the verifier references (keys, expected claim values, caches, ...) must outlive it.
+     */
+    template <alg A>
+    class verifier
+    {
+      public:
+        /**
+         * Creates a verifier for a raw key: the HMAC secret for HS*, a PEM-formatted public key or certificate for RS*, PS* and ES*, or the hex-encoded public key for EdDSA.
+         */
+        explicit verifier(const std::string_view key) noexcept
+        {
+            init();
+            params_.verification_key = detail::mutable_bytes(key);
+            params_.verification_key_length = key.size();
+        }
+
+        /**
+         * Creates a verifier for a pre-parsed key.
+         */
+        explicit verifier(const verification_key<A>& key) noexcept
+            requires(is_asymmetric_pem(A))
+        {
+            init();
+            params_.verification_key_object = key.get();
+        }
+
+        verifier(verifier&&) noexcept = default;
+        verifier& operator=(verifier&&) noexcept = default;
+        verifier(const verifier&) = delete;
+        verifier& operator=(const verifier&) = delete;
+
+        verifier& expect_iss(const std::string_view iss) noexcept
+        {
+            params_.validate_iss = detail::mutable_chars(iss);
+            params_.validate_iss_length = iss.size();
+            return *this;
+        }
+
+        verifier& expect_sub(const std::string_view sub) noexcept
+        {
+            params_.validate_sub = detail::mutable_chars(sub);
+            params_.validate_sub_length = sub.size();
+            return *this;
+        }
+
+        verifier& expect_aud(const std::string_view aud) noexcept
+        {
+            params_.validate_aud = detail::mutable_chars(aud);
+            params_.validate_aud_length = aud.size();
+            return *this;
+        }
+
+        verifier& expect_typ(const std::string_view typ) noexcept
+        {
+            params_.validate_typ = detail::mutable_chars(typ);
+            params_.validate_typ_length = typ.size();
+            return *this;
+        }
+
+        verifier& validate_exp(const uint8_t tolerance_seconds = 0) noexcept
+        {
+            params_.validate_exp = 1;
+            params_.exp_tolerance_seconds = tolerance_seconds;
+            return *this;
+        }
+
+        verifier& validate_nbf(const uint8_t tolerance_seconds = 0) noexcept
+        {
+            params_.validate_nbf = 1;
+            params_.nbf_tolerance_seconds = tolerance_seconds;
+            return *this;
+        }
+
+        verifier& validate_iat(const uint8_t tolerance_seconds = 0) noexcept
+        {
+            params_.validate_iat = 1;
+            params_.iat_tolerance_seconds = tolerance_seconds;
+            return *this;
+        }
+
+        /**
+         * Allocates the claims (and everything else that verifying allocates) from \p allocator instead of the global heap. It must outlive the returned claims.
+         */
+        verifier& use_allocator(const l8w8jwt_allocator* allocator) noexcept
+        {
+            params_.allocator = allocator;
+            return *this;
+        }
+
+        /**
+         * The underlying C params, for the settings that have no setter here (caches, jti stores, revocation filters, ...).
+         */
+        [[nodiscard]] l8w8jwt_decoding_params& params() noexcept
+        {
+            return params_;
+        }
+
+        /**
+         * Decodes and verifies a token on the calling thread.
+         */
+        [[nodiscard]] verification verify(const cstring_view jwt) const noexcept
+        {
+            l8w8jwt_decoding_params params = params_;
+            params.jwt = const_cast<char*>(jwt.c_str());
+            params.jwt_length = jwt.size();
+
+            verification out;
+            l8w8jwt_claim* claims = nullptr;
+            std::size_t claims_length = 0;
+
+            out.code = l8w8jwt_decode(&params, &out.validation, &claims, &claims_length);
+
+            if (out.code == L8W8JWT_SUCCESS)
+            {
+                out.claims = l8w8jwt::claims(claims, claims_length, params.allocator);
+
+                // The C API only verifies the signature with params.alg: it never looks at what the header claims to be signed with.
+                const auto header_alg = out.claims.find("alg");
+
+                if (!header_alg || header_alg->type() != L8W8JWT_CLAIM_TYPE_STRING || header_alg->value() != jwa_name(A))
+                {
+                    out.validation = static_cast<l8w8jwt_validation_result>(out.validation | L8W8JWT_SIGNATURE_VERIFICATION_FAILURE);
+                }
+            }
+
+            return out;
+        }
+
+        /**
+         * Decodes and verifies a token on an executor: <code>verification v = co_await verifier.verify(pool, jwt);</code>
+         */
+        template <executor E>
+        [[nodiscard]] auto verify(E& ex, const cstring_view jwt) const
+        {
+            return offloaded(ex, [this, jwt]() noexcept { return verify(jwt); });
+        }
+
+      private:
+        void init() noexcept
+        {
+            l8w8jwt_decoding_params_init(&params_);
+            params_.alg = static_cast<int>(A);
+        }
+
+        l8w8jwt_decoding_params params_;
+    };
+
+    /**
+     * The registered claims of a token to sign (all optional; string views must stay valid until the token is signed).
+     */
+    struct payload
+    {
+        std::string_view iss;
+        std::string_view sub;
+        std::string_view aud;
+        std::string_view jti;
+        l8w8jwt_time_t exp = 0;
+        l8w8jwt_time_t nbf = 0;
+        l8w8jwt_time_t iat = 0;
+
+        /**
+         * Any additional payload claims.
+         */
+        l8w8jwt_claim* additional_claims = nullptr;
+        std::size_t additional_claims_count = 0;
+    };
+
+    /**
+     * Signs tokens with alg \p A and one key (move-only). Like a {@link #l8w8jwt::verifier}, it's a filled-in {@link #l8w8jwt_encoding_params} that each call copies. <p>
+     * The key must outlive the signer.
+     */
+    template <alg A>
+    class signer
+    {
+      public:
+        /**
+         * Creates a signer: the HMAC secret for HS*, a PEM-formatted private key for RS*, PS* and ES*, or the hex-encoded private key for EdDSA.
+         * @param key The key.
+         * @param password [OPTIONAL] The private key's password.
+         */
+        explicit signer(const std::string_view key, const std::string_view password = {}) noexcept
+        {
+            l8w8jwt_encoding_params_init(&params_);
+            params_.alg = static_cast<int>(A);
+            params_.secret_key = detail::mutable_bytes(key);
+            params_.secret_key_length = key.size();
+
+            if (!password.empty())
+            {
+                params_.secret_key_pw = detail::mutable_bytes(password);
+                params_.secret_key_pw_length = password.size();
+            }
+        }
+
+        signer(signer&&) noexcept = default;
+        signer& operator=(signer&&) noexcept = default;
+        signer(const signer&) = delete;
+        signer& operator=(const signer&) = delete;
+
+        /**
+         * Allocates the tokens from \p allocator instead of the global heap. It must outlive the returned tokens.
+         */
+        signer& use_allocator(const l8w8jwt_allocator* allocator) noexcept
+        {
+            params_.allocator = allocator;
+            return *this;
+        }
+
+        /**
+         * The underlying C params, for the settings that have no setter here (additional header claims, deterministic ECDSA, ...).
+         */
+        [[nodiscard]] l8w8jwt_encoding_params& params() noexcept
+        {
+            return params_;
+        }
+
+        /**
+         * Signs a token on the calling thread.
+         * @throws l8w8jwt::error if encoding or signing fails.
+         */
+        [[nodiscard]] token sign(const payload& claims) const
+        {
+            l8w8jwt_encoding_params params = params_;
+
+            params.iss = detail::mutable_chars(claims.iss);
+            params.iss_length = claims.iss.size();
+            params.sub = detail::mutable_chars(claims.sub);
+            params.sub_length = claims.sub.size();
+            params.aud = detail::mutable_chars(claims.aud);
+            params.aud_length = claims.aud.size();
+            params.jti = detail::mutable_chars(claims.jti);
+            params.jti_length = claims.jti.size();
+            params.exp = claims.exp;
+            params.nbf = claims.nbf;
+            params.iat = claims.iat;
+            params.additional_payload_claims = claims.additional_claims;
+            params.additional_payload_claims_count = claims.additional_claims_count;
+
+            char* jwt = nullptr;
+            std::size_t jwt_length = 0;
+
+            params.out = &jwt;
+            params.out_length = &jwt_length;
+
+            detail::check(l8w8jwt_encode(&params));
+            return token(jwt, jwt_length, params.allocator);
+        }
+
+        /**
+         * Signs a token on an executor: <code>token t = co_await signer.sign(pool, claims);</code>
+         */
+        template <executor E>
+        [[nodiscard]] auto sign(E& ex, const payload& claims) const
+        {
+            return offloaded(ex, [this, &claims]() { return sign(claims); });
+        }
+
+      private:
+        l8w8jwt_encoding_params params_;
+    };
+} // namespace l8w8jwt
+
+#endif // L8W8JWT_HPP
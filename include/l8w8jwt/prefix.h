@@ -0,0 +1,79 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file prefix.h
+ *  @author Raphael Beck
+ *  @brief Cached hash midstates for constant token prefixes (the base64url-encoded header + '.'), usable for both encoding and decoding.
+ */
+
+#ifndef L8W8JWT_PREFIX_H
+#define L8W8JWT_PREFIX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+#include <stddef.h>
+
+/**
+ * A reusable prefix context: holds the SHA-256/384/512 state (or for HS256/384/512, the HMAC inner and outer states)
+ * after absorbing a constant token prefix such as <code>base64url(header) + "."</code>. <p>
+ * Every signing input that starts with that prefix can then be hashed by cloning the cached midstate and only absorbing the rest,
+ * which saves at least one compression function call per token. <p>
+ * Assign it to {@link #l8w8jwt_encoding_params::prefix_context} or {@link #l8w8jwt_decoding_params::prefix_context}:
+ * tokens whose alg, key or prefix don't match the context are transparently hashed the regular way.
+ * @note A prefix context is never modified after creation, so it can be shared between threads.
+ */
+struct l8w8jwt_prefix_context;
+
+/**
+ * Creates a prefix context.
+ * @param alg The JWT alg that this context is for (EdDSA is not supported since Ed25519 does not hash the message as a prefix of its input).
+ * @param hmac_key The HMAC secret (only needed for HS256/384/512; ignored for all other algs, in which case you can pass <code>NULL</code>).
+ * @param hmac_key_length Length of the HMAC secret.
+ * @param prefix The constant prefix (typically the base64url-encoded header including the trailing '.').
+ * @param prefix_length Length of the prefix.
+ * @param out_prefix_context Where to write the newly allocated prefix context into (free it using {@link #l8w8jwt_prefix_context_free} once you're done).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_prefix_context_create(int alg, const unsigned char* hmac_key, size_t hmac_key_length, const char* prefix, size_t prefix_length, struct l8w8jwt_prefix_context** out_prefix_context);
+
+/**
+ * Creates a prefix context for decoding tokens that share the same header as the passed sample token
+ * (the prefix is everything up to and including the first '.' of \p jwt).
+ * @param alg The JWT alg that this context is for.
+ * @param hmac_key The HMAC secret (only needed for HS256/384/512; ignored for all other algs).
+ * @param hmac_key_length Length of the HMAC secret.
+ * @param jwt A sample token.
+ * @param jwt_length Length of the sample token.
+ * @param out_prefix_context Where to write the newly allocated prefix context into.
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_prefix_context_create_from_token(int alg, const unsigned char* hmac_key, size_t hmac_key_length, const char* jwt, size_t jwt_length, struct l8w8jwt_prefix_context** out_prefix_context);
+
+/**
+ * Frees a prefix context (securely zeroing its state).
+ * @param prefix_context The prefix context to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_prefix_context_free(struct l8w8jwt_prefix_context* prefix_context);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_PREFIX_H
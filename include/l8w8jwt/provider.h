@@ -0,0 +1,76 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file provider.h
+ *  @author Raphael Beck
+ *  @brief Selection of the crypto library that l8w8jwt uses for hashing, HMAC and RSA/PSS/ECDSA signing and verification.
+ */
+
+#ifndef L8W8JWT_PROVIDER_H
+#define L8W8JWT_PROVIDER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+
+/**
+ * MbedTLS (always available).
+ */
+#define L8W8JWT_CRYPTO_PROVIDER_MBEDTLS 0
+
+/**
+ * OpenSSL 3 libcrypto (only available if l8w8jwt was built with <code>L8W8JWT_ENABLE_OPENSSL_PROVIDER</code>).
+ */
+#define L8W8JWT_CRYPTO_PROVIDER_OPENSSL 1
+
+#ifndef L8W8JWT_ENABLE_OPENSSL_PROVIDER
+/**
+ * Set this to \c 1 to build the OpenSSL libcrypto provider (this adds a dependency to OpenSSL 3).
+ */
+#define L8W8JWT_ENABLE_OPENSSL_PROVIDER 0
+#endif
+
+#ifndef L8W8JWT_DEFAULT_CRYPTO_PROVIDER
+/**
+ * The crypto provider that is active until {@link #l8w8jwt_set_crypto_provider} is called.
+ */
+#define L8W8JWT_DEFAULT_CRYPTO_PROVIDER L8W8JWT_CRYPTO_PROVIDER_MBEDTLS
+#endif
+
+/**
+ * Selects the crypto provider for all subsequent encoding and decoding. <p>
+ * Call this once at startup, BEFORE any other thread uses l8w8jwt (the selection is a process-wide setting and switching it is not synchronized). <p>
+ * Keys that were already loaded (e.g. inside a token template) keep using the provider that loaded them. <p>
+ * EdDSA always uses lib/ed25519 (or l8w8jwt's radix-2^51 Ed25519 backend if built with <code>L8W8JWT_ED25519_FE51</code>), and prefix contexts always use l8w8jwt's own SHA-2 midstates, whichever provider is selected.
+ * @param provider <code>L8W8JWT_CRYPTO_PROVIDER_MBEDTLS</code> or <code>L8W8JWT_CRYPTO_PROVIDER_OPENSSL</code>
+ * @return <code>L8W8JWT_SUCCESS</code>; <code>L8W8JWT_UNSUPPORTED_ALG</code> if the requested provider wasn't built into this l8w8jwt library; <code>L8W8JWT_INVALID_ARG</code> for unknown provider IDs.
+ */
+L8W8JWT_API int l8w8jwt_set_crypto_provider(int provider);
+
+/**
+ * Gets the currently selected crypto provider.
+ * @return <code>L8W8JWT_CRYPTO_PROVIDER_MBEDTLS</code> or <code>L8W8JWT_CRYPTO_PROVIDER_OPENSSL</code>
+ */
+L8W8JWT_API int l8w8jwt_get_crypto_provider(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_PROVIDER_H
@@ -0,0 +1,64 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file psa.h
+ *  @author Raphael Beck
+ *  @brief Optional PSA Crypto API backend: import keys once into the PSA key store and sign/verify tokens through their PSA key IDs. <p>
+ *  Only available when building with <code>L8W8JWT_USE_PSA_CRYPTO</code>; otherwise all these functions return <code>L8W8JWT_UNSUPPORTED_ALG</code>.
+ */
+
+#ifndef L8W8JWT_PSA_H
+#define L8W8JWT_PSA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Imports a key into the PSA key store, such that it can be used for encoding and/or decoding tokens through its key ID
+ * (see {@link #l8w8jwt_encoding_params::psa_key_id} and {@link #l8w8jwt_decoding_params::psa_key_id}). <p>
+ * The key is passed in the same format as for the regular {@link #l8w8jwt_encoding_params::secret_key} or {@link #l8w8jwt_decoding_params::verification_key}:
+ * HMAC secrets as they are, RSA and EC keys as PEM (private keys, public keys or X.509 certificates). <p>
+ * The key's PSA usage policy is bound to the passed alg. Private keys may be used for signing as well as verifying, public keys only for verifying.
+ * @note EdDSA keys are not supported by this backend.
+ * @param alg The JWT alg that the key will be used with.
+ * @param key The key to import.
+ * @param key_length Length of the key.
+ * @param key_pw [OPTIONAL] Password of the private key (if there is any; otherwise pass <code>NULL</code>).
+ * @param key_pw_length Length of the password (<code>0</code> if there's none).
+ * @param persistent_key_id The PSA key ID under which the key should be persisted in the key store (requires <code>MBEDTLS_PSA_CRYPTO_STORAGE_C</code>). Pass <code>0</code> for a volatile key that only lives until it's destroyed or the process exits.
+ * @param out_key_id Where to write the key ID into (for persistent keys, this is the same as \p persistent_key_id).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_psa_import_key(int alg, const unsigned char* key, size_t key_length, const unsigned char* key_pw, size_t key_pw_length, uint32_t persistent_key_id, uint32_t* out_key_id);
+
+/**
+ * Destroys a key in the PSA key store (persistent keys are removed from storage as well).
+ * @param key_id The ID of the key to destroy.
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_psa_destroy_key(uint32_t key_id);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_PSA_H
@@ -0,0 +1,92 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file rejection_cache.h
+ *  @author Raphael Beck
+ *  @brief Small negative cache of tokens whose signature recently failed to verify, for rejecting replayed forgeries without verifying them again.
+ */
+
+#ifndef L8W8JWT_REJECTION_CACHE_H
+#define L8W8JWT_REJECTION_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A rejection cache remembers the digests (SHA-256 over alg, verification key and full token string, just like the {@link #l8w8jwt_verification_cache})
+ * of tokens whose signature didn't verify, for a fixed number of seconds. <p>
+ * When the same token comes in again, {@link #l8w8jwt_decode} flags it with <code>L8W8JWT_SIGNATURE_VERIFICATION_FAILURE</code> right after splitting it into its segments,
+ * without running the (potentially expensive) public key verification again. Everything else (claims parsing and validation) happens as usual. <p>
+ * All memory is allocated up front. When the cache is full, the entry that expires first makes room. The entries are spread over lock-striped buckets, so the cache can be shared between threads. <p>
+ * Assign it to {@link #l8w8jwt_decoding_params::rejection_cache}.
+ */
+struct l8w8jwt_rejection_cache;
+
+/**
+ * Rejection cache statistics (see {@link #l8w8jwt_rejection_cache_get_stats}).
+ */
+struct l8w8jwt_rejection_cache_stats
+{
+    /**
+     * How many tokens were rejected straight away because they were found in the cache.
+     */
+    uint64_t hits;
+
+    /**
+     * How many tokens weren't found in the cache (and thus had their signature verified).
+     */
+    uint64_t misses;
+
+    /**
+     * How many entries that were still within their TTL had to make room for a new one.
+     */
+    uint64_t evictions;
+};
+
+/**
+ * Creates a rejection cache.
+ * @param max_entries How many rejected tokens the cache can remember at most.
+ * @param ttl_seconds For how long (in seconds) a rejected token is remembered.
+ * @param out_rejection_cache Where to write the newly allocated rejection cache into (free it using {@link #l8w8jwt_rejection_cache_free} once you're done).
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_UNSUPPORTED_ALG</code> if the library was built without C11 atomics).
+ */
+L8W8JWT_API int l8w8jwt_rejection_cache_create(size_t max_entries, uint32_t ttl_seconds, struct l8w8jwt_rejection_cache** out_rejection_cache);
+
+/**
+ * Gets a rejection cache's statistics.
+ * @param rejection_cache The rejection cache.
+ * @param out_stats Where to write the statistics into.
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_rejection_cache_get_stats(const struct l8w8jwt_rejection_cache* rejection_cache, struct l8w8jwt_rejection_cache_stats* out_stats);
+
+/**
+ * Frees a rejection cache.
+ * @param rejection_cache The rejection cache to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_rejection_cache_free(struct l8w8jwt_rejection_cache* rejection_cache);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_REJECTION_CACHE_H
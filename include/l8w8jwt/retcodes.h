@@ -52,6 +52,11 @@ extern "C" {
  */
 #define L8W8JWT_OVERFLOW 310
 
+/**
+ * Returned if a caller-provided output buffer is too small to hold the result (nothing is written into it in that case).
+ */
+#define L8W8JWT_INSUFFICIENT_BUFFER_SIZE 320
+
 /**
  * Returned if signing a JWT failed.
  */
@@ -100,6 +105,16 @@ extern "C" {
  */
 #define L8W8JWT_UNSUPPORTED_ALG 800
 
+/**
+ * Returned by {@link #l8w8jwt_decode_step} while the token isn't fully decoded yet: call it again (e.g. on the next event loop iteration).
+ */
+#define L8W8JWT_IN_PROGRESS 900
+
+/**
+ * Returned by {@link #l8w8jwt_async_decoder_submit} when the maximum number of tokens are already in flight.
+ */
+#define L8W8JWT_QUEUE_FULL 910
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -0,0 +1,141 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file revocation.h
+ *  @author Raphael Beck
+ *  @brief Revocation lists (by "jti" or by "iss" + "sub") stored in an immutable, memory-mappable file format.
+ */
+
+#ifndef L8W8JWT_REVOCATION_H
+#define L8W8JWT_REVOCATION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+#include <stddef.h>
+
+/**
+ * A revocation list entry: either a JWT ID (if {@link #jti} is set), or a subject of a specific issuer (both {@link #iss} and {@link #sub} set).
+ */
+struct l8w8jwt_revocation_entry
+{
+    /**
+     * The revoked JWT ID (or <code>NULL</code> for revoking all tokens of an issuer's subject instead).
+     */
+    const char* jti;
+
+    /**
+     * jti string length.
+     */
+    size_t jti_length;
+
+    /**
+     * The issuer of the revoked subject (only used if {@link #jti} is <code>NULL</code>).
+     */
+    const char* iss;
+
+    /**
+     * iss string length.
+     */
+    size_t iss_length;
+
+    /**
+     * The revoked subject (only used if {@link #jti} is <code>NULL</code>).
+     */
+    const char* sub;
+
+    /**
+     * sub string length.
+     */
+    size_t sub_length;
+};
+
+/**
+ * Writes a revocation list file. <p>
+ * The file consists of a 64-byte header, a blocked Bloom filter (one 64-byte block per lookup, 7 probes, ~10 bits per entry)
+ * and a sorted array of 64-bit entry fingerprints (SHA-256 truncated to 64 bits) for ruling out the filter's false positives. All integers are little-endian. <p>
+ * Since the fingerprints are truncated, a token that isn't on the list is still reported as revoked if it passes the filter (~1%) and its fingerprint collides with one of the \p entries_count entries:
+ * that happens for at most one in <code>2^64 / entries_count</code> tokens (e.g. one in ~1.8 * 10^11 for a hundred million entries). Revoked tokens are never missed. <p>
+ * The file is written to a new, uniquely named file next to \p path (<code>path.&lt;pid&gt;.&lt;n&gt;.tmp</code>), flushed to the disk and then renamed over \p path,
+ * so that readers which (re)open \p path always get either the old or the new version in full, and concurrent writers don't clobber each other's files. <p>
+ * On Windows, a file can't be replaced while it's memory-mapped, so this fails (with <code>L8W8JWT_INVALID_ARG</code>) as long as a revocation filter in any process still maps \p path:
+ * write each version under a new name there instead, and switch the filters over to it with {@link #l8w8jwt_revocation_filter_reload}.
+ * @param path Where to write the file.
+ * @param entries The revoked JWT IDs and/or subjects.
+ * @param entries_count How many entries there are (can be <code>0</code>).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_revocation_list_write(const char* path, const struct l8w8jwt_revocation_entry* entries, size_t entries_count);
+
+/**
+ * A memory-mapped revocation list. Opening (or reloading) one maps the file and only checks its header: there is no parse step, so even lists with tens of millions of entries load instantly. <p>
+ * Checking a token costs one or two SHA-256 blocks and one cache line of filter; only the filter's positives (~1%) binary search the fingerprint section. <p>
+ * It can be shared between threads and reloaded at any time: checks that are in flight keep using the mapping that they started with, which is unmapped once the last of them is done. <p>
+ * Assign it to {@link #l8w8jwt_decoding_params::revocation_filter} to have revoked tokens flagged with <code>L8W8JWT_REVOKED</code>.
+ */
+struct l8w8jwt_revocation_filter;
+
+/**
+ * Maps a revocation list file.
+ * @param path The file (as written by {@link #l8w8jwt_revocation_list_write}).
+ * @param out_revocation_filter Where to write the newly allocated revocation filter into (free it using {@link #l8w8jwt_revocation_filter_free} once you're done).
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_INVALID_ARG</code> if the file isn't a valid revocation list;
+ * <code>L8W8JWT_UNSUPPORTED_ALG</code> on platforms without memory-mapped files or C11 atomics).
+ */
+L8W8JWT_API int l8w8jwt_revocation_filter_open(const char* path, struct l8w8jwt_revocation_filter** out_revocation_filter);
+
+/**
+ * Atomically swaps in the current version of the revocation list file (e.g. after it was republished).
+ * @param revocation_filter The revocation filter.
+ * @param path The file to map, or <code>NULL</code> for the path that the filter was opened with.
+ * @return Return code as defined in retcodes.h (on failure, the filter keeps using its current mapping).
+ */
+L8W8JWT_API int l8w8jwt_revocation_filter_reload(struct l8w8jwt_revocation_filter* revocation_filter, const char* path);
+
+/**
+ * Checks whether a token is revoked.
+ * @param revocation_filter The revocation filter.
+ * @param jti The token's JWT ID (<code>NULL</code> if it has none).
+ * @param jti_length jti string length.
+ * @param iss The token's issuer (<code>NULL</code> if it has none).
+ * @param iss_length iss string length.
+ * @param sub The token's subject (<code>NULL</code> if it has none).
+ * @param sub_length sub string length.
+ * @return <code>1</code> if the JWT ID or the issuer/subject pair is on the list; <code>0</code> if it isn't.
+ */
+L8W8JWT_API int l8w8jwt_revocation_filter_check(struct l8w8jwt_revocation_filter* revocation_filter, const char* jti, size_t jti_length, const char* iss, size_t iss_length, const char* sub, size_t sub_length);
+
+/**
+ * Gets the number of entries in the currently mapped revocation list.
+ * @param revocation_filter The revocation filter.
+ * @return The number of (distinct) entries.
+ */
+L8W8JWT_API size_t l8w8jwt_revocation_filter_get_entry_count(struct l8w8jwt_revocation_filter* revocation_filter);
+
+/**
+ * Unmaps and frees a revocation filter. Make sure that no other thread still uses it!
+ * @param revocation_filter The revocation filter to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_revocation_filter_free(struct l8w8jwt_revocation_filter* revocation_filter);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_REVOCATION_H
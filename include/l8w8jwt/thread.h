@@ -0,0 +1,65 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file thread.h
+ *  @author Raphael Beck
+ *  @brief Thread-safety guarantees and per-thread scratch contexts.
+ *
+ *  All <code>l8w8jwt_encode*</code> and <code>l8w8jwt_decode*</code> functions may be called from any number of threads at the same time,
+ *  as long as each call gets its own parameters struct and output buffers. They share no mutable state besides:
+ *  <ul>
+ *  <li>The global hooks (<code>L8W8JWT_PLATFORM_*_ALT</code> allocator and time functions, {@link #l8w8jwt_set_crypto_provider}): set these once, before any other thread uses the library.</li>
+ *  <li>The objects that you explicitly hand to several calls: verification keys, verification/rejection caches, jti stores, revocation filters, key sets and asynchronous decoders are safe to share between threads
+ *  (see their docs for the exceptions, e.g. RSA verification keys with MbedTLS built without <code>MBEDTLS_THREADING_C</code>); key set readers, token templates and signers are not.</li>
+ *  <li>MbedTLS' process-wide ECP operation budget, which {@link #l8w8jwt_decode_step} sets for the duration of each step: steps on different threads take turns (under an internal lock) and reset it to unlimited afterwards,
+ *  so only restartable MbedTLS operations that your own code runs concurrently with them could see it.</li>
+ *  </ul>
+ *  Scratch state that would otherwise be set up (and torn down) on every call lives in a per-thread context instead:
+ *  the CTR_DRBG (and its entropy source) that randomized signatures are made with, the MbedTLS bignum temporaries of ECDSA signing and verification,
+ *  and the JSON token array that claims are parsed into. A thread's context is created the first time it needs it, never shared with any other thread,
+ *  reseeded from scratch after a <code>fork()</code> and freed when the thread exits.
+ */
+
+#ifndef L8W8JWT_THREAD_H
+#define L8W8JWT_THREAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+
+#ifndef L8W8JWT_THREAD_CONTEXTS
+/**
+ * Set this pre-processor definition to \c 0 to set up all scratch state on every call instead of keeping it in per-thread contexts
+ * (e.g. for platforms without thread-local storage).
+ */
+#define L8W8JWT_THREAD_CONTEXTS 1
+#endif
+
+/**
+ * Frees the calling thread's scratch context (if it has one). <p>
+ * Contexts are freed automatically when their thread exits (through a <code>pthread_key_create</code> destructor, or a fiber-local storage callback on Windows),
+ * so this is only needed to give the memory back early, or on platforms that have neither (there, call it before a thread that used l8w8jwt exits). The next l8w8jwt call on the same thread simply creates a new context.
+ */
+L8W8JWT_API void l8w8jwt_thread_cleanup(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_THREAD_H
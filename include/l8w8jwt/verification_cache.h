@@ -0,0 +1,101 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file verification_cache.h
+ *  @author Raphael Beck
+ *  @brief Fixed-size cache of tokens whose signature was already verified, for not verifying the same bearer token over and over again.
+ */
+
+#ifndef L8W8JWT_VERIFICATION_CACHE_H
+#define L8W8JWT_VERIFICATION_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A verification cache remembers the tokens whose signature was verified successfully, along with their decoded claims. <p>
+ * Entries are looked up by the SHA-256 digest of the full token string, the alg and the verification key: a token that was sent before
+ * thus skips base64-decoding, signature verification and JSON parsing. Its claims are still validated again every time (against the current time
+ * and the {@link #l8w8jwt_decoding_params} of the call), so the same cache can be shared by calls with different validation settings. <p>
+ * Only tokens with an <code>exp</code> claim are cached, and only until that point in time (regardless of the {@link #l8w8jwt_decoding_params::exp_tolerance_seconds}).
+ * Since the verification key is part of the lookup, rotating it makes all of the old key's entries unreachable; they're then evicted as new tokens come in. <p>
+ * All memory is allocated up front. The entries are spread over lock-striped buckets, so that the cache can be shared between threads. <p>
+ * Assign it to {@link #l8w8jwt_decoding_params::verification_cache}.
+ */
+struct l8w8jwt_verification_cache;
+
+/**
+ * Verification cache statistics (see {@link #l8w8jwt_verification_cache_get_stats}).
+ */
+struct l8w8jwt_verification_cache_stats
+{
+    /**
+     * How many lookups found their token in the cache.
+     */
+    uint64_t hits;
+
+    /**
+     * How many lookups didn't find their token in the cache.
+     */
+    uint64_t misses;
+
+    /**
+     * How many valid entries had to make room for a new one.
+     */
+    uint64_t evictions;
+};
+
+/**
+ * Creates a verification cache.
+ * @param max_entries How many tokens the cache can hold at most.
+ * @param max_claims_size How many bytes of decoded claims (header + payload claim keys and values) can be stored per entry: tokens with more than that aren't cached.
+ * The cache allocates about <code>max_entries * (max_claims_size + 64)</code> bytes.
+ * @param out_verification_cache Where to write the newly allocated verification cache into (free it using {@link #l8w8jwt_verification_cache_free} once you're done).
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_UNSUPPORTED_ALG</code> if the library was built without C11 atomics).
+ */
+L8W8JWT_API int l8w8jwt_verification_cache_create(size_t max_entries, size_t max_claims_size, struct l8w8jwt_verification_cache** out_verification_cache);
+
+/**
+ * Drops all entries of a verification cache (e.g. after revoking a key whose ID was reused in the PSA key store).
+ * @param verification_cache The verification cache to clear.
+ */
+L8W8JWT_API void l8w8jwt_verification_cache_clear(struct l8w8jwt_verification_cache* verification_cache);
+
+/**
+ * Gets a verification cache's hit/miss statistics.
+ * @param verification_cache The verification cache.
+ * @param out_stats Where to write the statistics into.
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_verification_cache_get_stats(const struct l8w8jwt_verification_cache* verification_cache, struct l8w8jwt_verification_cache_stats* out_stats);
+
+/**
+ * Frees a verification cache (securely zeroing its entries).
+ * @param verification_cache The verification cache to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_verification_cache_free(struct l8w8jwt_verification_cache* verification_cache);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_VERIFICATION_CACHE_H
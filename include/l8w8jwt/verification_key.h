@@ -0,0 +1,81 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file verification_key.h
+ *  @author Raphael Beck
+ *  @brief Parse-once verification keys for RS/PS/ES tokens, optionally with precomputed public key tables for ES256 and ES256K.
+ */
+
+#ifndef L8W8JWT_VERIFICATION_KEY_H
+#define L8W8JWT_VERIFICATION_KEY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "version.h"
+#include <stddef.h>
+
+/**
+ * Pass this as <code>max_table_size</code> to {@link #l8w8jwt_verification_key_create} to always get a table where there is one to be had
+ * (currently 33,280 bytes per ES256 or ES256K key).
+ */
+#define L8W8JWT_VERIFICATION_KEY_TABLE_SIZE_UNLIMITED ((size_t)-1)
+
+/**
+ * A reusable verification key: the PEM-formatted public key (or X.509 certificate) is parsed only once instead of for every token. <p>
+ * For ES256 and ES256K (MbedTLS crypto provider with the dedicated P-256/secp256k1 engines), it can additionally carry a precomputed
+ * table of multiples of the public point, just like the one that the engines have built in for the base point. A verification then consists
+ * of two fixed-base multiplications without a single point doubling, which makes it about twice as fast for ES256 (somewhat less for ES256K,
+ * whose regular verification is already sped up by the GLV endomorphism). Building the table takes a few milliseconds, so it pays off for
+ * the handful of issuer keys that most of the traffic is signed with. <p>
+ * Assign it to {@link #l8w8jwt_decoding_params::verification_key_object}. It stays bound to the crypto provider that was active when it was created.
+ * @note The key is never modified after creation; ECDSA keys can thus be shared between threads.
+ * RSA keys only if MbedTLS is built with <code>MBEDTLS_THREADING_C</code>, since MbedTLS caches some values inside of RSA public keys the first time they're used.
+ */
+struct l8w8jwt_verification_key;
+
+/**
+ * Parses a verification key once, for reusing it across any number of {@link #l8w8jwt_decode} calls.
+ * @param alg The JWT alg that this key is for (RS*, PS* or ES*: HMAC secrets and EdDSA keys have nothing to be parsed, so these algs are not supported).
+ * @param key The PEM-formatted public key or X.509 certificate (same format as the {@link #l8w8jwt_decoding_params::verification_key}).
+ * @param key_length Length of the key string.
+ * @param max_table_size Memory cap (in bytes) for the precomputed public key table: pass <code>0</code> to only parse the key, or {@link #L8W8JWT_VERIFICATION_KEY_TABLE_SIZE_UNLIMITED}.
+ * Algs/keys that don't get a table, or whose table would exceed this cap, simply go without one.
+ * @param out_verification_key Where to write the newly allocated verification key into (free it using {@link #l8w8jwt_verification_key_free} once you're done).
+ * @return Return code as defined in retcodes.h
+ */
+L8W8JWT_API int l8w8jwt_verification_key_create(int alg, const unsigned char* key, size_t key_length, size_t max_table_size, struct l8w8jwt_verification_key** out_verification_key);
+
+/**
+ * Gets the size of a verification key's precomputed public key table.
+ * @param verification_key The verification key.
+ * @return The table size in bytes (<code>0</code> if the key has no table, or if \p verification_key is <code>NULL</code>).
+ */
+L8W8JWT_API size_t l8w8jwt_verification_key_get_table_size(const struct l8w8jwt_verification_key* verification_key);
+
+/**
+ * Frees a verification key.
+ * @param verification_key The verification key to free (can be <code>NULL</code>, in which case nothing happens).
+ */
+L8W8JWT_API void l8w8jwt_verification_key_free(struct l8w8jwt_verification_key* verification_key);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_VERIFICATION_KEY_H
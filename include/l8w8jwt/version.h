@@ -63,6 +63,14 @@ extern "C" {
 #define L8W8JWT_PLATFORM_TIME_ALT 0
 #endif
 
+#ifndef L8W8JWT_USE_PSA_CRYPTO
+/**
+ * Set this pre-processor definition to \c 1 to enable signing and verifying
+ * tokens through keys that live in the PSA Crypto key store (see psa.h).
+ */
+#define L8W8JWT_USE_PSA_CRYPTO 0
+#endif
+
 /**
  * Free memory that was allocated by L8W8JWT.
  * @param mem The memory to free.
@@ -0,0 +1,278 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/claim.h"
+#include "l8w8jwt/retcodes.h"
+#include "allocator_backend.h"
+#include "thread_context.h"
+
+/*
+ * Every block from a per-call allocator is prefixed with its size, since l8w8jwt_allocator::free wants it back (and realloc needs it for the copy).
+ * The union keeps the block behind it aligned for any type.
+ */
+union l8w8jwt_allocation_header
+{
+    size_t size;
+    long double ld;
+    long long ll;
+    void* ptr;
+};
+
+#ifdef L8W8JWT_THREAD_LOCAL
+static L8W8JWT_THREAD_LOCAL const struct l8w8jwt_allocator* l8w8jwt_call_allocator = NULL;
+#define L8W8JWT_CURRENT_CALL_ALLOCATOR l8w8jwt_call_allocator
+#else
+#define L8W8JWT_CURRENT_CALL_ALLOCATOR ((const struct l8w8jwt_allocator*)NULL)
+#endif
+
+int l8w8jwt_call_allocator_enter(const struct l8w8jwt_allocator* allocator, const struct l8w8jwt_allocator** out_previous)
+{
+    if (allocator != NULL && (allocator->alloc == NULL || allocator->free == NULL))
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+#ifdef L8W8JWT_THREAD_LOCAL
+    *out_previous = l8w8jwt_call_allocator;
+    l8w8jwt_call_allocator = allocator;
+    return L8W8JWT_SUCCESS;
+#else
+    *out_previous = NULL;
+    return allocator == NULL ? L8W8JWT_SUCCESS : L8W8JWT_UNSUPPORTED_ALG;
+#endif
+}
+
+void l8w8jwt_call_allocator_leave(const struct l8w8jwt_allocator* previous)
+{
+#ifdef L8W8JWT_THREAD_LOCAL
+    l8w8jwt_call_allocator = previous;
+#else
+    (void)previous;
+#endif
+}
+
+static void* l8w8jwt_allocator_alloc(const struct l8w8jwt_allocator* allocator, const size_t size)
+{
+    if (size > SIZE_MAX - sizeof(union l8w8jwt_allocation_header))
+    {
+        return NULL;
+    }
+
+    union l8w8jwt_allocation_header* header = allocator->alloc(allocator->usr, sizeof(union l8w8jwt_allocation_header) + size);
+    if (header == NULL)
+    {
+        return NULL;
+    }
+
+    header->size = size;
+    return header + 1;
+}
+
+static void l8w8jwt_allocator_release(const struct l8w8jwt_allocator* allocator, void* ptr)
+{
+    union l8w8jwt_allocation_header* header = (union l8w8jwt_allocation_header*)ptr - 1;
+    allocator->free(allocator->usr, header, sizeof(union l8w8jwt_allocation_header) + header->size);
+}
+
+static void* l8w8jwt_allocator_calloc(const struct l8w8jwt_allocator* allocator, const size_t nmemb, const size_t size)
+{
+    if (size != 0 && nmemb > SIZE_MAX / size)
+    {
+        return NULL;
+    }
+
+    void* ptr = l8w8jwt_allocator_alloc(allocator, nmemb * size);
+    if (ptr != NULL)
+    {
+        memset(ptr, 0x00, nmemb * size);
+    }
+
+    return ptr;
+}
+
+/* The allocator interface has no realloc: grow into a fresh block instead (call buffers only ever grow a handful of times per call). */
+static void* l8w8jwt_allocator_realloc(const struct l8w8jwt_allocator* allocator, void* ptr, const size_t size)
+{
+    if (ptr == NULL)
+    {
+        return l8w8jwt_allocator_alloc(allocator, size);
+    }
+
+    void* new_ptr = l8w8jwt_allocator_alloc(allocator, size);
+    if (new_ptr == NULL)
+    {
+        return NULL;
+    }
+
+    const size_t old_size = ((union l8w8jwt_allocation_header*)ptr - 1)->size;
+    memcpy(new_ptr, ptr, old_size < size ? old_size : size);
+
+    l8w8jwt_allocator_release(allocator, ptr);
+    return new_ptr;
+}
+
+void* l8w8jwt_call_malloc(const size_t size)
+{
+    const struct l8w8jwt_allocator* allocator = L8W8JWT_CURRENT_CALL_ALLOCATOR;
+    return allocator != NULL ? l8w8jwt_allocator_alloc(allocator, size) : l8w8jwt_malloc(size);
+}
+
+void* l8w8jwt_call_calloc(const size_t nmemb, const size_t size)
+{
+    const struct l8w8jwt_allocator* allocator = L8W8JWT_CURRENT_CALL_ALLOCATOR;
+    return allocator != NULL ? l8w8jwt_allocator_calloc(allocator, nmemb, size) : l8w8jwt_calloc(nmemb, size);
+}
+
+void* l8w8jwt_call_realloc(void* ptr, const size_t size)
+{
+    const struct l8w8jwt_allocator* allocator = L8W8JWT_CURRENT_CALL_ALLOCATOR;
+    return allocator != NULL ? l8w8jwt_allocator_realloc(allocator, ptr, size) : l8w8jwt_realloc(ptr, size);
+}
+
+void l8w8jwt_call_free(void* ptr)
+{
+    const struct l8w8jwt_allocator* allocator = L8W8JWT_CURRENT_CALL_ALLOCATOR;
+
+    if (allocator == NULL)
+    {
+        l8w8jwt_free(ptr);
+        return;
+    }
+
+    if (ptr != NULL)
+    {
+        l8w8jwt_allocator_release(allocator, ptr);
+    }
+}
+
+int l8w8jwt_call_buffer_init(struct l8w8jwt_call_buffer* buffer, const size_t initial_capacity, const size_t element_size)
+{
+    if (buffer == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (initial_capacity == 0 || element_size == 0)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    buffer->array = l8w8jwt_call_calloc(initial_capacity, element_size);
+    if (buffer->array == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    buffer->length = 0;
+    buffer->capacity = initial_capacity;
+    buffer->element_size = element_size;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_call_buffer_push_back(struct l8w8jwt_call_buffer* buffer, const void* elements, const size_t elements_count)
+{
+    if (buffer == NULL || elements == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (elements_count > SIZE_MAX - buffer->length)
+    {
+        return L8W8JWT_OVERFLOW;
+    }
+
+    const size_t length = buffer->length + elements_count;
+
+    if (length > buffer->capacity)
+    {
+        size_t capacity = buffer->capacity;
+
+        while (capacity < length)
+        {
+            if (capacity > SIZE_MAX / 2 / buffer->element_size)
+            {
+                return L8W8JWT_OVERFLOW;
+            }
+
+            capacity *= 2;
+        }
+
+        void* array = l8w8jwt_call_realloc(buffer->array, capacity * buffer->element_size);
+        if (array == NULL)
+        {
+            return L8W8JWT_OUT_OF_MEM;
+        }
+
+        memset((unsigned char*)array + buffer->capacity * buffer->element_size, 0x00, (capacity - buffer->capacity) * buffer->element_size);
+
+        buffer->array = array;
+        buffer->capacity = capacity;
+    }
+
+    memcpy((unsigned char*)buffer->array + buffer->length * buffer->element_size, elements, elements_count * buffer->element_size);
+    buffer->length = length;
+    return L8W8JWT_SUCCESS;
+}
+
+void l8w8jwt_call_buffer_free(struct l8w8jwt_call_buffer* buffer)
+{
+    if (buffer == NULL)
+    {
+        return;
+    }
+
+    l8w8jwt_call_free(buffer->array);
+    buffer->array = NULL;
+    buffer->length = buffer->capacity = 0;
+}
+
+void l8w8jwt_allocator_free(const struct l8w8jwt_allocator* allocator, void* ptr)
+{
+    if (allocator == NULL)
+    {
+        l8w8jwt_free(ptr);
+        return;
+    }
+
+    if (ptr != NULL)
+    {
+        l8w8jwt_allocator_release(allocator, ptr);
+    }
+}
+
+void l8w8jwt_allocator_free_claims(const struct l8w8jwt_allocator* allocator, struct l8w8jwt_claim* claims, const size_t claims_count)
+{
+    const struct l8w8jwt_allocator* previous;
+
+    if (l8w8jwt_call_allocator_enter(allocator, &previous) != L8W8JWT_SUCCESS)
+    {
+        /* Nothing can have been allocated with it in the first place. */
+        return;
+    }
+
+    l8w8jwt_free_claims(claims, claims_count);
+
+    l8w8jwt_call_allocator_leave(previous);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,95 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file allocator_backend.h
+ *  @author Raphael Beck
+ *  @brief Internal call allocator plumbing (see l8w8jwt/allocator.h). NOT part of the public API!
+ *
+ *  The encode/decode entry points make their params' allocator the calling thread's "call allocator" for the duration of the call,
+ *  so that the helpers deep down (base64, claims, call buffers) allocate from it without every internal signature having to carry it around.
+ *  Per-call memory is allocated and freed with the <code>l8w8jwt_call_*</code> functions below; long-lived objects keep using
+ *  <code>l8w8jwt_malloc</code>, <code>l8w8jwt_calloc</code> and <code>l8w8jwt_free</code>, even when they're updated from within a call.
+ */
+
+#ifndef L8W8JWT_ALLOCATOR_BACKEND_H
+#define L8W8JWT_ALLOCATOR_BACKEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/allocator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Makes \p allocator the calling thread's call allocator (calls can nest, e.g. batch decoding goes through the regular decode function).
+ * @param allocator The allocator (<code>NULL</code> for the global heap).
+ * @param out_previous Where to write the previous call allocator into, for restoring it with {@link #l8w8jwt_call_allocator_leave}.
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_UNSUPPORTED_ALG</code> on compilers without thread-local storage).
+ */
+int l8w8jwt_call_allocator_enter(const struct l8w8jwt_allocator* allocator, const struct l8w8jwt_allocator** out_previous);
+
+/**
+ * Restores the call allocator that was current before the matching {@link #l8w8jwt_call_allocator_enter}.
+ * @param previous What {@link #l8w8jwt_call_allocator_enter} wrote into its <code>out_previous</code> argument.
+ */
+void l8w8jwt_call_allocator_leave(const struct l8w8jwt_allocator* previous);
+
+void* l8w8jwt_call_malloc(size_t size);
+void* l8w8jwt_call_calloc(size_t nmemb, size_t size);
+void* l8w8jwt_call_realloc(void* ptr, size_t size);
+void l8w8jwt_call_free(void* ptr);
+
+/**
+ * Growable array whose memory comes from the call allocator (the claims arrays that decode hands out are built in these).
+ */
+struct l8w8jwt_call_buffer
+{
+    void* array;
+    size_t length;
+    size_t capacity;
+    size_t element_size;
+};
+
+/**
+ * Allocates room for \p initial_capacity zeroed elements of \p element_size bytes each.
+ * @return Return code as defined in retcodes.h
+ */
+int l8w8jwt_call_buffer_init(struct l8w8jwt_call_buffer* buffer, size_t initial_capacity, size_t element_size);
+
+/**
+ * Appends \p elements_count elements (doubling the capacity as often as needed).
+ * @return Return code as defined in retcodes.h (on failure, the buffer is left as it was).
+ */
+int l8w8jwt_call_buffer_push_back(struct l8w8jwt_call_buffer* buffer, const void* elements, size_t elements_count);
+
+/**
+ * Frees the array (with {@link #l8w8jwt_call_free}) and resets the buffer; only needed if it isn't handed out or freed as a claims array.
+ */
+void l8w8jwt_call_buffer_free(struct l8w8jwt_call_buffer* buffer);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_ALLOCATOR_BACKEND_H
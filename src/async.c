@@ -0,0 +1,443 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/retcodes.h"
+#include "l8w8jwt/async.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if L8W8JWT_ENABLE_ASYNC
+
+#if defined(_WIN32)
+#include <windows.h>
+
+typedef SRWLOCK l8w8jwt_async_mutex;
+typedef CONDITION_VARIABLE l8w8jwt_async_cond;
+typedef HANDLE l8w8jwt_async_thread;
+
+#define l8w8jwt_async_mutex_init(m) (InitializeSRWLock(m), 0)
+#define l8w8jwt_async_mutex_destroy(m) ((void)(m))
+#define l8w8jwt_async_mutex_lock(m) AcquireSRWLockExclusive(m)
+#define l8w8jwt_async_mutex_unlock(m) ReleaseSRWLockExclusive(m)
+#define l8w8jwt_async_cond_init(c) (InitializeConditionVariable(c), 0)
+#define l8w8jwt_async_cond_destroy(c) ((void)(c))
+#define l8w8jwt_async_cond_wait(c, m) SleepConditionVariableSRW((c), (m), INFINITE, 0)
+#define l8w8jwt_async_cond_signal(c) WakeConditionVariable(c)
+#define l8w8jwt_async_cond_broadcast(c) WakeAllConditionVariable(c)
+
+#else
+#include <pthread.h>
+#include <unistd.h>
+
+typedef pthread_mutex_t l8w8jwt_async_mutex;
+typedef pthread_cond_t l8w8jwt_async_cond;
+typedef pthread_t l8w8jwt_async_thread;
+
+#define l8w8jwt_async_mutex_init(m) pthread_mutex_init((m), NULL)
+#define l8w8jwt_async_mutex_destroy(m) pthread_mutex_destroy(m)
+#define l8w8jwt_async_mutex_lock(m) pthread_mutex_lock(m)
+#define l8w8jwt_async_mutex_unlock(m) pthread_mutex_unlock(m)
+#define l8w8jwt_async_cond_init(c) pthread_cond_init((c), NULL)
+#define l8w8jwt_async_cond_destroy(c) pthread_cond_destroy(c)
+#define l8w8jwt_async_cond_wait(c, m) pthread_cond_wait((c), (m))
+#define l8w8jwt_async_cond_signal(c) pthread_cond_signal(c)
+#define l8w8jwt_async_cond_broadcast(c) pthread_cond_broadcast(c)
+
+#endif
+
+struct l8w8jwt_async_job
+{
+    struct l8w8jwt_decoding_params params;
+    void* user_data;
+};
+
+/*
+ * Both queues are ring buffers of queue_capacity slots. Submissions are only accepted while fewer than queue_capacity tokens are in flight
+ * (queued, being decoded or completed but not picked up yet), so neither ring can ever overflow.
+ * A single mutex guards both: it's held for a few dozen instructions per token, next to a signature verification that takes tens of microseconds at least.
+ */
+struct l8w8jwt_async_decoder
+{
+    l8w8jwt_async_mutex mutex;
+    l8w8jwt_async_cond jobs_available;
+    l8w8jwt_async_cond results_available;
+
+    size_t queue_capacity;
+    size_t in_flight;
+    int stop;
+    int event_fd;
+
+    struct l8w8jwt_async_job* jobs;
+    size_t jobs_head;
+    size_t jobs_count;
+
+    struct l8w8jwt_async_result* results;
+    size_t results_head;
+    size_t results_count;
+
+    l8w8jwt_async_thread* workers;
+    size_t worker_count;
+};
+
+static void l8w8jwt_async_signal_event_fd(const int event_fd)
+{
+#if defined(_WIN32)
+    (void)event_fd;
+#else
+    if (event_fd < 0)
+    {
+        return;
+    }
+
+    const uint64_t one = 1;
+
+    /* A full eventfd counter (EAGAIN) already means "readable", so failures don't lose wake-ups. */
+    ssize_t written = write(event_fd, &one, sizeof(one));
+    (void)written;
+#endif
+}
+
+static void l8w8jwt_async_decode_job(struct l8w8jwt_async_job* job, struct l8w8jwt_async_result* out_result)
+{
+    out_result->user_data = job->user_data;
+    out_result->claims = NULL;
+    out_result->claims_length = 0;
+    out_result->validation_result = ~L8W8JWT_VALID;
+    out_result->allocator = job->params.allocator;
+
+    out_result->r = l8w8jwt_decode(&job->params, &out_result->validation_result, &out_result->claims, &out_result->claims_length);
+
+    l8w8jwt_free(job->params.jwt);
+    job->params.jwt = NULL;
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI l8w8jwt_async_worker(LPVOID arg)
+#else
+static void* l8w8jwt_async_worker(void* arg)
+#endif
+{
+    struct l8w8jwt_async_decoder* decoder = (struct l8w8jwt_async_decoder*)arg;
+
+    for (;;)
+    {
+        l8w8jwt_async_mutex_lock(&decoder->mutex);
+
+        while (decoder->jobs_count == 0 && !decoder->stop)
+        {
+            l8w8jwt_async_cond_wait(&decoder->jobs_available, &decoder->mutex);
+        }
+
+        if (decoder->stop)
+        {
+            l8w8jwt_async_mutex_unlock(&decoder->mutex);
+            break;
+        }
+
+        struct l8w8jwt_async_job job = decoder->jobs[decoder->jobs_head];
+        decoder->jobs_head = (decoder->jobs_head + 1) % decoder->queue_capacity;
+        decoder->jobs_count--;
+
+        l8w8jwt_async_mutex_unlock(&decoder->mutex);
+
+        struct l8w8jwt_async_result result;
+        l8w8jwt_async_decode_job(&job, &result);
+
+        l8w8jwt_async_mutex_lock(&decoder->mutex);
+
+        const int was_empty = decoder->results_count == 0;
+
+        decoder->results[(decoder->results_head + decoder->results_count) % decoder->queue_capacity] = result;
+        decoder->results_count++;
+
+        l8w8jwt_async_cond_signal(&decoder->results_available);
+        l8w8jwt_async_mutex_unlock(&decoder->mutex);
+
+        if (was_empty)
+        {
+            l8w8jwt_async_signal_event_fd(decoder->event_fd);
+        }
+    }
+
+    l8w8jwt_thread_cleanup();
+
+#if defined(_WIN32)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+static void l8w8jwt_async_decoder_stop(struct l8w8jwt_async_decoder* decoder)
+{
+    l8w8jwt_async_mutex_lock(&decoder->mutex);
+    decoder->stop = 1;
+    l8w8jwt_async_cond_broadcast(&decoder->jobs_available);
+    l8w8jwt_async_mutex_unlock(&decoder->mutex);
+
+    for (size_t i = 0; i < decoder->worker_count; ++i)
+    {
+#if defined(_WIN32)
+        WaitForSingleObject(decoder->workers[i], INFINITE);
+        CloseHandle(decoder->workers[i]);
+#else
+        pthread_join(decoder->workers[i], NULL);
+#endif
+    }
+
+    decoder->worker_count = 0;
+}
+
+int l8w8jwt_async_decoder_create(size_t worker_count, const size_t queue_capacity, const int event_fd, struct l8w8jwt_async_decoder** out_decoder)
+{
+    if (out_decoder == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (queue_capacity == 0)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    if (worker_count == 0)
+    {
+        worker_count = 1;
+    }
+
+    struct l8w8jwt_async_decoder* decoder = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_async_decoder));
+    if (decoder == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    decoder->queue_capacity = queue_capacity;
+    decoder->event_fd = event_fd;
+
+    decoder->jobs = l8w8jwt_calloc(queue_capacity, sizeof(struct l8w8jwt_async_job));
+    decoder->results = l8w8jwt_calloc(queue_capacity, sizeof(struct l8w8jwt_async_result));
+    decoder->workers = l8w8jwt_calloc(worker_count, sizeof(l8w8jwt_async_thread));
+
+    if (decoder->jobs == NULL || decoder->results == NULL || decoder->workers == NULL)
+    {
+        l8w8jwt_free(decoder->jobs);
+        l8w8jwt_free(decoder->results);
+        l8w8jwt_free(decoder->workers);
+        l8w8jwt_free(decoder);
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    l8w8jwt_async_mutex_init(&decoder->mutex);
+    l8w8jwt_async_cond_init(&decoder->jobs_available);
+    l8w8jwt_async_cond_init(&decoder->results_available);
+
+    for (size_t i = 0; i < worker_count; ++i)
+    {
+#if defined(_WIN32)
+        decoder->workers[i] = CreateThread(NULL, 0, &l8w8jwt_async_worker, decoder, 0, NULL);
+        const int failed = decoder->workers[i] == NULL;
+#else
+        const int failed = pthread_create(&decoder->workers[i], NULL, &l8w8jwt_async_worker, decoder) != 0;
+#endif
+        if (failed)
+        {
+            l8w8jwt_async_decoder_free(decoder);
+            return L8W8JWT_OUT_OF_MEM;
+        }
+
+        decoder->worker_count++;
+    }
+
+    *out_decoder = decoder;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_async_decoder_submit(struct l8w8jwt_async_decoder* decoder, const struct l8w8jwt_decoding_params* params, void* user_data)
+{
+    if (decoder == NULL || params == NULL || params->jwt == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (params->jwt_length == 0 || params->key_set_reader != NULL)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    struct l8w8jwt_async_job job;
+    job.params = *params;
+    job.user_data = user_data;
+
+    /* Copied before taking the lock, so that a full queue costs an allocation but never blocks the workers. */
+    job.params.jwt = l8w8jwt_malloc(params->jwt_length + 1);
+    if (job.params.jwt == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    memcpy(job.params.jwt, params->jwt, params->jwt_length);
+    job.params.jwt[params->jwt_length] = '\0';
+
+    l8w8jwt_async_mutex_lock(&decoder->mutex);
+
+    if (decoder->in_flight == decoder->queue_capacity)
+    {
+        l8w8jwt_async_mutex_unlock(&decoder->mutex);
+        l8w8jwt_free(job.params.jwt);
+        return L8W8JWT_QUEUE_FULL;
+    }
+
+    decoder->jobs[(decoder->jobs_head + decoder->jobs_count) % decoder->queue_capacity] = job;
+    decoder->jobs_count++;
+    decoder->in_flight++;
+
+    l8w8jwt_async_cond_signal(&decoder->jobs_available);
+    l8w8jwt_async_mutex_unlock(&decoder->mutex);
+
+    return L8W8JWT_SUCCESS;
+}
+
+/* Moves up to max_results results out of the completion queue: the decoder's mutex must be held. */
+static size_t l8w8jwt_async_take_results(struct l8w8jwt_async_decoder* decoder, struct l8w8jwt_async_result* out_results, const size_t max_results)
+{
+    size_t n = 0;
+
+    while (n < max_results && decoder->results_count != 0)
+    {
+        out_results[n++] = decoder->results[decoder->results_head];
+        decoder->results_head = (decoder->results_head + 1) % decoder->queue_capacity;
+        decoder->results_count--;
+    }
+
+    decoder->in_flight -= n;
+    return n;
+}
+
+size_t l8w8jwt_async_decoder_poll(struct l8w8jwt_async_decoder* decoder, struct l8w8jwt_async_result* out_results, const size_t max_results)
+{
+    if (decoder == NULL || out_results == NULL || max_results == 0)
+    {
+        return 0;
+    }
+
+    l8w8jwt_async_mutex_lock(&decoder->mutex);
+    const size_t n = l8w8jwt_async_take_results(decoder, out_results, max_results);
+    l8w8jwt_async_mutex_unlock(&decoder->mutex);
+
+    return n;
+}
+
+size_t l8w8jwt_async_decoder_wait(struct l8w8jwt_async_decoder* decoder, struct l8w8jwt_async_result* out_results, const size_t max_results)
+{
+    if (decoder == NULL || out_results == NULL || max_results == 0)
+    {
+        return 0;
+    }
+
+    l8w8jwt_async_mutex_lock(&decoder->mutex);
+
+    while (decoder->results_count == 0 && decoder->in_flight != 0)
+    {
+        l8w8jwt_async_cond_wait(&decoder->results_available, &decoder->mutex);
+    }
+
+    const size_t n = l8w8jwt_async_take_results(decoder, out_results, max_results);
+    l8w8jwt_async_mutex_unlock(&decoder->mutex);
+
+    return n;
+}
+
+void l8w8jwt_async_decoder_free(struct l8w8jwt_async_decoder* decoder)
+{
+    if (decoder == NULL)
+    {
+        return;
+    }
+
+    l8w8jwt_async_decoder_stop(decoder);
+
+    for (size_t i = 0; i < decoder->jobs_count; ++i)
+    {
+        l8w8jwt_free(decoder->jobs[(decoder->jobs_head + i) % decoder->queue_capacity].params.jwt);
+    }
+
+    for (size_t i = 0; i < decoder->results_count; ++i)
+    {
+        struct l8w8jwt_async_result* result = &decoder->results[(decoder->results_head + i) % decoder->queue_capacity];
+        l8w8jwt_allocator_free_claims(result->allocator, result->claims, result->claims_length);
+    }
+
+    l8w8jwt_async_cond_destroy(&decoder->jobs_available);
+    l8w8jwt_async_cond_destroy(&decoder->results_available);
+    l8w8jwt_async_mutex_destroy(&decoder->mutex);
+
+    l8w8jwt_free(decoder->jobs);
+    l8w8jwt_free(decoder->results);
+    l8w8jwt_free(decoder->workers);
+    l8w8jwt_free(decoder);
+}
+
+#else
+
+int l8w8jwt_async_decoder_create(size_t worker_count, size_t queue_capacity, int event_fd, struct l8w8jwt_async_decoder** out_decoder)
+{
+    (void)worker_count;
+    (void)queue_capacity;
+    (void)event_fd;
+    (void)out_decoder;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_async_decoder_submit(struct l8w8jwt_async_decoder* decoder, const struct l8w8jwt_decoding_params* params, void* user_data)
+{
+    (void)decoder;
+    (void)params;
+    (void)user_data;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+size_t l8w8jwt_async_decoder_poll(struct l8w8jwt_async_decoder* decoder, struct l8w8jwt_async_result* out_results, size_t max_results)
+{
+    (void)decoder;
+    (void)out_results;
+    (void)max_results;
+    return 0;
+}
+
+size_t l8w8jwt_async_decoder_wait(struct l8w8jwt_async_decoder* decoder, struct l8w8jwt_async_result* out_results, size_t max_results)
+{
+    (void)decoder;
+    (void)out_results;
+    (void)max_results;
+    return 0;
+}
+
+void l8w8jwt_async_decoder_free(struct l8w8jwt_async_decoder* decoder)
+{
+    (void)decoder;
+}
+
+#endif // L8W8JWT_ENABLE_ASYNC
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
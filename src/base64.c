@@ -108,6 +108,7 @@ after February 11, 2012 is no longer under the GPL v2 option.
 #include "l8w8jwt/base64.h"
 #include "l8w8jwt/version.h"
 #include "l8w8jwt/retcodes.h"
+#include "allocator_backend.h"
 
 static const uint8_t TABLE[64 + 1] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 static const uint8_t URL_SAFE_TABLE[64 + 1] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
@@ -134,7 +135,7 @@ int l8w8jwt_base64_encode(const int url, const uint8_t* data, const size_t data_
         return L8W8JWT_OVERFLOW;
     }
 
-    *out = l8w8jwt_malloc(olen);
+    *out = l8w8jwt_call_malloc(olen);
     if (*out == NULL)
     {
         return L8W8JWT_OUT_OF_MEM;
@@ -250,7 +251,7 @@ int l8w8jwt_base64_decode(const int url, const char* data, const size_t data_len
     if (r == 3)
         r = 1;
 
-    *out = l8w8jwt_calloc(count / 4 * 3 + 16, sizeof(uint8_t));
+    *out = l8w8jwt_call_calloc(count / 4 * 3 + 16, sizeof(uint8_t));
     if (*out == NULL)
     {
         return L8W8JWT_OUT_OF_MEM;
@@ -295,7 +296,7 @@ int l8w8jwt_base64_decode(const int url, const char* data, const size_t data_len
                 }
                 else
                 {
-                    l8w8jwt_free(*out);
+                    l8w8jwt_call_free(*out);
                     *out = NULL;
                     return L8W8JWT_INVALID_ARG; // Invalid padding...
                 }
@@ -309,6 +310,94 @@ int l8w8jwt_base64_decode(const int url, const char* data, const size_t data_len
     return L8W8JWT_SUCCESS;
 }
 
+size_t l8w8jwt_base64url_encoded_length(const size_t data_length)
+{
+    const size_t remainder = data_length % 3;
+    return (data_length / 3) * 4 + (remainder ? remainder + 1 : 0);
+}
+
+void l8w8jwt_base64url_stream_init(struct l8w8jwt_base64url_stream* stream, char* out)
+{
+    stream->out = out;
+    stream->out_length = 0;
+    stream->pending_length = 0;
+}
+
+void l8w8jwt_base64url_stream_write(struct l8w8jwt_base64url_stream* stream, const uint8_t* data, size_t data_length)
+{
+    const uint8_t* table = URL_SAFE_TABLE;
+    uint8_t* pos = (uint8_t*)stream->out + stream->out_length;
+
+    if (stream->pending_length != 0)
+    {
+        while (stream->pending_length < 3 && data_length != 0)
+        {
+            stream->pending[stream->pending_length++] = *data++;
+            --data_length;
+        }
+
+        if (stream->pending_length < 3)
+        {
+            return;
+        }
+
+        const uint8_t* in = stream->pending;
+        *pos++ = table[in[0] >> 2];
+        *pos++ = table[((in[0] & 0x03) << 4) | (in[1] >> 4)];
+        *pos++ = table[((in[1] & 0x0f) << 2) | (in[2] >> 6)];
+        *pos++ = table[in[2] & 0x3f];
+
+        stream->pending_length = 0;
+    }
+
+    const uint8_t* in = data;
+    const uint8_t* end = data + data_length;
+
+    while (end - in >= 3)
+    {
+        *pos++ = table[in[0] >> 2];
+        *pos++ = table[((in[0] & 0x03) << 4) | (in[1] >> 4)];
+        *pos++ = table[((in[1] & 0x0f) << 2) | (in[2] >> 6)];
+        *pos++ = table[in[2] & 0x3f];
+
+        in += 3;
+    }
+
+    while (in < end)
+    {
+        stream->pending[stream->pending_length++] = *in++;
+    }
+
+    stream->out_length = (size_t)(pos - (uint8_t*)stream->out);
+}
+
+size_t l8w8jwt_base64url_stream_finish(struct l8w8jwt_base64url_stream* stream)
+{
+    const uint8_t* table = URL_SAFE_TABLE;
+    const uint8_t* in = stream->pending;
+    uint8_t* pos = (uint8_t*)stream->out + stream->out_length;
+
+    switch (stream->pending_length)
+    {
+        case 1:
+            *pos++ = table[in[0] >> 2];
+            *pos++ = table[(in[0] & 0x03) << 4];
+            break;
+        case 2:
+            *pos++ = table[in[0] >> 2];
+            *pos++ = table[((in[0] & 0x03) << 4) | (in[1] >> 4)];
+            *pos++ = table[(in[1] & 0x0f) << 2];
+            break;
+        default:
+            break;
+    }
+
+    stream->pending_length = 0;
+    stream->out_length = (size_t)(pos - (uint8_t*)stream->out);
+
+    return stream->out_length;
+}
+
 /*
  * All credits for this base-64 encoding/decoding implementation go to Jouni Malinen.
  * I take no credit for this (not even the modifications I made to it!) whatsoever.
@@ -21,7 +21,9 @@ extern "C" {
 #include "l8w8jwt/claim.h"
 #include "l8w8jwt/version.h"
 #include "l8w8jwt/retcodes.h"
+#include "allocator_backend.h"
 
+#include <stdint.h>
 #include <string.h>
 #include <chillbuff.h>
 #include <mbedtls/md.h>
@@ -44,8 +46,8 @@ void l8w8jwt_free_claims(struct l8w8jwt_claim* claims, const size_t claims_count
         mbedtls_platform_zeroize(claim->key, claim->key_length);
         mbedtls_platform_zeroize(claim->value, claim->value_length);
 
-        l8w8jwt_free(claim->key);
-        l8w8jwt_free(claim->value);
+        l8w8jwt_call_free(claim->key);
+        l8w8jwt_call_free(claim->value);
     }
 
     if (claims_count != 0)
@@ -53,78 +55,175 @@ void l8w8jwt_free_claims(struct l8w8jwt_claim* claims, const size_t claims_count
         mbedtls_platform_zeroize(claims, claims_count * sizeof(struct l8w8jwt_claim));
     }
 
-    l8w8jwt_free(claims);
+    l8w8jwt_call_free(claims);
 }
 
-static inline void l8w8jwt_escape_claim_string(struct chillbuff* stringbuilder, const char* string, const size_t string_length)
+static const char* escape_table[] = {
+    "\\u0000", "\\u0001", "\\u0002", "\\u0003", "\\u0004", "\\u0005", "\\u0006", "\\u0007",
+    "\\b", "\\t", "\\n", "\\u000b", "\\f", "\\r", "\\u000e", "\\u000f",
+    "\\u0010", "\\u0011", "\\u0012", "\\u0013", "\\u0014", "\\u0015", "\\u0016", "\\u0017",
+    "\\u0018", "\\u0019", "\\u001a", "\\u001b", "\\u001c", "\\u001d", "\\u001e", "\\u001f",
+    NULL, NULL, "\\\"", NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, "\\/",
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, "\\\\", NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, "\\u007f",
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL
+};
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define L8W8JWT_ESCAPE_SSE2 1
+#include <emmintrin.h>
+#else
+#define L8W8JWT_ESCAPE_SSE2 0
+#endif
+
+#if L8W8JWT_ESCAPE_SSE2
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+static inline unsigned int l8w8jwt_ctz32(const unsigned int x)
+{
+    unsigned long i;
+    _BitScanForward(&i, x);
+    return (unsigned int)i;
+}
+#else
+#define l8w8jwt_ctz32(x) ((unsigned int)__builtin_ctz(x))
+#endif
+#endif
+
+#define L8W8JWT_SWAR_ONES 0x0101010101010101ULL
+#define L8W8JWT_SWAR_HIGHS 0x8080808080808080ULL
+
+/* Non-zero if any byte inside the 64-bit word might need escaping (false positives are possible and are sorted out by the caller using the escape table). */
+static inline uint64_t l8w8jwt_swar_needs_escape(const uint64_t w)
+{
+#define L8W8JWT_SWAR_HAS_BYTE(x, c) (((((x) ^ (L8W8JWT_SWAR_ONES * (c))) - L8W8JWT_SWAR_ONES) & ~((x) ^ (L8W8JWT_SWAR_ONES * (c)))) & L8W8JWT_SWAR_HIGHS)
+    const uint64_t control = (w - L8W8JWT_SWAR_ONES * 0x20) & ~w & L8W8JWT_SWAR_HIGHS;
+    return control | L8W8JWT_SWAR_HAS_BYTE(w, '"') | L8W8JWT_SWAR_HAS_BYTE(w, '/') | L8W8JWT_SWAR_HAS_BYTE(w, '\\') | L8W8JWT_SWAR_HAS_BYTE(w, 0x7f);
+#undef L8W8JWT_SWAR_HAS_BYTE
+}
+
+/* Finds the index of the next character (starting at index i) that needs escaping; returns string_length if there is none. */
+static inline size_t l8w8jwt_find_next_escape(const char* string, size_t i, const size_t string_length)
 {
-    static const char* escape_table[] = {
-        "\\u0000", "\\u0001", "\\u0002", "\\u0003", "\\u0004", "\\u0005", "\\u0006", "\\u0007",
-        "\\b", "\\t", "\\n", "\\u000b", "\\f", "\\r", "\\u000e", "\\u000f",
-        "\\u0010", "\\u0011", "\\u0012", "\\u0013", "\\u0014", "\\u0015", "\\u0016", "\\u0017",
-        "\\u0018", "\\u0019", "\\u001a", "\\u001b", "\\u001c", "\\u001d", "\\u001e", "\\u001f",
-        NULL, NULL, "\\\"", NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, "\\/",
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, "\\\\", NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, "\\u007f",
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-        NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL
-    };
-
-    for (size_t i = 0; i < string_length; ++i)
+#if L8W8JWT_ESCAPE_SSE2
+    const __m128i c1f = _mm_set1_epi8(0x1f);
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i slash = _mm_set1_epi8('/');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i del = _mm_set1_epi8(0x7f);
+
+    for (; i + 16 <= string_length; i += 16)
     {
-        const char c = string[i];
-        const char* e = escape_table[c];
+        const __m128i v = _mm_loadu_si128((const __m128i*)(string + i));
+
+        /* max_epu8(v, 0x1f) == 0x1f <=> v <= 0x1f (unsigned) */
+        __m128i m = _mm_cmpeq_epi8(_mm_max_epu8(v, c1f), c1f);
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, quote));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, slash));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, backslash));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, del));
 
-        if (e)
+        const unsigned int mask = (unsigned int)_mm_movemask_epi8(m);
+        if (mask != 0)
         {
-            chillbuff_push_back(stringbuilder, e, strlen(e));
+            return i + l8w8jwt_ctz32(mask);
         }
-        else
+    }
+#endif
+
+    for (; i + 8 <= string_length; i += 8)
+    {
+        uint64_t w;
+        memcpy(&w, string + i, sizeof(w));
+
+        if (l8w8jwt_swar_needs_escape(w))
         {
-            chillbuff_push_back(stringbuilder, &c, 1);
+            for (size_t j = i; j < i + 8; ++j)
+            {
+                if (escape_table[(unsigned char)string[j]] != NULL)
+                {
+                    return j;
+                }
+            }
         }
     }
+
+    for (; i < string_length; ++i)
+    {
+        if (escape_table[(unsigned char)string[i]] != NULL)
+        {
+            return i;
+        }
+    }
+
+    return string_length;
 }
 
-int l8w8jwt_write_claims(struct chillbuff* stringbuilder, struct l8w8jwt_claim* claims, const size_t claims_count)
+void l8w8jwt_escape_claim_string_to_sink(l8w8jwt_claims_sink sink, void* usr, const char* string, const size_t string_length)
 {
-    if (stringbuilder == NULL || claims == NULL)
+    if (sink == NULL || string == NULL)
     {
-        return L8W8JWT_NULL_ARG;
+        return;
     }
 
-    if (claims_count == 0)
+    /* Runs of characters that don't need escaping are passed on to the sink in bulk. */
+    size_t i = 0;
+
+    while (i < string_length)
     {
-        return L8W8JWT_INVALID_ARG;
+        const size_t next = l8w8jwt_find_next_escape(string, i, string_length);
+
+        if (next > i)
+        {
+            sink(usr, string + i, next - i);
+        }
+
+        if (next == string_length)
+        {
+            break;
+        }
+
+        const char* e = escape_table[(unsigned char)string[next]];
+        sink(usr, e, strlen(e));
+
+        i = next + 1;
     }
+}
 
-    struct chillbuff escape_buffer;
-    if (chillbuff_init(&escape_buffer, 256, sizeof(char), CHILLBUFF_GROW_LINEAR) != 0)
+int l8w8jwt_write_claims_to_sink(l8w8jwt_claims_sink sink, void* usr, struct l8w8jwt_claim* claims, const size_t claims_count)
+{
+    if (sink == NULL || claims == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (claims_count == 0)
     {
-        return L8W8JWT_OUT_OF_MEM;
+        return L8W8JWT_INVALID_ARG;
     }
 
     int first = 1;
@@ -137,42 +236,66 @@ int l8w8jwt_write_claims(struct chillbuff* stringbuilder, struct l8w8jwt_claim*
 
         if (!first)
         {
-            chillbuff_push_back(stringbuilder, ",", 1);
+            sink(usr, ",", 1);
         }
 
         const size_t key_length = claim->key_length ? claim->key_length : strlen(claim->key);
         const size_t value_length = claim->value_length ? claim->value_length : strlen(claim->value);
 
-        chillbuff_clear(&escape_buffer);
-        l8w8jwt_escape_claim_string(&escape_buffer, claim->key, key_length);
-
-        chillbuff_push_back(stringbuilder, "\"", 1);
-        chillbuff_push_back(stringbuilder, escape_buffer.array, escape_buffer.length);
-        chillbuff_push_back(stringbuilder, "\":", 2);
+        sink(usr, "\"", 1);
+        l8w8jwt_escape_claim_string_to_sink(sink, usr, claim->key, key_length);
+        sink(usr, "\":", 2);
 
         if (claim->type == L8W8JWT_CLAIM_TYPE_STRING)
         {
-            chillbuff_push_back(stringbuilder, "\"", 1);
-
-            chillbuff_clear(&escape_buffer);
-            l8w8jwt_escape_claim_string(&escape_buffer, claim->value, value_length);
-
-            chillbuff_push_back(stringbuilder, escape_buffer.array, escape_buffer.length);
-
-            chillbuff_push_back(stringbuilder, "\"", 1);
+            sink(usr, "\"", 1);
+            l8w8jwt_escape_claim_string_to_sink(sink, usr, claim->value, value_length);
+            sink(usr, "\"", 1);
         }
-        else
+        else if (value_length != 0)
         {
-            chillbuff_push_back(stringbuilder, claim->value, value_length);
+            sink(usr, claim->value, value_length);
         }
 
         first = 0;
     }
 
-    chillbuff_free(&escape_buffer);
     return L8W8JWT_SUCCESS;
 }
 
+static void l8w8jwt_chillbuff_sink(void* usr, const char* data, const size_t data_length)
+{
+    chillbuff_push_back((struct chillbuff*)usr, data, data_length);
+}
+
+int l8w8jwt_write_claims(struct chillbuff* stringbuilder, struct l8w8jwt_claim* claims, const size_t claims_count)
+{
+    if (stringbuilder == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    return l8w8jwt_write_claims_to_sink(&l8w8jwt_chillbuff_sink, stringbuilder, claims, claims_count);
+}
+
+static void l8w8jwt_count_sink(void* usr, const char* data, const size_t data_length)
+{
+    (void)data;
+    *((size_t*)usr) += data_length;
+}
+
+size_t l8w8jwt_get_claims_length(struct l8w8jwt_claim* claims, const size_t claims_count)
+{
+    size_t length = 0;
+
+    if (l8w8jwt_write_claims_to_sink(&l8w8jwt_count_sink, &length, claims, claims_count) != L8W8JWT_SUCCESS)
+    {
+        return 0;
+    }
+
+    return length;
+}
+
 struct l8w8jwt_claim* l8w8jwt_get_claim(struct l8w8jwt_claim* claims, const size_t claims_count, const char* key, const size_t key_length)
 {
     if (claims == NULL || key == NULL || claims_count == 0 || key_length == 0)
@@ -0,0 +1,813 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/algs.h"
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/retcodes.h"
+#include "crypto_provider.h"
+#include "sha2.h"
+#include "p256.h"
+#include "secp256k1.h"
+#include "thread_context.h"
+#include "spinlock.h"
+
+#include <string.h>
+#include <mbedtls/pk.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/hmac_drbg.h>
+#include <mbedtls/x509_crt.h>
+#include <mbedtls/platform_util.h>
+
+/* Key handle of the MbedTLS provider. */
+struct l8w8jwt_mbedtls_key
+{
+    /* Points either to pk or to crt.pk */
+    mbedtls_pk_context* pk;
+
+    mbedtls_pk_context own_pk;
+    mbedtls_x509_crt crt;
+
+    /* Only seeded for signing keys, and only if the signing thread has no per-thread DRBG (see l8w8jwt/thread.h). */
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context ctr_drbg;
+    int ctr_drbg_seeded;
+
+    /*
+     * Non-zero if ECDSA signatures use RFC 6979 nonces: in that case, ctr_drbg is left unseeded (no entropy source is touched at all)
+     * and hmac_drbg, seeded from the PEM key itself, provides the blinding values for key parsing and signing instead.
+     */
+    int deterministic_ecdsa;
+    mbedtls_hmac_drbg_context hmac_drbg;
+
+#if L8W8JWT_P256 || L8W8JWT_SECP256K1
+    /* The alg (ES256 or ES256K) whose dedicated engine this key was exported for (see p256.h and secp256k1.h), or 0 if MbedTLS handles it. */
+    int ecc256_alg;
+
+    /* Big-endian private scalar (signing keys only). */
+    unsigned char ecc256_private_key[32];
+
+    /* Uncompressed public point (0x04 || x || y). */
+    unsigned char ecc256_public_key[65];
+
+    /* Precomputed multiples of the public point (verification keys only, see l8w8jwt_mbedtls_precompute_verification_key); NULL if there's none. */
+    void* ecc256_table;
+#endif
+};
+
+static struct l8w8jwt_mbedtls_key* l8w8jwt_mbedtls_key_new(void)
+{
+    struct l8w8jwt_mbedtls_key* key = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_mbedtls_key));
+    if (key == NULL)
+    {
+        return NULL;
+    }
+
+    mbedtls_pk_init(&key->own_pk);
+    mbedtls_x509_crt_init(&key->crt);
+    mbedtls_entropy_init(&key->entropy);
+    mbedtls_ctr_drbg_init(&key->ctr_drbg);
+    mbedtls_hmac_drbg_init(&key->hmac_drbg);
+
+    key->pk = &key->own_pk;
+    return key;
+}
+
+static void l8w8jwt_mbedtls_free_key(void* key)
+{
+    struct l8w8jwt_mbedtls_key* k = (struct l8w8jwt_mbedtls_key*)key;
+    if (k == NULL)
+    {
+        return;
+    }
+
+    mbedtls_ctr_drbg_free(&k->ctr_drbg);
+    mbedtls_hmac_drbg_free(&k->hmac_drbg);
+    mbedtls_entropy_free(&k->entropy);
+    mbedtls_x509_crt_free(&k->crt);
+    mbedtls_pk_free(&k->own_pk);
+
+#if L8W8JWT_P256 || L8W8JWT_SECP256K1
+    l8w8jwt_free(k->ecc256_table);
+#endif
+
+    mbedtls_platform_zeroize(k, sizeof(struct l8w8jwt_mbedtls_key));
+    l8w8jwt_free(k);
+}
+
+#if L8W8JWT_P256 || L8W8JWT_SECP256K1
+/* Returns the curve of the given alg if l8w8jwt has a dedicated 256-bit ECDSA engine for it, or MBEDTLS_ECP_DP_NONE otherwise. */
+static mbedtls_ecp_group_id l8w8jwt_mbedtls_ecc256_curve(const int alg)
+{
+#if L8W8JWT_P256
+    if (alg == L8W8JWT_ALG_ES256)
+    {
+        return MBEDTLS_ECP_DP_SECP256R1;
+    }
+#endif
+#if L8W8JWT_SECP256K1
+    if (alg == L8W8JWT_ALG_ES256K)
+    {
+        return MBEDTLS_ECP_DP_SECP256K1;
+    }
+#endif
+    return MBEDTLS_ECP_DP_NONE;
+}
+#endif
+
+/* The CTR_DRBG to use with a signing key: the calling thread's (no per-call entropy gathering), or else the key's own (seeded on first use). */
+static mbedtls_ctr_drbg_context* l8w8jwt_mbedtls_ctr_drbg(struct l8w8jwt_mbedtls_key* k)
+{
+    mbedtls_ctr_drbg_context* ctr_drbg = l8w8jwt_thread_ctr_drbg();
+    if (ctr_drbg != NULL)
+    {
+        return ctr_drbg;
+    }
+
+    if (!k->ctr_drbg_seeded)
+    {
+        if (mbedtls_ctr_drbg_seed(&k->ctr_drbg, mbedtls_entropy_func, &k->entropy, (const unsigned char*)"l8w8jwt_mbedtls_pers.!#@", 24) != 0)
+        {
+            return NULL;
+        }
+
+        k->ctr_drbg_seeded = 1;
+    }
+
+    return &k->ctr_drbg;
+}
+
+static int l8w8jwt_mbedtls_hash(const mbedtls_md_type_t md_type, const unsigned char* data, const size_t data_length, unsigned char* out)
+{
+    return l8w8jwt_sha2(md_type, data, data_length, out);
+}
+
+static int l8w8jwt_mbedtls_hmac(const mbedtls_md_type_t md_type, const unsigned char* key, const size_t key_length, const unsigned char* data, const size_t data_length, unsigned char* out)
+{
+    return l8w8jwt_hmac_sha2(md_type, key, key_length, data, data_length, out);
+}
+
+static int l8w8jwt_mbedtls_load_signing_key(const int alg, const int deterministic_ecdsa, const unsigned char* key, const size_t key_length, const unsigned char* key_pw, const size_t key_pw_length, void** out_key, size_t* out_signature_length)
+{
+    int r;
+
+    struct l8w8jwt_mbedtls_key* k = l8w8jwt_mbedtls_key_new();
+    if (k == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    int (*f_rng)(void*, unsigned char*, size_t) = &mbedtls_ctr_drbg_random;
+    void* p_rng = NULL;
+
+    k->deterministic_ecdsa = deterministic_ecdsa && (alg == L8W8JWT_ALG_ES256 || alg == L8W8JWT_ALG_ES384 || alg == L8W8JWT_ALG_ES512 || alg == L8W8JWT_ALG_ES256K);
+
+    if (k->deterministic_ecdsa)
+    {
+        f_rng = &mbedtls_hmac_drbg_random;
+        p_rng = &k->hmac_drbg;
+
+        r = mbedtls_hmac_drbg_seed_buf(&k->hmac_drbg, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), key, key_length);
+
+        /* For encrypted PEMs, the secret that makes the blinding values unpredictable is the password. */
+        if (r == 0 && key_pw != NULL && key_pw_length != 0)
+        {
+            r = mbedtls_hmac_drbg_update(&k->hmac_drbg, key_pw, key_pw_length);
+        }
+    }
+    else
+    {
+        p_rng = l8w8jwt_mbedtls_ctr_drbg(k);
+        r = p_rng == NULL;
+    }
+
+    if (r != 0)
+    {
+        r = L8W8JWT_MBEDTLS_CTR_DRBG_SEED_FAILURE;
+        goto exit;
+    }
+
+    r = mbedtls_pk_parse_key(k->pk, key, key_length, key_pw, key_pw_length, f_rng, p_rng);
+    if (r != 0)
+    {
+        r = L8W8JWT_KEY_PARSE_FAILURE;
+        goto exit;
+    }
+
+    r = L8W8JWT_WRONG_KEY_TYPE;
+
+    switch (alg)
+    {
+        case L8W8JWT_ALG_RS256:
+        case L8W8JWT_ALG_RS384:
+        case L8W8JWT_ALG_RS512: {
+
+            /* Ensure RSA functionality. */
+            if (!mbedtls_pk_can_do(k->pk, MBEDTLS_PK_RSA) && !mbedtls_pk_can_do(k->pk, MBEDTLS_PK_RSA_ALT))
+            {
+                goto exit;
+            }
+
+            /* Weak RSA keys are forbidden! */
+            if (mbedtls_pk_get_bitlen(k->pk) < 2048)
+            {
+                goto exit;
+            }
+
+            *out_signature_length = mbedtls_pk_get_len(k->pk);
+            break;
+        }
+        case L8W8JWT_ALG_PS256:
+        case L8W8JWT_ALG_PS384:
+        case L8W8JWT_ALG_PS512: {
+
+            if (!mbedtls_pk_can_do(k->pk, MBEDTLS_PK_RSASSA_PSS))
+            {
+                goto exit;
+            }
+
+            if (mbedtls_pk_get_bitlen(k->pk) < 2048)
+            {
+                goto exit;
+            }
+
+            *out_signature_length = mbedtls_pk_get_len(k->pk);
+            break;
+        }
+        case L8W8JWT_ALG_ES256:
+        case L8W8JWT_ALG_ES384:
+        case L8W8JWT_ALG_ES512:
+        case L8W8JWT_ALG_ES256K: {
+
+            if (!mbedtls_pk_can_do(k->pk, MBEDTLS_PK_ECDSA))
+            {
+                goto exit;
+            }
+
+            mbedtls_ecp_group_id expected_curve;
+            size_t expected_bitlen;
+
+            switch (alg)
+            {
+                case L8W8JWT_ALG_ES256:
+                    expected_curve = MBEDTLS_ECP_DP_SECP256R1;
+                    expected_bitlen = 256;
+                    *out_signature_length = 64;
+                    break;
+                case L8W8JWT_ALG_ES256K:
+                    expected_curve = MBEDTLS_ECP_DP_SECP256K1;
+                    expected_bitlen = 256;
+                    *out_signature_length = 64;
+                    break;
+                case L8W8JWT_ALG_ES384:
+                    expected_curve = MBEDTLS_ECP_DP_SECP384R1;
+                    expected_bitlen = 384;
+                    *out_signature_length = 96;
+                    break;
+                default:
+                    expected_curve = MBEDTLS_ECP_DP_SECP521R1;
+                    expected_bitlen = 521;
+                    *out_signature_length = 132;
+                    break;
+            }
+
+            /*
+             * Ensure that the passed elliptic-curve cryptography key
+             * has a size that is valid and compatible with the selected JWT alg.
+             */
+            if (mbedtls_pk_ec(*k->pk)->MBEDTLS_PRIVATE(grp).id != expected_curve || mbedtls_pk_get_bitlen(k->pk) != expected_bitlen)
+            {
+                goto exit;
+            }
+
+#if L8W8JWT_P256 || L8W8JWT_SECP256K1
+            if (l8w8jwt_mbedtls_ecc256_curve(alg) != MBEDTLS_ECP_DP_NONE && mbedtls_mpi_write_binary(&mbedtls_pk_ec(*k->pk)->MBEDTLS_PRIVATE(d), k->ecc256_private_key, sizeof(k->ecc256_private_key)) == 0)
+            {
+                k->ecc256_alg = alg;
+            }
+#endif
+            break;
+        }
+        default: {
+            r = L8W8JWT_INVALID_ARG;
+            goto exit;
+        }
+    }
+
+    *out_key = k;
+    k = NULL;
+    r = L8W8JWT_SUCCESS;
+
+exit:
+    l8w8jwt_mbedtls_free_key(k);
+    return r;
+}
+
+static int l8w8jwt_mbedtls_load_verification_key(const int alg, const unsigned char* key, const size_t key_length, void** out_key)
+{
+    struct l8w8jwt_mbedtls_key* k = l8w8jwt_mbedtls_key_new();
+    if (k == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    int r;
+
+    // If the validation PEM is a X.509 certificate, its public key is used.
+    if (strstr((const char*)key, "-----BEGIN CERTIFICATE-----") != NULL)
+    {
+        r = mbedtls_x509_crt_parse(&k->crt, key, key_length);
+        k->pk = &k->crt.pk;
+    }
+    else
+    {
+        r = mbedtls_pk_parse_public_key(k->pk, key, key_length);
+    }
+
+    if (r != 0)
+    {
+        l8w8jwt_mbedtls_free_key(k);
+        return L8W8JWT_KEY_PARSE_FAILURE;
+    }
+
+#if L8W8JWT_P256 || L8W8JWT_SECP256K1
+    const mbedtls_ecp_group_id ecc256_curve = l8w8jwt_mbedtls_ecc256_curve(alg);
+    if (ecc256_curve != MBEDTLS_ECP_DP_NONE && mbedtls_pk_can_do(k->pk, MBEDTLS_PK_ECDSA) && mbedtls_pk_ec(*k->pk)->MBEDTLS_PRIVATE(grp).id == ecc256_curve)
+    {
+        size_t public_key_length = 0;
+        mbedtls_ecp_keypair* ec = mbedtls_pk_ec(*k->pk);
+
+        r = mbedtls_ecp_point_write_binary(&ec->MBEDTLS_PRIVATE(grp), &ec->MBEDTLS_PRIVATE(Q), MBEDTLS_ECP_PF_UNCOMPRESSED, &public_key_length, k->ecc256_public_key, sizeof(k->ecc256_public_key));
+        k->ecc256_alg = r == 0 && public_key_length == sizeof(k->ecc256_public_key) ? alg : 0;
+    }
+#else
+    (void)alg;
+#endif
+
+    *out_key = k;
+    return L8W8JWT_SUCCESS;
+}
+
+static int l8w8jwt_mbedtls_sign(void* key, const int alg, const unsigned char* hash, const size_t hash_length, unsigned char* out, const size_t signature_length)
+{
+    int r;
+    struct l8w8jwt_mbedtls_key* k = (struct l8w8jwt_mbedtls_key*)key;
+
+    const mbedtls_md_type_t md_type = hash_length == 32 ? MBEDTLS_MD_SHA256 : hash_length == 48 ? MBEDTLS_MD_SHA384 : MBEDTLS_MD_SHA512;
+
+    mbedtls_ctr_drbg_context* ctr_drbg = NULL;
+
+    if (!k->deterministic_ecdsa && (ctr_drbg = l8w8jwt_mbedtls_ctr_drbg(k)) == NULL)
+    {
+        return L8W8JWT_SIGNATURE_CREATION_FAILURE;
+    }
+
+    switch (alg)
+    {
+        case L8W8JWT_ALG_RS256:
+        case L8W8JWT_ALG_RS384:
+        case L8W8JWT_ALG_RS512: {
+
+            size_t written_signature_length = 0;
+
+            /* Sign the hash using the provided private key. */
+            r = mbedtls_pk_sign(k->pk, md_type, hash, hash_length, out, signature_length, &written_signature_length, mbedtls_ctr_drbg_random, ctr_drbg);
+            if (r != 0 || written_signature_length != signature_length)
+            {
+                return L8W8JWT_SIGNATURE_CREATION_FAILURE;
+            }
+
+            return L8W8JWT_SUCCESS;
+        }
+        case L8W8JWT_ALG_PS256:
+        case L8W8JWT_ALG_PS384:
+        case L8W8JWT_ALG_PS512: {
+
+            mbedtls_rsa_context* rsa = mbedtls_pk_rsa(*k->pk);
+            mbedtls_rsa_set_padding(rsa, MBEDTLS_RSA_PKCS_V21, md_type);
+
+            r = mbedtls_rsa_rsassa_pss_sign(rsa, mbedtls_ctr_drbg_random, ctr_drbg, md_type, (unsigned int)hash_length, hash, out);
+            if (r != 0)
+            {
+                return L8W8JWT_SIGNATURE_CREATION_FAILURE;
+            }
+
+            return L8W8JWT_SUCCESS;
+        }
+        case L8W8JWT_ALG_ES256:
+        case L8W8JWT_ALG_ES384:
+        case L8W8JWT_ALG_ES512:
+        case L8W8JWT_ALG_ES256K: {
+
+#if L8W8JWT_P256
+            if (k->ecc256_alg == L8W8JWT_ALG_ES256 && alg == L8W8JWT_ALG_ES256 && hash_length == 32 && signature_length == 64)
+            {
+                r = k->deterministic_ecdsa ? l8w8jwt_p256_sign_deterministic(out, k->ecc256_private_key, hash) : l8w8jwt_p256_sign(out, k->ecc256_private_key, hash, mbedtls_ctr_drbg_random, ctr_drbg);
+                return r == 0 ? L8W8JWT_SUCCESS : L8W8JWT_SIGNATURE_CREATION_FAILURE;
+            }
+#endif
+#if L8W8JWT_SECP256K1
+            if (k->ecc256_alg == L8W8JWT_ALG_ES256K && alg == L8W8JWT_ALG_ES256K && hash_length == 32 && signature_length == 64)
+            {
+                r = k->deterministic_ecdsa ? l8w8jwt_secp256k1_sign_deterministic(out, k->ecc256_private_key, hash) : l8w8jwt_secp256k1_sign(out, k->ecc256_private_key, hash, mbedtls_ctr_drbg_random, ctr_drbg);
+                return r == 0 ? L8W8JWT_SUCCESS : L8W8JWT_SIGNATURE_CREATION_FAILURE;
+            }
+#endif
+            mbedtls_ecp_keypair* ec = mbedtls_pk_ec(*k->pk);
+            const size_t half_signature_length = signature_length / 2;
+
+            /* r and s: the thread's bignum temporaries keep their limbs allocated from one signature to the next. */
+            mbedtls_mpi own_sig[2];
+            mbedtls_mpi* sig = l8w8jwt_thread_mpis();
+
+            if (sig == NULL)
+            {
+                sig = own_sig;
+                mbedtls_mpi_init(&sig[0]);
+                mbedtls_mpi_init(&sig[1]);
+            }
+
+            if (k->deterministic_ecdsa)
+            {
+                r = mbedtls_ecdsa_sign_det_ext(&ec->MBEDTLS_PRIVATE(grp), &sig[0], &sig[1], &ec->MBEDTLS_PRIVATE(d), hash, hash_length, md_type, mbedtls_hmac_drbg_random, &k->hmac_drbg);
+            }
+            else
+            {
+                r = mbedtls_ecdsa_sign(&ec->MBEDTLS_PRIVATE(grp), &sig[0], &sig[1], &ec->MBEDTLS_PRIVATE(d), hash, hash_length, mbedtls_ctr_drbg_random, ctr_drbg);
+            }
+
+            if (r == 0)
+            {
+                r = mbedtls_mpi_write_binary(&sig[0], out, half_signature_length);
+            }
+
+            if (r == 0)
+            {
+                r = mbedtls_mpi_write_binary(&sig[1], out + half_signature_length, half_signature_length);
+            }
+
+            if (sig == own_sig)
+            {
+                mbedtls_mpi_free(&sig[0]);
+                mbedtls_mpi_free(&sig[1]);
+            }
+
+            return r == 0 ? L8W8JWT_SUCCESS : L8W8JWT_SIGNATURE_CREATION_FAILURE;
+        }
+        default: {
+            return L8W8JWT_INVALID_ARG;
+        }
+    }
+}
+
+/* Checks that a parsed key can be used with the passed alg (RSA: type and minimum size; ECDSA: the exact curve), just like the OpenSSL provider does. */
+static int l8w8jwt_mbedtls_key_fits_alg(const mbedtls_pk_context* pk, const int alg)
+{
+    mbedtls_ecp_group_id expected_curve;
+
+    switch (alg)
+    {
+        case L8W8JWT_ALG_RS256:
+        case L8W8JWT_ALG_RS384:
+        case L8W8JWT_ALG_RS512:
+            /* Weak RSA keys are forbidden! */
+            return mbedtls_pk_can_do(pk, MBEDTLS_PK_RSA) && mbedtls_pk_get_bitlen(pk) >= 2048;
+        case L8W8JWT_ALG_PS256:
+        case L8W8JWT_ALG_PS384:
+        case L8W8JWT_ALG_PS512:
+            return mbedtls_pk_can_do(pk, MBEDTLS_PK_RSASSA_PSS) && mbedtls_pk_get_bitlen(pk) >= 2048;
+        case L8W8JWT_ALG_ES256:
+            expected_curve = MBEDTLS_ECP_DP_SECP256R1;
+            break;
+        case L8W8JWT_ALG_ES256K:
+            expected_curve = MBEDTLS_ECP_DP_SECP256K1;
+            break;
+        case L8W8JWT_ALG_ES384:
+            expected_curve = MBEDTLS_ECP_DP_SECP384R1;
+            break;
+        case L8W8JWT_ALG_ES512:
+            expected_curve = MBEDTLS_ECP_DP_SECP521R1;
+            break;
+        default:
+            return 0;
+    }
+
+    return mbedtls_pk_can_do(pk, MBEDTLS_PK_ECDSA) && mbedtls_pk_ec(*pk)->MBEDTLS_PRIVATE(grp).id == expected_curve;
+}
+
+/* Maps the outcome of an MbedTLS verification to what verify() returns: a failed allocation means that the signature couldn't be checked, anything else that it doesn't match. */
+static int l8w8jwt_mbedtls_verify_result(const int r)
+{
+    if (r == 0)
+    {
+        return 0;
+    }
+
+    /* MbedTLS error codes are the sum of a high-level (bits 7-14) and a low-level (bits 1-6) error. */
+    const int low_level = -r & 0x007F;
+    const int high_level = -r & 0x7F80;
+
+    if (low_level == -MBEDTLS_ERR_MPI_ALLOC_FAILED || high_level == -MBEDTLS_ERR_ECP_ALLOC_FAILED || high_level == -MBEDTLS_ERR_PK_ALLOC_FAILED)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    return 1;
+}
+
+static int l8w8jwt_mbedtls_verify(void* key, const int alg, const unsigned char* hash, const size_t hash_length, const unsigned char* signature, const size_t signature_length)
+{
+    int r;
+    struct l8w8jwt_mbedtls_key* k = (struct l8w8jwt_mbedtls_key*)key;
+
+    const mbedtls_md_type_t md_type = hash_length == 32 ? MBEDTLS_MD_SHA256 : hash_length == 48 ? MBEDTLS_MD_SHA384 : MBEDTLS_MD_SHA512;
+
+    if (!l8w8jwt_mbedtls_key_fits_alg(k->pk, alg))
+    {
+        return 1;
+    }
+
+    switch (alg)
+    {
+        case L8W8JWT_ALG_RS256:
+        case L8W8JWT_ALG_RS384:
+        case L8W8JWT_ALG_RS512: {
+            return l8w8jwt_mbedtls_verify_result(mbedtls_pk_verify(k->pk, md_type, hash, hash_length, signature, signature_length));
+        }
+        case L8W8JWT_ALG_PS256:
+        case L8W8JWT_ALG_PS384:
+        case L8W8JWT_ALG_PS512: {
+
+            mbedtls_rsa_context* rsa = mbedtls_pk_rsa(*k->pk);
+            if (signature_length != mbedtls_rsa_get_len(rsa))
+            {
+                return 1;
+            }
+
+            mbedtls_rsa_set_padding(rsa, MBEDTLS_RSA_PKCS_V21, md_type);
+
+            return l8w8jwt_mbedtls_verify_result(mbedtls_rsa_rsassa_pss_verify(rsa, md_type, (unsigned int)hash_length, hash, signature));
+        }
+        case L8W8JWT_ALG_ES256:
+        case L8W8JWT_ALG_ES256K:
+        case L8W8JWT_ALG_ES384:
+        case L8W8JWT_ALG_ES512: {
+
+#if L8W8JWT_P256
+            if (k->ecc256_alg == L8W8JWT_ALG_ES256 && alg == L8W8JWT_ALG_ES256 && hash_length == 32 && signature_length == 64)
+            {
+                if (k->ecc256_table != NULL)
+                {
+                    return l8w8jwt_p256_verify_precomputed(k->ecc256_table, hash, signature);
+                }
+
+                return l8w8jwt_p256_verify(k->ecc256_public_key + 1, hash, signature);
+            }
+#endif
+#if L8W8JWT_SECP256K1
+            if (k->ecc256_alg == L8W8JWT_ALG_ES256K && alg == L8W8JWT_ALG_ES256K && hash_length == 32 && signature_length == 64)
+            {
+                if (k->ecc256_table != NULL)
+                {
+                    return l8w8jwt_secp256k1_verify_precomputed(k->ecc256_table, hash, signature);
+                }
+
+                return l8w8jwt_secp256k1_verify(k->ecc256_public_key + 1, hash, signature);
+            }
+#endif
+            const size_t half_signature_length = signature_length / 2;
+
+            mbedtls_ecdsa_context ecdsa;
+            mbedtls_ecdsa_init(&ecdsa);
+
+            mbedtls_mpi own_sig[2];
+            mbedtls_mpi* sig = l8w8jwt_thread_mpis();
+
+            if (sig == NULL)
+            {
+                sig = own_sig;
+                mbedtls_mpi_init(&sig[0]);
+                mbedtls_mpi_init(&sig[1]);
+            }
+
+            r = mbedtls_ecdsa_from_keypair(&ecdsa, mbedtls_pk_ec(*k->pk));
+            r = r != 0 ? r : mbedtls_mpi_read_binary(&sig[0], signature, half_signature_length);
+            r = r != 0 ? r : mbedtls_mpi_read_binary(&sig[1], signature + half_signature_length, half_signature_length);
+            r = r != 0 ? r : mbedtls_ecdsa_verify(&ecdsa.MBEDTLS_PRIVATE(grp), hash, hash_length, &ecdsa.MBEDTLS_PRIVATE(Q), &sig[0], &sig[1]);
+
+            mbedtls_ecdsa_free(&ecdsa);
+
+            if (sig == own_sig)
+            {
+                mbedtls_mpi_free(&sig[0]);
+                mbedtls_mpi_free(&sig[1]);
+            }
+
+            return l8w8jwt_mbedtls_verify_result(r);
+        }
+        default: {
+            return 1;
+        }
+    }
+}
+
+#if defined(MBEDTLS_ECP_RESTARTABLE) && !defined(__STDC_NO_ATOMICS__)
+/*
+ * The op budget is a process-wide MbedTLS setting (and there's no getter for it).
+ * Steps hold this lock from setting their budget until they've reset it to the default (0, i.e. unlimited),
+ * so that steps on different threads don't run with each other's budget and nothing else restartable ends up with a stale one.
+ */
+static atomic_flag l8w8jwt_mbedtls_ecp_budget_lock = ATOMIC_FLAG_INIT;
+
+/* State of a step-wise ECDSA verification: everything that mbedtls_ecdsa_verify_restartable() needs to see unchanged from one call to the next. */
+struct l8w8jwt_mbedtls_restart_ctx
+{
+    mbedtls_ecdsa_restart_ctx rs_ctx;
+    mbedtls_ecp_group grp;
+    mbedtls_ecp_point Q;
+    mbedtls_mpi r;
+    mbedtls_mpi s;
+};
+
+static void l8w8jwt_mbedtls_free_restart_ctx(void* restart_ctx)
+{
+    struct l8w8jwt_mbedtls_restart_ctx* ctx = (struct l8w8jwt_mbedtls_restart_ctx*)restart_ctx;
+    if (ctx == NULL)
+    {
+        return;
+    }
+
+    mbedtls_ecdsa_restart_free(&ctx->rs_ctx);
+    mbedtls_ecp_group_free(&ctx->grp);
+    mbedtls_ecp_point_free(&ctx->Q);
+    mbedtls_mpi_free(&ctx->r);
+    mbedtls_mpi_free(&ctx->s);
+    l8w8jwt_free(ctx);
+}
+
+static int l8w8jwt_mbedtls_verify_restartable(void* key, const int alg, const unsigned char* hash, const size_t hash_length, const unsigned char* signature, const size_t signature_length, const unsigned int max_ops, void** restart_ctx)
+{
+    struct l8w8jwt_mbedtls_key* k = (struct l8w8jwt_mbedtls_key*)key;
+    struct l8w8jwt_mbedtls_restart_ctx* ctx = (struct l8w8jwt_mbedtls_restart_ctx*)*restart_ctx;
+
+    /* Keys that don't fit the alg are turned down by l8w8jwt_mbedtls_verify(). */
+    int restartable = (alg == L8W8JWT_ALG_ES256 || alg == L8W8JWT_ALG_ES256K || alg == L8W8JWT_ALG_ES384 || alg == L8W8JWT_ALG_ES512) && l8w8jwt_mbedtls_key_fits_alg(k->pk, alg);
+
+#if L8W8JWT_P256 || L8W8JWT_SECP256K1
+    /* The dedicated 256-bit engines are fast enough to run in one go. */
+    restartable = restartable && !(k->ecc256_alg == alg && hash_length == 32 && signature_length == 64);
+#endif
+
+    if (!restartable)
+    {
+        return l8w8jwt_mbedtls_verify(key, alg, hash, hash_length, signature, signature_length);
+    }
+
+    int r;
+
+    if (ctx == NULL)
+    {
+        ctx = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_mbedtls_restart_ctx));
+        if (ctx == NULL)
+        {
+            return L8W8JWT_OUT_OF_MEM;
+        }
+
+        mbedtls_ecdsa_restart_init(&ctx->rs_ctx);
+        mbedtls_ecp_group_init(&ctx->grp);
+        mbedtls_ecp_point_init(&ctx->Q);
+        mbedtls_mpi_init(&ctx->r);
+        mbedtls_mpi_init(&ctx->s);
+
+        *restart_ctx = ctx;
+
+        const mbedtls_ecp_keypair* ec = mbedtls_pk_ec(*k->pk);
+        const size_t half_signature_length = signature_length / 2;
+
+        r = mbedtls_ecp_group_copy(&ctx->grp, &ec->MBEDTLS_PRIVATE(grp));
+        r = r != 0 ? r : mbedtls_ecp_copy(&ctx->Q, &ec->MBEDTLS_PRIVATE(Q));
+        r = r != 0 ? r : mbedtls_mpi_read_binary(&ctx->r, signature, half_signature_length);
+        r = r != 0 ? r : mbedtls_mpi_read_binary(&ctx->s, signature + half_signature_length, half_signature_length);
+
+        if (r != 0)
+        {
+            return l8w8jwt_mbedtls_verify_result(r);
+        }
+    }
+
+    /* The budget only applies to operations with a restart context, so regular verifications on other threads aren't affected by it in the meantime. */
+    l8w8jwt_spinlock_lock(&l8w8jwt_mbedtls_ecp_budget_lock);
+    mbedtls_ecp_set_max_ops(max_ops);
+
+    r = mbedtls_ecdsa_verify_restartable(&ctx->grp, hash, hash_length, &ctx->Q, &ctx->r, &ctx->s, &ctx->rs_ctx);
+
+    mbedtls_ecp_set_max_ops(0);
+    l8w8jwt_spinlock_unlock(&l8w8jwt_mbedtls_ecp_budget_lock);
+
+    return r == MBEDTLS_ERR_ECP_IN_PROGRESS ? L8W8JWT_IN_PROGRESS : l8w8jwt_mbedtls_verify_result(r);
+}
+#endif
+
+#if L8W8JWT_P256 || L8W8JWT_SECP256K1
+static int l8w8jwt_mbedtls_precompute_verification_key(void* key, const int alg, const size_t max_table_size, size_t* out_table_size)
+{
+    struct l8w8jwt_mbedtls_key* k = (struct l8w8jwt_mbedtls_key*)key;
+
+    size_t table_size = 0;
+    int (*precompute)(void*, const unsigned char*) = NULL;
+
+    *out_table_size = 0;
+
+#if L8W8JWT_P256
+    if (k->ecc256_alg == L8W8JWT_ALG_ES256 && alg == L8W8JWT_ALG_ES256)
+    {
+        table_size = L8W8JWT_P256_TABLE_SIZE;
+        precompute = &l8w8jwt_p256_precompute;
+    }
+#endif
+#if L8W8JWT_SECP256K1
+    if (k->ecc256_alg == L8W8JWT_ALG_ES256K && alg == L8W8JWT_ALG_ES256K)
+    {
+        table_size = L8W8JWT_SECP256K1_TABLE_SIZE;
+        precompute = &l8w8jwt_secp256k1_precompute;
+    }
+#endif
+
+    if (precompute == NULL || table_size > max_table_size || k->ecc256_table != NULL)
+    {
+        return L8W8JWT_SUCCESS;
+    }
+
+    void* table = l8w8jwt_malloc(table_size);
+    if (table == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    if (precompute(table, k->ecc256_public_key + 1) != 0)
+    {
+        l8w8jwt_free(table);
+        return L8W8JWT_KEY_PARSE_FAILURE;
+    }
+
+    k->ecc256_table = table;
+    *out_table_size = table_size;
+    return L8W8JWT_SUCCESS;
+}
+#endif
+
+#if L8W8JWT_P256
+static int l8w8jwt_mbedtls_sign_presigned(void* key, const int alg, const unsigned char* hash, const size_t hash_length, const unsigned char* presignature, unsigned char* out, const size_t signature_length)
+{
+    struct l8w8jwt_mbedtls_key* k = (struct l8w8jwt_mbedtls_key*)key;
+
+    if (k->ecc256_alg != L8W8JWT_ALG_ES256 || k->deterministic_ecdsa || alg != L8W8JWT_ALG_ES256 || hash_length != 32 || signature_length != 64)
+    {
+        return L8W8JWT_UNSUPPORTED_ALG;
+    }
+
+    return l8w8jwt_p256_sign_presigned(out, k->ecc256_private_key, hash, presignature) == 0 ? L8W8JWT_SUCCESS : L8W8JWT_SIGNATURE_CREATION_FAILURE;
+}
+#endif
+
+const struct l8w8jwt_crypto_provider l8w8jwt_crypto_provider_mbedtls = {
+    .id = L8W8JWT_CRYPTO_PROVIDER_MBEDTLS,
+    .hash = &l8w8jwt_mbedtls_hash,
+    .hmac = &l8w8jwt_mbedtls_hmac,
+    .load_signing_key = &l8w8jwt_mbedtls_load_signing_key,
+    .load_verification_key = &l8w8jwt_mbedtls_load_verification_key,
+    .sign = &l8w8jwt_mbedtls_sign,
+#if L8W8JWT_P256
+    .sign_presigned = &l8w8jwt_mbedtls_sign_presigned,
+#endif
+    .verify = &l8w8jwt_mbedtls_verify,
+#if defined(MBEDTLS_ECP_RESTARTABLE) && !defined(__STDC_NO_ATOMICS__)
+    .verify_restartable = &l8w8jwt_mbedtls_verify_restartable,
+    .free_restart_ctx = &l8w8jwt_mbedtls_free_restart_ctx,
+#endif
+#if L8W8JWT_P256 || L8W8JWT_SECP256K1
+    .precompute_verification_key = &l8w8jwt_mbedtls_precompute_verification_key,
+#endif
+    .free_key = &l8w8jwt_mbedtls_free_key,
+};
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
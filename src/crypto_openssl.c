@@ -0,0 +1,462 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/algs.h"
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/retcodes.h"
+#include "crypto_provider.h"
+
+#if L8W8JWT_ENABLE_OPENSSL_PROVIDER
+
+#include <stdint.h>
+#include <string.h>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/rsa.h>
+#include <openssl/hmac.h>
+#include <openssl/x509.h>
+#include <openssl/objects.h>
+#include <openssl/core_names.h>
+#include <openssl/decoder.h>
+
+static const EVP_MD* l8w8jwt_openssl_md(const mbedtls_md_type_t md_type)
+{
+    switch (md_type)
+    {
+        case MBEDTLS_MD_SHA256:
+            return EVP_sha256();
+        case MBEDTLS_MD_SHA384:
+            return EVP_sha384();
+        case MBEDTLS_MD_SHA512:
+            return EVP_sha512();
+        default:
+            return NULL;
+    }
+}
+
+static const EVP_MD* l8w8jwt_openssl_md_from_hash_length(const size_t hash_length)
+{
+    return l8w8jwt_openssl_md(hash_length == 32 ? MBEDTLS_MD_SHA256 : hash_length == 48 ? MBEDTLS_MD_SHA384 : hash_length == 64 ? MBEDTLS_MD_SHA512 : MBEDTLS_MD_NONE);
+}
+
+static inline int is_rsa_alg(const int alg)
+{
+    return alg >= L8W8JWT_ALG_RS256 && alg <= L8W8JWT_ALG_PS512;
+}
+
+static inline int is_pss_alg(const int alg)
+{
+    return alg >= L8W8JWT_ALG_PS256 && alg <= L8W8JWT_ALG_PS512;
+}
+
+/* Checks that an EVP_PKEY can be used with the passed alg (RSA: type and minimum size; ECDSA: the exact curve). */
+static int l8w8jwt_openssl_key_fits_alg(EVP_PKEY* pkey, const int alg)
+{
+    const int type = EVP_PKEY_get_base_id(pkey);
+
+    if (is_rsa_alg(alg))
+    {
+        /* Weak RSA keys are forbidden! */
+        return (type == EVP_PKEY_RSA || (type == EVP_PKEY_RSA_PSS && is_pss_alg(alg))) && EVP_PKEY_get_bits(pkey) >= 2048;
+    }
+
+    int expected_curve;
+
+    switch (alg)
+    {
+        case L8W8JWT_ALG_ES256:
+            expected_curve = NID_X9_62_prime256v1;
+            break;
+        case L8W8JWT_ALG_ES256K:
+            expected_curve = NID_secp256k1;
+            break;
+        case L8W8JWT_ALG_ES384:
+            expected_curve = NID_secp384r1;
+            break;
+        case L8W8JWT_ALG_ES512:
+            expected_curve = NID_secp521r1;
+            break;
+        default:
+            return 0;
+    }
+
+    char group_name[64] = { 0x00 };
+    size_t group_name_length = 0;
+
+    if (type != EVP_PKEY_EC || EVP_PKEY_get_group_name(pkey, group_name, sizeof(group_name), &group_name_length) != 1)
+    {
+        return 0;
+    }
+
+    return OBJ_txt2nid(group_name) == expected_curve;
+}
+
+static int l8w8jwt_openssl_hash(const mbedtls_md_type_t md_type, const unsigned char* data, const size_t data_length, unsigned char* out)
+{
+    const EVP_MD* md = l8w8jwt_openssl_md(md_type);
+    return md != NULL && EVP_Digest(data, data_length, out, NULL, md, NULL) == 1 ? 0 : -1;
+}
+
+static int l8w8jwt_openssl_hmac(const mbedtls_md_type_t md_type, const unsigned char* key, const size_t key_length, const unsigned char* data, const size_t data_length, unsigned char* out)
+{
+    const EVP_MD* md = l8w8jwt_openssl_md(md_type);
+    if (md == NULL || key_length > INT32_MAX)
+    {
+        return -1;
+    }
+
+    /* HMAC() needs a non-NULL key pointer, even for empty keys. */
+    return HMAC(md, key != NULL ? key : (const unsigned char*)"", (int)key_length, data, data_length, out, NULL) != NULL ? 0 : -1;
+}
+
+struct l8w8jwt_openssl_password
+{
+    const unsigned char* password;
+    size_t password_length;
+};
+
+/* Never let OpenSSL fall back to prompting for a password on the terminal. */
+static int l8w8jwt_openssl_password_callback(char* buffer, const int buffer_size, const int rwflag, void* usr)
+{
+    (void)rwflag;
+    const struct l8w8jwt_openssl_password* pw = (const struct l8w8jwt_openssl_password*)usr;
+
+    if (pw == NULL || pw->password == NULL || pw->password_length == 0 || pw->password_length > (size_t)buffer_size)
+    {
+        return 0;
+    }
+
+    memcpy(buffer, pw->password, pw->password_length);
+    return (int)pw->password_length;
+}
+
+/* Key handle of the OpenSSL provider. */
+struct l8w8jwt_openssl_key
+{
+    EVP_PKEY* pkey;
+
+    /* Whether ECDSA signatures use RFC 6979 nonces (signing keys only). */
+    int deterministic_ecdsa;
+};
+
+/* Wraps (and takes ownership of) a parsed EVP_PKEY into a key handle. */
+static int l8w8jwt_openssl_key_new(EVP_PKEY* pkey, const int deterministic_ecdsa, void** out_key)
+{
+    struct l8w8jwt_openssl_key* k = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_openssl_key));
+    if (k == NULL)
+    {
+        EVP_PKEY_free(pkey);
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    k->pkey = pkey;
+    k->deterministic_ecdsa = deterministic_ecdsa;
+
+    *out_key = k;
+    return L8W8JWT_SUCCESS;
+}
+
+static void l8w8jwt_openssl_free_key(void* key)
+{
+    struct l8w8jwt_openssl_key* k = (struct l8w8jwt_openssl_key*)key;
+    if (k == NULL)
+    {
+        return;
+    }
+
+    EVP_PKEY_free(k->pkey);
+    l8w8jwt_free(k);
+}
+
+static int l8w8jwt_openssl_load_signing_key(const int alg, const int deterministic_ecdsa, const unsigned char* key, const size_t key_length, const unsigned char* key_pw, const size_t key_pw_length, void** out_key, size_t* out_signature_length)
+{
+#ifndef OSSL_SIGNATURE_PARAM_NONCE_TYPE
+    /* RFC 6979 nonces are only available since OpenSSL 3.2. */
+    if (deterministic_ecdsa && !is_rsa_alg(alg))
+    {
+        return L8W8JWT_UNSUPPORTED_ALG;
+    }
+#endif
+
+    BIO* bio = BIO_new_mem_buf(key, (int)key_length);
+    if (bio == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    struct l8w8jwt_openssl_password pw = { .password = key_pw, .password_length = key_pw_length };
+
+    EVP_PKEY* pkey = PEM_read_bio_PrivateKey(bio, NULL, &l8w8jwt_openssl_password_callback, &pw);
+    BIO_free(bio);
+
+    if (pkey == NULL)
+    {
+        return L8W8JWT_KEY_PARSE_FAILURE;
+    }
+
+    if (!l8w8jwt_openssl_key_fits_alg(pkey, alg))
+    {
+        EVP_PKEY_free(pkey);
+        return L8W8JWT_WRONG_KEY_TYPE;
+    }
+
+    switch (alg)
+    {
+        case L8W8JWT_ALG_ES256:
+        case L8W8JWT_ALG_ES256K:
+            *out_signature_length = 64;
+            break;
+        case L8W8JWT_ALG_ES384:
+            *out_signature_length = 96;
+            break;
+        case L8W8JWT_ALG_ES512:
+            *out_signature_length = 132;
+            break;
+        default:
+            *out_signature_length = (size_t)EVP_PKEY_get_size(pkey);
+            break;
+    }
+
+    return l8w8jwt_openssl_key_new(pkey, deterministic_ecdsa, out_key);
+}
+
+static int l8w8jwt_openssl_load_verification_key(const int alg, const unsigned char* key, const size_t key_length, void** out_key)
+{
+    (void)alg;
+
+    BIO* bio = BIO_new_mem_buf(key, (int)key_length);
+    if (bio == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    EVP_PKEY* pkey = NULL;
+
+    // If the validation PEM is a X.509 certificate, its public key is used.
+    if (strstr((const char*)key, "-----BEGIN CERTIFICATE-----") != NULL)
+    {
+        X509* crt = PEM_read_bio_X509(bio, NULL, NULL, NULL);
+        if (crt != NULL)
+        {
+            pkey = X509_get_pubkey(crt);
+            X509_free(crt);
+        }
+    }
+    else
+    {
+        /* Accepts SubjectPublicKeyInfo ("PUBLIC KEY") as well as PKCS#1 ("RSA PUBLIC KEY") PEMs, just like mbedtls_pk_parse_public_key() does. */
+        OSSL_DECODER_CTX* decoder = OSSL_DECODER_CTX_new_for_pkey(&pkey, "PEM", NULL, NULL, EVP_PKEY_PUBLIC_KEY, NULL, NULL);
+        if (decoder != NULL)
+        {
+            if (OSSL_DECODER_from_bio(decoder, bio) != 1)
+            {
+                EVP_PKEY_free(pkey);
+                pkey = NULL;
+            }
+
+            OSSL_DECODER_CTX_free(decoder);
+        }
+    }
+
+    BIO_free(bio);
+
+    if (pkey == NULL)
+    {
+        return L8W8JWT_KEY_PARSE_FAILURE;
+    }
+
+    return l8w8jwt_openssl_key_new(pkey, 0, out_key);
+}
+
+/* Creates a signing/verification context for the passed key + alg. */
+static EVP_PKEY_CTX* l8w8jwt_openssl_pkey_ctx(EVP_PKEY* pkey, const int alg, const size_t hash_length, const int verify)
+{
+    const EVP_MD* md = l8w8jwt_openssl_md_from_hash_length(hash_length);
+    if (md == NULL)
+    {
+        return NULL;
+    }
+
+    EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new(pkey, NULL);
+    if (ctx == NULL)
+    {
+        return NULL;
+    }
+
+    if ((verify ? EVP_PKEY_verify_init(ctx) : EVP_PKEY_sign_init(ctx)) != 1 || EVP_PKEY_CTX_set_signature_md(ctx, md) <= 0)
+    {
+        goto error;
+    }
+
+    if (is_rsa_alg(alg))
+    {
+        if (EVP_PKEY_CTX_set_rsa_padding(ctx, is_pss_alg(alg) ? RSA_PKCS1_PSS_PADDING : RSA_PKCS1_PADDING) <= 0)
+        {
+            goto error;
+        }
+
+        /* RFC 7518 wants the PSS salt to be as long as the hash; when verifying, any salt length is accepted (like MbedTLS does). */
+        if (is_pss_alg(alg) && EVP_PKEY_CTX_set_rsa_pss_saltlen(ctx, verify ? RSA_PSS_SALTLEN_AUTO : RSA_PSS_SALTLEN_DIGEST) <= 0)
+        {
+            goto error;
+        }
+    }
+
+    return ctx;
+
+error:
+    EVP_PKEY_CTX_free(ctx);
+    return NULL;
+}
+
+static int l8w8jwt_openssl_sign(void* key, const int alg, const unsigned char* hash, const size_t hash_length, unsigned char* out, const size_t signature_length)
+{
+    int r = L8W8JWT_SIGNATURE_CREATION_FAILURE;
+
+    const struct l8w8jwt_openssl_key* k = (const struct l8w8jwt_openssl_key*)key;
+
+    EVP_PKEY_CTX* ctx = l8w8jwt_openssl_pkey_ctx(k->pkey, alg, hash_length, 0);
+    if (ctx == NULL)
+    {
+        return r;
+    }
+
+    if (is_rsa_alg(alg))
+    {
+        size_t written_signature_length = signature_length;
+
+        if (EVP_PKEY_sign(ctx, out, &written_signature_length, hash, hash_length) == 1 && written_signature_length == signature_length)
+        {
+            r = L8W8JWT_SUCCESS;
+        }
+
+        EVP_PKEY_CTX_free(ctx);
+        return r;
+    }
+
+#ifdef OSSL_SIGNATURE_PARAM_NONCE_TYPE
+    if (k->deterministic_ecdsa)
+    {
+        unsigned int nonce_type = 1;
+        OSSL_PARAM params[] = { OSSL_PARAM_construct_uint(OSSL_SIGNATURE_PARAM_NONCE_TYPE, &nonce_type), OSSL_PARAM_construct_end() };
+
+        if (EVP_PKEY_CTX_set_params(ctx, params) != 1)
+        {
+            EVP_PKEY_CTX_free(ctx);
+            return r;
+        }
+    }
+#endif
+
+    /* OpenSSL outputs DER-encoded ECDSA signatures, whereas JWS wants the raw r || s. */
+    unsigned char der[160];
+    size_t der_length = sizeof(der);
+
+    if (EVP_PKEY_sign(ctx, der, &der_length, hash, hash_length) == 1)
+    {
+        const unsigned char* p = der;
+        ECDSA_SIG* sig = d2i_ECDSA_SIG(NULL, &p, (long)der_length);
+
+        const int half_signature_length = (int)(signature_length / 2);
+
+        if (sig != NULL && BN_bn2binpad(ECDSA_SIG_get0_r(sig), out, half_signature_length) == half_signature_length && BN_bn2binpad(ECDSA_SIG_get0_s(sig), out + half_signature_length, half_signature_length) == half_signature_length)
+        {
+            r = L8W8JWT_SUCCESS;
+        }
+
+        ECDSA_SIG_free(sig);
+    }
+
+    EVP_PKEY_CTX_free(ctx);
+    return r;
+}
+
+static int l8w8jwt_openssl_verify(void* key, const int alg, const unsigned char* hash, const size_t hash_length, const unsigned char* signature, const size_t signature_length)
+{
+    int r = 1;
+    EVP_PKEY* pkey = ((const struct l8w8jwt_openssl_key*)key)->pkey;
+
+    if (!l8w8jwt_openssl_key_fits_alg(pkey, alg))
+    {
+        return r;
+    }
+
+    /* The key fits the alg, so this can only fail for lack of resources. */
+    EVP_PKEY_CTX* ctx = l8w8jwt_openssl_pkey_ctx(pkey, alg, hash_length, 1);
+    if (ctx == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    if (is_rsa_alg(alg))
+    {
+        r = EVP_PKEY_verify(ctx, signature, signature_length, hash, hash_length) == 1 ? 0 : 1;
+        EVP_PKEY_CTX_free(ctx);
+        return r;
+    }
+
+    const size_t half_signature_length = signature_length / 2;
+
+    ECDSA_SIG* sig = ECDSA_SIG_new();
+    BIGNUM* sig_r = BN_bin2bn(signature, (int)half_signature_length, NULL);
+    BIGNUM* sig_s = BN_bin2bn(signature + half_signature_length, (int)half_signature_length, NULL);
+
+    if (sig != NULL && sig_r != NULL && sig_s != NULL && ECDSA_SIG_set0(sig, sig_r, sig_s) == 1)
+    {
+        /* Ownership of r and s was transferred to sig. */
+        sig_r = sig_s = NULL;
+
+        unsigned char* der = NULL;
+        const int der_length = i2d_ECDSA_SIG(sig, &der);
+
+        r = der_length > 0 ? (EVP_PKEY_verify(ctx, der, (size_t)der_length, hash, hash_length) == 1 ? 0 : 1) : L8W8JWT_OUT_OF_MEM;
+
+        OPENSSL_free(der);
+    }
+    else
+    {
+        r = L8W8JWT_OUT_OF_MEM;
+    }
+
+    BN_free(sig_r);
+    BN_free(sig_s);
+    ECDSA_SIG_free(sig);
+    EVP_PKEY_CTX_free(ctx);
+    return r;
+}
+
+const struct l8w8jwt_crypto_provider l8w8jwt_crypto_provider_openssl = {
+    .id = L8W8JWT_CRYPTO_PROVIDER_OPENSSL,
+    .hash = &l8w8jwt_openssl_hash,
+    .hmac = &l8w8jwt_openssl_hmac,
+    .load_signing_key = &l8w8jwt_openssl_load_signing_key,
+    .load_verification_key = &l8w8jwt_openssl_load_verification_key,
+    .sign = &l8w8jwt_openssl_sign,
+    .verify = &l8w8jwt_openssl_verify,
+    .free_key = &l8w8jwt_openssl_free_key,
+};
+
+#endif // L8W8JWT_ENABLE_OPENSSL_PROVIDER
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
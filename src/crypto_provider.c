@@ -0,0 +1,76 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/retcodes.h"
+#include "crypto_provider.h"
+
+static const struct l8w8jwt_crypto_provider* get_provider_by_id(const int provider)
+{
+    switch (provider)
+    {
+        case L8W8JWT_CRYPTO_PROVIDER_MBEDTLS:
+            return &l8w8jwt_crypto_provider_mbedtls;
+#if L8W8JWT_ENABLE_OPENSSL_PROVIDER
+        case L8W8JWT_CRYPTO_PROVIDER_OPENSSL:
+            return &l8w8jwt_crypto_provider_openssl;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+static const struct l8w8jwt_crypto_provider* active_provider = NULL;
+
+const struct l8w8jwt_crypto_provider* l8w8jwt_get_active_crypto_provider(void)
+{
+    if (active_provider == NULL)
+    {
+        const struct l8w8jwt_crypto_provider* default_provider = get_provider_by_id(L8W8JWT_DEFAULT_CRYPTO_PROVIDER);
+        return default_provider != NULL ? default_provider : &l8w8jwt_crypto_provider_mbedtls;
+    }
+
+    return active_provider;
+}
+
+int l8w8jwt_set_crypto_provider(const int provider)
+{
+    if (provider != L8W8JWT_CRYPTO_PROVIDER_MBEDTLS && provider != L8W8JWT_CRYPTO_PROVIDER_OPENSSL)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    const struct l8w8jwt_crypto_provider* p = get_provider_by_id(provider);
+    if (p == NULL)
+    {
+        return L8W8JWT_UNSUPPORTED_ALG;
+    }
+
+    active_provider = p;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_get_crypto_provider(void)
+{
+    return l8w8jwt_get_active_crypto_provider()->id;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
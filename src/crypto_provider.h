@@ -0,0 +1,149 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file crypto_provider.h
+ *  @author Raphael Beck
+ *  @brief Internal crypto provider interface: the hash, HMAC and RSA/PSS/ECDSA key handling that encoding and decoding dispatch through. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_CRYPTO_PROVIDER_H
+#define L8W8JWT_CRYPTO_PROVIDER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/provider.h"
+
+#include <stddef.h>
+#include <mbedtls/md.h>
+
+/**
+ * A crypto provider's function table. <p>
+ * EdDSA is not part of it: Ed25519 keys come in the Ref10 format, which only lib/ed25519 (and the <code>L8W8JWT_ED25519_FE51</code> backend) understands, so that is used regardless of the selected provider. <p>
+ * Keys are opaque provider-specific handles: load them once, use them for any number of signatures/verifications, then free them.
+ */
+struct l8w8jwt_crypto_provider
+{
+    /**
+     * Provider ID (<code>L8W8JWT_CRYPTO_PROVIDER_MBEDTLS</code> or <code>L8W8JWT_CRYPTO_PROVIDER_OPENSSL</code>).
+     */
+    int id;
+
+    /**
+     * One-shot SHA-256/384/512. Returns <code>0</code> on success.
+     */
+    int (*hash)(mbedtls_md_type_t md_type, const unsigned char* data, size_t data_length, unsigned char* out);
+
+    /**
+     * One-shot HMAC-SHA-256/384/512. Returns <code>0</code> on success.
+     */
+    int (*hmac)(mbedtls_md_type_t md_type, const unsigned char* key, size_t key_length, const unsigned char* data, size_t data_length, unsigned char* out);
+
+    /**
+     * Parses a PEM-formatted private key (NUL-terminated, \p key_length includes the NUL-terminator) and checks it against the alg. <p>
+     * If \p deterministic_ecdsa is non-zero, ECDSA signatures made with the key must use RFC 6979 nonces (providers that can't do that return <code>L8W8JWT_UNSUPPORTED_ALG</code>). <p>
+     * Returns an l8w8jwt return code (<code>L8W8JWT_KEY_PARSE_FAILURE</code>, <code>L8W8JWT_WRONG_KEY_TYPE</code>, ...); on success, the exact signature length is written into \p out_signature_length.
+     */
+    int (*load_signing_key)(int alg, int deterministic_ecdsa, const unsigned char* key, size_t key_length, const unsigned char* key_pw, size_t key_pw_length, void** out_key, size_t* out_signature_length);
+
+    /**
+     * Parses a PEM-formatted public key or X.509 certificate (NUL-terminated, \p key_length includes the NUL-terminator). <p>
+     * Returns an l8w8jwt return code. Whether the key fits the alg is only checked when verifying.
+     */
+    int (*load_verification_key)(int alg, const unsigned char* key, size_t key_length, void** out_key);
+
+    /**
+     * Signs a hash with a key from load_signing_key(), writing exactly \p signature_length bytes (RSA signature or raw ECDSA <code>r || s</code>). Returns an l8w8jwt return code.
+     */
+    int (*sign)(void* key, int alg, const unsigned char* hash, size_t hash_length, unsigned char* out, size_t signature_length);
+
+    /**
+     * [OPTIONAL] Finishes an ES256 signature from a 64-byte presignature (see {@link #l8w8jwt_p256_presign}); <code>NULL</code> if the provider can't do that. <p>
+     * Returns an l8w8jwt return code: on failure (e.g. <code>L8W8JWT_UNSUPPORTED_ALG</code> for keys that aren't handled by the P-256 engine), the caller signs normally instead.
+     */
+    int (*sign_presigned)(void* key, int alg, const unsigned char* hash, size_t hash_length, const unsigned char* presignature, unsigned char* out, size_t signature_length);
+
+    /**
+     * Verifies a signature over a hash. Returns <code>0</code> if the signature is valid and <code>1</code> if it isn't (including when the key doesn't fit the alg). <p>
+     * If the signature couldn't be checked at all (e.g. because an allocation failed), an l8w8jwt return code such as <code>L8W8JWT_OUT_OF_MEM</code> is returned instead.
+     */
+    int (*verify)(void* key, int alg, const unsigned char* hash, size_t hash_length, const unsigned char* signature, size_t signature_length);
+
+    /**
+     * [OPTIONAL] Like verify(), but performs at most about \p max_ops elliptic curve operations per call (<code>0</code> means no limit); <code>NULL</code> if the provider can't do that. <p>
+     * Returns <code>L8W8JWT_IN_PROGRESS</code> if the budget ran out, in which case it needs to be called again with the same arguments and \p restart_ctx
+     * (which points to <code>NULL</code> on the first call and is set up by the provider). Signatures that can't be verified step-wise are verified in one go.
+     * The restart context needs to be freed with free_restart_ctx() once done, whatever the outcome.
+     */
+    int (*verify_restartable)(void* key, int alg, const unsigned char* hash, size_t hash_length, const unsigned char* signature, size_t signature_length, unsigned int max_ops, void** restart_ctx);
+
+    /**
+     * [OPTIONAL] Frees a restart context of verify_restartable() (<code>NULL</code> is ignored).
+     */
+    void (*free_restart_ctx)(void* restart_ctx);
+
+    /**
+     * [OPTIONAL] Precomputes a table of public key multiples (of at most \p max_table_size bytes) for a key from load_verification_key(), which verify() then uses from there on;
+     * <code>NULL</code> if the provider can't do that. <p>
+     * Returns an l8w8jwt return code and writes the table size into \p out_table_size (<code>0</code> if the alg or key don't get a table, or if it wouldn't fit).
+     */
+    int (*precompute_verification_key)(void* key, int alg, size_t max_table_size, size_t* out_table_size);
+
+    /**
+     * Frees a key handle (<code>NULL</code> is ignored).
+     */
+    void (*free_key)(void* key);
+};
+
+/**
+ * A parsed verification key (see l8w8jwt/verification_key.h): the key handle and the provider that it belongs to.
+ */
+struct l8w8jwt_verification_key
+{
+    const struct l8w8jwt_crypto_provider* provider;
+    int alg;
+    void* key;
+    size_t table_size;
+
+    /* SHA-256 of the PEM (without NUL-terminator): identifies the key in the verification cache. */
+    unsigned char fingerprint[32];
+};
+
+/**
+ * The MbedTLS provider (always available).
+ */
+extern const struct l8w8jwt_crypto_provider l8w8jwt_crypto_provider_mbedtls;
+
+#if L8W8JWT_ENABLE_OPENSSL_PROVIDER
+/**
+ * The OpenSSL libcrypto provider.
+ */
+extern const struct l8w8jwt_crypto_provider l8w8jwt_crypto_provider_openssl;
+#endif
+
+/**
+ * Gets the currently selected crypto provider (see {@link #l8w8jwt_set_crypto_provider}).
+ * @return The active provider's function table (never <code>NULL</code>).
+ */
+const struct l8w8jwt_crypto_provider* l8w8jwt_get_active_crypto_provider(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_CRYPTO_PROVIDER_H
@@ -23,23 +23,29 @@ extern "C" {
 #include "l8w8jwt/util.h"
 #include "l8w8jwt/decode.h"
 #include "l8w8jwt/base64.h"
+#include "sha2.h"
+#include "psa_backend.h"
+#include "crypto_provider.h"
+#include "verification_cache_backend.h"
+#include "key_set_backend.h"
+#include "thread_context.h"
+#include "allocator_backend.h"
 
 #include <jsmn.h>
 #include <string.h>
 #include <inttypes.h>
 #include <checknum.h>
-#include <chillbuff.h>
-#include <mbedtls/pk.h>
 #include <mbedtls/md.h>
 #include <mbedtls/platform_util.h>
-#include <mbedtls/pk.h>
-#include <mbedtls/x509_crt.h>
 
 #if L8W8JWT_ENABLE_EDDSA
+#include "ed25519_fe51.h"
+#if !L8W8JWT_ED25519_FE51
 #include <ed25519.h>
 #endif
+#endif
 
-static inline void md_info_from_alg(const int alg, mbedtls_md_info_t** md_info, mbedtls_md_type_t* md_type, size_t* md_length)
+static inline void md_type_from_alg(const int alg, mbedtls_md_type_t* md_type, size_t* md_length)
 {
     switch (alg)
     {
@@ -50,7 +56,6 @@ static inline void md_info_from_alg(const int alg, mbedtls_md_info_t** md_info,
         case L8W8JWT_ALG_ES256K:
             *md_length = 32;
             *md_type = MBEDTLS_MD_SHA256;
-            *md_info = (mbedtls_md_info_t*)mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
             break;
 
         case L8W8JWT_ALG_HS384:
@@ -59,7 +64,6 @@ static inline void md_info_from_alg(const int alg, mbedtls_md_info_t** md_info,
         case L8W8JWT_ALG_ES384:
             *md_length = 48;
             *md_type = MBEDTLS_MD_SHA384;
-            *md_info = (mbedtls_md_info_t*)mbedtls_md_info_from_type(MBEDTLS_MD_SHA384);
             break;
 
         case L8W8JWT_ALG_HS512:
@@ -69,7 +73,6 @@ static inline void md_info_from_alg(const int alg, mbedtls_md_info_t** md_info,
         case L8W8JWT_ALG_ED25519:
             *md_length = 64;
             *md_type = MBEDTLS_MD_SHA512;
-            *md_info = (mbedtls_md_info_t*)mbedtls_md_info_from_type(MBEDTLS_MD_SHA512);
             break;
 
         default:
@@ -130,15 +133,16 @@ static char* l8w8jwt_unescape_string(char* out, const char* in, const size_t n)
 static int l8w8jwt_unescape_claim(struct l8w8jwt_claim* claim, const char* key, const size_t key_length, const char* value, const size_t value_length)
 {
     claim->key_length = 0;
-    claim->key = l8w8jwt_calloc(sizeof(char), key_length + 1);
+    claim->key = l8w8jwt_call_calloc(sizeof(char), key_length + 1);
 
     claim->value_length = 0;
-    claim->value = l8w8jwt_calloc(sizeof(char), value_length + 1);
+    claim->value = l8w8jwt_call_calloc(sizeof(char), value_length + 1);
 
     if (claim->key == NULL || claim->value == NULL)
     {
-        free(claim->key);
-        free(claim->value);
+        l8w8jwt_call_free(claim->key);
+        l8w8jwt_call_free(claim->value);
+        claim->key = claim->value = NULL;
         return L8W8JWT_OUT_OF_MEM;
     }
 
@@ -225,7 +229,7 @@ exit:
     return r;
 }
 
-static int l8w8jwt_parse_claims(chillbuff* buffer, char* json, const size_t json_length)
+static int l8w8jwt_parse_claims(struct l8w8jwt_call_buffer* buffer, char* json, const size_t json_length)
 {
     jsmn_parser parser;
     jsmn_init(&parser);
@@ -242,11 +246,23 @@ static int l8w8jwt_parse_claims(chillbuff* buffer, char* json, const size_t json
     }
 
     jsmntok_t _tokens[64];
-    jsmntok_t* tokens = r <= (sizeof(_tokens) / sizeof(_tokens[0])) ? _tokens : l8w8jwt_malloc(r * sizeof(jsmntok_t));
+    jsmntok_t* tokens = _tokens;
+    jsmntok_t* heap_tokens = NULL;
 
-    if (tokens == NULL)
+    if (r > (sizeof(_tokens) / sizeof(_tokens[0])))
     {
-        return L8W8JWT_OUT_OF_MEM;
+        /* The thread's token array is kept around for the next large token; only fall back to a one-off allocation without it. */
+        tokens = l8w8jwt_thread_tokens(r * sizeof(jsmntok_t));
+
+        if (tokens == NULL)
+        {
+            tokens = heap_tokens = l8w8jwt_call_malloc(r * sizeof(jsmntok_t));
+        }
+
+        if (tokens == NULL)
+        {
+            return L8W8JWT_OUT_OF_MEM;
+        }
     }
 
     jsmn_init(&parser);
@@ -254,7 +270,8 @@ static int l8w8jwt_parse_claims(chillbuff* buffer, char* json, const size_t json
 
     if (r < 0)
     {
-        return L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+        r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+        goto exit;
     }
 
     if (tokens->type != JSMN_OBJECT)
@@ -358,19 +375,23 @@ static int l8w8jwt_parse_claims(chillbuff* buffer, char* json, const size_t json
             goto exit;
         }
 
-        chillbuff_push_back(buffer, &claim, 1);
+        int pr = l8w8jwt_call_buffer_push_back(buffer, &claim, 1);
+        if (pr != L8W8JWT_SUCCESS)
+        {
+            l8w8jwt_call_free(claim.key);
+            l8w8jwt_call_free(claim.value);
+            r = pr;
+            goto exit;
+        }
     }
 
     r = L8W8JWT_SUCCESS;
 exit:
-    if (tokens != _tokens)
-    {
-        l8w8jwt_free(tokens);
-    }
+    l8w8jwt_call_free(heap_tokens);
     return r;
 }
 
-static void l8w8jwt_validate_claims(const struct l8w8jwt_decoding_params* params, const chillbuff* claims, enum l8w8jwt_validation_result* out_validation_result)
+static void l8w8jwt_validate_claims(const struct l8w8jwt_decoding_params* params, const struct l8w8jwt_call_buffer* claims, enum l8w8jwt_validation_result* out_validation_result)
 {
     size_t validation_length;
 
@@ -459,8 +480,221 @@ static void l8w8jwt_validate_claims(const struct l8w8jwt_decoding_params* params
             *out_validation_result |= (unsigned)L8W8JWT_TYP_FAILURE;
         }
     }
+
+    if (params->revocation_filter != NULL)
+    {
+        struct l8w8jwt_claim* jti = l8w8jwt_get_claim(claims->array, claims->length, "jti", 3);
+        struct l8w8jwt_claim* iss = l8w8jwt_get_claim(claims->array, claims->length, "iss", 3);
+        struct l8w8jwt_claim* sub = l8w8jwt_get_claim(claims->array, claims->length, "sub", 3);
+
+        const char* jti_value = jti != NULL ? jti->value : NULL;
+        const char* iss_value = iss != NULL ? iss->value : NULL;
+        const char* sub_value = sub != NULL ? sub->value : NULL;
+
+        if (l8w8jwt_revocation_filter_check(params->revocation_filter, jti_value, jti != NULL ? jti->value_length : 0, iss_value, iss != NULL ? iss->value_length : 0, sub_value, sub != NULL ? sub->value_length : 0))
+        {
+            *out_validation_result |= (unsigned)L8W8JWT_REVOKED;
+        }
+    }
+}
+
+/*
+ * Selects the key that the token needs to be verified with from the key set (by the "kid" header claim) and points out_params (a copy of params) to it.
+ * The key set reader needs to be released afterwards, whatever the outcome.
+ */
+static int l8w8jwt_select_key_set_key(const struct l8w8jwt_decoding_params* params, struct l8w8jwt_decoding_params* out_params, int* out_key_found)
+{
+    *out_params = *params;
+    out_params->key_set_reader = NULL;
+
+    const char* header_segment_end = strchr(params->jwt, '.');
+    if (header_segment_end == NULL)
+    {
+        return L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+    }
+
+    uint8_t* header = NULL;
+    size_t header_length = 0;
+
+    int r = l8w8jwt_base64_decode(true, params->jwt, header_segment_end - params->jwt, &header, &header_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r == L8W8JWT_OUT_OF_MEM ? r : L8W8JWT_BASE64_FAILURE;
+    }
+
+    struct l8w8jwt_call_buffer header_claims;
+    r = l8w8jwt_call_buffer_init(&header_claims, 8, sizeof(struct l8w8jwt_claim));
+    if (r != L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_call_free(header);
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    r = l8w8jwt_parse_claims(&header_claims, (char*)header, header_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        if (r != L8W8JWT_OUT_OF_MEM)
+            r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+        goto exit;
+    }
+
+    struct l8w8jwt_claim* kid = l8w8jwt_get_claim(header_claims.array, header_claims.length, "kid", 3);
+
+    *out_key_found = l8w8jwt_key_set_reader_select(params->key_set_reader, params->alg, kid != NULL ? kid->value : NULL, kid != NULL ? kid->value_length : 0, out_params) == 0;
+
+exit:
+    l8w8jwt_free_claims((struct l8w8jwt_claim*)header_claims.array, header_claims.length);
+    l8w8jwt_call_free(header);
+    return r;
+}
+
+/* Records the token's jti in the replay store (only once the token passed every other check, so that forged or otherwise rejected tokens can't use up a jti). */
+static int l8w8jwt_check_jti_replay(const struct l8w8jwt_decoding_params* params, const struct l8w8jwt_call_buffer* claims, enum l8w8jwt_validation_result* out_validation_result)
+{
+    if (params->jti_store == NULL || *out_validation_result != L8W8JWT_VALID)
+    {
+        return L8W8JWT_SUCCESS;
+    }
+
+    struct l8w8jwt_claim* jti = l8w8jwt_get_claim(claims->array, claims->length, "jti", 3);
+    struct l8w8jwt_claim* exp = l8w8jwt_get_claim(claims->array, claims->length, "exp", 3);
+
+    if (jti == NULL || exp == NULL || exp->type != L8W8JWT_CLAIM_TYPE_INTEGER)
+    {
+        *out_validation_result |= (unsigned)L8W8JWT_JTI_FAILURE;
+        return L8W8JWT_SUCCESS;
+    }
+
+    int replayed = 0;
+
+    int r = l8w8jwt_jti_store_check_and_insert(params->jti_store, jti->value, jti->value_length, (l8w8jwt_time_t)strtoll(exp->value, NULL, 10) + params->exp_tolerance_seconds, &replayed);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    if (replayed)
+    {
+        *out_validation_result |= (unsigned)L8W8JWT_JTI_REPLAY;
+    }
+
+    return L8W8JWT_SUCCESS;
+}
+
+/* l8w8jwt_verify_signature() for verification keys that live in the PSA key store. */
+static int l8w8jwt_verify_signature_psa(const struct l8w8jwt_decoding_params* params, enum l8w8jwt_validation_result* out_validation_res, const uint8_t* signature, const size_t signature_length)
+{
+    const int alg = params->alg;
+
+    size_t expected_signature_length = 0;
+
+    int r = l8w8jwt_psa_get_signature_length(alg, params->psa_key_id, &expected_signature_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    const char* signature_segment = strchr(params->jwt, '.');
+    if (signature_segment == NULL || (signature_segment = strchr(signature_segment + 1, '.')) == NULL)
+    {
+        return L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+    }
+
+    const unsigned char* signing_input = (const unsigned char*)params->jwt;
+    const size_t signing_input_length = signature_segment - params->jwt;
+
+    if (alg == L8W8JWT_ALG_HS256 || alg == L8W8JWT_ALG_HS384 || alg == L8W8JWT_ALG_HS512)
+    {
+        r = l8w8jwt_psa_verify_mac(alg, params->psa_key_id, signing_input, signing_input_length, signature, signature_length);
+        if (r == 1)
+        {
+            *out_validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+            r = L8W8JWT_SUCCESS;
+        }
+
+        return r;
+    }
+
+    size_t md_length = 0;
+    mbedtls_md_type_t md_type = MBEDTLS_MD_NONE;
+
+    md_type_from_alg(alg, &md_type, &md_length);
+
+    unsigned char hash[64] = { 0x00 };
+
+    r = l8w8jwt_prefix_context_digest(params->prefix_context, alg, NULL, 0, signing_input, signing_input_length, hash);
+    if (r == 1)
+    {
+        r = l8w8jwt_get_active_crypto_provider()->hash(md_type, signing_input, signing_input_length, hash);
+    }
+
+    if (r != 0)
+    {
+        return L8W8JWT_SHA2_FAILURE;
+    }
+
+    r = l8w8jwt_psa_verify_hash(alg, params->psa_key_id, hash, md_length, signature, signature_length);
+    if (r == 1)
+    {
+        *out_validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+        r = L8W8JWT_SUCCESS;
+    }
+
+    return r;
+}
+
+/* l8w8jwt_verify_signature() for verification keys that were parsed ahead of time. */
+static int l8w8jwt_verify_signature_key_object(const struct l8w8jwt_decoding_params* params, enum l8w8jwt_validation_result* out_validation_res, const uint8_t* signature, const size_t signature_length)
+{
+    const int alg = params->alg;
+    const struct l8w8jwt_verification_key* verification_key = params->verification_key_object;
+
+    if (verification_key->alg != alg)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    const char* signature_segment = strchr(params->jwt, '.');
+    if (signature_segment == NULL || (signature_segment = strchr(signature_segment + 1, '.')) == NULL)
+    {
+        return L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+    }
+
+    const unsigned char* signing_input = (const unsigned char*)params->jwt;
+    const size_t signing_input_length = signature_segment - params->jwt;
+
+    size_t md_length = 0;
+    mbedtls_md_type_t md_type = MBEDTLS_MD_NONE;
+
+    md_type_from_alg(alg, &md_type, &md_length);
+
+    unsigned char hash[64] = { 0x00 };
+
+    int r = l8w8jwt_prefix_context_digest(params->prefix_context, alg, NULL, 0, signing_input, signing_input_length, hash);
+    if (r == 1)
+    {
+        r = verification_key->provider->hash(md_type, signing_input, signing_input_length, hash);
+    }
+
+    if (r != 0)
+    {
+        return L8W8JWT_SHA2_FAILURE;
+    }
+
+    r = verification_key->provider->verify(verification_key->key, alg, hash, md_length, signature, signature_length);
+    if (r == 1)
+    {
+        *out_validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+        r = L8W8JWT_SUCCESS;
+    }
+
+    return r;
 }
 
+/*
+ * Only flags the validation result with L8W8JWT_SIGNATURE_VERIFICATION_FAILURE if the signature was checked and doesn't match:
+ * anything that kept it from being checked (out of memory, a failing HMAC, ...) is returned as an error instead.
+ */
 static int l8w8jwt_verify_signature(const struct l8w8jwt_decoding_params* params, enum l8w8jwt_validation_result* out_validation_res, const uint8_t* signature, const size_t signature_length)
 {
     int r = L8W8JWT_SUCCESS;
@@ -472,6 +706,16 @@ static int l8w8jwt_verify_signature(const struct l8w8jwt_decoding_params* params
         return r;
     }
 
+    if (params->psa_key_id != 0)
+    {
+        return l8w8jwt_verify_signature_psa(params, out_validation_res, signature, signature_length);
+    }
+
+    if (params->verification_key_object != NULL)
+    {
+        return l8w8jwt_verify_signature_key_object(params, out_validation_res, signature, signature_length);
+    }
+
     if (params->verification_key == NULL)
     {
         return L8W8JWT_NULL_ARG;
@@ -482,23 +726,17 @@ static int l8w8jwt_verify_signature(const struct l8w8jwt_decoding_params* params
         return L8W8JWT_INVALID_ARG;
     }
 
-    int is_cert = 0; // If the validation PEM is a X.509 certificate, this will be set to 1.
-
-    mbedtls_pk_context pk;
-    mbedtls_pk_init(&pk);
-
-    mbedtls_x509_crt crt;
-    mbedtls_x509_crt_init(&crt);
+    const struct l8w8jwt_crypto_provider* provider = l8w8jwt_get_active_crypto_provider();
+    void* verification_key = NULL;
 
 #if L8W8JWT_SMALL_STACK
-    unsigned char* key = l8w8jwt_calloc(sizeof(unsigned char), L8W8JWT_MAX_KEY_SIZE);
+    unsigned char* key = l8w8jwt_call_calloc(sizeof(unsigned char), L8W8JWT_MAX_KEY_SIZE + 1);
     if (key == NULL)
     {
-        r = L8W8JWT_OUT_OF_MEM;
-        goto exit;
+        return L8W8JWT_OUT_OF_MEM;
     }
 #else
-    unsigned char key[L8W8JWT_MAX_KEY_SIZE] = { 0x00 };
+    unsigned char key[L8W8JWT_MAX_KEY_SIZE + 1] = { 0x00 };
 #endif
 
     size_t key_length = params->verification_key_length;
@@ -506,24 +744,10 @@ static int l8w8jwt_verify_signature(const struct l8w8jwt_decoding_params* params
 
     key_length += key[key_length - 1] != '\0';
 
-    is_cert = strstr((const char*)key, "-----BEGIN CERTIFICATE-----") != NULL;
-    if (is_cert)
-    {
-        r = mbedtls_x509_crt_parse(&crt, key, key_length);
-        if (r != 0)
-        {
-            r = L8W8JWT_KEY_PARSE_FAILURE;
-            goto exit;
-        }
-
-        pk = crt.pk;
-    }
-
     size_t md_length = 0;
     mbedtls_md_type_t md_type = MBEDTLS_MD_NONE;
-    mbedtls_md_info_t* md_info = NULL;
 
-    md_info_from_alg(alg, &md_info, &md_type, &md_length);
+    md_type_from_alg(alg, &md_type, &md_length);
 
     unsigned char hash[64] = { 0x00 };
 
@@ -543,31 +767,6 @@ static int l8w8jwt_verify_signature(const struct l8w8jwt_decoding_params* params
         goto exit;
     }
 
-    switch (alg)
-    {
-        case L8W8JWT_ALG_ES256:
-        case L8W8JWT_ALG_ES384:
-        case L8W8JWT_ALG_ES512:
-        case L8W8JWT_ALG_RS256:
-        case L8W8JWT_ALG_RS384:
-        case L8W8JWT_ALG_RS512:
-        case L8W8JWT_ALG_PS256:
-        case L8W8JWT_ALG_PS384:
-        case L8W8JWT_ALG_PS512:
-        case L8W8JWT_ALG_ES256K: {
-
-            r = mbedtls_md(md_info, (const unsigned char*)params->jwt, signature_segment - params->jwt, hash);
-            if (r != L8W8JWT_SUCCESS)
-            {
-                r = L8W8JWT_SHA2_FAILURE;
-                goto exit;
-            }
-            break;
-        }
-        default:
-            break;
-    }
-
     switch (alg)
     {
         case L8W8JWT_ALG_HS256:
@@ -577,37 +776,19 @@ static int l8w8jwt_verify_signature(const struct l8w8jwt_decoding_params* params
             unsigned char signature_cmp[64];
             memset(signature_cmp, '\0', sizeof(signature_cmp));
 
-            r = mbedtls_md_hmac(md_info, key, key_length - 1, (const unsigned char*)params->jwt, signature_segment - params->jwt, signature_cmp);
-            if (r != 0)
+            r = l8w8jwt_prefix_context_digest(params->prefix_context, alg, key, key_length - 1, (const unsigned char*)params->jwt, signature_segment - params->jwt, signature_cmp);
+            if (r == 1)
             {
-                *out_validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
-                break;
+                r = provider->hmac(md_type, key, key_length - 1, (const unsigned char*)params->jwt, signature_segment - params->jwt, signature_cmp);
             }
 
-            r = l8w8jwt_memcmp(signature, signature_cmp, 32 + (16 * alg));
             if (r != 0)
             {
-                *out_validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
-                break;
-            }
-
-            break;
-        }
-        case L8W8JWT_ALG_RS256:
-        case L8W8JWT_ALG_RS384:
-        case L8W8JWT_ALG_RS512: {
-
-            if (!is_cert)
-            {
-                r = mbedtls_pk_parse_public_key(&pk, key, key_length);
-                if (r != 0)
-                {
-                    r = L8W8JWT_KEY_PARSE_FAILURE;
-                    goto exit;
-                }
+                r = L8W8JWT_SHA2_FAILURE;
+                goto exit;
             }
 
-            r = mbedtls_pk_verify(&pk, md_type, hash, md_length, (const unsigned char*)signature, signature_length);
+            r = signature_length != 32 + (16 * alg) || l8w8jwt_memcmp(signature, signature_cmp, 32 + (16 * alg));
             if (r != 0)
             {
                 *out_validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
@@ -616,79 +797,46 @@ static int l8w8jwt_verify_signature(const struct l8w8jwt_decoding_params* params
 
             break;
         }
+        case L8W8JWT_ALG_RS256:
+        case L8W8JWT_ALG_RS384:
+        case L8W8JWT_ALG_RS512:
         case L8W8JWT_ALG_PS256:
         case L8W8JWT_ALG_PS384:
-        case L8W8JWT_ALG_PS512: {
-
-            if (!is_cert)
-            {
-                r = mbedtls_pk_parse_public_key(&pk, key, key_length);
-                if (r != 0)
-                {
-                    r = L8W8JWT_KEY_PARSE_FAILURE;
-                    goto exit;
-                }
-            }
-
-            mbedtls_rsa_context* rsa = mbedtls_pk_rsa(pk);
-            mbedtls_rsa_set_padding(rsa, MBEDTLS_RSA_PKCS_V21, md_type);
-
-            r = mbedtls_rsa_rsassa_pss_verify(rsa, md_type, md_length, hash, signature);
-            if (r != 0)
-            {
-                *out_validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
-                break;
-            }
-
-            break;
-        }
+        case L8W8JWT_ALG_PS512:
         case L8W8JWT_ALG_ES256:
         case L8W8JWT_ALG_ES256K:
         case L8W8JWT_ALG_ES384:
         case L8W8JWT_ALG_ES512: {
 
-            if (!is_cert)
+            r = l8w8jwt_prefix_context_digest(params->prefix_context, alg, NULL, 0, (const unsigned char*)params->jwt, signature_segment - params->jwt, hash);
+            if (r == 1)
             {
-                r = mbedtls_pk_parse_public_key(&pk, key, key_length);
-                if (r != 0)
-                {
-                    r = L8W8JWT_KEY_PARSE_FAILURE;
-                    goto exit;
-                }
+                r = provider->hash(md_type, (const unsigned char*)params->jwt, signature_segment - params->jwt, hash);
             }
 
-            const size_t half_signature_length = signature_length / 2;
-
-            mbedtls_ecdsa_context ecdsa;
-            mbedtls_ecdsa_init(&ecdsa);
-
-            mbedtls_mpi sig_r, sig_s;
-            mbedtls_mpi_init(&sig_r);
-            mbedtls_mpi_init(&sig_s);
-
-            r = mbedtls_ecdsa_from_keypair(&ecdsa, mbedtls_pk_ec(pk));
-
-            if (r != 0)
+            if (r != L8W8JWT_SUCCESS)
             {
-                r = L8W8JWT_KEY_PARSE_FAILURE;
-                mbedtls_ecdsa_free(&ecdsa);
-                mbedtls_mpi_free(&sig_r);
-                mbedtls_mpi_free(&sig_s);
+                r = L8W8JWT_SHA2_FAILURE;
                 goto exit;
             }
 
-            mbedtls_mpi_read_binary(&sig_r, signature, half_signature_length);
-            mbedtls_mpi_read_binary(&sig_s, signature + half_signature_length, half_signature_length);
+            r = provider->load_verification_key(alg, key, key_length, &verification_key);
+            if (r != L8W8JWT_SUCCESS)
+            {
+                goto exit;
+            }
 
-            r = mbedtls_ecdsa_verify(&ecdsa.MBEDTLS_PRIVATE(grp), hash, md_length, &ecdsa.MBEDTLS_PRIVATE(Q), &sig_r, &sig_s);
-            if (r != 0)
+            r = provider->verify(verification_key, alg, hash, md_length, (const unsigned char*)signature, signature_length);
+            if (r == 1)
             {
                 *out_validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+                break;
             }
 
-            mbedtls_ecdsa_free(&ecdsa);
-            mbedtls_mpi_free(&sig_r);
-            mbedtls_mpi_free(&sig_s);
+            if (r != 0)
+            {
+                goto exit;
+            }
 
             break;
         }
@@ -709,7 +857,11 @@ static int l8w8jwt_verify_signature(const struct l8w8jwt_decoding_params* params
                 goto exit;
             }
 
+#if L8W8JWT_ED25519_FE51
+            if (!l8w8jwt_ed25519_verify(signature, (const unsigned char*)params->jwt, signature_segment - params->jwt, public_key))
+#else
             if (!ed25519_verify(signature, (const unsigned char*)params->jwt, signature_segment - params->jwt, public_key))
+#endif
             {
                 *out_validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
                 break;
@@ -728,19 +880,15 @@ static int l8w8jwt_verify_signature(const struct l8w8jwt_decoding_params* params
     r = L8W8JWT_SUCCESS;
 
 exit:
-    mbedtls_platform_zeroize(key, L8W8JWT_MAX_KEY_SIZE);
+    mbedtls_platform_zeroize(key, L8W8JWT_MAX_KEY_SIZE + 1);
 
 #if L8W8JWT_SMALL_STACK
-    l8w8jwt_free(key);
+    l8w8jwt_call_free(key);
 #endif
 
-    if (is_cert)
-    {
-        mbedtls_x509_crt_free(&crt);
-    }
-    else
+    if (verification_key != NULL)
     {
-        mbedtls_pk_free(&pk);
+        provider->free_key(verification_key);
     }
 
     return r;
@@ -775,10 +923,15 @@ int l8w8jwt_validate_decoding_params(struct l8w8jwt_decoding_params* params)
     }
 #endif
 
+    if (params->allocator != NULL && (params->allocator->alloc == NULL || params->allocator->free == NULL))
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
     return L8W8JWT_SUCCESS;
 }
 
-int l8w8jwt_decode(struct l8w8jwt_decoding_params* params, enum l8w8jwt_validation_result* out_validation_result, struct l8w8jwt_claim** out_claims, size_t* out_claims_length)
+static int l8w8jwt_decode_impl(struct l8w8jwt_decoding_params* params, enum l8w8jwt_validation_result* out_validation_result, struct l8w8jwt_claim** out_claims, size_t* out_claims_length)
 {
     if (params == NULL || (out_claims != NULL && out_claims_length == NULL))
     {
@@ -809,43 +962,117 @@ int l8w8jwt_decode(struct l8w8jwt_decoding_params* params, enum l8w8jwt_validati
     uint8_t* signature = NULL;
     size_t signature_length = 0;
 
-    chillbuff claims;
-    r = chillbuff_init(&claims, 16, sizeof(struct l8w8jwt_claim), CHILLBUFF_GROW_DUPLICATIVE);
-    if (r != CHILLBUFF_SUCCESS)
-    {
+    struct l8w8jwt_decoding_params key_set_params;
+    struct l8w8jwt_key_set_reader* key_set_reader = params->key_set_reader;
+    int key_found = 1;
+
+    struct l8w8jwt_call_buffer claims;
+    r = l8w8jwt_call_buffer_init(&claims, 16, sizeof(struct l8w8jwt_claim));
+    if (r != L8W8JWT_SUCCESS)
+    {
         r = L8W8JWT_OUT_OF_MEM;
         goto exit;
     }
 
+    if (key_set_reader != NULL)
+    {
+        r = l8w8jwt_select_key_set_key(params, &key_set_params, &key_found);
+        if (r != L8W8JWT_SUCCESS)
+        {
+            goto exit;
+        }
+
+        params = &key_set_params;
+    }
+
+    unsigned char cache_digest[32];
+    const int use_cache = (params->verification_cache != NULL || params->rejection_cache != NULL) && params->alg != -1 && key_found;
+
+    if (use_cache)
+    {
+        r = l8w8jwt_verification_cache_digest(params, cache_digest);
+        if (r != L8W8JWT_SUCCESS)
+        {
+            goto exit;
+        }
+    }
+
+    if (use_cache && params->verification_cache != NULL)
+    {
+        r = l8w8jwt_verification_cache_get(params->verification_cache, cache_digest, &claims);
+        if (r == L8W8JWT_SUCCESS)
+        {
+            /* The signature was verified when the token was cached: only the claims need to be validated again. */
+            goto validate;
+        }
+
+        if (r != 1)
+        {
+            goto exit;
+        }
+    }
+
     r = l8w8jwt_decode_segments(params, (uint8_t**)&header, &header_length, (uint8_t**)&payload, &payload_length, (uint8_t**)&signature, &signature_length);
     if (r != L8W8JWT_SUCCESS)
     {
         goto exit;
     }
 
-    r = l8w8jwt_verify_signature(params, &validation_res, signature, signature_length);
-    if (r != L8W8JWT_SUCCESS)
+    if (!key_found)
     {
-        goto exit;
+        /* No key in the key set for this token. */
+        validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+    }
+    else if (use_cache && params->rejection_cache != NULL && signature_length != 0 && l8w8jwt_rejection_cache_contains(params->rejection_cache, cache_digest))
+    {
+        /* Replayed forgery: no need to verify it again. */
+        validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+    }
+    else
+    {
+        r = l8w8jwt_verify_signature(params, &validation_res, signature, signature_length);
+        if (r != L8W8JWT_SUCCESS)
+        {
+            goto exit;
+        }
+
+        /* Errors were returned above, so this is a signature that was checked and didn't match. */
+        if (use_cache && params->rejection_cache != NULL && (validation_res & (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE))
+        {
+            l8w8jwt_rejection_cache_put(params->rejection_cache, cache_digest);
+        }
     }
 
     r = l8w8jwt_parse_claims(&claims, header, header_length);
     if (r != L8W8JWT_SUCCESS)
     {
-        r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+        if (r != L8W8JWT_OUT_OF_MEM)
+            r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
         goto exit;
     }
 
     r = l8w8jwt_parse_claims(&claims, payload, payload_length);
     if (r != L8W8JWT_SUCCESS)
     {
-        r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+        if (r != L8W8JWT_OUT_OF_MEM)
+            r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
         goto exit;
     }
 
+    if (use_cache && params->verification_cache != NULL && signature_length != 0 && !(validation_res & (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE))
+    {
+        l8w8jwt_verification_cache_put(params->verification_cache, cache_digest, (struct l8w8jwt_claim*)claims.array, claims.length);
+    }
+
+validate:
     l8w8jwt_validate_claims(params, &claims, &validation_res);
 
-    r = L8W8JWT_SUCCESS;
+    r = l8w8jwt_check_jti_replay(params, &claims, &validation_res);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        goto exit;
+    }
+
     *out_validation_result = validation_res;
 
     if (out_claims != NULL && out_claims_length != NULL)
@@ -855,9 +1082,14 @@ int l8w8jwt_decode(struct l8w8jwt_decoding_params* params, enum l8w8jwt_validati
     }
 
 exit:
-    l8w8jwt_free(header);
-    l8w8jwt_free(payload);
-    l8w8jwt_free(signature);
+    if (key_set_reader != NULL)
+    {
+        l8w8jwt_key_set_reader_release(key_set_reader);
+    }
+
+    l8w8jwt_call_free(header);
+    l8w8jwt_call_free(payload);
+    l8w8jwt_call_free(signature);
 
     if (out_claims == NULL || r != L8W8JWT_SUCCESS)
     {
@@ -867,7 +1099,23 @@ exit:
     return r;
 }
 
-int l8w8jwt_decode_raw(struct l8w8jwt_decoding_params* params, enum l8w8jwt_validation_result* out_validation_result, char** out_header, size_t* out_header_length, char** out_payload, size_t* out_payload_length, uint8_t** out_signature, size_t* out_signature_length)
+int l8w8jwt_decode(struct l8w8jwt_decoding_params* params, enum l8w8jwt_validation_result* out_validation_result, struct l8w8jwt_claim** out_claims, size_t* out_claims_length)
+{
+    const struct l8w8jwt_allocator* previous_allocator;
+
+    int r = l8w8jwt_call_allocator_enter(params != NULL ? params->allocator : NULL, &previous_allocator);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    r = l8w8jwt_decode_impl(params, out_validation_result, out_claims, out_claims_length);
+
+    l8w8jwt_call_allocator_leave(previous_allocator);
+    return r;
+}
+
+static int l8w8jwt_decode_raw_impl(struct l8w8jwt_decoding_params* params, enum l8w8jwt_validation_result* out_validation_result, char** out_header, size_t* out_header_length, char** out_payload, size_t* out_payload_length, uint8_t** out_signature, size_t* out_signature_length)
 {
     if
     (
@@ -904,46 +1152,80 @@ int l8w8jwt_decode_raw(struct l8w8jwt_decoding_params* params, enum l8w8jwt_vali
     uint8_t* signature = NULL;
     size_t signature_length = 0;
 
-    chillbuff claims;
-    r = chillbuff_init(&claims, 16, sizeof(struct l8w8jwt_claim), CHILLBUFF_GROW_DUPLICATIVE);
-    if (r != CHILLBUFF_SUCCESS)
+    struct l8w8jwt_decoding_params key_set_params;
+    struct l8w8jwt_key_set_reader* key_set_reader = params->key_set_reader;
+    int key_found = 1;
+
+    struct l8w8jwt_call_buffer claims;
+    r = l8w8jwt_call_buffer_init(&claims, 16, sizeof(struct l8w8jwt_claim));
+    if (r != L8W8JWT_SUCCESS)
     {
         r = L8W8JWT_OUT_OF_MEM;
         goto exit;
     }
 
+    if (key_set_reader != NULL)
+    {
+        r = l8w8jwt_select_key_set_key(params, &key_set_params, &key_found);
+        if (r != L8W8JWT_SUCCESS)
+        {
+            goto exit;
+        }
+
+        params = &key_set_params;
+    }
+
     r = l8w8jwt_decode_segments(params, (uint8_t**)&header, &header_length, (uint8_t**)&payload, &payload_length, (uint8_t**)&signature, &signature_length);
     if (r != L8W8JWT_SUCCESS)
     {
         goto exit;
     }
 
-    r = l8w8jwt_verify_signature(params, &validation_res, signature, signature_length);
-    if (r != L8W8JWT_SUCCESS)
+    if (!key_found)
     {
-        goto exit;
+        validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+    }
+    else
+    {
+        r = l8w8jwt_verify_signature(params, &validation_res, signature, signature_length);
+        if (r != L8W8JWT_SUCCESS)
+        {
+            goto exit;
+        }
     }
 
     r = l8w8jwt_parse_claims(&claims, header, header_length);
     if (r != L8W8JWT_SUCCESS)
     {
-        r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+        if (r != L8W8JWT_OUT_OF_MEM)
+            r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
         goto exit;
     }
 
     r = l8w8jwt_parse_claims(&claims, payload, payload_length);
     if (r != L8W8JWT_SUCCESS)
     {
-        r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+        if (r != L8W8JWT_OUT_OF_MEM)
+            r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
         goto exit;
     }
 
     l8w8jwt_validate_claims(params, &claims, &validation_res);
 
-    r = L8W8JWT_SUCCESS;
+    r = l8w8jwt_check_jti_replay(params, &claims, &validation_res);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        goto exit;
+    }
+
     *out_validation_result = validation_res;
 
 exit:
+    if (key_set_reader != NULL)
+    {
+        l8w8jwt_key_set_reader_release(key_set_reader);
+    }
+
     if (out_header != NULL)
     {
         *out_header = header;
@@ -951,7 +1233,7 @@ exit:
     }
     else
     {
-        l8w8jwt_free(header);
+        l8w8jwt_call_free(header);
     }
 
     if (out_payload != NULL)
@@ -961,7 +1243,7 @@ exit:
     }
     else
     {
-        l8w8jwt_free(payload);
+        l8w8jwt_call_free(payload);
     }
 
     if (out_signature != NULL)
@@ -971,7 +1253,7 @@ exit:
     }
     else
     {
-        l8w8jwt_free(signature);
+        l8w8jwt_call_free(signature);
     }
 
     l8w8jwt_free_claims((struct l8w8jwt_claim*)claims.array, claims.length);
@@ -979,7 +1261,23 @@ exit:
     return r;
 }
 
-int l8w8jwt_decode_raw_no_validation(struct l8w8jwt_decoding_params* params, char** out_header, size_t* out_header_length, char** out_payload, size_t* out_payload_length, uint8_t** out_signature, size_t* out_signature_length)
+int l8w8jwt_decode_raw(struct l8w8jwt_decoding_params* params, enum l8w8jwt_validation_result* out_validation_result, char** out_header, size_t* out_header_length, char** out_payload, size_t* out_payload_length, uint8_t** out_signature, size_t* out_signature_length)
+{
+    const struct l8w8jwt_allocator* previous_allocator;
+
+    int r = l8w8jwt_call_allocator_enter(params != NULL ? params->allocator : NULL, &previous_allocator);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    r = l8w8jwt_decode_raw_impl(params, out_validation_result, out_header, out_header_length, out_payload, out_payload_length, out_signature, out_signature_length);
+
+    l8w8jwt_call_allocator_leave(previous_allocator);
+    return r;
+}
+
+static int l8w8jwt_decode_raw_no_validation_impl(struct l8w8jwt_decoding_params* params, char** out_header, size_t* out_header_length, char** out_payload, size_t* out_payload_length, uint8_t** out_signature, size_t* out_signature_length)
 {
     if
         (
@@ -1028,7 +1326,7 @@ exit:
     }
     else
     {
-        l8w8jwt_free(header);
+        l8w8jwt_call_free(header);
     }
 
     if (out_payload != NULL)
@@ -1038,7 +1336,7 @@ exit:
     }
     else
     {
-        l8w8jwt_free(payload);
+        l8w8jwt_call_free(payload);
     }
 
     if (out_signature != NULL)
@@ -1048,12 +1346,660 @@ exit:
     }
     else
     {
-        l8w8jwt_free(signature);
+        l8w8jwt_call_free(signature);
+    }
+
+    return r;
+}
+
+int l8w8jwt_decode_raw_no_validation(struct l8w8jwt_decoding_params* params, char** out_header, size_t* out_header_length, char** out_payload, size_t* out_payload_length, uint8_t** out_signature, size_t* out_signature_length)
+{
+    const struct l8w8jwt_allocator* previous_allocator;
+
+    int r = l8w8jwt_call_allocator_enter(params != NULL ? params->allocator : NULL, &previous_allocator);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
     }
 
+    r = l8w8jwt_decode_raw_no_validation_impl(params, out_header, out_header_length, out_payload, out_payload_length, out_signature, out_signature_length);
+
+    l8w8jwt_call_allocator_leave(previous_allocator);
     return r;
 }
 
+/* Maximum number of tokens that l8w8jwt_decode_batch() keeps decoded at the same time (and hashes together). */
+#define L8W8JWT_DECODE_BATCH_CHUNK_SIZE 16
+
+/* Parses a decoded token's header and payload and validates its claims (just like l8w8jwt_decode() does, but without keeping the claims). */
+static int l8w8jwt_validate_segments(const struct l8w8jwt_decoding_params* params, char* header, const size_t header_length, char* payload, const size_t payload_length, enum l8w8jwt_validation_result* out_validation_res)
+{
+    struct l8w8jwt_call_buffer claims;
+
+    int r = l8w8jwt_call_buffer_init(&claims, 16, sizeof(struct l8w8jwt_claim));
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    r = l8w8jwt_parse_claims(&claims, header, header_length);
+    if (r == L8W8JWT_SUCCESS)
+    {
+        r = l8w8jwt_parse_claims(&claims, payload, payload_length);
+    }
+
+    if (r != L8W8JWT_SUCCESS)
+    {
+        if (r != L8W8JWT_OUT_OF_MEM)
+            r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+        goto exit;
+    }
+
+    l8w8jwt_validate_claims(params, &claims, out_validation_res);
+    r = L8W8JWT_SUCCESS;
+
+exit:
+    l8w8jwt_free_claims((struct l8w8jwt_claim*)claims.array, claims.length);
+    return r;
+}
+
+static int l8w8jwt_decode_batch_impl(struct l8w8jwt_decoding_params* params, char* const* jwts, const size_t* jwt_lengths, const size_t count, enum l8w8jwt_validation_result* out_validation_results)
+{
+    if (params == NULL || jwts == NULL || jwt_lengths == NULL || out_validation_results == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    int r = L8W8JWT_SUCCESS;
+    int first_error = L8W8JWT_SUCCESS;
+
+    const int alg = params->alg;
+    struct l8w8jwt_decoding_params token_params = *params;
+
+    const int hs256 = alg == L8W8JWT_ALG_HS256;
+    const int sha256 = hs256 || alg == L8W8JWT_ALG_RS256 || alg == L8W8JWT_ALG_PS256 || alg == L8W8JWT_ALG_ES256 || alg == L8W8JWT_ALG_ES256K;
+
+    if (!sha256 || params->psa_key_id != 0 || params->jti_store != NULL || params->key_set_reader != NULL || params->verification_cache != NULL || params->rejection_cache != NULL || params->prefix_context != NULL)
+    {
+        /*
+         * Nothing to batch here: decode the tokens one by one. With a jti store, every token's jti must be recorded in order; with a key set, each token picks its own key;
+         * cached tokens skip the hashing altogether, and a prefix context's midstate can't go through the multi-buffer hash.
+         */
+        for (size_t i = 0; i < count; ++i)
+        {
+            token_params.jwt = jwts[i];
+            token_params.jwt_length = jwt_lengths[i];
+
+            r = l8w8jwt_decode(&token_params, &out_validation_results[i], NULL, NULL);
+            if (r != L8W8JWT_SUCCESS && first_error == L8W8JWT_SUCCESS)
+            {
+                first_error = r;
+            }
+        }
+
+        return first_error;
+    }
+
+    const struct l8w8jwt_crypto_provider* provider = l8w8jwt_get_active_crypto_provider();
+    void* verification_key = NULL;
+
+    size_t key_length = params->verification_key_length;
+    const unsigned char* key = params->verification_key;
+
+    /* A verification key object is already parsed (and owned by the caller). */
+    const struct l8w8jwt_verification_key* verification_key_object = hs256 ? NULL : params->verification_key_object;
+
+    if (verification_key_object != NULL)
+    {
+        if (verification_key_object->alg != alg)
+        {
+            return L8W8JWT_INVALID_ARG;
+        }
+
+        provider = verification_key_object->provider;
+        verification_key = verification_key_object->key;
+    }
+    else if (key == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+    else if (key_length == 0 || key_length > L8W8JWT_MAX_KEY_SIZE)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+    else if (hs256)
+    {
+        key_length -= key[key_length - 1] == '\0';
+    }
+    else
+    {
+        /* The verification key only needs to be parsed once for the whole batch. */
+        unsigned char* pem = l8w8jwt_call_calloc(sizeof(unsigned char), key_length + 1);
+        if (pem == NULL)
+        {
+            return L8W8JWT_OUT_OF_MEM;
+        }
+
+        memcpy(pem, key, key_length);
+        key_length += pem[key_length - 1] != '\0';
+
+        r = provider->load_verification_key(alg, pem, key_length, &verification_key);
+
+        mbedtls_platform_zeroize(pem, key_length);
+        l8w8jwt_call_free(pem);
+
+        if (r != L8W8JWT_SUCCESS)
+        {
+            return r;
+        }
+    }
+
+    char* headers[L8W8JWT_DECODE_BATCH_CHUNK_SIZE];
+    char* payloads[L8W8JWT_DECODE_BATCH_CHUNK_SIZE];
+    uint8_t* signatures[L8W8JWT_DECODE_BATCH_CHUNK_SIZE];
+    size_t header_lengths[L8W8JWT_DECODE_BATCH_CHUNK_SIZE];
+    size_t payload_lengths[L8W8JWT_DECODE_BATCH_CHUNK_SIZE];
+    size_t signature_lengths[L8W8JWT_DECODE_BATCH_CHUNK_SIZE];
+
+    const unsigned char* signing_inputs[L8W8JWT_DECODE_BATCH_CHUNK_SIZE];
+    size_t signing_input_lengths[L8W8JWT_DECODE_BATCH_CHUNK_SIZE];
+    size_t chunk_indices[L8W8JWT_DECODE_BATCH_CHUNK_SIZE];
+
+    unsigned char hashes[32 * L8W8JWT_DECODE_BATCH_CHUNK_SIZE];
+
+    for (size_t chunk = 0; chunk < count; chunk += L8W8JWT_DECODE_BATCH_CHUNK_SIZE)
+    {
+        const size_t chunk_size = count - chunk < L8W8JWT_DECODE_BATCH_CHUNK_SIZE ? count - chunk : L8W8JWT_DECODE_BATCH_CHUNK_SIZE;
+        size_t n = 0;
+
+        memset(headers, 0x00, sizeof(headers));
+        memset(payloads, 0x00, sizeof(payloads));
+        memset(signatures, 0x00, sizeof(signatures));
+
+        /* Decode every token of the chunk first, so that all of their signing inputs can be hashed in one go. */
+        for (size_t j = 0; j < chunk_size; ++j)
+        {
+            const size_t i = chunk + j;
+            enum l8w8jwt_validation_result* validation_res = &out_validation_results[i];
+
+            *validation_res = ~L8W8JWT_VALID;
+
+            token_params.jwt = jwts[i];
+            token_params.jwt_length = jwt_lengths[i];
+
+            r = l8w8jwt_validate_decoding_params(&token_params);
+            if (r == L8W8JWT_SUCCESS)
+            {
+                r = l8w8jwt_decode_segments(&token_params, (uint8_t**)&headers[j], &header_lengths[j], (uint8_t**)&payloads[j], &payload_lengths[j], &signatures[j], &signature_lengths[j]);
+            }
+
+            if (r == L8W8JWT_SUCCESS && signatures[j] == NULL)
+            {
+                r = L8W8JWT_DECODE_FAILED_MISSING_SIGNATURE;
+            }
+
+            if (r != L8W8JWT_SUCCESS)
+            {
+                if (first_error == L8W8JWT_SUCCESS)
+                {
+                    first_error = r;
+                }
+                continue;
+            }
+
+            *validation_res = L8W8JWT_VALID;
+
+            /* decode_segments() found both dots already, so this can't fail anymore. */
+            const char* signature_segment = strchr(strchr(jwts[i], '.') + 1, '.');
+
+            signing_inputs[n] = (const unsigned char*)jwts[i];
+            signing_input_lengths[n] = signature_segment - jwts[i];
+            chunk_indices[n] = j;
+            ++n;
+        }
+
+        r = hs256 ? l8w8jwt_hmac_sha256_multi(key, key_length, signing_inputs, signing_input_lengths, n, hashes) : l8w8jwt_sha256_multi(signing_inputs, signing_input_lengths, n, hashes);
+
+        /* Just like l8w8jwt_decode(): the signature first, then the claims. */
+        for (size_t k = 0; k < n; ++k)
+        {
+            const size_t j = chunk_indices[k];
+            const unsigned char* hash = hashes + 32 * k;
+            enum l8w8jwt_validation_result* validation_res = &out_validation_results[chunk + j];
+
+            if (r != 0)
+            {
+                *validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+            }
+            else if (hs256)
+            {
+                if (signature_lengths[j] != 32 || l8w8jwt_memcmp(signatures[j], hash, 32) != 0)
+                {
+                    *validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+                }
+            }
+            else if (provider->verify(verification_key, alg, hash, 32, signatures[j], signature_lengths[j]) != 0)
+            {
+                *validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+            }
+
+            const int vr = l8w8jwt_validate_segments(params, headers[j], header_lengths[j], payloads[j], payload_lengths[j], validation_res);
+            if (vr != L8W8JWT_SUCCESS)
+            {
+                *validation_res = ~L8W8JWT_VALID;
+
+                if (first_error == L8W8JWT_SUCCESS)
+                {
+                    first_error = vr;
+                }
+            }
+        }
+
+        if (r != 0 && first_error == L8W8JWT_SUCCESS)
+        {
+            first_error = L8W8JWT_SHA2_FAILURE;
+        }
+
+        mbedtls_platform_zeroize(hashes, sizeof(hashes));
+
+        for (size_t j = 0; j < chunk_size; ++j)
+        {
+            l8w8jwt_call_free(headers[j]);
+            l8w8jwt_call_free(payloads[j]);
+            l8w8jwt_call_free(signatures[j]);
+        }
+    }
+
+    if (verification_key != NULL && verification_key_object == NULL)
+    {
+        provider->free_key(verification_key);
+    }
+
+    return first_error;
+}
+
+int l8w8jwt_decode_batch(struct l8w8jwt_decoding_params* params, char* const* jwts, const size_t* jwt_lengths, const size_t count, enum l8w8jwt_validation_result* out_validation_results)
+{
+    const struct l8w8jwt_allocator* previous_allocator;
+
+    int r = l8w8jwt_call_allocator_enter(params != NULL ? params->allocator : NULL, &previous_allocator);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    r = l8w8jwt_decode_batch_impl(params, jwts, jwt_lengths, count, out_validation_results);
+
+    l8w8jwt_call_allocator_leave(previous_allocator);
+    return r;
+}
+
+enum l8w8jwt_decode_phase
+{
+    L8W8JWT_DECODE_PHASE_START = 0,
+    L8W8JWT_DECODE_PHASE_VERIFY = 1,
+    L8W8JWT_DECODE_PHASE_DONE = 2
+};
+
+struct l8w8jwt_decode_state
+{
+    struct l8w8jwt_decoding_params params;
+    enum l8w8jwt_decode_phase phase;
+    int r;
+
+    enum l8w8jwt_validation_result validation_res;
+
+    char* header;
+    size_t header_length;
+    char* payload;
+    size_t payload_length;
+    uint8_t* signature;
+    size_t signature_length;
+
+    /* The key that the signature is verified with: either parsed by this state (own_key) or borrowed from the params' verification_key_object. */
+    const struct l8w8jwt_crypto_provider* provider;
+    void* key;
+    int own_key;
+    void* restart_ctx;
+
+    unsigned char hash[64];
+    size_t hash_length;
+
+    struct l8w8jwt_claim* claims;
+    size_t claims_length;
+};
+
+/* Only ECDSA verification can be split into steps: everything else goes through l8w8jwt_decode() in one go. */
+static int l8w8jwt_decode_state_is_stepwise(const struct l8w8jwt_decoding_params* params)
+{
+    switch (params->alg)
+    {
+        case L8W8JWT_ALG_ES256:
+        case L8W8JWT_ALG_ES256K:
+        case L8W8JWT_ALG_ES384:
+        case L8W8JWT_ALG_ES512:
+            break;
+        default:
+            return 0;
+    }
+
+    return params->psa_key_id == 0 && params->key_set_reader == NULL && params->verification_cache == NULL && params->rejection_cache == NULL;
+}
+
+/* Decodes the segments, hashes the signing input and loads the verification key. */
+static int l8w8jwt_decode_state_prepare(struct l8w8jwt_decode_state* state)
+{
+    const struct l8w8jwt_decoding_params* params = &state->params;
+    const int alg = params->alg;
+
+    int r = l8w8jwt_decode_segments(params, (uint8_t**)&state->header, &state->header_length, (uint8_t**)&state->payload, &state->payload_length, &state->signature, &state->signature_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    if (state->signature == NULL || state->signature_length == 0)
+    {
+        return L8W8JWT_SUCCESS;
+    }
+
+    const char* signature_segment = strchr(params->jwt, '.');
+    if (signature_segment == NULL || (signature_segment = strchr(signature_segment + 1, '.')) == NULL)
+    {
+        return L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+    }
+
+    const unsigned char* signing_input = (const unsigned char*)params->jwt;
+    const size_t signing_input_length = signature_segment - params->jwt;
+
+    if (params->verification_key_object != NULL)
+    {
+        if (params->verification_key_object->alg != alg)
+        {
+            return L8W8JWT_INVALID_ARG;
+        }
+
+        state->provider = params->verification_key_object->provider;
+        state->key = params->verification_key_object->key;
+    }
+    else
+    {
+        if (params->verification_key == NULL)
+        {
+            return L8W8JWT_NULL_ARG;
+        }
+
+        if (params->verification_key_length == 0 || params->verification_key_length > L8W8JWT_MAX_KEY_SIZE)
+        {
+            return L8W8JWT_INVALID_ARG;
+        }
+
+        state->provider = l8w8jwt_get_active_crypto_provider();
+
+        size_t key_length = params->verification_key_length;
+
+        unsigned char* key = l8w8jwt_call_calloc(sizeof(unsigned char), key_length + 1);
+        if (key == NULL)
+        {
+            return L8W8JWT_OUT_OF_MEM;
+        }
+
+        memcpy(key, params->verification_key, key_length);
+        key_length += key[key_length - 1] != '\0';
+
+        r = state->provider->load_verification_key(alg, key, key_length, &state->key);
+
+        mbedtls_platform_zeroize(key, params->verification_key_length + 1);
+        l8w8jwt_call_free(key);
+
+        if (r != L8W8JWT_SUCCESS)
+        {
+            return r;
+        }
+
+        state->own_key = 1;
+    }
+
+    mbedtls_md_type_t md_type = MBEDTLS_MD_NONE;
+    md_type_from_alg(alg, &md_type, &state->hash_length);
+
+    r = l8w8jwt_prefix_context_digest(params->prefix_context, alg, NULL, 0, signing_input, signing_input_length, state->hash);
+    if (r == 1)
+    {
+        r = state->provider->hash(md_type, signing_input, signing_input_length, state->hash);
+    }
+
+    return r != 0 ? L8W8JWT_SHA2_FAILURE : L8W8JWT_SUCCESS;
+}
+
+/* Parses and validates the claims once the signature is verified. */
+static int l8w8jwt_decode_state_complete(struct l8w8jwt_decode_state* state)
+{
+    struct l8w8jwt_call_buffer claims;
+
+    int r = l8w8jwt_call_buffer_init(&claims, 16, sizeof(struct l8w8jwt_claim));
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    r = l8w8jwt_parse_claims(&claims, state->header, state->header_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        if (r != L8W8JWT_OUT_OF_MEM)
+            r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+        goto exit;
+    }
+
+    r = l8w8jwt_parse_claims(&claims, state->payload, state->payload_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        if (r != L8W8JWT_OUT_OF_MEM)
+            r = L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+        goto exit;
+    }
+
+    l8w8jwt_validate_claims(&state->params, &claims, &state->validation_res);
+
+    r = l8w8jwt_check_jti_replay(&state->params, &claims, &state->validation_res);
+
+exit:
+    if (r != L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_free_claims((struct l8w8jwt_claim*)claims.array, claims.length);
+        return r;
+    }
+
+    state->claims = (struct l8w8jwt_claim*)claims.array;
+    state->claims_length = claims.length;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_decode_start(const struct l8w8jwt_decoding_params* params, struct l8w8jwt_decode_state** out_state)
+{
+    if (params == NULL || out_state == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    struct l8w8jwt_decode_state* state = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_decode_state));
+    if (state == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    state->params = *params;
+
+    int r = l8w8jwt_validate_decoding_params(&state->params);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_free(state);
+        return r;
+    }
+
+    if (l8w8jwt_decode_state_is_stepwise(&state->params))
+    {
+        const struct l8w8jwt_crypto_provider* provider = state->params.verification_key_object != NULL ? state->params.verification_key_object->provider : l8w8jwt_get_active_crypto_provider();
+
+        /* Rather than silently blocking for the entire verification in the first step. */
+        if (provider->verify_restartable == NULL)
+        {
+            l8w8jwt_free(state);
+            return L8W8JWT_UNSUPPORTED_ALG;
+        }
+    }
+
+    state->phase = L8W8JWT_DECODE_PHASE_START;
+    state->r = L8W8JWT_IN_PROGRESS;
+    state->validation_res = L8W8JWT_VALID;
+
+    *out_state = state;
+    return L8W8JWT_SUCCESS;
+}
+
+static int l8w8jwt_decode_step_impl(struct l8w8jwt_decode_state* state, const unsigned int max_ops)
+{
+    int r;
+
+    switch (state->phase)
+    {
+        case L8W8JWT_DECODE_PHASE_START: {
+
+            if (!l8w8jwt_decode_state_is_stepwise(&state->params))
+            {
+                r = l8w8jwt_decode(&state->params, &state->validation_res, &state->claims, &state->claims_length);
+                goto done;
+            }
+
+            r = l8w8jwt_decode_state_prepare(state);
+            if (r != L8W8JWT_SUCCESS)
+            {
+                goto done;
+            }
+
+            state->phase = L8W8JWT_DECODE_PHASE_VERIFY;
+
+            /* The first slice of the verification already fits into this step. */
+        }
+        /* fall through */
+        case L8W8JWT_DECODE_PHASE_VERIFY: {
+
+            if (state->key != NULL)
+            {
+                if (state->provider->verify_restartable != NULL)
+                {
+                    r = state->provider->verify_restartable(state->key, state->params.alg, state->hash, state->hash_length, state->signature, state->signature_length, max_ops, &state->restart_ctx);
+                    if (r == L8W8JWT_IN_PROGRESS)
+                    {
+                        return L8W8JWT_IN_PROGRESS;
+                    }
+                }
+                else
+                {
+                    r = state->provider->verify(state->key, state->params.alg, state->hash, state->hash_length, state->signature, state->signature_length);
+                }
+
+                if (r != 0)
+                {
+                    state->validation_res |= (unsigned)L8W8JWT_SIGNATURE_VERIFICATION_FAILURE;
+                }
+            }
+
+            r = l8w8jwt_decode_state_complete(state);
+            goto done;
+        }
+        default:
+            return state->r;
+    }
+
+done:
+    state->phase = L8W8JWT_DECODE_PHASE_DONE;
+    state->r = r;
+    return r;
+}
+
+int l8w8jwt_decode_step(struct l8w8jwt_decode_state* state, const unsigned int max_ops)
+{
+    if (state == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    /* The state itself lives on the global heap (it's just one fixed-size block), but the segments and claims that the steps allocate come from the params' allocator. */
+    const struct l8w8jwt_allocator* previous_allocator;
+
+    int r = l8w8jwt_call_allocator_enter(state->params.allocator, &previous_allocator);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    r = l8w8jwt_decode_step_impl(state, max_ops);
+
+    l8w8jwt_call_allocator_leave(previous_allocator);
+    return r;
+}
+
+int l8w8jwt_decode_finish(struct l8w8jwt_decode_state* state, enum l8w8jwt_validation_result* out_validation_result, struct l8w8jwt_claim** out_claims, size_t* out_claims_length)
+{
+    if (state == NULL || out_validation_result == NULL || (out_claims != NULL && out_claims_length == NULL))
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (state->r != L8W8JWT_SUCCESS)
+    {
+        *out_validation_result = ~L8W8JWT_VALID;
+        return state->r;
+    }
+
+    *out_validation_result = state->validation_res;
+
+    if (out_claims != NULL)
+    {
+        *out_claims = state->claims;
+        *out_claims_length = state->claims_length;
+
+        state->claims = NULL;
+        state->claims_length = 0;
+    }
+
+    return L8W8JWT_SUCCESS;
+}
+
+void l8w8jwt_decode_state_free(struct l8w8jwt_decode_state* state)
+{
+    if (state == NULL)
+    {
+        return;
+    }
+
+    if (state->restart_ctx != NULL && state->provider->free_restart_ctx != NULL)
+    {
+        state->provider->free_restart_ctx(state->restart_ctx);
+    }
+
+    if (state->own_key)
+    {
+        state->provider->free_key(state->key);
+    }
+
+    const struct l8w8jwt_allocator* previous_allocator;
+
+    if (l8w8jwt_call_allocator_enter(state->params.allocator, &previous_allocator) == L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_call_free(state->header);
+        l8w8jwt_call_free(state->payload);
+        l8w8jwt_call_free(state->signature);
+        l8w8jwt_free_claims(state->claims, state->claims_length);
+
+        l8w8jwt_call_allocator_leave(previous_allocator);
+    }
+
+    mbedtls_platform_zeroize(state, sizeof(struct l8w8jwt_decode_state));
+    l8w8jwt_free(state);
+}
+
 #undef JSMN_STATIC
 
 #ifdef __cplusplus
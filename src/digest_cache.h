@@ -0,0 +1,158 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file digest_cache.h
+ *  @author Raphael Beck
+ *  @brief Internal set-associative table of fixed-size entries keyed by a 32-byte token digest, with striped locks and hit/miss/eviction counters.
+ *  The verification and rejection caches are built on it. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_DIGEST_CACHE_H
+#define L8W8JWT_DIGEST_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/version.h"
+#include "l8w8jwt/retcodes.h"
+#include "spinlock.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <mbedtls/platform_util.h>
+
+#if !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+/* Entries per bucket (the bucket is picked by the digest, any of its entries can hold the token). */
+#define L8W8JWT_DIGEST_CACHE_WAYS 4
+
+/* Number of locks: bucket i is guarded by lock i % L8W8JWT_DIGEST_CACHE_STRIPES. */
+#define L8W8JWT_DIGEST_CACHE_STRIPES 64
+
+struct l8w8jwt_digest_cache_stripe
+{
+    atomic_flag lock;
+
+    /* Keeps the locks on separate cache lines. */
+    unsigned char padding[64 - sizeof(atomic_flag)];
+};
+
+/* Every entry starts with the 32-byte digest that it's stored under; what follows is up to the cache that embeds this. */
+struct l8w8jwt_digest_cache
+{
+    size_t bucket_count;
+    size_t entry_size;
+
+    atomic_uint_fast64_t hits;
+    atomic_uint_fast64_t misses;
+    atomic_uint_fast64_t evictions;
+
+    struct l8w8jwt_digest_cache_stripe stripes[L8W8JWT_DIGEST_CACHE_STRIPES];
+
+    unsigned char* entries;
+};
+
+/**
+ * Allocates the zeroed entry table for (at least) \p max_entries entries of \p entry_size bytes each and resets the locks and counters.
+ * @return Return code as defined in retcodes.h
+ */
+static inline int l8w8jwt_digest_cache_init(struct l8w8jwt_digest_cache* cache, const size_t max_entries, const size_t entry_size)
+{
+    if (max_entries == 0 || entry_size == 0 || max_entries > SIZE_MAX - L8W8JWT_DIGEST_CACHE_WAYS)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    const size_t bucket_count = (max_entries + L8W8JWT_DIGEST_CACHE_WAYS - 1) / L8W8JWT_DIGEST_CACHE_WAYS;
+
+    if (bucket_count > SIZE_MAX / L8W8JWT_DIGEST_CACHE_WAYS / entry_size)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    cache->bucket_count = bucket_count;
+    cache->entry_size = entry_size;
+
+    cache->entries = l8w8jwt_calloc(bucket_count * L8W8JWT_DIGEST_CACHE_WAYS, entry_size);
+    if (cache->entries == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    atomic_init(&cache->hits, 0);
+    atomic_init(&cache->misses, 0);
+    atomic_init(&cache->evictions, 0);
+
+    for (size_t i = 0; i < L8W8JWT_DIGEST_CACHE_STRIPES; ++i)
+    {
+        atomic_flag_clear(&cache->stripes[i].lock);
+    }
+
+    return L8W8JWT_SUCCESS;
+}
+
+/**
+ * Wipes and frees the entry table.
+ */
+static inline void l8w8jwt_digest_cache_destroy(struct l8w8jwt_digest_cache* cache)
+{
+    if (cache->entries != NULL)
+    {
+        mbedtls_platform_zeroize(cache->entries, cache->bucket_count * L8W8JWT_DIGEST_CACHE_WAYS * cache->entry_size);
+        l8w8jwt_free(cache->entries);
+        cache->entries = NULL;
+    }
+}
+
+static inline size_t l8w8jwt_digest_cache_bucket(const struct l8w8jwt_digest_cache* cache, const unsigned char digest[32])
+{
+    uint64_t h;
+    memcpy(&h, digest, sizeof(h));
+    return (size_t)(h % cache->bucket_count);
+}
+
+static inline void* l8w8jwt_digest_cache_entry_at(const struct l8w8jwt_digest_cache* cache, const size_t bucket, const size_t way)
+{
+    return cache->entries + (bucket * L8W8JWT_DIGEST_CACHE_WAYS + way) * cache->entry_size;
+}
+
+static inline void l8w8jwt_digest_cache_lock(struct l8w8jwt_digest_cache* cache, const size_t bucket)
+{
+    l8w8jwt_spinlock_lock(&cache->stripes[bucket % L8W8JWT_DIGEST_CACHE_STRIPES].lock);
+}
+
+static inline void l8w8jwt_digest_cache_unlock(struct l8w8jwt_digest_cache* cache, const size_t bucket)
+{
+    l8w8jwt_spinlock_unlock(&cache->stripes[bucket % L8W8JWT_DIGEST_CACHE_STRIPES].lock);
+}
+
+static inline void l8w8jwt_digest_cache_count(atomic_uint_fast64_t* counter)
+{
+    atomic_fetch_add_explicit(counter, 1, memory_order_relaxed);
+}
+
+#endif // !defined(__STDC_NO_ATOMICS__)
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_DIGEST_CACHE_H
@@ -0,0 +1,129 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ecc256.h"
+
+#if defined(__SIZEOF_INT128__)
+
+#include "sha2.h"
+
+#include <string.h>
+#include <mbedtls/platform_util.h>
+
+void l8w8jwt_ecc256_mont_pow(uint64_t r[4], const uint64_t a[4], const uint64_t e[4], const uint64_t m[4], const uint64_t m_inv, const uint64_t one[4])
+{
+    uint64_t table[16][4];
+    uint64_t t[4];
+
+    memcpy(table[0], one, sizeof(table[0]));
+    memcpy(table[1], a, sizeof(table[1]));
+    for (int i = 2; i < 16; ++i)
+    {
+        mont_mul(table[i], table[i - 1], a, m, m_inv);
+    }
+
+    memcpy(t, one, sizeof(t));
+
+    for (int i = 63; i >= 0; --i)
+    {
+        mont_mul(t, t, t, m, m_inv);
+        mont_mul(t, t, t, m, m_inv);
+        mont_mul(t, t, t, m, m_inv);
+        mont_mul(t, t, t, m, m_inv);
+
+        const unsigned int w = (unsigned int)(e[i / 16] >> (4 * (i % 16))) & 15;
+        if (w != 0)
+        {
+            mont_mul(t, t, table[w], m, m_inv);
+        }
+    }
+
+    memcpy(r, t, sizeof(t));
+    mbedtls_platform_zeroize(t, sizeof(t));
+    mbedtls_platform_zeroize(table, sizeof(table));
+}
+
+/* K = HMAC_K(V || marker || x || h1); V = HMAC_K(V) */
+static int rfc6979_update(struct l8w8jwt_rfc6979* ctx, const unsigned char marker, const unsigned char x[32], const unsigned char h1[32])
+{
+    int r;
+    unsigned char buffer[32 + 1 + 32 + 32];
+    size_t buffer_length = 32 + 1;
+
+    memcpy(buffer, ctx->V, 32);
+    buffer[32] = marker;
+
+    if (x != NULL)
+    {
+        memcpy(buffer + buffer_length, x, 32);
+        memcpy(buffer + buffer_length + 32, h1, 32);
+        buffer_length += 64;
+    }
+
+    r = l8w8jwt_hmac_sha2(MBEDTLS_MD_SHA256, ctx->K, 32, buffer, buffer_length, ctx->K);
+
+    if (r == 0)
+    {
+        r = l8w8jwt_hmac_sha2(MBEDTLS_MD_SHA256, ctx->K, 32, ctx->V, 32, ctx->V);
+    }
+
+    mbedtls_platform_zeroize(buffer, sizeof(buffer));
+    return r;
+}
+
+int l8w8jwt_rfc6979_init(struct l8w8jwt_rfc6979* ctx, const unsigned char x[32], const unsigned char h1[32])
+{
+    memset(ctx->K, 0x00, sizeof(ctx->K));
+    memset(ctx->V, 0x01, sizeof(ctx->V));
+    ctx->generated = 0;
+
+    int r = rfc6979_update(ctx, 0x00, x, h1);
+    return r != 0 ? r : rfc6979_update(ctx, 0x01, x, h1);
+}
+
+int l8w8jwt_rfc6979_generate(void* p_rng, unsigned char* out, const size_t out_length)
+{
+    struct l8w8jwt_rfc6979* ctx = (struct l8w8jwt_rfc6979*)p_rng;
+
+    if (out_length != 32)
+    {
+        return -1;
+    }
+
+    if (ctx->generated && rfc6979_update(ctx, 0x00, NULL, NULL) != 0)
+    {
+        return -1;
+    }
+
+    if (l8w8jwt_hmac_sha2(MBEDTLS_MD_SHA256, ctx->K, 32, ctx->V, 32, ctx->V) != 0)
+    {
+        return -1;
+    }
+
+    memcpy(out, ctx->V, 32);
+    ctx->generated = 1;
+    return 0;
+}
+
+#endif // __SIZEOF_INT128__
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,249 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file ecc256.h
+ *  @author Raphael Beck
+ *  @brief Arithmetic on four 64-bit limbs (Montgomery form) and the RFC 6979 nonce generator, shared by the dedicated 256-bit ECDSA engines (p256.c and secp256k1.c). NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_ECC256_H
+#define L8W8JWT_ECC256_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__SIZEOF_INT128__)
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned __int128 uint128_t;
+
+/*
+ * Numbers are four little-endian 64-bit words. Unless noted otherwise, everything is constant time.
+ */
+
+static inline uint64_t load64_be(const unsigned char* in)
+{
+    uint64_t r = 0;
+    for (int i = 0; i < 8; ++i)
+    {
+        r = (r << 8) | in[i];
+    }
+    return r;
+}
+
+static inline void store64_be(unsigned char* out, const uint64_t in)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        out[i] = (unsigned char)(in >> (56 - 8 * i));
+    }
+}
+
+static inline void words_from_bytes(uint64_t r[4], const unsigned char in[32])
+{
+    r[3] = load64_be(in);
+    r[2] = load64_be(in + 8);
+    r[1] = load64_be(in + 16);
+    r[0] = load64_be(in + 24);
+}
+
+static inline void words_to_bytes(unsigned char out[32], const uint64_t a[4])
+{
+    store64_be(out, a[3]);
+    store64_be(out + 8, a[2]);
+    store64_be(out + 16, a[1]);
+    store64_be(out + 24, a[0]);
+}
+
+static inline int words_is_zero(const uint64_t a[4])
+{
+    return (a[0] | a[1] | a[2] | a[3]) == 0;
+}
+
+/* Whether a < m (variable time: only used on public values and for RNG rejection sampling). */
+static inline int words_lt(const uint64_t a[4], const uint64_t m[4])
+{
+    for (int i = 3; i >= 0; --i)
+    {
+        if (a[i] != m[i])
+        {
+            return a[i] < m[i];
+        }
+    }
+    return 0;
+}
+
+static inline void words_cmov(uint64_t r[4], const uint64_t a[4], const uint64_t mask)
+{
+    r[0] ^= mask & (r[0] ^ a[0]);
+    r[1] ^= mask & (r[1] ^ a[1]);
+    r[2] ^= mask & (r[2] ^ a[2]);
+    r[3] ^= mask & (r[3] ^ a[3]);
+}
+
+/* Add with carry, subtract with borrow and multiply-accumulate on 64-bit words (the carry/borrow in and out is 0 or 1). */
+
+static inline uint64_t adc(uint64_t* r, const uint64_t a, const uint64_t b, const uint64_t carry)
+{
+    const uint128_t t = (uint128_t)a + b + carry;
+    *r = (uint64_t)t;
+    return (uint64_t)(t >> 64);
+}
+
+static inline uint64_t sbb(uint64_t* r, const uint64_t a, const uint64_t b, const uint64_t borrow)
+{
+    const uint128_t t = (uint128_t)a - b - borrow;
+    *r = (uint64_t)t;
+    return (uint64_t)(t >> 64) & 1;
+}
+
+static inline uint64_t mac(uint64_t* r, const uint64_t t, const uint64_t a, const uint64_t b, const uint64_t carry)
+{
+    const uint128_t x = (uint128_t)a * b + t + carry;
+    *r = (uint64_t)x;
+    return (uint64_t)(x >> 64);
+}
+
+/* r = (a + carry * 2^256) mod m, for a + carry * 2^256 < 2m (constant time) */
+static inline void mod_reduce_once(uint64_t r[4], const uint64_t a[4], const uint64_t carry, const uint64_t m[4])
+{
+    uint64_t d0, d1, d2, d3, borrow;
+
+    borrow = sbb(&d0, a[0], m[0], 0);
+    borrow = sbb(&d1, a[1], m[1], borrow);
+    borrow = sbb(&d2, a[2], m[2], borrow);
+    borrow = sbb(&d3, a[3], m[3], borrow);
+
+    // Keep a if the subtraction borrowed past the carry word (a < m).
+    const uint64_t keep_a = (uint64_t)0 - (borrow & (carry ^ 1));
+
+    r[0] = d0 ^ (keep_a & (d0 ^ a[0]));
+    r[1] = d1 ^ (keep_a & (d1 ^ a[1]));
+    r[2] = d2 ^ (keep_a & (d2 ^ a[2]));
+    r[3] = d3 ^ (keep_a & (d3 ^ a[3]));
+}
+
+static inline void mod_add(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const uint64_t m[4])
+{
+    uint64_t s[4], carry;
+
+    carry = adc(&s[0], a[0], b[0], 0);
+    carry = adc(&s[1], a[1], b[1], carry);
+    carry = adc(&s[2], a[2], b[2], carry);
+    carry = adc(&s[3], a[3], b[3], carry);
+
+    mod_reduce_once(r, s, carry, m);
+}
+
+static inline void mod_sub(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const uint64_t m[4])
+{
+    uint64_t d0, d1, d2, d3, borrow, carry;
+
+    borrow = sbb(&d0, a[0], b[0], 0);
+    borrow = sbb(&d1, a[1], b[1], borrow);
+    borrow = sbb(&d2, a[2], b[2], borrow);
+    borrow = sbb(&d3, a[3], b[3], borrow);
+
+    // Add m back if a < b.
+    const uint64_t mask = (uint64_t)0 - borrow;
+
+    carry = adc(&r[0], d0, m[0] & mask, 0);
+    carry = adc(&r[1], d1, m[1] & mask, carry);
+    carry = adc(&r[2], d2, m[2] & mask, carry);
+    adc(&r[3], d3, m[3] & mask, carry);
+}
+
+/* Montgomery multiplication (CIOS): r = a * b * 2^-256 mod m, for a, b < m */
+static inline void mont_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const uint64_t m[4], const uint64_t m_inv)
+{
+    uint64_t t[4] = { 0 };
+    uint64_t t4 = 0, t5, c, u, discard;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        const uint64_t bi = b[i];
+
+        c = mac(&t[0], t[0], a[0], bi, 0);
+        c = mac(&t[1], t[1], a[1], bi, c);
+        c = mac(&t[2], t[2], a[2], bi, c);
+        c = mac(&t[3], t[3], a[3], bi, c);
+        t5 = adc(&t4, t4, c, 0);
+
+        u = t[0] * m_inv;
+
+        c = mac(&discard, t[0], u, m[0], 0);
+        c = mac(&t[0], t[1], u, m[1], c);
+        c = mac(&t[1], t[2], u, m[2], c);
+        c = mac(&t[2], t[3], u, m[3], c);
+        c = adc(&t[3], t4, c, 0);
+        t4 = t5 + c;
+    }
+
+    (void)discard;
+    mod_reduce_once(r, t, t4, m);
+}
+
+/**
+ * Modular exponentiation in the Montgomery domain: <code>r = a^e</code> (fixed 4-bit window; only for public exponents, such as <code>m - 2</code> for inversions).
+ * @param r Where to write the result into.
+ * @param a The base (Montgomery form, fully reduced).
+ * @param e The exponent.
+ * @param m The odd modulus.
+ * @param m_inv <code>-m^-1 mod 2^64</code>
+ * @param one 1 in Montgomery form (<code>2^256 mod m</code>).
+ */
+void l8w8jwt_ecc256_mont_pow(uint64_t r[4], const uint64_t a[4], const uint64_t e[4], const uint64_t m[4], uint64_t m_inv, const uint64_t one[4]);
+
+/**
+ * HMAC-SHA-256 state of the RFC 6979 nonce generator (section 3.2, steps b - h) for 256-bit curve orders.
+ */
+struct l8w8jwt_rfc6979
+{
+    unsigned char K[32];
+    unsigned char V[32];
+    int generated;
+};
+
+/**
+ * Initializes an RFC 6979 nonce generator.
+ * @param ctx The generator to initialize.
+ * @param x The 32-byte big-endian private key.
+ * @param h1 bits2octets(h1): the 32-byte message hash, reduced mod n.
+ * @return <code>0</code> on success.
+ */
+int l8w8jwt_rfc6979_init(struct l8w8jwt_rfc6979* ctx, const unsigned char x[32], const unsigned char h1[32]);
+
+/**
+ * f_rng-compatible nonce source: every call yields the next 32-byte candidate k. Since qlen = hlen = 256, every candidate is exactly one <code>V = HMAC_K(V)</code>. <p>
+ * Signing code asks for another candidate whenever k, r or s is out of range; RFC 6979 step h.3 then wants K and V updated first, which this takes care of.
+ * @param p_rng The l8w8jwt_rfc6979 generator.
+ * @param out Where to write the candidate into.
+ * @param out_length Must be 32.
+ * @return <code>0</code> on success.
+ */
+int l8w8jwt_rfc6979_generate(void* p_rng, unsigned char* out, size_t out_length);
+
+#endif // __SIZEOF_INT128__
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_ECC256_H
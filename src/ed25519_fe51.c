@@ -0,0 +1,982 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/algs.h"
+#include "ed25519_fe51.h"
+
+#if L8W8JWT_ENABLE_EDDSA && L8W8JWT_ED25519_FE51
+
+#include "sha2.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <mbedtls/platform_util.h>
+
+typedef unsigned __int128 uint128_t;
+
+/*
+ * Field elements mod p = 2^255 - 19 in radix 2^51: f = f[0] + f[1] * 2^51 + ... + f[4] * 2^204.
+ * Limbs are only loosely reduced between operations (below 2^54), which is what fe51_mul/fe51_sq accept.
+ */
+typedef uint64_t fe51[5];
+
+#define FE51_MASK 0x7ffffffffffffULL
+
+static const fe51 fe51_d = { 0x34dca135978a3, 0x1a8283b156ebd, 0x5e7a26001c029, 0x739c663a03cbb, 0x52036cee2b6ff };
+static const fe51 fe51_d2 = { 0x69b9426b2f159, 0x35050762add7a, 0x3cf44c0038052, 0x6738cc7407977, 0x2406d9dc56dff };
+static const fe51 fe51_sqrtm1 = { 0x61b274a0ea0b0, 0x0d5a5fc8f189d, 0x7ef5e9cbd0c60, 0x78595a6804c9e, 0x2b8324804fc1d };
+
+/* Group elements: projective (P2), extended (P3), completed (P1P1), cached and precomputed (Niels) coordinates, as in ref10. */
+
+struct ge51_p2
+{
+    fe51 X, Y, Z;
+};
+
+struct ge51_p3
+{
+    fe51 X, Y, Z, T;
+};
+
+struct ge51_p1p1
+{
+    fe51 X, Y, Z, T;
+};
+
+struct ge51_cached
+{
+    fe51 YplusX, YminusX, Z, T2d;
+};
+
+struct ge51_precomp
+{
+    fe51 yplusx, yminusx, xy2d;
+};
+
+#include "ed25519_fe51_precomp.h"
+
+static inline uint64_t load64_le(const unsigned char* in)
+{
+    return (uint64_t)in[0] | ((uint64_t)in[1] << 8) | ((uint64_t)in[2] << 16) | ((uint64_t)in[3] << 24) | ((uint64_t)in[4] << 32) | ((uint64_t)in[5] << 40) | ((uint64_t)in[6] << 48) | ((uint64_t)in[7] << 56);
+}
+
+static inline void store64_le(unsigned char* out, const uint64_t in)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        out[i] = (unsigned char)(in >> (8 * i));
+    }
+}
+
+static inline void fe51_0(fe51 h)
+{
+    h[0] = h[1] = h[2] = h[3] = h[4] = 0;
+}
+
+static inline void fe51_1(fe51 h)
+{
+    h[0] = 1;
+    h[1] = h[2] = h[3] = h[4] = 0;
+}
+
+static inline void fe51_copy(fe51 h, const fe51 f)
+{
+    memcpy(h, f, sizeof(fe51));
+}
+
+static inline void fe51_add(fe51 h, const fe51 f, const fe51 g)
+{
+    h[0] = f[0] + g[0];
+    h[1] = f[1] + g[1];
+    h[2] = f[2] + g[2];
+    h[3] = f[3] + g[3];
+    h[4] = f[4] + g[4];
+}
+
+static inline void fe51_sub(fe51 h, const fe51 f, const fe51 g)
+{
+    uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+
+    // Carry g first so that adding 2p to f is guaranteed to keep every limb non-negative.
+    g1 += g0 >> 51;
+    g0 &= FE51_MASK;
+    g2 += g1 >> 51;
+    g1 &= FE51_MASK;
+    g3 += g2 >> 51;
+    g2 &= FE51_MASK;
+    g4 += g3 >> 51;
+    g3 &= FE51_MASK;
+    g0 += 19 * (g4 >> 51);
+    g4 &= FE51_MASK;
+
+    h[0] = (f[0] + 0xfffffffffffdaULL) - g0;
+    h[1] = (f[1] + 0xffffffffffffeULL) - g1;
+    h[2] = (f[2] + 0xffffffffffffeULL) - g2;
+    h[3] = (f[3] + 0xffffffffffffeULL) - g3;
+    h[4] = (f[4] + 0xffffffffffffeULL) - g4;
+}
+
+static inline void fe51_neg(fe51 h, const fe51 f)
+{
+    fe51 zero;
+    fe51_0(zero);
+    fe51_sub(h, zero, f);
+}
+
+static inline void fe51_cmov(fe51 f, const fe51 g, const unsigned int b)
+{
+    const uint64_t mask = (uint64_t)0 - (uint64_t)b;
+    f[0] ^= mask & (f[0] ^ g[0]);
+    f[1] ^= mask & (f[1] ^ g[1]);
+    f[2] ^= mask & (f[2] ^ g[2]);
+    f[3] ^= mask & (f[3] ^ g[3]);
+    f[4] ^= mask & (f[4] ^ g[4]);
+}
+
+static inline void fe51_carry(fe51 h, uint128_t r0, uint128_t r1, uint128_t r2, uint128_t r3, uint128_t r4)
+{
+    r1 += r0 >> 51;
+    r2 += r1 >> 51;
+    r3 += r2 >> 51;
+    r4 += r3 >> 51;
+
+    // Fold the carry out of the top limb back in (2^255 = 19 mod p).
+    const uint128_t c = (r4 >> 51) * 19 + ((uint64_t)r0 & FE51_MASK);
+
+    h[0] = (uint64_t)c & FE51_MASK;
+    h[1] = ((uint64_t)r1 & FE51_MASK) + (uint64_t)(c >> 51);
+    h[2] = (uint64_t)r2 & FE51_MASK;
+    h[3] = (uint64_t)r3 & FE51_MASK;
+    h[4] = (uint64_t)r4 & FE51_MASK;
+}
+
+static inline void fe51_mul(fe51 h, const fe51 f, const fe51 g)
+{
+    const uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    const uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+    const uint64_t g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3, g4_19 = 19 * g4;
+
+    const uint128_t r0 = (uint128_t)f0 * g0 + (uint128_t)f1 * g4_19 + (uint128_t)f2 * g3_19 + (uint128_t)f3 * g2_19 + (uint128_t)f4 * g1_19;
+    const uint128_t r1 = (uint128_t)f0 * g1 + (uint128_t)f1 * g0 + (uint128_t)f2 * g4_19 + (uint128_t)f3 * g3_19 + (uint128_t)f4 * g2_19;
+    const uint128_t r2 = (uint128_t)f0 * g2 + (uint128_t)f1 * g1 + (uint128_t)f2 * g0 + (uint128_t)f3 * g4_19 + (uint128_t)f4 * g3_19;
+    const uint128_t r3 = (uint128_t)f0 * g3 + (uint128_t)f1 * g2 + (uint128_t)f2 * g1 + (uint128_t)f3 * g0 + (uint128_t)f4 * g4_19;
+    const uint128_t r4 = (uint128_t)f0 * g4 + (uint128_t)f1 * g3 + (uint128_t)f2 * g2 + (uint128_t)f3 * g1 + (uint128_t)f4 * g0;
+
+    fe51_carry(h, r0, r1, r2, r3, r4);
+}
+
+static inline void fe51_sq(fe51 h, const fe51 f)
+{
+    const uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    const uint64_t f0_2 = 2 * f0, f1_2 = 2 * f1;
+    const uint64_t f1_38 = 38 * f1, f2_38 = 38 * f2, f3_38 = 38 * f3;
+    const uint64_t f3_19 = 19 * f3, f4_19 = 19 * f4;
+
+    const uint128_t r0 = (uint128_t)f0 * f0 + (uint128_t)f1_38 * f4 + (uint128_t)f2_38 * f3;
+    const uint128_t r1 = (uint128_t)f0_2 * f1 + (uint128_t)f2_38 * f4 + (uint128_t)f3_19 * f3;
+    const uint128_t r2 = (uint128_t)f0_2 * f2 + (uint128_t)f1 * f1 + (uint128_t)f3_38 * f4;
+    const uint128_t r3 = (uint128_t)f0_2 * f3 + (uint128_t)f1_2 * f2 + (uint128_t)f4_19 * f4;
+    const uint128_t r4 = (uint128_t)f0_2 * f4 + (uint128_t)f1_2 * f3 + (uint128_t)f2 * f2;
+
+    fe51_carry(h, r0, r1, r2, r3, r4);
+}
+
+static inline void fe51_sq_n(fe51 h, const fe51 f, int n)
+{
+    fe51_sq(h, f);
+    while (--n > 0)
+    {
+        fe51_sq(h, h);
+    }
+}
+
+static void fe51_frombytes(fe51 h, const unsigned char s[32])
+{
+    h[0] = load64_le(s) & FE51_MASK;
+    h[1] = (load64_le(s + 6) >> 3) & FE51_MASK;
+    h[2] = (load64_le(s + 12) >> 6) & FE51_MASK;
+    h[3] = (load64_le(s + 19) >> 1) & FE51_MASK;
+    h[4] = (load64_le(s + 24) >> 12) & FE51_MASK;
+}
+
+static inline void fe51_carry_once(uint64_t t[5])
+{
+    t[1] += t[0] >> 51;
+    t[0] &= FE51_MASK;
+    t[2] += t[1] >> 51;
+    t[1] &= FE51_MASK;
+    t[3] += t[2] >> 51;
+    t[2] &= FE51_MASK;
+    t[4] += t[3] >> 51;
+    t[3] &= FE51_MASK;
+    t[0] += 19 * (t[4] >> 51);
+    t[4] &= FE51_MASK;
+}
+
+static void fe51_tobytes(unsigned char s[32], const fe51 f)
+{
+    uint64_t t[5];
+    fe51_copy(t, f);
+
+    fe51_carry_once(t);
+    fe51_carry_once(t);
+
+    // Now 0 <= t < 2^255: add 19 and let the carry out of bit 255 tell whether t >= p.
+    t[0] += 19;
+    fe51_carry_once(t);
+
+    // Now 19 <= t < 2^255 + 19 (mod 2^255); add 2^255 - 19 and drop bit 255 to get t mod p.
+    t[0] += 0x8000000000000ULL - 19;
+    t[1] += 0x8000000000000ULL - 1;
+    t[2] += 0x8000000000000ULL - 1;
+    t[3] += 0x8000000000000ULL - 1;
+    t[4] += 0x8000000000000ULL - 1;
+
+    t[1] += t[0] >> 51;
+    t[0] &= FE51_MASK;
+    t[2] += t[1] >> 51;
+    t[1] &= FE51_MASK;
+    t[3] += t[2] >> 51;
+    t[2] &= FE51_MASK;
+    t[4] += t[3] >> 51;
+    t[3] &= FE51_MASK;
+    t[4] &= FE51_MASK;
+
+    store64_le(s, t[0] | (t[1] << 51));
+    store64_le(s + 8, (t[1] >> 13) | (t[2] << 38));
+    store64_le(s + 16, (t[2] >> 26) | (t[3] << 25));
+    store64_le(s + 24, (t[3] >> 39) | (t[4] << 12));
+}
+
+static inline int fe51_isnegative(const fe51 f)
+{
+    unsigned char s[32];
+    fe51_tobytes(s, f);
+    return s[0] & 1;
+}
+
+static inline int fe51_isnonzero(const fe51 f)
+{
+    unsigned char s[32];
+    unsigned char r = 0;
+    fe51_tobytes(s, f);
+    for (int i = 0; i < 32; ++i)
+    {
+        r |= s[i];
+    }
+    return r != 0;
+}
+
+/* z^(p - 2) */
+static void fe51_invert(fe51 out, const fe51 z)
+{
+    fe51 t0, t1, t2, t3;
+
+    fe51_sq(t0, z);
+    fe51_sq_n(t1, t0, 2);
+    fe51_mul(t1, z, t1);
+    fe51_mul(t0, t0, t1);
+    fe51_sq(t2, t0);
+    fe51_mul(t1, t1, t2);
+    fe51_sq_n(t2, t1, 5);
+    fe51_mul(t1, t2, t1);
+    fe51_sq_n(t2, t1, 10);
+    fe51_mul(t2, t2, t1);
+    fe51_sq_n(t3, t2, 20);
+    fe51_mul(t2, t3, t2);
+    fe51_sq_n(t2, t2, 10);
+    fe51_mul(t1, t2, t1);
+    fe51_sq_n(t2, t1, 50);
+    fe51_mul(t2, t2, t1);
+    fe51_sq_n(t3, t2, 100);
+    fe51_mul(t2, t3, t2);
+    fe51_sq_n(t2, t2, 50);
+    fe51_mul(t1, t2, t1);
+    fe51_sq_n(t1, t1, 5);
+    fe51_mul(out, t1, t0);
+}
+
+/* z^((p - 5) / 8) */
+static void fe51_pow22523(fe51 out, const fe51 z)
+{
+    fe51 t0, t1, t2;
+
+    fe51_sq(t0, z);
+    fe51_sq_n(t1, t0, 2);
+    fe51_mul(t1, z, t1);
+    fe51_mul(t0, t0, t1);
+    fe51_sq(t0, t0);
+    fe51_mul(t0, t1, t0);
+    fe51_sq_n(t1, t0, 5);
+    fe51_mul(t0, t1, t0);
+    fe51_sq_n(t1, t0, 10);
+    fe51_mul(t1, t1, t0);
+    fe51_sq_n(t2, t1, 20);
+    fe51_mul(t1, t2, t1);
+    fe51_sq_n(t1, t1, 10);
+    fe51_mul(t0, t1, t0);
+    fe51_sq_n(t1, t0, 50);
+    fe51_mul(t1, t1, t0);
+    fe51_sq_n(t2, t1, 100);
+    fe51_mul(t1, t2, t1);
+    fe51_sq_n(t1, t1, 50);
+    fe51_mul(t0, t1, t0);
+    fe51_sq_n(t0, t0, 2);
+    fe51_mul(out, t0, z);
+}
+
+static inline void ge51_p2_0(struct ge51_p2* h)
+{
+    fe51_0(h->X);
+    fe51_1(h->Y);
+    fe51_1(h->Z);
+}
+
+static inline void ge51_p3_0(struct ge51_p3* h)
+{
+    fe51_0(h->X);
+    fe51_1(h->Y);
+    fe51_1(h->Z);
+    fe51_0(h->T);
+}
+
+static inline void ge51_precomp_0(struct ge51_precomp* h)
+{
+    fe51_1(h->yplusx);
+    fe51_1(h->yminusx);
+    fe51_0(h->xy2d);
+}
+
+static inline void ge51_p1p1_to_p2(struct ge51_p2* r, const struct ge51_p1p1* p)
+{
+    fe51_mul(r->X, p->X, p->T);
+    fe51_mul(r->Y, p->Y, p->Z);
+    fe51_mul(r->Z, p->Z, p->T);
+}
+
+static inline void ge51_p1p1_to_p3(struct ge51_p3* r, const struct ge51_p1p1* p)
+{
+    fe51_mul(r->X, p->X, p->T);
+    fe51_mul(r->Y, p->Y, p->Z);
+    fe51_mul(r->Z, p->Z, p->T);
+    fe51_mul(r->T, p->X, p->Y);
+}
+
+static inline void ge51_p3_to_cached(struct ge51_cached* r, const struct ge51_p3* p)
+{
+    fe51_add(r->YplusX, p->Y, p->X);
+    fe51_sub(r->YminusX, p->Y, p->X);
+    fe51_copy(r->Z, p->Z);
+    fe51_mul(r->T2d, p->T, fe51_d2);
+}
+
+static inline void ge51_p2_dbl(struct ge51_p1p1* r, const struct ge51_p2* p)
+{
+    fe51 t0;
+
+    fe51_sq(r->X, p->X);
+    fe51_sq(r->Z, p->Y);
+    fe51_sq(r->T, p->Z);
+    fe51_add(r->T, r->T, r->T);
+    fe51_add(r->Y, p->X, p->Y);
+    fe51_sq(t0, r->Y);
+    fe51_add(r->Y, r->Z, r->X);
+    fe51_sub(r->Z, r->Z, r->X);
+    fe51_sub(r->X, t0, r->Y);
+    fe51_sub(r->T, r->T, r->Z);
+}
+
+static inline void ge51_p3_dbl(struct ge51_p1p1* r, const struct ge51_p3* p)
+{
+    struct ge51_p2 q;
+    fe51_copy(q.X, p->X);
+    fe51_copy(q.Y, p->Y);
+    fe51_copy(q.Z, p->Z);
+    ge51_p2_dbl(r, &q);
+}
+
+static inline void ge51_add(struct ge51_p1p1* r, const struct ge51_p3* p, const struct ge51_cached* q)
+{
+    fe51 t0;
+
+    fe51_add(r->X, p->Y, p->X);
+    fe51_sub(r->Y, p->Y, p->X);
+    fe51_mul(r->Z, r->X, q->YplusX);
+    fe51_mul(r->Y, r->Y, q->YminusX);
+    fe51_mul(r->T, q->T2d, p->T);
+    fe51_mul(r->X, p->Z, q->Z);
+    fe51_add(t0, r->X, r->X);
+    fe51_sub(r->X, r->Z, r->Y);
+    fe51_add(r->Y, r->Z, r->Y);
+    fe51_add(r->Z, t0, r->T);
+    fe51_sub(r->T, t0, r->T);
+}
+
+static inline void ge51_sub(struct ge51_p1p1* r, const struct ge51_p3* p, const struct ge51_cached* q)
+{
+    fe51 t0;
+
+    fe51_add(r->X, p->Y, p->X);
+    fe51_sub(r->Y, p->Y, p->X);
+    fe51_mul(r->Z, r->X, q->YminusX);
+    fe51_mul(r->Y, r->Y, q->YplusX);
+    fe51_mul(r->T, q->T2d, p->T);
+    fe51_mul(r->X, p->Z, q->Z);
+    fe51_add(t0, r->X, r->X);
+    fe51_sub(r->X, r->Z, r->Y);
+    fe51_add(r->Y, r->Z, r->Y);
+    fe51_sub(r->Z, t0, r->T);
+    fe51_add(r->T, t0, r->T);
+}
+
+static inline void ge51_madd(struct ge51_p1p1* r, const struct ge51_p3* p, const struct ge51_precomp* q)
+{
+    fe51 t0;
+
+    fe51_add(r->X, p->Y, p->X);
+    fe51_sub(r->Y, p->Y, p->X);
+    fe51_mul(r->Z, r->X, q->yplusx);
+    fe51_mul(r->Y, r->Y, q->yminusx);
+    fe51_mul(r->T, q->xy2d, p->T);
+    fe51_add(t0, p->Z, p->Z);
+    fe51_sub(r->X, r->Z, r->Y);
+    fe51_add(r->Y, r->Z, r->Y);
+    fe51_add(r->Z, t0, r->T);
+    fe51_sub(r->T, t0, r->T);
+}
+
+static inline void ge51_msub(struct ge51_p1p1* r, const struct ge51_p3* p, const struct ge51_precomp* q)
+{
+    fe51 t0;
+
+    fe51_add(r->X, p->Y, p->X);
+    fe51_sub(r->Y, p->Y, p->X);
+    fe51_mul(r->Z, r->X, q->yminusx);
+    fe51_mul(r->Y, r->Y, q->yplusx);
+    fe51_mul(r->T, q->xy2d, p->T);
+    fe51_add(t0, p->Z, p->Z);
+    fe51_sub(r->X, r->Z, r->Y);
+    fe51_add(r->Y, r->Z, r->Y);
+    fe51_sub(r->Z, t0, r->T);
+    fe51_add(r->T, t0, r->T);
+}
+
+static void ge51_tobytes(unsigned char s[32], const fe51 X, const fe51 Y, const fe51 Z)
+{
+    fe51 recip, x, y;
+
+    fe51_invert(recip, Z);
+    fe51_mul(x, X, recip);
+    fe51_mul(y, Y, recip);
+    fe51_tobytes(s, y);
+    s[31] ^= (unsigned char)(fe51_isnegative(x) << 7);
+}
+
+/*
+ * Decodes a point and negates it (verification needs -A).
+ * Returns 0 on success and -1 if the encoding is not a point on the curve.
+ */
+static int ge51_frombytes_negate_vartime(struct ge51_p3* h, const unsigned char s[32])
+{
+    fe51 u, v, v3, vxx, check;
+
+    fe51_frombytes(h->Y, s);
+    fe51_1(h->Z);
+    fe51_sq(u, h->Y);
+    fe51_mul(v, u, fe51_d);
+    fe51_sub(u, u, h->Z); // u = y^2 - 1
+    fe51_add(v, v, h->Z); // v = d * y^2 + 1
+
+    fe51_sq(v3, v);
+    fe51_mul(v3, v3, v); // v3 = v^3
+    fe51_sq(h->X, v3);
+    fe51_mul(h->X, h->X, v);
+    fe51_mul(h->X, h->X, u); // x = u * v^7
+
+    fe51_pow22523(h->X, h->X); // x = (u * v^7)^((p - 5) / 8)
+    fe51_mul(h->X, h->X, v3);
+    fe51_mul(h->X, h->X, u); // x = u * v^3 * (u * v^7)^((p - 5) / 8)
+
+    fe51_sq(vxx, h->X);
+    fe51_mul(vxx, vxx, v);
+    fe51_sub(check, vxx, u); // v * x^2 - u
+    if (fe51_isnonzero(check))
+    {
+        fe51_add(check, vxx, u); // v * x^2 + u
+        if (fe51_isnonzero(check))
+        {
+            return -1;
+        }
+        fe51_mul(h->X, h->X, fe51_sqrtm1);
+    }
+
+    if (fe51_isnegative(h->X) == (s[31] >> 7))
+    {
+        fe51_neg(h->X, h->X);
+    }
+
+    fe51_mul(h->T, h->X, h->Y);
+    return 0;
+}
+
+static inline unsigned char equal(const signed char b, const signed char c)
+{
+    const unsigned char x = (unsigned char)b ^ (unsigned char)c;
+    uint32_t y = x;
+    y -= 1;
+    y >>= 31;
+    return (unsigned char)y;
+}
+
+static inline unsigned char negative(const signed char b)
+{
+    uint64_t x = (uint64_t)(int64_t)b;
+    x >>= 63;
+    return (unsigned char)x;
+}
+
+static inline void ge51_cmov(struct ge51_precomp* t, const struct ge51_precomp* u, const unsigned char b)
+{
+    fe51_cmov(t->yplusx, u->yplusx, b);
+    fe51_cmov(t->yminusx, u->yminusx, b);
+    fe51_cmov(t->xy2d, u->xy2d, b);
+}
+
+/* Constant-time lookup of b * 256^pos * B for -8 <= b <= 8. */
+static void ge51_select(struct ge51_precomp* t, const int pos, const signed char b)
+{
+    struct ge51_precomp minust;
+    const unsigned char bnegative = negative(b);
+    const unsigned char babs = (unsigned char)(b - (((-bnegative) & b) * 2));
+
+    ge51_precomp_0(t);
+    for (int i = 0; i < 8; ++i)
+    {
+        ge51_cmov(t, &ge51_base[pos][i], equal((signed char)babs, (signed char)(i + 1)));
+    }
+
+    fe51_copy(minust.yplusx, t->yminusx);
+    fe51_copy(minust.yminusx, t->yplusx);
+    fe51_neg(minust.xy2d, t->xy2d);
+    ge51_cmov(t, &minust, bnegative);
+}
+
+/* h = a * B (constant time; a[31] <= 127) */
+static void ge51_scalarmult_base(struct ge51_p3* h, const unsigned char a[32])
+{
+    signed char e[64];
+    signed char carry = 0;
+    struct ge51_p1p1 r;
+    struct ge51_p2 s;
+    struct ge51_precomp t;
+
+    for (int i = 0; i < 32; ++i)
+    {
+        e[2 * i + 0] = (signed char)((a[i] >> 0) & 15);
+        e[2 * i + 1] = (signed char)((a[i] >> 4) & 15);
+    }
+
+    // Recode into signed radix-16 digits in [-8, 8).
+    for (int i = 0; i < 63; ++i)
+    {
+        e[i] = (signed char)(e[i] + carry);
+        carry = (signed char)((e[i] + 8) >> 4);
+        e[i] = (signed char)(e[i] - carry * 16);
+    }
+    e[63] = (signed char)(e[63] + carry);
+
+    ge51_p3_0(h);
+
+    for (int i = 1; i < 64; i += 2)
+    {
+        ge51_select(&t, i / 2, e[i]);
+        ge51_madd(&r, h, &t);
+        ge51_p1p1_to_p3(h, &r);
+    }
+
+    ge51_p3_dbl(&r, h);
+    ge51_p1p1_to_p2(&s, &r);
+    ge51_p2_dbl(&r, &s);
+    ge51_p1p1_to_p2(&s, &r);
+    ge51_p2_dbl(&r, &s);
+    ge51_p1p1_to_p2(&s, &r);
+    ge51_p2_dbl(&r, &s);
+    ge51_p1p1_to_p3(h, &r);
+
+    for (int i = 0; i < 64; i += 2)
+    {
+        ge51_select(&t, i / 2, e[i]);
+        ge51_madd(&r, h, &t);
+        ge51_p1p1_to_p3(h, &r);
+    }
+
+    mbedtls_platform_zeroize(e, sizeof(e));
+}
+
+/* Sliding-window (width 5) signed recoding for the variable-time double scalar multiplication. */
+static void slide(signed char r[256], const unsigned char a[32])
+{
+    for (int i = 0; i < 256; ++i)
+    {
+        r[i] = (signed char)(1 & (a[i >> 3] >> (i & 7)));
+    }
+
+    for (int i = 0; i < 256; ++i)
+    {
+        if (!r[i])
+        {
+            continue;
+        }
+
+        for (int b = 1; b <= 6 && i + b < 256; ++b)
+        {
+            if (!r[i + b])
+            {
+                continue;
+            }
+
+            if (r[i] + (r[i + b] << b) <= 15)
+            {
+                r[i] = (signed char)(r[i] + (r[i + b] << b));
+                r[i + b] = 0;
+            }
+            else if (r[i] - (r[i + b] << b) >= -15)
+            {
+                r[i] = (signed char)(r[i] - (r[i + b] << b));
+                for (int k = i + b; k < 256; ++k)
+                {
+                    if (!r[k])
+                    {
+                        r[k] = 1;
+                        break;
+                    }
+                    r[k] = 0;
+                }
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+}
+
+/* r = a * A + b * B (variable time: only ever used with public inputs) */
+static void ge51_double_scalarmult_vartime(struct ge51_p2* r, const unsigned char a[32], const struct ge51_p3* A, const unsigned char b[32])
+{
+    signed char aslide[256];
+    signed char bslide[256];
+    struct ge51_cached Ai[8]; // A, 3A, 5A, 7A, 9A, 11A, 13A, 15A
+    struct ge51_p1p1 t;
+    struct ge51_p3 u;
+    struct ge51_p3 A2;
+    int i;
+
+    slide(aslide, a);
+    slide(bslide, b);
+
+    ge51_p3_to_cached(&Ai[0], A);
+    ge51_p3_dbl(&t, A);
+    ge51_p1p1_to_p3(&A2, &t);
+
+    for (i = 0; i < 7; ++i)
+    {
+        ge51_add(&t, &A2, &Ai[i]);
+        ge51_p1p1_to_p3(&u, &t);
+        ge51_p3_to_cached(&Ai[i + 1], &u);
+    }
+
+    ge51_p2_0(r);
+
+    for (i = 255; i >= 0; --i)
+    {
+        if (aslide[i] || bslide[i])
+        {
+            break;
+        }
+    }
+
+    for (; i >= 0; --i)
+    {
+        ge51_p2_dbl(&t, r);
+
+        if (aslide[i] > 0)
+        {
+            ge51_p1p1_to_p3(&u, &t);
+            ge51_add(&t, &u, &Ai[aslide[i] / 2]);
+        }
+        else if (aslide[i] < 0)
+        {
+            ge51_p1p1_to_p3(&u, &t);
+            ge51_sub(&t, &u, &Ai[(-aslide[i]) / 2]);
+        }
+
+        if (bslide[i] > 0)
+        {
+            ge51_p1p1_to_p3(&u, &t);
+            ge51_madd(&t, &u, &ge51_base_odd[bslide[i] / 2]);
+        }
+        else if (bslide[i] < 0)
+        {
+            ge51_p1p1_to_p3(&u, &t);
+            ge51_msub(&t, &u, &ge51_base_odd[(-bslide[i]) / 2]);
+        }
+
+        ge51_p1p1_to_p2(r, &t);
+    }
+}
+
+/*
+ * Scalars mod L = 2^252 + 27742317777372353535851937790883648493, as four little-endian 64-bit words.
+ * Reduction is Barrett's with b = 2^64, k = 4 and mu = floor(2^512 / L).
+ */
+
+static const uint64_t sc_L[4] = { 0x5812631a5cf5d3edULL, 0x14def9dea2f79cd6ULL, 0x0000000000000000ULL, 0x1000000000000000ULL };
+static const uint64_t sc_mu[5] = { 0xed9ce5a30a2c131bULL, 0x2106215d086329a7ULL, 0xffffffffffffffebULL, 0xffffffffffffffffULL, 0x000000000000000fULL };
+
+/* Subtracts L from r (5 words) if r >= L, in constant time. */
+static inline void sc_cond_sub_L(uint64_t r[5])
+{
+    uint64_t t[5];
+    uint64_t borrow = 0;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        const uint128_t d = (uint128_t)r[i] - (i < 4 ? sc_L[i] : 0) - borrow;
+        t[i] = (uint64_t)d;
+        borrow = (uint64_t)(d >> 64) & 1;
+    }
+
+    const uint64_t mask = borrow - 1; // all ones if there was no borrow (r >= L)
+    for (int i = 0; i < 5; ++i)
+    {
+        r[i] ^= mask & (r[i] ^ t[i]);
+    }
+}
+
+/* out = x mod L, for any 512-bit x. */
+static void sc_barrett_reduce(unsigned char out[32], const uint64_t x[8])
+{
+    uint64_t q2[10] = { 0 };
+    uint64_t r2[5] = { 0 };
+    uint64_t r[5];
+
+    // q2 = floor(x / 2^192) * mu
+    for (int i = 0; i < 5; ++i)
+    {
+        uint64_t carry = 0;
+        for (int j = 0; j < 5; ++j)
+        {
+            const uint128_t p = (uint128_t)x[3 + i] * sc_mu[j] + q2[i + j] + carry;
+            q2[i + j] = (uint64_t)p;
+            carry = (uint64_t)(p >> 64);
+        }
+        q2[i + 5] = carry;
+    }
+
+    // r2 = (floor(q2 / 2^320) * L) mod 2^320
+    for (int i = 0; i < 5; ++i)
+    {
+        uint64_t carry = 0;
+        for (int j = 0; j < 4 && i + j < 5; ++j)
+        {
+            const uint128_t p = (uint128_t)q2[5 + i] * sc_L[j] + r2[i + j] + carry;
+            r2[i + j] = (uint64_t)p;
+            carry = (uint64_t)(p >> 64);
+        }
+        if (i + 4 < 5)
+        {
+            r2[i + 4] += carry;
+        }
+    }
+
+    // r = (x - r2) mod 2^320, which is known to be < 3L.
+    uint64_t borrow = 0;
+    for (int i = 0; i < 5; ++i)
+    {
+        const uint128_t d = (uint128_t)x[i] - r2[i] - borrow;
+        r[i] = (uint64_t)d;
+        borrow = (uint64_t)(d >> 64) & 1;
+    }
+
+    sc_cond_sub_L(r);
+    sc_cond_sub_L(r);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        store64_le(out + 8 * i, r[i]);
+    }
+
+    mbedtls_platform_zeroize(q2, sizeof(q2));
+    mbedtls_platform_zeroize(r, sizeof(r));
+}
+
+/* s = s[0..63] mod L, written into the first 32 bytes of s. */
+static void sc_reduce(unsigned char s[64])
+{
+    uint64_t x[8];
+
+    for (int i = 0; i < 8; ++i)
+    {
+        x[i] = load64_le(s + 8 * i);
+    }
+
+    sc_barrett_reduce(s, x);
+    mbedtls_platform_zeroize(x, sizeof(x));
+}
+
+/* s = (a * b + c) mod L */
+static void sc_muladd(unsigned char s[32], const unsigned char a[32], const unsigned char b[32], const unsigned char c[32])
+{
+    uint64_t aw[4], bw[4];
+    uint64_t x[8] = { 0 };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        aw[i] = load64_le(a + 8 * i);
+        bw[i] = load64_le(b + 8 * i);
+        x[i] = load64_le(c + 8 * i);
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        uint64_t carry = 0;
+        for (int j = 0; j < 4; ++j)
+        {
+            const uint128_t p = (uint128_t)aw[i] * bw[j] + x[i + j] + carry;
+            x[i + j] = (uint64_t)p;
+            carry = (uint64_t)(p >> 64);
+        }
+        for (int k = i + 4; k < 8; ++k)
+        {
+            const uint128_t t = (uint128_t)x[k] + carry;
+            x[k] = (uint64_t)t;
+            carry = (uint64_t)(t >> 64);
+        }
+    }
+
+    sc_barrett_reduce(s, x);
+
+    mbedtls_platform_zeroize(aw, sizeof(aw));
+    mbedtls_platform_zeroize(bw, sizeof(bw));
+    mbedtls_platform_zeroize(x, sizeof(x));
+}
+
+/* Whether s < L (variable time; s is public). */
+static int sc_is_canonical(const unsigned char s[32])
+{
+    for (int i = 3; i >= 0; --i)
+    {
+        const uint64_t w = load64_le(s + 8 * i);
+        if (w < sc_L[i])
+        {
+            return 1;
+        }
+        if (w > sc_L[i])
+        {
+            return 0;
+        }
+    }
+    return 0;
+}
+
+void l8w8jwt_ed25519_sign(unsigned char signature[64], const unsigned char* message, const size_t message_length, const unsigned char private_key_ref10[64])
+{
+    unsigned char az[64];
+    unsigned char nonce[64];
+    unsigned char hram[64];
+    struct ge51_p3 R;
+    struct l8w8jwt_sha2_context sha512;
+
+    l8w8jwt_sha2(MBEDTLS_MD_SHA512, private_key_ref10, 32, az);
+    az[0] &= 248;
+    az[31] &= 63;
+    az[31] |= 64;
+
+    l8w8jwt_sha2_starts(&sha512, MBEDTLS_MD_SHA512);
+    l8w8jwt_sha2_update(&sha512, az + 32, 32);
+    l8w8jwt_sha2_update(&sha512, message, message_length);
+    l8w8jwt_sha2_finish(&sha512, nonce);
+    l8w8jwt_sha2_free(&sha512);
+
+    sc_reduce(nonce);
+    ge51_scalarmult_base(&R, nonce);
+    ge51_tobytes(signature, R.X, R.Y, R.Z);
+
+    l8w8jwt_sha2_starts(&sha512, MBEDTLS_MD_SHA512);
+    l8w8jwt_sha2_update(&sha512, signature, 32);
+    l8w8jwt_sha2_update(&sha512, private_key_ref10 + 32, 32);
+    l8w8jwt_sha2_update(&sha512, message, message_length);
+    l8w8jwt_sha2_finish(&sha512, hram);
+    l8w8jwt_sha2_free(&sha512);
+
+    sc_reduce(hram);
+    sc_muladd(signature + 32, hram, az, nonce);
+
+    mbedtls_platform_zeroize(az, sizeof(az));
+    mbedtls_platform_zeroize(nonce, sizeof(nonce));
+    mbedtls_platform_zeroize(&R, sizeof(R));
+}
+
+int l8w8jwt_ed25519_verify(const unsigned char signature[64], const unsigned char* message, const size_t message_length, const unsigned char public_key[32])
+{
+    unsigned char h[64];
+    unsigned char check[32];
+    struct ge51_p3 A;
+    struct ge51_p2 R;
+    struct l8w8jwt_sha2_context sha512;
+
+    if (!sc_is_canonical(signature + 32))
+    {
+        return 0;
+    }
+
+    if (ge51_frombytes_negate_vartime(&A, public_key) != 0)
+    {
+        return 0;
+    }
+
+    l8w8jwt_sha2_starts(&sha512, MBEDTLS_MD_SHA512);
+    l8w8jwt_sha2_update(&sha512, signature, 32);
+    l8w8jwt_sha2_update(&sha512, public_key, 32);
+    l8w8jwt_sha2_update(&sha512, message, message_length);
+    l8w8jwt_sha2_finish(&sha512, h);
+    l8w8jwt_sha2_free(&sha512);
+
+    sc_reduce(h);
+
+    // R' = h * (-A) + S * B, which must encode to the R that was signed.
+    ge51_double_scalarmult_vartime(&R, h, &A, signature + 32);
+    ge51_tobytes(check, R.X, R.Y, R.Z);
+
+    unsigned char diff = 0;
+    for (int i = 0; i < 32; ++i)
+    {
+        diff |= check[i] ^ signature[i];
+    }
+
+    return diff == 0;
+}
+
+#endif // L8W8JWT_ENABLE_EDDSA && L8W8JWT_ED25519_FE51
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
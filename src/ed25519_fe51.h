@@ -0,0 +1,69 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file ed25519_fe51.h
+ *  @author Raphael Beck
+ *  @brief Ed25519 signing/verification on 64-bit limbs (radix 2^51, <code>unsigned __int128</code> products). NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_ED25519_FE51_H
+#define L8W8JWT_ED25519_FE51_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#ifndef L8W8JWT_ED25519_FE51
+/**
+ * Set this to \c 1 to sign and verify EdDSA tokens with l8w8jwt's own radix-2^51 Ed25519 backend instead of lib/ed25519's ref10 code. <p>
+ * It keeps field elements in five 51-bit limbs and multiplies them with 64x64->128-bit products, which needs a compiler that provides <code>unsigned __int128</code> (GCC/Clang on 64-bit targets). <p>
+ * Key formats stay the same: the private key is still the 64-byte Ref10 key (seed + public key), so lib/ed25519 is still what generates keys.
+ */
+#define L8W8JWT_ED25519_FE51 0
+#endif
+
+#if L8W8JWT_ED25519_FE51 && !defined(__SIZEOF_INT128__)
+#error "L8W8JWT_ED25519_FE51 requires a compiler with unsigned __int128 support."
+#endif
+
+/**
+ * Creates an Ed25519 signature (RFC 8032, pure Ed25519).
+ * @param signature Where to write the 64-byte signature into.
+ * @param message The message to sign.
+ * @param message_length Length of the message.
+ * @param private_key_ref10 The 64-byte Ref10 private key (32-byte seed followed by the 32-byte public key).
+ */
+void l8w8jwt_ed25519_sign(unsigned char signature[64], const unsigned char* message, size_t message_length, const unsigned char private_key_ref10[64]);
+
+/**
+ * Verifies an Ed25519 signature (RFC 8032, pure Ed25519). <p>
+ * Non-canonical <code>S</code> values (<code>S >= L</code>) are rejected.
+ * @param signature The 64-byte signature to verify.
+ * @param message The signed message.
+ * @param message_length Length of the message.
+ * @param public_key The 32-byte public key.
+ * @return <code>1</code> if the signature is valid; <code>0</code> if it isn't (same convention as lib/ed25519's <code>ed25519_verify</code>).
+ */
+int l8w8jwt_ed25519_verify(const unsigned char signature[64], const unsigned char* message, size_t message_length, const unsigned char public_key[32]);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_ED25519_FE51_H
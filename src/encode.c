@@ -21,20 +21,27 @@ extern "C" {
 #include "l8w8jwt/util.h"
 #include "l8w8jwt/encode.h"
 #include "l8w8jwt/base64.h"
-
+#include "l8w8jwt/prefix.h"
+#include "sha2.h"
+#include "presign.h"
+#include "psa_backend.h"
+#include "crypto_provider.h"
+#include "allocator_backend.h"
+
+#include <stdio.h>
+#include <string.h>
 #include <inttypes.h>
-#include <chillbuff.h>
-#include <mbedtls/pk.h>
-#include <mbedtls/entropy.h>
-#include <mbedtls/ctr_drbg.h>
 #include <mbedtls/md.h>
 #include <mbedtls/platform_util.h>
 
 #if L8W8JWT_ENABLE_EDDSA
+#include "ed25519_fe51.h"
+#if !L8W8JWT_ED25519_FE51
 #include <ed25519.h>
 #endif
+#endif
 
-static inline void md_info_from_alg(const int alg, mbedtls_md_info_t** md_info, mbedtls_md_type_t* md_type, size_t* md_length)
+static inline void md_type_from_alg(const int alg, mbedtls_md_type_t* md_type, size_t* md_length)
 {
     switch (alg)
     {
@@ -45,7 +52,6 @@ static inline void md_info_from_alg(const int alg, mbedtls_md_info_t** md_info,
         case L8W8JWT_ALG_ES256K:
             *md_length = 32;
             *md_type = MBEDTLS_MD_SHA256;
-            *md_info = (mbedtls_md_info_t*)mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
             break;
 
         case L8W8JWT_ALG_HS384:
@@ -54,16 +60,15 @@ static inline void md_info_from_alg(const int alg, mbedtls_md_info_t** md_info,
         case L8W8JWT_ALG_ES384:
             *md_length = 48;
             *md_type = MBEDTLS_MD_SHA384;
-            *md_info = (mbedtls_md_info_t*)mbedtls_md_info_from_type(MBEDTLS_MD_SHA384);
             break;
 
         case L8W8JWT_ALG_HS512:
         case L8W8JWT_ALG_RS512:
         case L8W8JWT_ALG_PS512:
         case L8W8JWT_ALG_ES512:
+        case L8W8JWT_ALG_ED25519:
             *md_length = 64;
             *md_type = MBEDTLS_MD_SHA512;
-            *md_info = (mbedtls_md_info_t*)mbedtls_md_info_from_type(MBEDTLS_MD_SHA512);
             break;
 
         default:
@@ -71,93 +76,62 @@ static inline void md_info_from_alg(const int alg, mbedtls_md_info_t** md_info,
     }
 }
 
-/* Step 1: prepare the token by encoding header + payload claims into a stringbuilder, ready to be signed! */
-static int write_header_and_payload(chillbuff* stringbuilder, struct l8w8jwt_encoding_params* params)
+static inline const char* get_header_prefix(const int alg, size_t* out_length)
 {
-    int r;
-    chillbuff buff;
-
-    r = chillbuff_init(&buff, 256, sizeof(char), CHILLBUFF_GROW_DUPLICATIVE);
-    if (r != CHILLBUFF_SUCCESS)
-    {
-        return L8W8JWT_OUT_OF_MEM;
-    }
-
-    switch (params->alg)
+    switch (alg)
     {
         case L8W8JWT_ALG_HS256:
-            chillbuff_push_back(&buff, "{\"alg\":\"HS256\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"HS256\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_HS384:
-            chillbuff_push_back(&buff, "{\"alg\":\"HS384\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"HS384\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_HS512:
-            chillbuff_push_back(&buff, "{\"alg\":\"HS512\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"HS512\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_RS256:
-            chillbuff_push_back(&buff, "{\"alg\":\"RS256\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"RS256\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_RS384:
-            chillbuff_push_back(&buff, "{\"alg\":\"RS384\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"RS384\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_RS512:
-            chillbuff_push_back(&buff, "{\"alg\":\"RS512\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"RS512\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_PS256:
-            chillbuff_push_back(&buff, "{\"alg\":\"PS256\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"PS256\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_PS384:
-            chillbuff_push_back(&buff, "{\"alg\":\"PS384\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"PS384\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_PS512:
-            chillbuff_push_back(&buff, "{\"alg\":\"PS512\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"PS512\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_ES256:
-            chillbuff_push_back(&buff, "{\"alg\":\"ES256\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"ES256\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_ES384:
-            chillbuff_push_back(&buff, "{\"alg\":\"ES384\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"ES384\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_ES512:
-            chillbuff_push_back(&buff, "{\"alg\":\"ES512\",\"typ\":\"JWT\"", 26);
-            break;
+            *out_length = 26;
+            return "{\"alg\":\"ES512\",\"typ\":\"JWT\"";
         case L8W8JWT_ALG_ES256K:
-            chillbuff_push_back(&buff, "{\"alg\":\"ES256K\",\"typ\":\"JWT\",\"kty\":\"EC\",\"crv\":\"secp256k1\"", 56);
-            break;
+            *out_length = 56;
+            return "{\"alg\":\"ES256K\",\"typ\":\"JWT\",\"kty\":\"EC\",\"crv\":\"secp256k1\"";
         case L8W8JWT_ALG_ED25519:
-            chillbuff_push_back(&buff, "{\"alg\":\"EdDSA\",\"typ\":\"JWT\",\"kty\":\"EC\",\"crv\":\"Ed25519\"", 53);
-            break;
+            *out_length = 53;
+            return "{\"alg\":\"EdDSA\",\"typ\":\"JWT\",\"kty\":\"EC\",\"crv\":\"Ed25519\"";
         default:
-            chillbuff_free(&buff);
-            return L8W8JWT_INVALID_ARG;
-    }
-
-    if (params->additional_header_claims_count > 0)
-    {
-        chillbuff_push_back(&buff, ",", 1);
-        l8w8jwt_write_claims(&buff, params->additional_header_claims, params->additional_header_claims_count);
-    }
-
-    chillbuff_push_back(&buff, "}", 1);
-
-    char* segment;
-    size_t segment_length;
-
-    r = l8w8jwt_base64_encode(1, buff.array, buff.length, &segment, &segment_length);
-    if (r != L8W8JWT_SUCCESS)
-    {
-        chillbuff_free(&buff);
-        return r;
+            *out_length = 0;
+            return NULL;
     }
+}
 
-    chillbuff_push_back(stringbuilder, segment, segment_length);
-
-    chillbuff_clear(&buff);
-
-    l8w8jwt_free(segment);
-    segment = NULL;
-
-    char iatnbfexp[64] = { 0x00 };
+/* Fills the registered claims array (iat, nbf, exp, sub, iss, aud, jti): unset claims have a NULL key and are skipped by the claims writer. */
+static int get_registered_claims(struct l8w8jwt_encoding_params* params, char iatnbfexp[64], struct l8w8jwt_claim claims[7])
+{
+    memset(iatnbfexp, 0x00, 64);
 
     if (params->iat)
     {
@@ -174,7 +148,7 @@ static int write_header_and_payload(chillbuff* stringbuilder, struct l8w8jwt_enc
         snprintf(iatnbfexp + 42, 21, "%" PRIu64 "", (uint64_t)params->exp);
     }
 
-    struct l8w8jwt_claim claims[] = {
+    const struct l8w8jwt_claim registered_claims[] = {
         // Setting l8w8jwt_claim::value_length to 0 makes the encoder use strlen, which in this case is fine.
         { .key = *(iatnbfexp + 00) ? "iat" : NULL, .key_length = 3, .value = iatnbfexp + 00, .value_length = 0, .type = L8W8JWT_CLAIM_TYPE_INTEGER },
         { .key = *(iatnbfexp + 21) ? "nbf" : NULL, .key_length = 3, .value = iatnbfexp + 21, .value_length = 0, .type = L8W8JWT_CLAIM_TYPE_INTEGER },
@@ -185,443 +159,447 @@ static int write_header_and_payload(chillbuff* stringbuilder, struct l8w8jwt_enc
         { .key = params->jti ? "jti" : NULL, .key_length = 3, .value = params->jti, .value_length = params->jti_length, .type = L8W8JWT_CLAIM_TYPE_STRING },
     };
 
-    chillbuff_push_back(&buff, "{", 1);
-
-    l8w8jwt_write_claims(&buff, claims, sizeof(claims) / sizeof(struct l8w8jwt_claim));
+    memcpy(claims, registered_claims, sizeof(registered_claims));
 
-    if (params->additional_payload_claims_count > 0)
+    for (size_t i = 0; i < 7; ++i)
     {
-        if (params->iat || params->exp || params->nbf || params->iss_length || params->sub_length || params->jti_length || params->aud_length)
-            chillbuff_push_back(&buff, ",", 1);
-
-        l8w8jwt_write_claims(&buff, params->additional_payload_claims, params->additional_payload_claims_count);
+        if (claims[i].key != NULL)
+        {
+            return 1;
+        }
     }
 
-    chillbuff_push_back(&buff, "}", 1);
+    return 0;
+}
 
-    r = l8w8jwt_base64_encode(1, buff.array, buff.length, &segment, &segment_length);
-    if (r != L8W8JWT_SUCCESS)
-    {
-        chillbuff_free(&buff);
-        return r;
-    }
+/* Writes the JWT header JSON into a sink (the alg must have been checked using get_header_prefix beforehand). */
+static void write_header_json(l8w8jwt_claims_sink sink, void* usr, struct l8w8jwt_encoding_params* params)
+{
+    size_t header_prefix_length;
+    const char* header_prefix = get_header_prefix(params->alg, &header_prefix_length);
 
-    chillbuff_push_back(stringbuilder, ".", 1);
-    chillbuff_push_back(stringbuilder, segment, segment_length);
+    sink(usr, header_prefix, header_prefix_length);
 
-    l8w8jwt_free(segment);
-    chillbuff_free(&buff);
+    if (params->additional_header_claims_count > 0)
+    {
+        sink(usr, ",", 1);
+        l8w8jwt_write_claims_to_sink(sink, usr, params->additional_header_claims, params->additional_header_claims_count);
+    }
 
-    return L8W8JWT_SUCCESS;
+    sink(usr, "}", 1);
 }
 
-/* Step 2: call write_header_and_payload before you call this! */
-static int write_signature(chillbuff* stringbuilder, struct l8w8jwt_encoding_params* params)
+/* Writes the registered claims followed by the additional payload claims into a sink (without curly braces). Returns whether anything was written. */
+static int write_payload_claims(l8w8jwt_claims_sink sink, void* usr, struct l8w8jwt_encoding_params* params)
 {
-    int r;
-    const int alg = params->alg;
-
-    char* signature = NULL;
-    size_t signature_length = 0, signature_bytes_length = 0, key_length = 0;
-
-    mbedtls_pk_context pk;
-    mbedtls_entropy_context entropy;
-    mbedtls_ctr_drbg_context ctr_drbg;
+    char iatnbfexp[64];
+    struct l8w8jwt_claim claims[7];
 
-    mbedtls_pk_init(&pk);
-    mbedtls_entropy_init(&entropy);
-    mbedtls_ctr_drbg_init(&ctr_drbg);
+    const int has_registered_claims = get_registered_claims(params, iatnbfexp, claims);
 
-#if L8W8JWT_SMALL_STACK
-    unsigned char* signature_bytes = l8w8jwt_calloc(sizeof(unsigned char), 4096);
-    unsigned char* key = l8w8jwt_calloc(sizeof(unsigned char), L8W8JWT_MAX_KEY_SIZE);
-
-    if (signature_bytes == NULL || key == NULL)
+    if (has_registered_claims)
     {
-        r = L8W8JWT_OUT_OF_MEM;
-        goto exit;
+        l8w8jwt_write_claims_to_sink(sink, usr, claims, sizeof(claims) / sizeof(struct l8w8jwt_claim));
     }
-#else
-    unsigned char signature_bytes[4096] = { 0x00 };
-    unsigned char key[L8W8JWT_MAX_KEY_SIZE] = { 0x00 };
-#endif
-
-    key_length = params->secret_key_length;
-    memcpy(key, params->secret_key, key_length);
-
-    /*
-     * MbedTLS requires the NUL-terminator to be included
-     * in the PEM-formatted key string passed to the key parse function.
-     * HMAC-key variants should subtract 1 from key_length again to compensate.
-     */
-    key_length += key[key_length - 1] != '\0';
 
-    r = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func, &entropy, (const unsigned char*)"l8w8jwt_mbedtls_pers.!#@", 24);
-    if (r != 0)
+    if (params->additional_payload_claims_count > 0)
     {
-        r = L8W8JWT_MBEDTLS_CTR_DRBG_SEED_FAILURE;
-        goto exit;
-    }
+        if (has_registered_claims)
+            sink(usr, ",", 1);
 
-    size_t md_length = 0;
-    mbedtls_md_type_t md_type = MBEDTLS_MD_NONE;
-    mbedtls_md_info_t* md_info = NULL;
+        l8w8jwt_write_claims_to_sink(sink, usr, params->additional_payload_claims, params->additional_payload_claims_count);
+        return 1;
+    }
 
-    md_info_from_alg(alg, &md_info, &md_type, &md_length);
+    return has_registered_claims;
+}
 
-    unsigned char hash[64] = { 0x00 };
+/* Writes the JWT payload JSON (registered claims first, then the additional payload claims) into a sink. */
+static void write_payload_json(l8w8jwt_claims_sink sink, void* usr, struct l8w8jwt_encoding_params* params)
+{
+    sink(usr, "{", 1);
+    write_payload_claims(sink, usr, params);
+    sink(usr, "}", 1);
+}
 
-    switch (alg)
-    {
-        case L8W8JWT_ALG_HS256:
-        case L8W8JWT_ALG_HS384:
-        case L8W8JWT_ALG_HS512: {
+static void count_sink(void* usr, const char* data, const size_t data_length)
+{
+    (void)data;
+    *((size_t*)usr) += data_length;
+}
 
-            /*
-             * "key_length - 1" because the MbedTLS implementation of HMAC
-             * does not require its key string to include the NUL-terminator,
-             * unlike the RSA/ECC PEM key parse function "mbedtls_pk_parse_key",
-             * which MUST include the '\0' in the PEM-formatted key string.
-             */
-            r = mbedtls_md_hmac(md_info, key, key_length - 1, (const unsigned char*)stringbuilder->array, stringbuilder->length, signature_bytes);
-            if (r != 0)
-            {
-                r = L8W8JWT_SIGNATURE_CREATION_FAILURE;
-                goto exit;
-            }
+static void base64url_stream_sink(void* usr, const char* data, const size_t data_length)
+{
+    l8w8jwt_base64url_stream_write((struct l8w8jwt_base64url_stream*)usr, (const uint8_t*)data, data_length);
+}
 
-            signature_bytes_length = 32 + (16 * params->alg);
-            break;
-        }
-        case L8W8JWT_ALG_RS256:
-        case L8W8JWT_ALG_RS384:
-        case L8W8JWT_ALG_RS512: {
+#ifndef L8W8JWT_SIGNATURE_BUFFER_SIZE
+/* Large enough for RSA signatures of every key that fits into L8W8JWT_MAX_KEY_SIZE. */
+#define L8W8JWT_SIGNATURE_BUFFER_SIZE 4096
+#endif
 
-            /* Parse & load the key string into the mbedtls pk instance. */
+#define L8W8JWT_SIGNER_SCRATCH_SIZE (L8W8JWT_MAX_KEY_SIZE + 1 > L8W8JWT_SIGNATURE_BUFFER_SIZE ? L8W8JWT_MAX_KEY_SIZE + 1 : L8W8JWT_SIGNATURE_BUFFER_SIZE)
 
-            r = mbedtls_pk_parse_key(&pk, key, key_length, params->secret_key_pw, params->secret_key_pw_length, mbedtls_ctr_drbg_random, &ctr_drbg);
-            if (r != 0)
-            {
-                r = L8W8JWT_KEY_PARSE_FAILURE;
-                goto exit;
-            }
+/*
+ * Everything that is needed for signing a token: keys are parsed and checked against the alg up-front,
+ * such that the exact signature size is known BEFORE anything is written into the output.
+ */
+struct l8w8jwt_signer
+{
+    int alg;
 
-            /* Ensure RSA functionality. */
-            if (!mbedtls_pk_can_do(&pk, MBEDTLS_PK_RSA) && !mbedtls_pk_can_do(&pk, MBEDTLS_PK_RSA_ALT))
-            {
-                r = L8W8JWT_WRONG_KEY_TYPE;
-                goto exit;
-            }
+    size_t md_length;
+    mbedtls_md_type_t md_type;
 
-            /* Weak RSA keys are forbidden! */
-            if (mbedtls_pk_get_bitlen(&pk) < 2048)
-            {
-                r = L8W8JWT_WRONG_KEY_TYPE;
-                goto exit;
-            }
+    /* Exact size of the raw (not yet base64url-encoded) signature. */
+    size_t signature_length;
 
-            /* Hash the JWT header + payload. */
-            r = mbedtls_md(md_info, (const unsigned char*)stringbuilder->array, stringbuilder->length, hash);
-            if (r != L8W8JWT_SUCCESS)
-            {
-                r = L8W8JWT_SHA2_FAILURE;
-                goto exit;
-            }
+    /* Where the raw signature is written into (points either to digest_signature or to scratch). */
+    unsigned char* signature;
 
-            /* Sign the hash using the provided private key. */
-            r = mbedtls_pk_sign(&pk, md_type, hash, md_length, signature_bytes, 4096, &signature_bytes_length, mbedtls_ctr_drbg_random, &ctr_drbg);
-            if (r != L8W8JWT_SUCCESS)
-            {
-                r = L8W8JWT_SIGNATURE_CREATION_FAILURE;
-                goto exit;
-            }
+    /* Fits HMAC, ECDSA (up to P-521) and EdDSA signatures. */
+    unsigned char digest_signature[132];
 
-            break;
-        }
-        case L8W8JWT_ALG_PS256:
-        case L8W8JWT_ALG_PS384:
-        case L8W8JWT_ALG_PS512: {
+    const unsigned char* hmac_key;
+    size_t hmac_key_length;
 
-            r = mbedtls_pk_parse_key(&pk, key, key_length, params->secret_key_pw, params->secret_key_pw_length, mbedtls_ctr_drbg_random, &ctr_drbg);
-            if (r != 0)
-            {
-                r = L8W8JWT_KEY_PARSE_FAILURE;
-                goto exit;
-            }
+    /* [OPTIONAL] Cached midstate for the constant signing input prefix. */
+    const struct l8w8jwt_prefix_context* prefix_context;
 
-            if (!mbedtls_pk_can_do(&pk, MBEDTLS_PK_RSASSA_PSS))
-            {
-                r = L8W8JWT_WRONG_KEY_TYPE;
-                goto exit;
-            }
+    /* Non-zero if the signing key lives in the PSA key store (in that case, no key is loaded through the provider). */
+    uint32_t psa_key_id;
 
-            if (mbedtls_pk_get_bitlen(&pk) < 2048)
-            {
-                r = L8W8JWT_WRONG_KEY_TYPE;
-                goto exit;
-            }
+    /* The crypto provider that hashes and signs, and its handle of the parsed RSA/EC private key (if any). */
+    const struct l8w8jwt_crypto_provider* provider;
+    void* key;
 
-            r = mbedtls_md(md_info, (const unsigned char*)stringbuilder->array, stringbuilder->length, hash);
-            if (r != L8W8JWT_SUCCESS)
-            {
-                r = L8W8JWT_SHA2_FAILURE;
-                goto exit;
-            }
+    /* RFC 6979 nonces instead of random ones (ECDSA only). */
+    int deterministic_ecdsa;
 
-            mbedtls_rsa_context* rsa = mbedtls_pk_rsa(pk);
-            mbedtls_rsa_set_padding(rsa, MBEDTLS_RSA_PKCS_V21, md_type);
+    /* [OPTIONAL] Precomputed ES256 nonces (owned by the token template, not by the signer). */
+    struct l8w8jwt_presignature_pool* presignatures;
 
-            r = mbedtls_rsa_rsassa_pss_sign(rsa, mbedtls_ctr_drbg_random, &ctr_drbg, md_type, (unsigned int)md_length, hash, signature_bytes);
-            if (r != 0)
-            {
-                r = L8W8JWT_SIGNATURE_CREATION_FAILURE;
-                goto exit;
-            }
+#if L8W8JWT_ENABLE_EDDSA
+    unsigned char private_key_ref10[64 + 1];
+#endif
 
-            signature_bytes_length = mbedtls_pk_get_bitlen(&pk) / 8;
-            break;
-        }
-        case L8W8JWT_ALG_ES256:
-        case L8W8JWT_ALG_ES384:
-        case L8W8JWT_ALG_ES512:
-        case L8W8JWT_ALG_ES256K: {
+    /* Used for the NUL-terminated PEM key copy while parsing, and afterwards for RSA signatures. */
+#if L8W8JWT_SMALL_STACK
+    unsigned char* scratch;
+#else
+    unsigned char scratch[L8W8JWT_SIGNER_SCRATCH_SIZE];
+#endif
+};
 
-            mbedtls_ecdsa_context ecdsa;
-            mbedtls_ecdsa_init(&ecdsa);
+static void signer_free(struct l8w8jwt_signer* signer)
+{
+    if (signer->key != NULL)
+    {
+        signer->provider->free_key(signer->key);
+        signer->key = NULL;
+    }
 
-            mbedtls_mpi sig_r, sig_s;
-            mbedtls_mpi_init(&sig_r);
-            mbedtls_mpi_init(&sig_s);
+#if L8W8JWT_ENABLE_EDDSA
+    mbedtls_platform_zeroize(signer->private_key_ref10, sizeof(signer->private_key_ref10));
+#endif
 
-            r = mbedtls_pk_parse_key(&pk, key, key_length, params->secret_key_pw, params->secret_key_pw_length, mbedtls_ctr_drbg_random, &ctr_drbg);
-            if (r != 0)
-            {
-                r = L8W8JWT_KEY_PARSE_FAILURE;
-                goto ecdsa_exit;
-            }
+    mbedtls_platform_zeroize(signer->digest_signature, sizeof(signer->digest_signature));
 
-            if (!mbedtls_pk_can_do(&pk, MBEDTLS_PK_ECDSA))
-            {
-                r = L8W8JWT_WRONG_KEY_TYPE;
-                goto ecdsa_exit;
-            }
+#if L8W8JWT_SMALL_STACK
+    if (signer->scratch != NULL)
+    {
+        mbedtls_platform_zeroize(signer->scratch, L8W8JWT_SIGNER_SCRATCH_SIZE);
+        l8w8jwt_free(signer->scratch);
+        signer->scratch = NULL;
+    }
+#else
+    mbedtls_platform_zeroize(signer->scratch, L8W8JWT_SIGNER_SCRATCH_SIZE);
+#endif
+}
 
-            r = mbedtls_ecdsa_from_keypair(&ecdsa, mbedtls_pk_ec(pk));
-            if (r != 0)
-            {
-                r = L8W8JWT_KEY_PARSE_FAILURE;
-                goto ecdsa_exit;
-            }
+/* Parses and checks the signing key: after this succeeded, signer->signature_length is known. Always call signer_free() afterwards (even on failure)! */
+static int signer_init(struct l8w8jwt_signer* signer, struct l8w8jwt_encoding_params* params)
+{
+    int r;
+    const int alg = params->alg;
 
-            r = mbedtls_md(md_info, (const unsigned char*)stringbuilder->array, stringbuilder->length, hash);
-            if (r != L8W8JWT_SUCCESS)
-            {
-                r = L8W8JWT_SHA2_FAILURE;
-                goto ecdsa_exit;
-            }
+    signer->alg = alg;
+    signer->md_length = 0;
+    signer->md_type = MBEDTLS_MD_NONE;
+    signer->signature_length = 0;
+    signer->signature = signer->digest_signature;
+    signer->hmac_key = NULL;
+    signer->hmac_key_length = 0;
+    signer->prefix_context = params->prefix_context;
+    signer->psa_key_id = params->psa_key_id;
+    signer->provider = l8w8jwt_get_active_crypto_provider();
+    signer->key = NULL;
+    signer->deterministic_ecdsa = params->deterministic_ecdsa;
+    signer->presignatures = NULL;
 
-            r = 0;
-            switch (alg)
-            {
-                case L8W8JWT_ALG_ES256: {
-
-                    if (ecdsa.MBEDTLS_PRIVATE(grp).id != MBEDTLS_ECP_DP_SECP256R1)
-                    {
-                        r = L8W8JWT_WRONG_KEY_TYPE;
-                        goto ecdsa_exit;
-                    }
-
-                    signature_bytes_length = 64;
-                    r = mbedtls_pk_get_bitlen(&pk) == 256;
-                    break;
-                }
-                case L8W8JWT_ALG_ES256K: {
-
-                    if (ecdsa.MBEDTLS_PRIVATE(grp).id != MBEDTLS_ECP_DP_SECP256K1)
-                    {
-                        r = L8W8JWT_WRONG_KEY_TYPE;
-                        goto ecdsa_exit;
-                    }
-
-                    signature_bytes_length = 64;
-                    r = mbedtls_pk_get_bitlen(&pk) == 256;
-                    break;
-                }
-                case L8W8JWT_ALG_ES384: {
-
-                    if (ecdsa.MBEDTLS_PRIVATE(grp).id != MBEDTLS_ECP_DP_SECP384R1)
-                    {
-                        r = L8W8JWT_WRONG_KEY_TYPE;
-                        goto ecdsa_exit;
-                    }
-
-                    signature_bytes_length = 96;
-                    r = mbedtls_pk_get_bitlen(&pk) == 384;
-                    break;
-                }
-                case L8W8JWT_ALG_ES512: {
-
-                    if (ecdsa.MBEDTLS_PRIVATE(grp).id != MBEDTLS_ECP_DP_SECP521R1)
-                    {
-                        r = L8W8JWT_WRONG_KEY_TYPE;
-                        goto ecdsa_exit;
-                    }
-
-                    signature_bytes_length = 132;
-                    r = mbedtls_pk_get_bitlen(&pk) == 521;
-                    break;
-                }
-                default:
-                    break;
-            }
+#if L8W8JWT_SMALL_STACK
+    signer->scratch = NULL;
+#endif
 
-            /*
-             * Ensure that the passed elliptic-curve cryptography key
-             * has a size that is valid and compatible with the selected JWT alg.
-             */
-            if (r == 0)
-            {
-                r = L8W8JWT_WRONG_KEY_TYPE;
-                goto ecdsa_exit;
-            }
+    md_type_from_alg(alg, &signer->md_type, &signer->md_length);
 
-            r = mbedtls_ecdsa_sign(&ecdsa.MBEDTLS_PRIVATE(grp), &sig_r, &sig_s, &ecdsa.MBEDTLS_PRIVATE(d), hash, md_length, mbedtls_ctr_drbg_random, &ctr_drbg);
-            if (r != 0)
-            {
-                r = L8W8JWT_SIGNATURE_CREATION_FAILURE;
-                goto ecdsa_exit;
-            }
+    if (signer->psa_key_id != 0)
+    {
+        /* PSA keys are imported with a randomized ECDSA policy. */
+        if (params->deterministic_ecdsa && (alg == L8W8JWT_ALG_ES256 || alg == L8W8JWT_ALG_ES384 || alg == L8W8JWT_ALG_ES512 || alg == L8W8JWT_ALG_ES256K))
+        {
+            return L8W8JWT_UNSUPPORTED_ALG;
+        }
 
-            const size_t half_signature_bytes_length = signature_bytes_length / 2;
+        /* PSA keys are neither copied nor parsed here: they were imported once up-front and are only checked against the alg. */
+        r = l8w8jwt_psa_get_signature_length(alg, signer->psa_key_id, &signer->signature_length);
+        if (r != L8W8JWT_SUCCESS)
+        {
+            return r;
+        }
 
-            r = mbedtls_mpi_write_binary(&sig_r, signature_bytes, half_signature_bytes_length);
-            if (r != 0)
+        if (signer->signature_length > sizeof(signer->digest_signature))
+        {
+            if (signer->signature_length > L8W8JWT_SIGNATURE_BUFFER_SIZE)
             {
-                r = L8W8JWT_SIGNATURE_CREATION_FAILURE;
-                goto ecdsa_exit;
+                return L8W8JWT_WRONG_KEY_TYPE;
             }
 
-            r = mbedtls_mpi_write_binary(&sig_s, signature_bytes + half_signature_bytes_length, half_signature_bytes_length);
-            if (r != 0)
+#if L8W8JWT_SMALL_STACK
+            signer->scratch = l8w8jwt_calloc(sizeof(unsigned char), L8W8JWT_SIGNER_SCRATCH_SIZE);
+            if (signer->scratch == NULL)
             {
-                r = L8W8JWT_SIGNATURE_CREATION_FAILURE;
-                goto ecdsa_exit;
+                return L8W8JWT_OUT_OF_MEM;
             }
+#endif
+            signer->signature = signer->scratch;
+        }
 
-            r = L8W8JWT_SUCCESS;
+        return L8W8JWT_SUCCESS;
+    }
 
-        ecdsa_exit:
-            mbedtls_mpi_free(&sig_r);
-            mbedtls_mpi_free(&sig_s);
-            mbedtls_ecdsa_free(&ecdsa);
-            if (r != L8W8JWT_SUCCESS)
-            {
-                goto exit;
-            }
-            break;
+    switch (alg)
+    {
+        case L8W8JWT_ALG_HS256:
+        case L8W8JWT_ALG_HS384:
+        case L8W8JWT_ALG_HS512: {
+
+            /*
+             * HMAC secrets are used as they are (no copy, no PEM parsing, no RNG needed).
+             * A trailing NUL-terminator that was included in the secret_key_length is not part of the key.
+             */
+            signer->hmac_key = params->secret_key;
+            signer->hmac_key_length = params->secret_key_length - (params->secret_key[params->secret_key_length - 1] == '\0');
+            signer->signature_length = signer->md_length;
+            return L8W8JWT_SUCCESS;
         }
         case L8W8JWT_ALG_ED25519: {
 
 #if L8W8JWT_ENABLE_EDDSA
             if (params->secret_key_length != 128 && !(params->secret_key_length == 129 && params->secret_key[128] == 0x00))
             {
-                r = L8W8JWT_WRONG_KEY_TYPE;
-                goto exit;
+                return L8W8JWT_WRONG_KEY_TYPE;
             }
 
-            unsigned char private_key_ref10[64 + 1] = { 0x00 };
-
-            if (l8w8jwt_hexstr2bin((const char*)params->secret_key, params->secret_key_length, private_key_ref10, sizeof(private_key_ref10), NULL) != 0)
+            if (l8w8jwt_hexstr2bin((const char*)params->secret_key, params->secret_key_length, signer->private_key_ref10, sizeof(signer->private_key_ref10), NULL) != 0)
             {
-                r = L8W8JWT_WRONG_KEY_TYPE;
-                goto exit;
+                return L8W8JWT_WRONG_KEY_TYPE;
             }
 
-            ed25519_sign_ref10(signature_bytes, (const unsigned char*)stringbuilder->array, stringbuilder->length, private_key_ref10);
-            signature_bytes_length = 64;
-
-            mbedtls_platform_zeroize(private_key_ref10, sizeof(private_key_ref10));
-            break;
+            signer->signature_length = 64;
+            return L8W8JWT_SUCCESS;
 #else
-            r = L8W8JWT_UNSUPPORTED_ALG;
-            goto exit;
+            return L8W8JWT_UNSUPPORTED_ALG;
 #endif
         }
-        default: {
-            r = L8W8JWT_INVALID_ARG;
-            goto exit;
-        }
+        case L8W8JWT_ALG_RS256:
+        case L8W8JWT_ALG_RS384:
+        case L8W8JWT_ALG_RS512:
+        case L8W8JWT_ALG_PS256:
+        case L8W8JWT_ALG_PS384:
+        case L8W8JWT_ALG_PS512:
+        case L8W8JWT_ALG_ES256:
+        case L8W8JWT_ALG_ES384:
+        case L8W8JWT_ALG_ES512:
+        case L8W8JWT_ALG_ES256K:
+            break;
+        default:
+            return L8W8JWT_INVALID_ARG;
     }
 
-    if (signature_bytes_length == 0)
+#if L8W8JWT_SMALL_STACK
+    signer->scratch = l8w8jwt_calloc(sizeof(unsigned char), L8W8JWT_SIGNER_SCRATCH_SIZE);
+    if (signer->scratch == NULL)
     {
-        r = L8W8JWT_SIGNATURE_CREATION_FAILURE;
-        goto exit;
+        return L8W8JWT_OUT_OF_MEM;
     }
+#endif
 
     /*
-     * If this succeeds, it mallocs "signature" (using l8w8jwt_malloc) and assigns the resulting string length to "signature_length".
+     * The PEM-formatted key string passed to the provider
+     * must include the NUL-terminator (MbedTLS requires it).
      */
-    r = l8w8jwt_base64_encode(1, (uint8_t*)signature_bytes, signature_bytes_length, &signature, &signature_length);
+    size_t key_length = params->secret_key_length;
+    memcpy(signer->scratch, params->secret_key, key_length);
+    signer->scratch[key_length] = '\0';
+    key_length += signer->scratch[key_length - 1] != '\0';
+
+    r = signer->provider->load_signing_key(alg, params->deterministic_ecdsa, signer->scratch, key_length, params->secret_key_pw, params->secret_key_pw_length, &signer->key, &signer->signature_length);
+
+    mbedtls_platform_zeroize(signer->scratch, key_length);
+
     if (r != L8W8JWT_SUCCESS)
     {
-        r = L8W8JWT_BASE64_FAILURE;
-        goto exit;
+        return r;
     }
 
-    chillbuff_push_back(stringbuilder, ".", 1);
-    chillbuff_push_back(stringbuilder, signature, signature_length);
+    /* RSA signatures don't fit into digest_signature. */
+    if (signer->signature_length > sizeof(signer->digest_signature))
+    {
+        if (signer->signature_length > L8W8JWT_SIGNATURE_BUFFER_SIZE)
+        {
+            return L8W8JWT_WRONG_KEY_TYPE;
+        }
 
-exit:
-    mbedtls_platform_zeroize(key, L8W8JWT_MAX_KEY_SIZE);
-    mbedtls_ctr_drbg_free(&ctr_drbg);
-    mbedtls_entropy_free(&entropy);
-    mbedtls_pk_free(&pk);
-    l8w8jwt_free(signature);
-#if L8W8JWT_SMALL_STACK
-    l8w8jwt_free(key);
-    l8w8jwt_free(signature_bytes);
-#endif
+        signer->signature = signer->scratch;
+    }
 
-    return r;
+    return L8W8JWT_SUCCESS;
 }
 
-/* Step 3: finalize the token by writing it into the "out" string defined in the l8w8jwt_encoding_params argument. */
-static int write_token(chillbuff* stringbuilder, struct l8w8jwt_encoding_params* params)
+/* signer_sign() for keys that live in the PSA key store. */
+static int signer_sign_psa(struct l8w8jwt_signer* signer, const unsigned char* signing_input, const size_t signing_input_length)
 {
-    *(params->out) = l8w8jwt_malloc(stringbuilder->length + 1);
-    if (*(params->out) == NULL)
+    int r;
+    unsigned char hash[64] = { 0x00 };
+
+    if (signer->alg == L8W8JWT_ALG_HS256 || signer->alg == L8W8JWT_ALG_HS384 || signer->alg == L8W8JWT_ALG_HS512)
     {
-        return L8W8JWT_OUT_OF_MEM;
+        return l8w8jwt_psa_mac(signer->alg, signer->psa_key_id, signing_input, signing_input_length, signer->signature, signer->signature_length);
     }
 
-    *(params->out_length) = stringbuilder->length;
-    (*(params->out))[stringbuilder->length] = '\0';
-    memcpy(*(params->out), stringbuilder->array, stringbuilder->length);
-
-    return L8W8JWT_SUCCESS;
-}
+    r = l8w8jwt_prefix_context_digest(signer->prefix_context, signer->alg, NULL, 0, signing_input, signing_input_length, hash);
+    if (r == 1)
+    {
+        r = signer->provider->hash(signer->md_type, signing_input, signing_input_length, hash);
+    }
 
-void l8w8jwt_encoding_params_init(struct l8w8jwt_encoding_params* params)
-{
-    if (params == NULL)
+    if (r != 0)
     {
-        return;
+        return L8W8JWT_SHA2_FAILURE;
     }
-    memset(params, 0x00, sizeof(struct l8w8jwt_encoding_params));
-    params->alg = -2;
+
+    /* PSA already outputs ECDSA signatures in the raw r || s format that JWS wants. */
+    r = l8w8jwt_psa_sign_hash(signer->alg, signer->psa_key_id, hash, signer->md_length, signer->signature, signer->signature_length);
+
+    mbedtls_platform_zeroize(hash, sizeof(hash));
+    return r;
 }
 
-int l8w8jwt_validate_encoding_params(struct l8w8jwt_encoding_params* params)
+/* Signs the passed signing input (base64url header + '.' + base64url payload): the raw signature ends up in signer->signature. */
+static int signer_sign(struct l8w8jwt_signer* signer, const unsigned char* signing_input, const size_t signing_input_length)
 {
-    if (params == NULL || params->secret_key == NULL || params->out == NULL || params->out_length == NULL)
+    int r;
+    unsigned char hash[64] = { 0x00 };
+
+    if (signer->psa_key_id != 0)
     {
-        return L8W8JWT_NULL_ARG;
+        return signer_sign_psa(signer, signing_input, signing_input_length);
     }
 
-    if (params->secret_key_length == 0 || params->secret_key_length > L8W8JWT_MAX_KEY_SIZE)
+    switch (signer->alg)
     {
-        return L8W8JWT_INVALID_ARG;
+        case L8W8JWT_ALG_HS256:
+        case L8W8JWT_ALG_HS384:
+        case L8W8JWT_ALG_HS512: {
+
+            r = l8w8jwt_prefix_context_digest(signer->prefix_context, signer->alg, signer->hmac_key, signer->hmac_key_length, signing_input, signing_input_length, signer->signature);
+            if (r == 1)
+            {
+                r = signer->provider->hmac(signer->md_type, signer->hmac_key, signer->hmac_key_length, signing_input, signing_input_length, signer->signature);
+            }
+
+            if (r != 0)
+            {
+                return L8W8JWT_SIGNATURE_CREATION_FAILURE;
+            }
+
+            return L8W8JWT_SUCCESS;
+        }
+        case L8W8JWT_ALG_ED25519: {
+
+#if L8W8JWT_ENABLE_EDDSA
+#if L8W8JWT_ED25519_FE51
+            l8w8jwt_ed25519_sign(signer->signature, signing_input, signing_input_length, signer->private_key_ref10);
+#else
+            ed25519_sign_ref10(signer->signature, signing_input, signing_input_length, signer->private_key_ref10);
+#endif
+            return L8W8JWT_SUCCESS;
+#else
+            return L8W8JWT_UNSUPPORTED_ALG;
+#endif
+        }
+        default:
+            break;
+    }
+
+    /* Hash the JWT header + payload (continuing from the cached prefix midstate if possible). */
+    r = l8w8jwt_prefix_context_digest(signer->prefix_context, signer->alg, NULL, 0, signing_input, signing_input_length, hash);
+    if (r == 1)
+    {
+        r = signer->provider->hash(signer->md_type, signing_input, signing_input_length, hash);
+    }
+
+    if (r != 0)
+    {
+        return L8W8JWT_SHA2_FAILURE;
+    }
+
+    /* Use up a precomputed nonce if there is one; if that doesn't work out, sign normally. */
+    if (signer->presignatures != NULL && signer->provider->sign_presigned != NULL)
+    {
+        unsigned char presignature[64];
+
+        if (l8w8jwt_presignature_pool_take(signer->presignatures, presignature))
+        {
+            r = signer->provider->sign_presigned(signer->key, signer->alg, hash, signer->md_length, presignature, signer->signature, signer->signature_length);
+            mbedtls_platform_zeroize(presignature, sizeof(presignature));
+
+            if (r == L8W8JWT_SUCCESS)
+            {
+                mbedtls_platform_zeroize(hash, sizeof(hash));
+                return r;
+            }
+        }
+    }
+
+    r = signer->provider->sign(signer->key, signer->alg, hash, signer->md_length, signer->signature, signer->signature_length);
+
+    mbedtls_platform_zeroize(hash, sizeof(hash));
+    return r;
+}
+
+void l8w8jwt_encoding_params_init(struct l8w8jwt_encoding_params* params)
+{
+    if (params == NULL)
+    {
+        return;
+    }
+    memset(params, 0x00, sizeof(struct l8w8jwt_encoding_params));
+    params->alg = -2;
+}
+
+/* Validates everything except the l8w8jwt_encoding_params::out and l8w8jwt_encoding_params::out_length fields. */
+static int validate_encoding_params_common(struct l8w8jwt_encoding_params* params)
+{
+    if (params == NULL || (params->secret_key == NULL && params->psa_key_id == 0))
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (params->psa_key_id == 0 && (params->secret_key_length == 0 || params->secret_key_length > L8W8JWT_MAX_KEY_SIZE))
+    {
+        return L8W8JWT_INVALID_ARG;
     }
 
     if ((params->additional_payload_claims != NULL && params->additional_payload_claims_count == 0))
@@ -634,13 +612,195 @@ int l8w8jwt_validate_encoding_params(struct l8w8jwt_encoding_params* params)
         return L8W8JWT_INVALID_ARG;
     }
 
+    if (params->allocator != NULL && (params->allocator->alloc == NULL || params->allocator->free == NULL))
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_validate_encoding_params(struct l8w8jwt_encoding_params* params)
+{
+    if (params == NULL || params->out == NULL || params->out_length == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    return validate_encoding_params_common(params);
+}
+
+/* Step 1: compute the exact token length (excluding the NUL-terminator) for an already initialized signer. */
+static size_t get_token_length(struct l8w8jwt_encoding_params* params, struct l8w8jwt_signer* signer)
+{
+    size_t header_json_length = 0;
+    size_t payload_json_length = 0;
+
+    write_header_json(&count_sink, &header_json_length, params);
+    write_payload_json(&count_sink, &payload_json_length, params);
+
+    const size_t signing_input_length = l8w8jwt_base64url_encoded_length(header_json_length) + 1 + l8w8jwt_base64url_encoded_length(payload_json_length);
+
+    return signing_input_length + 1 + l8w8jwt_base64url_encoded_length(signer->signature_length);
+}
+
+/*
+ * Signs the signing input (the first "signing_input_length" bytes inside "out", i.e. base64url header + '.' + base64url payload)
+ * in-place and appends the '.' + base64url-encoded signature + NUL-terminator to it.
+ */
+static int sign_and_finish_token(struct l8w8jwt_signer* signer, char* out, size_t signing_input_length, size_t* out_length)
+{
+    struct l8w8jwt_base64url_stream stream;
+
+    int r = signer_sign(signer, (const unsigned char*)out, signing_input_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        mbedtls_platform_zeroize(out, signing_input_length);
+        return r;
+    }
+
+    size_t n = signing_input_length;
+    out[n++] = '.';
+
+    l8w8jwt_base64url_stream_init(&stream, out + n);
+    l8w8jwt_base64url_stream_write(&stream, signer->signature, signer->signature_length);
+    n += l8w8jwt_base64url_stream_finish(&stream);
+
+    out[n] = '\0';
+    *out_length = n;
+
     return L8W8JWT_SUCCESS;
 }
 
+/*
+ * Step 2: stream header and payload JSON through the base64url encoder straight into "out",
+ * sign the (thus contiguous) signing input in-place and append the encoded signature + NUL-terminator.
+ * The "out" buffer must be at least get_token_length() + 1 bytes big!
+ */
+static int write_token(struct l8w8jwt_encoding_params* params, struct l8w8jwt_signer* signer, char* out, size_t* out_length)
+{
+    struct l8w8jwt_base64url_stream stream;
+
+    l8w8jwt_base64url_stream_init(&stream, out);
+    write_header_json(&base64url_stream_sink, &stream, params);
+    size_t n = l8w8jwt_base64url_stream_finish(&stream);
+
+    out[n++] = '.';
+
+    l8w8jwt_base64url_stream_init(&stream, out + n);
+    write_payload_json(&base64url_stream_sink, &stream, params);
+    n += l8w8jwt_base64url_stream_finish(&stream);
+
+    return sign_and_finish_token(signer, out, n, out_length);
+}
+
+int l8w8jwt_get_encoded_length(struct l8w8jwt_encoding_params* params, size_t* out_length)
+{
+    int r;
+    struct l8w8jwt_signer signer;
+    const struct l8w8jwt_allocator* previous_allocator;
+
+    if (out_length == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    r = validate_encoding_params_common(params);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    size_t header_prefix_length;
+    if (get_header_prefix(params->alg, &header_prefix_length) == NULL)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    r = l8w8jwt_call_allocator_enter(params->allocator, &previous_allocator);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    r = signer_init(&signer, params);
+    if (r == L8W8JWT_SUCCESS)
+    {
+        *out_length = get_token_length(params, &signer);
+    }
+
+    signer_free(&signer);
+    l8w8jwt_call_allocator_leave(previous_allocator);
+    return r;
+}
+
+int l8w8jwt_encode_to_buffer(struct l8w8jwt_encoding_params* params, char* out, const size_t out_size, size_t* out_length)
+{
+    int r;
+    struct l8w8jwt_signer signer;
+    const struct l8w8jwt_allocator* previous_allocator;
+
+    if (out == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    r = validate_encoding_params_common(params);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    size_t header_prefix_length;
+    if (get_header_prefix(params->alg, &header_prefix_length) == NULL)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    r = l8w8jwt_call_allocator_enter(params->allocator, &previous_allocator);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    /* The key is parsed and checked first: nothing is written into "out" if it is unusable. */
+    r = signer_init(&signer, params);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        goto exit;
+    }
+
+    const size_t token_length = get_token_length(params, &signer);
+
+    if (out_size < token_length + 1)
+    {
+        r = L8W8JWT_INSUFFICIENT_BUFFER_SIZE;
+        goto exit;
+    }
+
+    size_t written_length;
+    r = write_token(params, &signer, out, &written_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        goto exit;
+    }
+
+    if (out_length != NULL)
+    {
+        *out_length = written_length;
+    }
+
+exit:
+    signer_free(&signer);
+    l8w8jwt_call_allocator_leave(previous_allocator);
+    return r;
+}
+
 int l8w8jwt_encode(struct l8w8jwt_encoding_params* params)
 {
     int r;
-    chillbuff stringbuilder;
+    struct l8w8jwt_signer signer;
+    const struct l8w8jwt_allocator* previous_allocator;
 
     r = l8w8jwt_validate_encoding_params(params);
     if (r != L8W8JWT_SUCCESS)
@@ -648,38 +808,589 @@ int l8w8jwt_encode(struct l8w8jwt_encoding_params* params)
         return r;
     }
 
-    r = chillbuff_init(&stringbuilder, 1024, sizeof(char), CHILLBUFF_GROW_DUPLICATIVE);
-    if (r != CHILLBUFF_SUCCESS)
+    size_t header_prefix_length;
+    if (get_header_prefix(params->alg, &header_prefix_length) == NULL)
     {
-        return L8W8JWT_OUT_OF_MEM;
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    r = l8w8jwt_call_allocator_enter(params->allocator, &previous_allocator);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
     }
 
-    r = write_header_and_payload(&stringbuilder, params);
+    /* The signer is also used by token templates, which outlive the call: its scratch buffer stays on the global heap. */
+    r = signer_init(&signer, params);
     if (r != L8W8JWT_SUCCESS)
     {
         goto exit;
     }
 
-    if (params->alg != -1)
+    const size_t token_length = get_token_length(params, &signer);
+
+    /* The exact token length is known up-front: this is the only allocation needed for the output. */
+    char* out = l8w8jwt_call_malloc(token_length + 1);
+    if (out == NULL)
     {
-        r = write_signature(&stringbuilder, params);
-        if (r != L8W8JWT_SUCCESS)
-        {
-            goto exit;
-        }
+        r = L8W8JWT_OUT_OF_MEM;
+        goto exit;
     }
 
-    r = write_token(&stringbuilder, params);
+    r = write_token(params, &signer, out, params->out_length);
     if (r != L8W8JWT_SUCCESS)
     {
+        l8w8jwt_call_free(out);
         goto exit;
     }
 
+    *(params->out) = out;
+
 exit:
-    chillbuff_free(&stringbuilder);
+    signer_free(&signer);
+    l8w8jwt_call_allocator_leave(previous_allocator);
     return r;
 }
 
+int l8w8jwt_create_encoding_prefix_context(struct l8w8jwt_encoding_params* params, struct l8w8jwt_prefix_context** out_prefix_context)
+{
+    if (params == NULL || params->secret_key == NULL || out_prefix_context == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    size_t header_prefix_length;
+    if (get_header_prefix(params->alg, &header_prefix_length) == NULL)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    size_t header_json_length = 0;
+    write_header_json(&count_sink, &header_json_length, params);
+
+    const size_t prefix_length = l8w8jwt_base64url_encoded_length(header_json_length) + 1;
+
+    char* prefix = l8w8jwt_malloc(prefix_length);
+    if (prefix == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    struct l8w8jwt_base64url_stream stream;
+    l8w8jwt_base64url_stream_init(&stream, prefix);
+    write_header_json(&base64url_stream_sink, &stream, params);
+    prefix[l8w8jwt_base64url_stream_finish(&stream)] = '.';
+
+    const int r = l8w8jwt_prefix_context_create(params->alg, params->secret_key, params->secret_key_length, prefix, prefix_length, out_prefix_context);
+
+    l8w8jwt_free(prefix);
+    return r;
+}
+
+/*
+ * A compiled token template:
+ * the base64url-encoded header is computed once, the payload JSON is split into pre-serialized (and pre-escaped) fragments
+ * around the variable slots, and the signing key is parsed only once.
+ */
+struct l8w8jwt_token_template
+{
+    struct l8w8jwt_signer signer;
+
+    /* Private copy of the signing key (the signer might reference it, e.g. for HMAC). */
+    unsigned char* secret_key;
+    size_t secret_key_length;
+
+    /* Base64url-encoded header + '.' */
+    char* header;
+    size_t header_length;
+
+    /* Cached hash midstate of the (constant) header: NULL for EdDSA. */
+    struct l8w8jwt_prefix_context* prefix_context;
+
+    /* All payload JSON fragments back-to-back: fragment i spans [fragment_offsets[i]; fragment_offsets[i + 1]) */
+    char* fragments;
+    size_t* fragment_offsets;
+
+    /* The l8w8jwt_claim::type of each slot. */
+    int* slot_types;
+    size_t slots_count;
+
+    /* [OPTIONAL] See l8w8jwt_token_template_enable_presignatures() */
+    struct l8w8jwt_presignature_pool* presignatures;
+};
+
+/* Sink that appends into a pre-sized buffer (or only counts when "out" is NULL). */
+struct template_buffer_sink
+{
+    char* out;
+    size_t length;
+};
+
+static void template_buffer_sink(void* usr, const char* data, const size_t data_length)
+{
+    struct template_buffer_sink* buffer = (struct template_buffer_sink*)usr;
+
+    if (buffer->out != NULL)
+    {
+        memcpy(buffer->out + buffer->length, data, data_length);
+    }
+
+    buffer->length += data_length;
+}
+
+/* Writes the "key": part (plus the opening double-quote for string slots) of a slot. */
+static void write_template_slot_key(struct template_buffer_sink* buffer, const struct l8w8jwt_claim* slot)
+{
+    template_buffer_sink(buffer, "\"", 1);
+    l8w8jwt_escape_claim_string_to_sink(&template_buffer_sink, buffer, slot->key, slot->key_length ? slot->key_length : strlen(slot->key));
+    template_buffer_sink(buffer, "\":", 2);
+
+    if (slot->type == L8W8JWT_CLAIM_TYPE_STRING)
+    {
+        template_buffer_sink(buffer, "\"", 1);
+    }
+}
+
+/* Compares two claim keys (a key_length of 0 means that the key is NUL-terminated). */
+static int claim_keys_equal(const char* key1, size_t key1_length, const char* key2, size_t key2_length)
+{
+    key1_length = key1_length ? key1_length : strlen(key1);
+    key2_length = key2_length ? key2_length : strlen(key2);
+    return key1_length == key2_length && memcmp(key1, key2, key1_length) == 0;
+}
+
+/* Whether a slot's key is already written by the static claims (registered or additional ones) or by an earlier slot: the payload would end up with a duplicate key. */
+static int is_duplicate_template_slot(struct l8w8jwt_encoding_params* params, const struct l8w8jwt_claim* registered_claims, const struct l8w8jwt_claim* slots, const size_t slot_index)
+{
+    const struct l8w8jwt_claim* slot = slots + slot_index;
+
+    for (size_t i = 0; i < 7; ++i)
+    {
+        if (registered_claims[i].key != NULL && claim_keys_equal(registered_claims[i].key, registered_claims[i].key_length, slot->key, slot->key_length))
+        {
+            return 1;
+        }
+    }
+
+    for (size_t i = 0; params->additional_payload_claims != NULL && i < params->additional_payload_claims_count; ++i)
+    {
+        const struct l8w8jwt_claim* claim = params->additional_payload_claims + i;
+
+        if (claim->key != NULL && claim_keys_equal(claim->key, claim->key_length, slot->key, slot->key_length))
+        {
+            return 1;
+        }
+    }
+
+    for (size_t i = 0; i < slot_index; ++i)
+    {
+        if (claim_keys_equal(slots[i].key, slots[i].key_length, slot->key, slot->key_length))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* Writes all payload fragments in order, recording where each one starts if "fragment_offsets" is not NULL. */
+static void write_template_fragments(struct template_buffer_sink* buffer, struct l8w8jwt_encoding_params* params, const struct l8w8jwt_claim* slots, const size_t slots_count, size_t* fragment_offsets)
+{
+    if (fragment_offsets != NULL)
+    {
+        fragment_offsets[0] = buffer->length;
+    }
+
+    template_buffer_sink(buffer, "{", 1);
+
+    const int has_static_claims = write_payload_claims(&template_buffer_sink, buffer, params);
+
+    for (size_t i = 0; i < slots_count; ++i)
+    {
+        if (i > 0)
+        {
+            if (fragment_offsets != NULL)
+            {
+                fragment_offsets[i] = buffer->length;
+            }
+
+            if (slots[i - 1].type == L8W8JWT_CLAIM_TYPE_STRING)
+            {
+                template_buffer_sink(buffer, "\"", 1);
+            }
+        }
+
+        if (i > 0 || has_static_claims)
+        {
+            template_buffer_sink(buffer, ",", 1);
+        }
+
+        write_template_slot_key(buffer, slots + i);
+    }
+
+    if (slots_count > 0)
+    {
+        if (fragment_offsets != NULL)
+        {
+            fragment_offsets[slots_count] = buffer->length;
+        }
+
+        if (slots[slots_count - 1].type == L8W8JWT_CLAIM_TYPE_STRING)
+        {
+            template_buffer_sink(buffer, "\"", 1);
+        }
+    }
+
+    template_buffer_sink(buffer, "}", 1);
+
+    if (fragment_offsets != NULL)
+    {
+        fragment_offsets[slots_count + 1] = buffer->length;
+    }
+}
+
+int l8w8jwt_token_template_compile(struct l8w8jwt_encoding_params* params, struct l8w8jwt_claim* slots, const size_t slots_count, struct l8w8jwt_token_template** out_template)
+{
+    int r;
+
+    if (out_template == NULL || (slots == NULL && slots_count != 0))
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    r = validate_encoding_params_common(params);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    size_t header_prefix_length;
+    if (get_header_prefix(params->alg, &header_prefix_length) == NULL)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    char iatnbfexp[64];
+    struct l8w8jwt_claim registered_claims[7];
+    get_registered_claims(params, iatnbfexp, registered_claims);
+
+    for (size_t i = 0; i < slots_count; ++i)
+    {
+        if (slots[i].key == NULL)
+        {
+            return L8W8JWT_NULL_ARG;
+        }
+
+        if (slots[i].type < L8W8JWT_CLAIM_TYPE_STRING || slots[i].type > L8W8JWT_CLAIM_TYPE_OTHER)
+        {
+            return L8W8JWT_INVALID_ARG;
+        }
+
+        if (is_duplicate_template_slot(params, registered_claims, slots, i))
+        {
+            return L8W8JWT_INVALID_ARG;
+        }
+    }
+
+    struct l8w8jwt_token_template* token_template = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_token_template));
+    if (token_template == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    token_template->slots_count = slots_count;
+    token_template->secret_key_length = params->secret_key_length;
+    token_template->secret_key = l8w8jwt_malloc(params->secret_key_length + 1);
+    token_template->fragment_offsets = l8w8jwt_calloc(slots_count + 2, sizeof(size_t));
+    token_template->slot_types = l8w8jwt_calloc(slots_count + 1, sizeof(int));
+
+    struct template_buffer_sink header = { .out = NULL, .length = 0 };
+    struct template_buffer_sink fragments = { .out = NULL, .length = 0 };
+
+    write_header_json(&template_buffer_sink, &header, params);
+    write_template_fragments(&fragments, params, slots, slots_count, NULL);
+
+    token_template->header_length = l8w8jwt_base64url_encoded_length(header.length) + 1;
+    token_template->header = l8w8jwt_malloc(token_template->header_length);
+    token_template->fragments = l8w8jwt_malloc(fragments.length);
+
+    char* header_json = l8w8jwt_malloc(header.length);
+
+    if (token_template->secret_key == NULL || token_template->fragment_offsets == NULL || token_template->slot_types == NULL || token_template->header == NULL || token_template->fragments == NULL || header_json == NULL)
+    {
+        l8w8jwt_free(header_json);
+        l8w8jwt_token_template_free(token_template);
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    header.out = header_json;
+    header.length = 0;
+    write_header_json(&template_buffer_sink, &header, params);
+
+    struct l8w8jwt_base64url_stream stream;
+    l8w8jwt_base64url_stream_init(&stream, token_template->header);
+    l8w8jwt_base64url_stream_write(&stream, (const uint8_t*)header_json, header.length);
+    token_template->header[l8w8jwt_base64url_stream_finish(&stream)] = '.';
+
+    l8w8jwt_free(header_json);
+
+    fragments.out = token_template->fragments;
+    fragments.length = 0;
+    write_template_fragments(&fragments, params, slots, slots_count, token_template->fragment_offsets);
+
+    for (size_t i = 0; i < slots_count; ++i)
+    {
+        token_template->slot_types[i] = slots[i].type;
+    }
+
+    /* The signer must reference the template's own copy of the key, not the caller's (PSA keys don't need any). */
+    struct l8w8jwt_encoding_params signer_params = *params;
+
+    if (params->secret_key != NULL)
+    {
+        memcpy(token_template->secret_key, params->secret_key, params->secret_key_length);
+        signer_params.secret_key = token_template->secret_key;
+    }
+
+    r = signer_init(&token_template->signer, &signer_params);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_token_template_free(token_template);
+        return r;
+    }
+
+    /* Every token minted from this template starts with the same header: cache its hash midstate (HMACs of PSA keys are computed by PSA). */
+    const int psa_hmac = params->psa_key_id != 0 && (params->alg == L8W8JWT_ALG_HS256 || params->alg == L8W8JWT_ALG_HS384 || params->alg == L8W8JWT_ALG_HS512);
+
+    if (params->alg != L8W8JWT_ALG_ED25519 && !psa_hmac)
+    {
+        r = l8w8jwt_prefix_context_create(params->alg, token_template->secret_key, token_template->secret_key_length, token_template->header, token_template->header_length, &token_template->prefix_context);
+        if (r != L8W8JWT_SUCCESS)
+        {
+            l8w8jwt_token_template_free(token_template);
+            return r;
+        }
+
+        token_template->signer.prefix_context = token_template->prefix_context;
+    }
+
+    *out_template = token_template;
+    return L8W8JWT_SUCCESS;
+}
+
+void l8w8jwt_token_template_free(struct l8w8jwt_token_template* token_template)
+{
+    if (token_template == NULL)
+    {
+        return;
+    }
+
+    signer_free(&token_template->signer);
+    l8w8jwt_prefix_context_free(token_template->prefix_context);
+    l8w8jwt_presignature_pool_free(token_template->presignatures);
+
+    if (token_template->secret_key != NULL)
+    {
+        mbedtls_platform_zeroize(token_template->secret_key, token_template->secret_key_length);
+        l8w8jwt_free(token_template->secret_key);
+    }
+
+    l8w8jwt_free(token_template->header);
+    l8w8jwt_free(token_template->fragments);
+    l8w8jwt_free(token_template->fragment_offsets);
+    l8w8jwt_free(token_template->slot_types);
+
+    mbedtls_platform_zeroize(token_template, sizeof(struct l8w8jwt_token_template));
+    l8w8jwt_free(token_template);
+}
+
+/* Gets the exact token length for the passed slot values (excluding the NUL-terminator). */
+static int get_template_token_length(struct l8w8jwt_token_template* token_template, const char* const* values, const size_t* value_lengths, size_t* out_length)
+{
+    size_t payload_json_length = token_template->fragment_offsets[token_template->slots_count + 1];
+
+    for (size_t i = 0; i < token_template->slots_count; ++i)
+    {
+        if (values[i] == NULL)
+        {
+            return L8W8JWT_NULL_ARG;
+        }
+
+        const size_t value_length = value_lengths != NULL && value_lengths[i] ? value_lengths[i] : strlen(values[i]);
+
+        if (token_template->slot_types[i] == L8W8JWT_CLAIM_TYPE_STRING)
+        {
+            l8w8jwt_escape_claim_string_to_sink(&count_sink, &payload_json_length, values[i], value_length);
+        }
+        else
+        {
+            if (value_length == 0)
+            {
+                return L8W8JWT_INVALID_ARG;
+            }
+
+            payload_json_length += value_length;
+        }
+    }
+
+    *out_length = token_template->header_length + l8w8jwt_base64url_encoded_length(payload_json_length) + 1 + l8w8jwt_base64url_encoded_length(token_template->signer.signature_length);
+    return L8W8JWT_SUCCESS;
+}
+
+/* Concatenates the precomputed header and payload fragments with the slot values, then signs. "out" must be big enough! */
+static int write_template_token(struct l8w8jwt_token_template* token_template, const char* const* values, const size_t* value_lengths, char* out, size_t* out_length)
+{
+    struct l8w8jwt_base64url_stream stream;
+
+    memcpy(out, token_template->header, token_template->header_length);
+
+    l8w8jwt_base64url_stream_init(&stream, out + token_template->header_length);
+
+    for (size_t i = 0; i <= token_template->slots_count; ++i)
+    {
+        const size_t fragment_offset = token_template->fragment_offsets[i];
+        l8w8jwt_base64url_stream_write(&stream, (const uint8_t*)token_template->fragments + fragment_offset, token_template->fragment_offsets[i + 1] - fragment_offset);
+
+        if (i == token_template->slots_count)
+        {
+            break;
+        }
+
+        const size_t value_length = value_lengths != NULL && value_lengths[i] ? value_lengths[i] : strlen(values[i]);
+
+        if (token_template->slot_types[i] == L8W8JWT_CLAIM_TYPE_STRING)
+        {
+            l8w8jwt_escape_claim_string_to_sink(&base64url_stream_sink, &stream, values[i], value_length);
+        }
+        else
+        {
+            l8w8jwt_base64url_stream_write(&stream, (const uint8_t*)values[i], value_length);
+        }
+    }
+
+    const size_t signing_input_length = token_template->header_length + l8w8jwt_base64url_stream_finish(&stream);
+
+    return sign_and_finish_token(&token_template->signer, out, signing_input_length, out_length);
+}
+
+int l8w8jwt_token_template_encode(struct l8w8jwt_token_template* token_template, const char* const* values, const size_t* value_lengths, char** out, size_t* out_length)
+{
+    int r;
+    size_t token_length;
+
+    if (token_template == NULL || out == NULL || out_length == NULL || (values == NULL && token_template->slots_count != 0))
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    r = get_template_token_length(token_template, values, value_lengths, &token_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    char* token = l8w8jwt_malloc(token_length + 1);
+    if (token == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    r = write_template_token(token_template, values, value_lengths, token, out_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_free(token);
+        return r;
+    }
+
+    *out = token;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_token_template_encode_to_buffer(struct l8w8jwt_token_template* token_template, const char* const* values, const size_t* value_lengths, char* out, const size_t out_size, size_t* out_length)
+{
+    int r;
+    size_t token_length;
+
+    if (token_template == NULL || out == NULL || (values == NULL && token_template->slots_count != 0))
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    r = get_template_token_length(token_template, values, value_lengths, &token_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    if (out_size < token_length + 1)
+    {
+        return L8W8JWT_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    size_t written_length;
+    r = write_template_token(token_template, values, value_lengths, out, &written_length);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    if (out_length != NULL)
+    {
+        *out_length = written_length;
+    }
+
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_token_template_enable_presignatures(struct l8w8jwt_token_template* token_template, const size_t capacity)
+{
+    if (token_template == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (token_template->presignatures != NULL || capacity == 0)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    const struct l8w8jwt_signer* signer = &token_template->signer;
+
+    if (signer->alg != L8W8JWT_ALG_ES256 || signer->psa_key_id != 0 || signer->deterministic_ecdsa || signer->provider->sign_presigned == NULL)
+    {
+        return L8W8JWT_UNSUPPORTED_ALG;
+    }
+
+    int r = l8w8jwt_presignature_pool_create(capacity, &token_template->presignatures);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    token_template->signer.presignatures = token_template->presignatures;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_token_template_refill_presignatures(struct l8w8jwt_token_template* token_template, const size_t max_count, size_t* out_added)
+{
+    if (token_template == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (token_template->presignatures == NULL)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    return l8w8jwt_presignature_pool_refill(token_template->presignatures, max_count, out_added);
+}
+
+size_t l8w8jwt_token_template_get_presignatures_count(struct l8w8jwt_token_template* token_template)
+{
+    return token_template != NULL && token_template->presignatures != NULL ? l8w8jwt_presignature_pool_available(token_template->presignatures) : 0;
+}
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
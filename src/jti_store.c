@@ -0,0 +1,416 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/retcodes.h"
+#include "l8w8jwt/jti_store.h"
+#include "sha2.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+/* Maximum number of shards (each one has its own lock, table and timing wheel). */
+#define L8W8JWT_JTI_STORE_MAX_SHARDS 16
+
+/* Shards are only split off while each of them still gets at least this many entries. */
+#define L8W8JWT_JTI_STORE_MIN_SHARD_ENTRIES 256
+
+/* Timing wheel slots (one per second): an entry sits in slot (expires_at % L8W8JWT_JTI_STORE_WHEEL_SIZE) until the wheel passes it in the round that it expires in. */
+#define L8W8JWT_JTI_STORE_WHEEL_SIZE 1024
+
+/* Marks the end of a node list (and empty table slots). */
+#define L8W8JWT_JTI_STORE_NIL UINT32_MAX
+
+struct l8w8jwt_jti_store_node
+{
+    /* 128-bit jti fingerprint (truncated SHA-256). */
+    uint64_t fingerprint[2];
+
+    int64_t expires_at;
+
+    /* Next node in the same wheel slot (or in the free list). */
+    uint32_t next;
+
+    /* The table slot that references this node (kept up to date when entries are shifted back on deletion). */
+    uint32_t slot;
+};
+
+struct l8w8jwt_jti_store_shard
+{
+    atomic_flag lock;
+
+    /* Open-addressing table (linear probing) of node indices; L8W8JWT_JTI_STORE_NIL means empty. Twice as many slots as nodes. */
+    uint32_t* table;
+    size_t table_mask;
+
+    struct l8w8jwt_jti_store_node* nodes;
+    uint32_t free_list;
+    size_t live;
+
+    /* Every entry that expired before this point in time has been removed already. */
+    int64_t swept_until;
+
+    uint32_t wheel[L8W8JWT_JTI_STORE_WHEEL_SIZE];
+
+    uint64_t replays;
+    uint64_t expirations;
+};
+
+struct l8w8jwt_jti_store
+{
+    size_t shard_count;
+    struct l8w8jwt_jti_store_shard* shards;
+};
+
+static inline void l8w8jwt_jti_store_lock(struct l8w8jwt_jti_store_shard* shard)
+{
+    while (atomic_flag_test_and_set_explicit(&shard->lock, memory_order_acquire))
+    {
+        /* Critical sections are a probe sequence long (plus the occasional wheel tick). */
+    }
+}
+
+static inline void l8w8jwt_jti_store_unlock(struct l8w8jwt_jti_store_shard* shard)
+{
+    atomic_flag_clear_explicit(&shard->lock, memory_order_release);
+}
+
+/* Removes a node from the table, shifting the following entries of its probe sequence back so that lookups never need tombstones. */
+static void l8w8jwt_jti_store_table_remove(struct l8w8jwt_jti_store_shard* shard, size_t hole)
+{
+    size_t i = hole;
+
+    for (;;)
+    {
+        i = (i + 1) & shard->table_mask;
+
+        const uint32_t index = shard->table[i];
+        if (index == L8W8JWT_JTI_STORE_NIL)
+        {
+            break;
+        }
+
+        const size_t home = (size_t)shard->nodes[index].fingerprint[0] & shard->table_mask;
+
+        /* The entry at i can move into the hole only if its home slot isn't cyclically within (hole, i]. */
+        if (((i - home) & shard->table_mask) >= ((i - hole) & shard->table_mask))
+        {
+            shard->table[hole] = index;
+            shard->nodes[index].slot = (uint32_t)hole;
+            hole = i;
+        }
+    }
+
+    shard->table[hole] = L8W8JWT_JTI_STORE_NIL;
+}
+
+/* Advances the shard's timing wheel to now, dropping every entry that expired in the meantime. */
+static void l8w8jwt_jti_store_tick(struct l8w8jwt_jti_store_shard* shard, const int64_t now)
+{
+    if (now <= shard->swept_until)
+    {
+        return;
+    }
+
+    int64_t ticks = now - shard->swept_until;
+    if (ticks > L8W8JWT_JTI_STORE_WHEEL_SIZE)
+    {
+        ticks = L8W8JWT_JTI_STORE_WHEEL_SIZE;
+    }
+
+    for (int64_t t = 0; t < ticks; ++t)
+    {
+        uint32_t* link = &shard->wheel[(uint64_t)(shard->swept_until + t) % L8W8JWT_JTI_STORE_WHEEL_SIZE];
+
+        while (*link != L8W8JWT_JTI_STORE_NIL)
+        {
+            const uint32_t index = *link;
+            struct l8w8jwt_jti_store_node* node = &shard->nodes[index];
+
+            if (node->expires_at >= now)
+            {
+                /* Expires in a later round of the wheel. */
+                link = &node->next;
+                continue;
+            }
+
+            *link = node->next;
+
+            l8w8jwt_jti_store_table_remove(shard, node->slot);
+
+            node->next = shard->free_list;
+            shard->free_list = index;
+
+            --shard->live;
+            ++shard->expirations;
+        }
+    }
+
+    shard->swept_until = now;
+}
+
+int l8w8jwt_jti_store_create(const size_t max_entries, struct l8w8jwt_jti_store** out_jti_store)
+{
+    if (out_jti_store == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (max_entries == 0 || max_entries > (UINT32_MAX >> 2))
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    struct l8w8jwt_jti_store* store = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_jti_store));
+    if (store == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    store->shard_count = 1;
+    while (store->shard_count < L8W8JWT_JTI_STORE_MAX_SHARDS && max_entries / (store->shard_count << 1) >= L8W8JWT_JTI_STORE_MIN_SHARD_ENTRIES)
+    {
+        store->shard_count <<= 1;
+    }
+
+    /* Hashing doesn't spread the entries perfectly evenly over the shards. */
+    size_t shard_capacity = (max_entries + store->shard_count - 1) / store->shard_count;
+    if (store->shard_count > 1)
+    {
+        shard_capacity += shard_capacity / 8;
+    }
+
+    size_t table_size = 2;
+    while (table_size < shard_capacity * 2)
+    {
+        table_size <<= 1;
+    }
+
+    store->shards = l8w8jwt_calloc(store->shard_count, sizeof(struct l8w8jwt_jti_store_shard));
+    if (store->shards == NULL)
+    {
+        l8w8jwt_free(store);
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    const int64_t now = (int64_t)l8w8jwt_time(NULL);
+
+    for (size_t s = 0; s < store->shard_count; ++s)
+    {
+        struct l8w8jwt_jti_store_shard* shard = &store->shards[s];
+
+        atomic_flag_clear(&shard->lock);
+
+        shard->table = l8w8jwt_malloc(table_size * sizeof(uint32_t));
+        shard->nodes = l8w8jwt_malloc(shard_capacity * sizeof(struct l8w8jwt_jti_store_node));
+
+        if (shard->table == NULL || shard->nodes == NULL)
+        {
+            l8w8jwt_jti_store_free(store);
+            return L8W8JWT_OUT_OF_MEM;
+        }
+
+        shard->table_mask = table_size - 1;
+        memset(shard->table, 0xFF, table_size * sizeof(uint32_t));
+        memset(shard->wheel, 0xFF, sizeof(shard->wheel));
+
+        for (size_t i = 0; i < shard_capacity; ++i)
+        {
+            shard->nodes[i].next = i + 1 < shard_capacity ? (uint32_t)(i + 1) : L8W8JWT_JTI_STORE_NIL;
+        }
+
+        shard->free_list = 0;
+        shard->swept_until = now;
+    }
+
+    *out_jti_store = store;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_jti_store_check_and_insert(struct l8w8jwt_jti_store* jti_store, const char* jti, const size_t jti_length, const l8w8jwt_time_t expires_at, int* out_replayed)
+{
+    if (jti_store == NULL || jti == NULL || out_replayed == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    unsigned char hash[32];
+    if (l8w8jwt_sha2(MBEDTLS_MD_SHA256, (const unsigned char*)jti, jti_length, hash) != 0)
+    {
+        return L8W8JWT_SHA2_FAILURE;
+    }
+
+    uint64_t fingerprint[2];
+    memcpy(fingerprint, hash, sizeof(fingerprint));
+
+    /* The low bits of the first fingerprint word pick the table slot, the high bits the shard. */
+    struct l8w8jwt_jti_store_shard* shard = &jti_store->shards[(size_t)(fingerprint[0] >> 60) & (jti_store->shard_count - 1)];
+
+    const int64_t now = (int64_t)l8w8jwt_time(NULL);
+
+    int r = L8W8JWT_SUCCESS;
+    *out_replayed = 0;
+
+    l8w8jwt_jti_store_lock(shard);
+    l8w8jwt_jti_store_tick(shard, now);
+
+    size_t i = (size_t)fingerprint[0] & shard->table_mask;
+
+    for (;; i = (i + 1) & shard->table_mask)
+    {
+        const uint32_t index = shard->table[i];
+
+        if (index == L8W8JWT_JTI_STORE_NIL)
+        {
+            break;
+        }
+
+        const struct l8w8jwt_jti_store_node* node = &shard->nodes[index];
+
+        if (node->fingerprint[0] == fingerprint[0] && node->fingerprint[1] == fingerprint[1])
+        {
+            *out_replayed = 1;
+            ++shard->replays;
+            goto exit;
+        }
+    }
+
+    if ((int64_t)expires_at < now)
+    {
+        /* Already expired: nothing to remember. */
+        goto exit;
+    }
+
+    const uint32_t index = shard->free_list;
+    if (index == L8W8JWT_JTI_STORE_NIL)
+    {
+        r = L8W8JWT_OUT_OF_MEM;
+        goto exit;
+    }
+
+    struct l8w8jwt_jti_store_node* node = &shard->nodes[index];
+    shard->free_list = node->next;
+
+    node->fingerprint[0] = fingerprint[0];
+    node->fingerprint[1] = fingerprint[1];
+    node->expires_at = (int64_t)expires_at;
+    node->slot = (uint32_t)i;
+
+    uint32_t* wheel_slot = &shard->wheel[(uint64_t)node->expires_at % L8W8JWT_JTI_STORE_WHEEL_SIZE];
+    node->next = *wheel_slot;
+    *wheel_slot = index;
+
+    shard->table[i] = index;
+    ++shard->live;
+
+exit:
+    l8w8jwt_jti_store_unlock(shard);
+    return r;
+}
+
+int l8w8jwt_jti_store_get_stats(struct l8w8jwt_jti_store* jti_store, struct l8w8jwt_jti_store_stats* out_stats)
+{
+    if (jti_store == NULL || out_stats == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    memset(out_stats, 0x00, sizeof(struct l8w8jwt_jti_store_stats));
+
+    const int64_t now = (int64_t)l8w8jwt_time(NULL);
+
+    for (size_t s = 0; s < jti_store->shard_count; ++s)
+    {
+        struct l8w8jwt_jti_store_shard* shard = &jti_store->shards[s];
+
+        l8w8jwt_jti_store_lock(shard);
+        l8w8jwt_jti_store_tick(shard, now);
+
+        out_stats->entries += shard->live;
+        out_stats->replays += shard->replays;
+        out_stats->expirations += shard->expirations;
+
+        l8w8jwt_jti_store_unlock(shard);
+    }
+
+    return L8W8JWT_SUCCESS;
+}
+
+void l8w8jwt_jti_store_free(struct l8w8jwt_jti_store* jti_store)
+{
+    if (jti_store == NULL)
+    {
+        return;
+    }
+
+    if (jti_store->shards != NULL)
+    {
+        for (size_t s = 0; s < jti_store->shard_count; ++s)
+        {
+            l8w8jwt_free(jti_store->shards[s].table);
+            l8w8jwt_free(jti_store->shards[s].nodes);
+        }
+
+        l8w8jwt_free(jti_store->shards);
+    }
+
+    l8w8jwt_free(jti_store);
+}
+
+#else
+
+int l8w8jwt_jti_store_create(const size_t max_entries, struct l8w8jwt_jti_store** out_jti_store)
+{
+    (void)max_entries;
+    (void)out_jti_store;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_jti_store_check_and_insert(struct l8w8jwt_jti_store* jti_store, const char* jti, const size_t jti_length, const l8w8jwt_time_t expires_at, int* out_replayed)
+{
+    (void)jti_store;
+    (void)jti;
+    (void)jti_length;
+    (void)expires_at;
+    (void)out_replayed;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_jti_store_get_stats(struct l8w8jwt_jti_store* jti_store, struct l8w8jwt_jti_store_stats* out_stats)
+{
+    (void)jti_store;
+    (void)out_stats;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+void l8w8jwt_jti_store_free(struct l8w8jwt_jti_store* jti_store)
+{
+    (void)jti_store;
+}
+
+#endif // !defined(__STDC_NO_ATOMICS__)
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
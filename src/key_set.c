@@ -0,0 +1,478 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/algs.h"
+#include "l8w8jwt/retcodes.h"
+#include "l8w8jwt/verification_key.h"
+#include "key_set_backend.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mbedtls/platform_util.h>
+
+#if !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+struct l8w8jwt_key_set_key
+{
+    char* kid;
+    size_t kid_length;
+    int alg;
+
+    /* RS*, PS* and ES* keys are parsed; HMAC secrets and EdDSA keys are kept as they are. */
+    struct l8w8jwt_verification_key* verification_key;
+    unsigned char* key;
+    size_t key_length;
+};
+
+/* An immutable, published set of keys. */
+struct l8w8jwt_key_set_snapshot
+{
+    size_t count;
+    struct l8w8jwt_key_set_key keys[];
+};
+
+/*
+ * Epoch-based reclamation: a reader announces the epoch that it observed before it loads the current snapshot, and announces 0 once it's done with it.
+ * A writer swaps in the new snapshot, advances the epoch and waits until every reader is either idle or has announced the new epoch:
+ * such readers can only ever have loaded the new snapshot, so the old one can be freed.
+ */
+struct l8w8jwt_key_set_reader
+{
+    /* Written only by the reader's thread, read by writers. Padded to keep readers off each other's cache lines. */
+    atomic_uint_fast64_t epoch;
+    unsigned char padding[64 - sizeof(atomic_uint_fast64_t)];
+
+    struct l8w8jwt_key_set* key_set;
+    struct l8w8jwt_key_set_reader* prev;
+    struct l8w8jwt_key_set_reader* next;
+};
+
+struct l8w8jwt_key_set
+{
+    _Atomic(struct l8w8jwt_key_set_snapshot*) current;
+    atomic_uint_fast64_t epoch;
+
+    /* Serializes publications. */
+    atomic_flag publish_lock;
+
+    /* Guards the list of readers (only ever taken by writers and when creating or freeing readers). */
+    atomic_flag readers_lock;
+    struct l8w8jwt_key_set_reader* readers;
+};
+
+static inline void l8w8jwt_key_set_spin_lock(atomic_flag* lock)
+{
+    while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire))
+    {
+    }
+}
+
+static inline void l8w8jwt_key_set_spin_unlock(atomic_flag* lock)
+{
+    atomic_flag_clear_explicit(lock, memory_order_release);
+}
+
+static void l8w8jwt_key_set_snapshot_free(struct l8w8jwt_key_set_snapshot* snapshot)
+{
+    if (snapshot == NULL)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < snapshot->count; ++i)
+    {
+        struct l8w8jwt_key_set_key* key = &snapshot->keys[i];
+
+        l8w8jwt_verification_key_free(key->verification_key);
+
+        if (key->key != NULL)
+        {
+            mbedtls_platform_zeroize(key->key, key->key_length);
+            l8w8jwt_free(key->key);
+        }
+
+        l8w8jwt_free(key->kid);
+    }
+
+    l8w8jwt_free(snapshot);
+}
+
+static int l8w8jwt_key_set_snapshot_create(const struct l8w8jwt_key_set_entry* entries, const size_t entries_count, const size_t max_table_size, struct l8w8jwt_key_set_snapshot** out_snapshot)
+{
+    if (entries_count > (SIZE_MAX - sizeof(struct l8w8jwt_key_set_snapshot)) / sizeof(struct l8w8jwt_key_set_key))
+    {
+        return L8W8JWT_OVERFLOW;
+    }
+
+    struct l8w8jwt_key_set_snapshot* snapshot = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_key_set_snapshot) + entries_count * sizeof(struct l8w8jwt_key_set_key));
+    if (snapshot == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    int r = L8W8JWT_SUCCESS;
+
+    for (size_t i = 0; i < entries_count; ++i)
+    {
+        const struct l8w8jwt_key_set_entry* entry = &entries[i];
+        struct l8w8jwt_key_set_key* key = &snapshot->keys[i];
+
+        snapshot->count = i + 1;
+
+        if (entry->key == NULL || entry->key_length == 0 || entry->key_length > L8W8JWT_MAX_KEY_SIZE)
+        {
+            r = entry->key == NULL ? L8W8JWT_NULL_ARG : L8W8JWT_INVALID_ARG;
+            goto exit;
+        }
+
+        key->alg = entry->alg;
+
+        if (entry->kid != NULL)
+        {
+            key->kid = l8w8jwt_malloc(entry->kid_length + 1);
+            if (key->kid == NULL)
+            {
+                r = L8W8JWT_OUT_OF_MEM;
+                goto exit;
+            }
+
+            memcpy(key->kid, entry->kid, entry->kid_length);
+            key->kid[entry->kid_length] = '\0';
+            key->kid_length = entry->kid_length;
+        }
+
+        switch (entry->alg)
+        {
+            case L8W8JWT_ALG_HS256:
+            case L8W8JWT_ALG_HS384:
+            case L8W8JWT_ALG_HS512:
+            case L8W8JWT_ALG_ED25519: {
+                key->key = l8w8jwt_malloc(entry->key_length);
+                if (key->key == NULL)
+                {
+                    r = L8W8JWT_OUT_OF_MEM;
+                    goto exit;
+                }
+
+                memcpy(key->key, entry->key, entry->key_length);
+                key->key_length = entry->key_length;
+                break;
+            }
+            default: {
+                r = l8w8jwt_verification_key_create(entry->alg, entry->key, entry->key_length, max_table_size, &key->verification_key);
+                if (r != L8W8JWT_SUCCESS)
+                {
+                    goto exit;
+                }
+                break;
+            }
+        }
+    }
+
+    *out_snapshot = snapshot;
+    return L8W8JWT_SUCCESS;
+
+exit:
+    l8w8jwt_key_set_snapshot_free(snapshot);
+    return r;
+}
+
+int l8w8jwt_key_set_create(struct l8w8jwt_key_set** out_key_set)
+{
+    if (out_key_set == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    struct l8w8jwt_key_set* key_set = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_key_set));
+    if (key_set == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    struct l8w8jwt_key_set_snapshot* snapshot = NULL;
+
+    int r = l8w8jwt_key_set_snapshot_create(NULL, 0, 0, &snapshot);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_free(key_set);
+        return r;
+    }
+
+    atomic_init(&key_set->current, snapshot);
+    atomic_init(&key_set->epoch, 1);
+    atomic_flag_clear(&key_set->publish_lock);
+    atomic_flag_clear(&key_set->readers_lock);
+
+    *out_key_set = key_set;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_key_set_publish(struct l8w8jwt_key_set* key_set, const struct l8w8jwt_key_set_entry* entries, const size_t entries_count, const size_t max_table_size)
+{
+    if (key_set == NULL || (entries == NULL && entries_count != 0))
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    struct l8w8jwt_key_set_snapshot* snapshot = NULL;
+
+    /* Parsing (and building tables) is the expensive part: readers aren't affected by it at all. */
+    int r = l8w8jwt_key_set_snapshot_create(entries, entries_count, max_table_size, &snapshot);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    l8w8jwt_key_set_spin_lock(&key_set->publish_lock);
+
+    struct l8w8jwt_key_set_snapshot* old_snapshot = atomic_exchange_explicit(&key_set->current, snapshot, memory_order_seq_cst);
+    const uint_fast64_t epoch = atomic_fetch_add_explicit(&key_set->epoch, 1, memory_order_seq_cst) + 1;
+
+    /* Grace period: wait for every reader that might still be using the old snapshot. */
+    l8w8jwt_key_set_spin_lock(&key_set->readers_lock);
+
+    for (struct l8w8jwt_key_set_reader* reader = key_set->readers; reader != NULL; reader = reader->next)
+    {
+        for (;;)
+        {
+            const uint_fast64_t reader_epoch = atomic_load_explicit(&reader->epoch, memory_order_seq_cst);
+
+            if (reader_epoch == 0 || reader_epoch >= epoch)
+            {
+                break;
+            }
+        }
+    }
+
+    l8w8jwt_key_set_spin_unlock(&key_set->readers_lock);
+    l8w8jwt_key_set_spin_unlock(&key_set->publish_lock);
+
+    l8w8jwt_key_set_snapshot_free(old_snapshot);
+    return L8W8JWT_SUCCESS;
+}
+
+size_t l8w8jwt_key_set_get_key_count(struct l8w8jwt_key_set* key_set)
+{
+    if (key_set == NULL)
+    {
+        return 0;
+    }
+
+    l8w8jwt_key_set_spin_lock(&key_set->publish_lock);
+    const size_t count = atomic_load_explicit(&key_set->current, memory_order_acquire)->count;
+    l8w8jwt_key_set_spin_unlock(&key_set->publish_lock);
+
+    return count;
+}
+
+void l8w8jwt_key_set_free(struct l8w8jwt_key_set* key_set)
+{
+    if (key_set == NULL)
+    {
+        return;
+    }
+
+    l8w8jwt_key_set_snapshot_free(atomic_load_explicit(&key_set->current, memory_order_acquire));
+    l8w8jwt_free(key_set);
+}
+
+int l8w8jwt_key_set_reader_create(struct l8w8jwt_key_set* key_set, struct l8w8jwt_key_set_reader** out_key_set_reader)
+{
+    if (key_set == NULL || out_key_set_reader == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    struct l8w8jwt_key_set_reader* reader = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_key_set_reader));
+    if (reader == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    atomic_init(&reader->epoch, 0);
+    reader->key_set = key_set;
+
+    l8w8jwt_key_set_spin_lock(&key_set->readers_lock);
+
+    reader->next = key_set->readers;
+    if (reader->next != NULL)
+    {
+        reader->next->prev = reader;
+    }
+    key_set->readers = reader;
+
+    l8w8jwt_key_set_spin_unlock(&key_set->readers_lock);
+
+    *out_key_set_reader = reader;
+    return L8W8JWT_SUCCESS;
+}
+
+void l8w8jwt_key_set_reader_free(struct l8w8jwt_key_set_reader* key_set_reader)
+{
+    if (key_set_reader == NULL)
+    {
+        return;
+    }
+
+    struct l8w8jwt_key_set* key_set = key_set_reader->key_set;
+
+    l8w8jwt_key_set_spin_lock(&key_set->readers_lock);
+
+    if (key_set_reader->prev != NULL)
+    {
+        key_set_reader->prev->next = key_set_reader->next;
+    }
+    else
+    {
+        key_set->readers = key_set_reader->next;
+    }
+
+    if (key_set_reader->next != NULL)
+    {
+        key_set_reader->next->prev = key_set_reader->prev;
+    }
+
+    l8w8jwt_key_set_spin_unlock(&key_set->readers_lock);
+
+    l8w8jwt_free(key_set_reader);
+}
+
+int l8w8jwt_key_set_reader_select(struct l8w8jwt_key_set_reader* key_set_reader, const int alg, const char* kid, const size_t kid_length, struct l8w8jwt_decoding_params* out_params)
+{
+    struct l8w8jwt_key_set* key_set = key_set_reader->key_set;
+
+    /*
+     * Announce the observed epoch before loading the snapshot (a plain store and a load: no locks, no read-modify-write).
+     * The acquire load pairs with the writer's epoch increment, so observing the new epoch guarantees observing the new snapshot too.
+     */
+    atomic_store_explicit(&key_set_reader->epoch, atomic_load_explicit(&key_set->epoch, memory_order_acquire), memory_order_seq_cst);
+
+    const struct l8w8jwt_key_set_snapshot* snapshot = atomic_load_explicit(&key_set->current, memory_order_seq_cst);
+    const struct l8w8jwt_key_set_key* selected = NULL;
+
+    for (size_t i = 0; i < snapshot->count; ++i)
+    {
+        const struct l8w8jwt_key_set_key* key = &snapshot->keys[i];
+
+        if (key->alg != alg)
+        {
+            continue;
+        }
+
+        if (kid == NULL || (key->kid != NULL && key->kid_length == kid_length && memcmp(key->kid, kid, kid_length) == 0))
+        {
+            selected = key;
+            break;
+        }
+    }
+
+    out_params->psa_key_id = 0;
+    out_params->verification_key = NULL;
+    out_params->verification_key_length = 0;
+    out_params->verification_key_object = NULL;
+
+    if (selected == NULL)
+    {
+        return 1;
+    }
+
+    if (selected->verification_key != NULL)
+    {
+        out_params->verification_key_object = selected->verification_key;
+    }
+    else
+    {
+        out_params->verification_key = selected->key;
+        out_params->verification_key_length = selected->key_length;
+    }
+
+    return 0;
+}
+
+void l8w8jwt_key_set_reader_release(struct l8w8jwt_key_set_reader* key_set_reader)
+{
+    atomic_store_explicit(&key_set_reader->epoch, 0, memory_order_release);
+}
+
+#else
+
+int l8w8jwt_key_set_create(struct l8w8jwt_key_set** out_key_set)
+{
+    (void)out_key_set;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_key_set_publish(struct l8w8jwt_key_set* key_set, const struct l8w8jwt_key_set_entry* entries, const size_t entries_count, const size_t max_table_size)
+{
+    (void)key_set;
+    (void)entries;
+    (void)entries_count;
+    (void)max_table_size;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+size_t l8w8jwt_key_set_get_key_count(struct l8w8jwt_key_set* key_set)
+{
+    (void)key_set;
+    return 0;
+}
+
+void l8w8jwt_key_set_free(struct l8w8jwt_key_set* key_set)
+{
+    (void)key_set;
+}
+
+int l8w8jwt_key_set_reader_create(struct l8w8jwt_key_set* key_set, struct l8w8jwt_key_set_reader** out_key_set_reader)
+{
+    (void)key_set;
+    (void)out_key_set_reader;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+void l8w8jwt_key_set_reader_free(struct l8w8jwt_key_set_reader* key_set_reader)
+{
+    (void)key_set_reader;
+}
+
+int l8w8jwt_key_set_reader_select(struct l8w8jwt_key_set_reader* key_set_reader, const int alg, const char* kid, const size_t kid_length, struct l8w8jwt_decoding_params* out_params)
+{
+    (void)key_set_reader;
+    (void)alg;
+    (void)kid;
+    (void)kid_length;
+    (void)out_params;
+    return 1;
+}
+
+void l8w8jwt_key_set_reader_release(struct l8w8jwt_key_set_reader* key_set_reader)
+{
+    (void)key_set_reader;
+}
+
+#endif // !defined(__STDC_NO_ATOMICS__)
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,57 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file key_set_backend.h
+ *  @author Raphael Beck
+ *  @brief Internal key selection functions of the key sets, used by decode.c. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_KEY_SET_BACKEND_H
+#define L8W8JWT_KEY_SET_BACKEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/decode.h"
+#include "l8w8jwt/key_set.h"
+
+#include <stddef.h>
+
+/**
+ * Enters a read-side critical section on the reader's key set and selects the key for a token. <p>
+ * The selected key stays valid until {@link #l8w8jwt_key_set_reader_release} is called, which needs to happen in any case (even if no key was found).
+ * @param key_set_reader The reader.
+ * @param alg The token's alg.
+ * @param kid The token's "kid" header claim (<code>NULL</code> if it has none).
+ * @param kid_length kid string length.
+ * @param out_params Where to point the key fields (<code>verification_key</code> and <code>verification_key_length</code>, or <code>verification_key_object</code>) to the selected key.
+ * @return <code>0</code> if a key was selected, <code>1</code> if the key set has no matching key.
+ */
+int l8w8jwt_key_set_reader_select(struct l8w8jwt_key_set_reader* key_set_reader, int alg, const char* kid, size_t kid_length, struct l8w8jwt_decoding_params* out_params);
+
+/**
+ * Leaves the read-side critical section that {@link #l8w8jwt_key_set_reader_select} entered.
+ * @param key_set_reader The reader.
+ */
+void l8w8jwt_key_set_reader_release(struct l8w8jwt_key_set_reader* key_set_reader);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_KEY_SET_BACKEND_H
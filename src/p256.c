@@ -0,0 +1,898 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "p256.h"
+
+#if L8W8JWT_P256
+
+#include "ecc256.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <mbedtls/platform_util.h>
+
+/*
+ * Field elements (mod p) and scalars (mod n) are four little-endian 64-bit words.
+ * Field elements are kept in Montgomery form (a * 2^256 mod p) and always fully reduced, so they can be compared with memcmp.
+ */
+
+struct p256_affine
+{
+    uint64_t x[4];
+    uint64_t y[4];
+};
+
+/* Homogeneous projective coordinates (x = X / Z, y = Y / Z); the point at infinity is (0 : 1 : 0). */
+struct p256_point
+{
+    uint64_t X[4];
+    uint64_t Y[4];
+    uint64_t Z[4];
+};
+
+static const uint64_t p256_p[4] = { 0xffffffffffffffffULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0xffffffff00000001ULL };
+static const uint64_t p256_n[4] = { 0xf3b9cac2fc632551ULL, 0xbce6faada7179e84ULL, 0xffffffffffffffffULL, 0xffffffff00000000ULL };
+
+/* -p^-1 mod 2^64 and -n^-1 mod 2^64 */
+#define P256_P_INV 0x0000000000000001ULL
+#define P256_N_INV 0xccd1c8aaee00bc4fULL
+
+/* 2^512 mod p and 2^512 mod n (for converting into Montgomery form) */
+static const uint64_t p256_p_rr[4] = { 0x0000000000000003ULL, 0xfffffffbffffffffULL, 0xfffffffffffffffeULL, 0x00000004fffffffdULL };
+static const uint64_t p256_n_rr[4] = { 0x83244c95be79eea2ULL, 0x4699799c49bd6fa6ULL, 0x2845b2392b6bec59ULL, 0x66e12d94f3d95620ULL };
+
+/* 1 and b in Montgomery form (mod p), 1 in Montgomery form (mod n) */
+static const uint64_t p256_p_one[4] = { 0x0000000000000001ULL, 0xffffffff00000000ULL, 0xffffffffffffffffULL, 0x00000000fffffffeULL };
+static const uint64_t p256_n_one[4] = { 0x0c46353d039cdaafULL, 0x4319055258e8617bULL, 0x0000000000000000ULL, 0x00000000ffffffffULL };
+static const uint64_t p256_b[4] = { 0xd89cdf6229c4bddfULL, 0xacf005cd78843090ULL, 0xe5a220abf7212ed6ULL, 0xdc30061d04874834ULL };
+
+/* p - n */
+static const uint64_t p256_p_minus_n[4] = { 0x0c46353d039cdaaeULL, 0x4319055358e8617bULL, 0x0000000000000000ULL, 0x0000000000000000ULL };
+
+#include "p256_precomp.h"
+
+static inline void fp_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mont_mul(r, a, b, p256_p, P256_P_INV);
+}
+
+static inline void fp_add(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mod_add(r, a, b, p256_p);
+}
+
+static inline void fp_sub(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mod_sub(r, a, b, p256_p);
+}
+
+static inline void fp_mul3(uint64_t r[4], const uint64_t a[4])
+{
+    uint64_t t[4];
+    fp_add(t, a, a);
+    fp_add(r, t, a);
+}
+
+/* r = a^-1 (Montgomery form in and out) */
+static void fp_inv(uint64_t r[4], const uint64_t a[4])
+{
+    static const uint64_t p_minus_2[4] = { 0xfffffffffffffffdULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0xffffffff00000001ULL };
+    l8w8jwt_ecc256_mont_pow(r, a, p_minus_2, p256_p, P256_P_INV, p256_p_one);
+}
+
+static inline void fn_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mont_mul(r, a, b, p256_n, P256_N_INV);
+}
+
+/* r = a^-1 * 2^256 mod n, for a in Montgomery form */
+static void fn_inv(uint64_t r[4], const uint64_t a[4])
+{
+    static const uint64_t n_minus_2[4] = { 0xf3b9cac2fc63254fULL, 0xbce6faada7179e84ULL, 0xffffffffffffffffULL, 0xffffffff00000000ULL };
+    l8w8jwt_ecc256_mont_pow(r, a, n_minus_2, p256_n, P256_N_INV, p256_n_one);
+}
+
+/*
+ * Complete addition formulas for prime order short Weierstrass curves with a = -3
+ * (Renes, Costello, Batina: "Complete addition formulas for prime order elliptic curves", algorithms 4 and 5).
+ * They are valid for all inputs (including doubling and the point at infinity), so there are no secret-dependent branches.
+ */
+
+static void p256_add(struct p256_point* r, const struct p256_point* a, const struct p256_point* b)
+{
+    uint64_t xx[4], yy[4], zz[4], xy[4], yz[4], xz[4], t0[4], t1[4];
+    uint64_t bzz3[4], yy_m_bzz3[4], yy_p_bzz3[4], zz3[4], bxz3[4], xx3_m_zz3[4];
+
+    fp_mul(xx, a->X, b->X);
+    fp_mul(yy, a->Y, b->Y);
+    fp_mul(zz, a->Z, b->Z);
+
+    fp_add(t0, a->X, a->Y);
+    fp_add(t1, b->X, b->Y);
+    fp_mul(xy, t0, t1);
+    fp_add(t0, xx, yy);
+    fp_sub(xy, xy, t0);
+
+    fp_add(t0, a->Y, a->Z);
+    fp_add(t1, b->Y, b->Z);
+    fp_mul(yz, t0, t1);
+    fp_add(t0, yy, zz);
+    fp_sub(yz, yz, t0);
+
+    fp_add(t0, a->X, a->Z);
+    fp_add(t1, b->X, b->Z);
+    fp_mul(xz, t0, t1);
+    fp_add(t0, xx, zz);
+    fp_sub(xz, xz, t0);
+
+    fp_mul(t0, p256_b, zz);
+    fp_sub(t0, xz, t0);
+    fp_mul3(bzz3, t0);
+    fp_sub(yy_m_bzz3, yy, bzz3);
+    fp_add(yy_p_bzz3, yy, bzz3);
+
+    fp_mul3(zz3, zz);
+    fp_mul(t0, p256_b, xz);
+    fp_add(t1, zz3, xx);
+    fp_sub(t0, t0, t1);
+    fp_mul3(bxz3, t0);
+    fp_mul3(t0, xx);
+    fp_sub(xx3_m_zz3, t0, zz3);
+
+    fp_mul(t0, yy_p_bzz3, xy);
+    fp_mul(t1, yz, bxz3);
+    fp_sub(r->X, t0, t1);
+
+    fp_mul(t0, yy_p_bzz3, yy_m_bzz3);
+    fp_mul(t1, xx3_m_zz3, bxz3);
+    fp_add(r->Y, t0, t1);
+
+    fp_mul(t0, yy_m_bzz3, yz);
+    fp_mul(t1, xy, xx3_m_zz3);
+    fp_add(r->Z, t0, t1);
+}
+
+/* r = a + b for an affine b (b must not be the point at infinity, which has no affine representation) */
+static void p256_add_affine(struct p256_point* r, const struct p256_point* a, const struct p256_affine* b)
+{
+    uint64_t xx[4], yy[4], xy[4], yz[4], xz[4], t0[4], t1[4];
+    uint64_t bz3[4], yy_m_bz3[4], yy_p_bz3[4], z3[4], bxz3[4], xx3_m_z3[4];
+
+    fp_mul(xx, a->X, b->x);
+    fp_mul(yy, a->Y, b->y);
+
+    fp_add(t0, a->X, a->Y);
+    fp_add(t1, b->x, b->y);
+    fp_mul(xy, t0, t1);
+    fp_add(t0, xx, yy);
+    fp_sub(xy, xy, t0);
+
+    fp_mul(yz, b->y, a->Z);
+    fp_add(yz, yz, a->Y);
+
+    fp_mul(xz, b->x, a->Z);
+    fp_add(xz, xz, a->X);
+
+    fp_mul(t0, p256_b, a->Z);
+    fp_sub(t0, xz, t0);
+    fp_mul3(bz3, t0);
+    fp_sub(yy_m_bz3, yy, bz3);
+    fp_add(yy_p_bz3, yy, bz3);
+
+    fp_mul3(z3, a->Z);
+    fp_mul(t0, p256_b, xz);
+    fp_add(t1, z3, xx);
+    fp_sub(t0, t0, t1);
+    fp_mul3(bxz3, t0);
+    fp_mul3(t0, xx);
+    fp_sub(xx3_m_z3, t0, z3);
+
+    fp_mul(t0, yy_p_bz3, xy);
+    fp_mul(t1, yz, bxz3);
+    fp_sub(r->X, t0, t1);
+
+    fp_mul(t0, yy_p_bz3, yy_m_bz3);
+    fp_mul(t1, xx3_m_z3, bxz3);
+    fp_add(r->Y, t0, t1);
+
+    fp_mul(t0, yy_m_bz3, yz);
+    fp_mul(t1, xy, xx3_m_z3);
+    fp_add(r->Z, t0, t1);
+}
+
+static inline void p256_set_infinity(struct p256_point* r)
+{
+    memset(r->X, 0x00, sizeof(r->X));
+    memcpy(r->Y, p256_p_one, sizeof(r->Y));
+    memset(r->Z, 0x00, sizeof(r->Z));
+}
+
+static inline void p256_point_cmov(struct p256_point* r, const struct p256_point* a, const uint64_t mask)
+{
+    words_cmov(r->X, a->X, mask);
+    words_cmov(r->Y, a->Y, mask);
+    words_cmov(r->Z, a->Z, mask);
+}
+
+/* Splits a scalar into 65 signed radix-16 digits in [-8, 8). */
+static void p256_recode(signed char e[65], const uint64_t k[4])
+{
+    signed char carry = 0;
+
+    for (int i = 0; i < 64; ++i)
+    {
+        e[i] = (signed char)((k[i / 16] >> (4 * (i % 16))) & 15);
+    }
+
+    for (int i = 0; i < 64; ++i)
+    {
+        e[i] = (signed char)(e[i] + carry);
+        carry = (signed char)((e[i] + 8) >> 4);
+        e[i] = (signed char)(e[i] - carry * 16);
+    }
+
+    e[64] = carry;
+}
+
+/* Constant-time lookup of |d| * 16^row * G (negated if d < 0); returns an all-ones mask if d == 0 (nothing to add). */
+static uint64_t p256_select_base(struct p256_affine* t, const int row, const signed char d)
+{
+    const int64_t sign_mask = (int64_t)d >> 63;
+    const uint64_t abs_d = (uint64_t)(((int64_t)d ^ sign_mask) - sign_mask);
+    uint64_t neg_y[4];
+
+    memset(t, 0x00, sizeof(struct p256_affine));
+
+    for (uint64_t i = 0; i < 8; ++i)
+    {
+        const uint64_t mask = (uint64_t)0 - (uint64_t)(((abs_d ^ (i + 1)) - 1) >> 63);
+        words_cmov(t->x, l8w8jwt_p256_base[row][i].x, mask);
+        words_cmov(t->y, l8w8jwt_p256_base[row][i].y, mask);
+    }
+
+    fp_sub(neg_y, (const uint64_t[4]){ 0 }, t->y);
+    words_cmov(t->y, neg_y, (uint64_t)sign_mask);
+
+    return (uint64_t)0 - (uint64_t)((abs_d - 1) >> 63);
+}
+
+/* r = k * G (constant time) */
+static void p256_mul_base(struct p256_point* r, const uint64_t k[4])
+{
+    signed char e[65];
+    struct p256_affine t;
+    struct p256_point sum;
+
+    p256_recode(e, k);
+    p256_set_infinity(r);
+
+    for (int i = 0; i < 65; ++i)
+    {
+        const uint64_t skip = p256_select_base(&t, i, e[i]);
+        p256_add_affine(&sum, r, &t);
+        p256_point_cmov(r, &sum, ~skip);
+    }
+
+    mbedtls_platform_zeroize(e, sizeof(e));
+    mbedtls_platform_zeroize(&t, sizeof(t));
+    mbedtls_platform_zeroize(&sum, sizeof(sum));
+}
+
+/*
+ * Jacobian coordinates (x = X / Z^2, y = Y / Z^3) for the variable-time part of verification (u2 * Q),
+ * where doubling is much cheaper than with the complete formulas ("dbl-2001-b" and "add-2007-bl" from the EFD).
+ * Z == 0 is the point at infinity.
+ */
+
+static void p256_jacobian_dbl(struct p256_point* r, const struct p256_point* a)
+{
+    uint64_t delta[4], gamma[4], beta[4], alpha[4], t0[4], t1[4];
+
+    fp_mul(delta, a->Z, a->Z);
+    fp_mul(gamma, a->Y, a->Y);
+    fp_mul(beta, a->X, gamma);
+
+    fp_sub(t0, a->X, delta);
+    fp_add(t1, a->X, delta);
+    fp_mul(alpha, t0, t1);
+    fp_mul3(alpha, alpha);
+
+    fp_add(t0, a->Y, a->Z);
+    fp_mul(t0, t0, t0);
+    fp_sub(t0, t0, gamma);
+    fp_sub(r->Z, t0, delta);
+
+    fp_add(beta, beta, beta);
+    fp_add(beta, beta, beta); // 4 * beta
+    fp_mul(r->X, alpha, alpha);
+    fp_sub(r->X, r->X, beta);
+    fp_sub(r->X, r->X, beta);
+
+    fp_sub(t0, beta, r->X);
+    fp_mul(t0, alpha, t0);
+    fp_mul(t1, gamma, gamma);
+    fp_add(t1, t1, t1);
+    fp_add(t1, t1, t1);
+    fp_add(t1, t1, t1); // 8 * gamma^2
+    fp_sub(r->Y, t0, t1);
+}
+
+static void p256_jacobian_add(struct p256_point* r, const struct p256_point* a, const struct p256_point* b)
+{
+    uint64_t z1z1[4], z2z2[4], u1[4], u2[4], s1[4], s2[4], h[4], i[4], j[4], rr[4], v[4], t0[4];
+
+    if (words_is_zero(a->Z))
+    {
+        *r = *b;
+        return;
+    }
+
+    if (words_is_zero(b->Z))
+    {
+        *r = *a;
+        return;
+    }
+
+    fp_mul(z1z1, a->Z, a->Z);
+    fp_mul(z2z2, b->Z, b->Z);
+    fp_mul(u1, a->X, z2z2);
+    fp_mul(u2, b->X, z1z1);
+    fp_mul(s1, a->Y, b->Z);
+    fp_mul(s1, s1, z2z2);
+    fp_mul(s2, b->Y, a->Z);
+    fp_mul(s2, s2, z1z1);
+
+    fp_sub(h, u2, u1);
+    fp_sub(rr, s2, s1);
+
+    if (words_is_zero(h))
+    {
+        if (words_is_zero(rr))
+        {
+            p256_jacobian_dbl(r, a);
+            return;
+        }
+
+        memset(r, 0x00, sizeof(struct p256_point));
+        memcpy(r->X, p256_p_one, sizeof(r->X));
+        memcpy(r->Y, p256_p_one, sizeof(r->Y));
+        return;
+    }
+
+    fp_add(i, h, h);
+    fp_mul(i, i, i);
+    fp_mul(j, h, i);
+    fp_add(rr, rr, rr);
+    fp_mul(v, u1, i);
+
+    fp_add(t0, a->Z, b->Z);
+    fp_mul(t0, t0, t0);
+    fp_sub(t0, t0, z1z1);
+    fp_sub(t0, t0, z2z2);
+    fp_mul(r->Z, t0, h);
+
+    fp_mul(r->X, rr, rr);
+    fp_sub(r->X, r->X, j);
+    fp_sub(r->X, r->X, v);
+    fp_sub(r->X, r->X, v);
+
+    fp_sub(t0, v, r->X);
+    fp_mul(t0, rr, t0);
+    fp_mul(s1, s1, j);
+    fp_add(s1, s1, s1);
+    fp_sub(r->Y, t0, s1);
+}
+
+/* Width-5 signed sliding window recoding: odd digits in [-15, 15]. */
+static void p256_slide(signed char r[257], const uint64_t k[4])
+{
+    for (int i = 0; i < 256; ++i)
+    {
+        r[i] = (signed char)((k[i / 64] >> (i % 64)) & 1);
+    }
+    r[256] = 0;
+
+    for (int i = 0; i < 256; ++i)
+    {
+        if (!r[i])
+        {
+            continue;
+        }
+
+        for (int b = 1; b <= 6 && i + b < 257; ++b)
+        {
+            if (!r[i + b])
+            {
+                continue;
+            }
+
+            if (r[i] + (r[i + b] << b) <= 15)
+            {
+                r[i] = (signed char)(r[i] + (r[i + b] << b));
+                r[i + b] = 0;
+            }
+            else if (r[i] - (r[i + b] << b) >= -15)
+            {
+                r[i] = (signed char)(r[i] - (r[i + b] << b));
+                for (int j = i + b; j < 257; ++j)
+                {
+                    if (!r[j])
+                    {
+                        r[j] = 1;
+                        break;
+                    }
+                    r[j] = 0;
+                }
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+}
+
+/* r = k * Q, in homogeneous projective coordinates (variable time: only used for verification, where k and Q are public) */
+static void p256_mul_vartime(struct p256_point* r, const uint64_t k[4], const struct p256_point* q)
+{
+    signed char naf[257];
+    struct p256_point table[8]; // Q, 3Q, 5Q, ..., 15Q
+    struct p256_point q2, neg, acc;
+    int i;
+
+    p256_slide(naf, k);
+
+    table[0] = *q;
+    p256_jacobian_dbl(&q2, q);
+    for (i = 1; i < 8; ++i)
+    {
+        p256_jacobian_add(&table[i], &table[i - 1], &q2);
+    }
+
+    memset(&acc, 0x00, sizeof(acc));
+    memcpy(acc.X, p256_p_one, sizeof(acc.X));
+    memcpy(acc.Y, p256_p_one, sizeof(acc.Y));
+
+    for (i = 256; i >= 0 && naf[i] == 0; --i)
+    {
+    }
+
+    for (; i >= 0; --i)
+    {
+        p256_jacobian_dbl(&acc, &acc);
+
+        if (naf[i] > 0)
+        {
+            p256_jacobian_add(&acc, &acc, &table[naf[i] / 2]);
+        }
+        else if (naf[i] < 0)
+        {
+            neg = table[-naf[i] / 2];
+            fp_sub(neg.Y, (const uint64_t[4]){ 0 }, neg.Y);
+            p256_jacobian_add(&acc, &acc, &neg);
+        }
+    }
+
+    if (words_is_zero(acc.Z))
+    {
+        p256_set_infinity(r);
+        return;
+    }
+
+    // (X / Z^2, Y / Z^3) = (X * Z / Z^3, Y / Z^3)
+    fp_mul(r->X, acc.X, acc.Z);
+    memcpy(r->Y, acc.Y, sizeof(r->Y));
+    fp_mul(r->Z, acc.Z, acc.Z);
+    fp_mul(r->Z, r->Z, acc.Z);
+}
+
+/* Reduces a big-endian hash into a scalar mod n (ES256 hashes are exactly as long as n, so no truncation is needed). */
+static inline void p256_hash_to_scalar(uint64_t e[4], const unsigned char hash[32])
+{
+    words_from_bytes(e, hash);
+    mod_reduce_once(e, e, 0, p256_n);
+}
+
+/* Parses and validates an uncompressed public key (big-endian x || y) into Montgomery form with Z = 1. Returns 0 if it's a point on the curve. */
+static int p256_load_public_key(struct p256_point* q, const unsigned char public_key[64])
+{
+    uint64_t t0[4], t1[4];
+
+    words_from_bytes(q->X, public_key);
+    words_from_bytes(q->Y, public_key + 32);
+
+    if (!words_lt(q->X, p256_p) || !words_lt(q->Y, p256_p))
+    {
+        return 1;
+    }
+
+    fp_mul(q->X, q->X, p256_p_rr);
+    fp_mul(q->Y, q->Y, p256_p_rr);
+    memcpy(q->Z, p256_p_one, sizeof(q->Z));
+
+    // y^2 = x^3 - 3x + b
+    fp_mul(t0, q->Y, q->Y);
+    fp_mul(t1, q->X, q->X);
+    fp_mul(t1, t1, q->X);
+    fp_sub(t1, t1, q->X);
+    fp_sub(t1, t1, q->X);
+    fp_sub(t1, t1, q->X);
+    fp_add(t1, t1, p256_b);
+
+    return memcmp(t0, t1, sizeof(t0)) != 0;
+}
+
+/* Parses the signature and computes u1 = e / s and u2 = r / s. Returns 0 if r and s are both in [1, n - 1]. */
+static int p256_verify_scalars(uint64_t sig_r[4], uint64_t u1[4], uint64_t u2[4], const unsigned char hash[32], const unsigned char signature[64])
+{
+    uint64_t e[4], sig_s[4], w[4];
+
+    words_from_bytes(sig_r, signature);
+    words_from_bytes(sig_s, signature + 32);
+
+    if (words_is_zero(sig_r) || words_is_zero(sig_s) || !words_lt(sig_r, p256_n) || !words_lt(sig_s, p256_n))
+    {
+        return 1;
+    }
+
+    p256_hash_to_scalar(e, hash);
+    fn_mul(w, sig_s, p256_n_rr);
+    fn_inv(w, w);
+    fn_mul(u1, e, w);
+    fn_mul(u2, sig_r, w);
+
+    return 0;
+}
+
+/* Checks the projective result a of u1 * G + u2 * Q against r. Returns 0 if the signature is valid. */
+static int p256_verify_finish(const uint64_t sig_r[4], const struct p256_point* a)
+{
+    uint64_t t0[4], t1[4];
+
+    if (words_is_zero(a->Z))
+    {
+        return 1;
+    }
+
+    // Instead of inverting Z, check whether X == r * Z (or (r + n) * Z, if r + n is still a field element).
+    fp_mul(t0, sig_r, p256_p_rr);
+    fp_mul(t0, t0, a->Z);
+    if (memcmp(t0, a->X, sizeof(t0)) == 0)
+    {
+        return 0;
+    }
+
+    if (words_lt(sig_r, p256_p_minus_n))
+    {
+        mod_add(t1, sig_r, p256_n, p256_p);
+        fp_mul(t0, t1, p256_p_rr);
+        fp_mul(t0, t0, a->Z);
+        if (memcmp(t0, a->X, sizeof(t0)) == 0)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* Computes r = x(k * G) mod n and k^-1 (in Montgomery form) for a nonce k in [1, n - 1]. Returns 0 if r happens to be 0 (which means k can't be used). */
+static int p256_nonce(uint64_t sig_r[4], uint64_t k_inv[4], const uint64_t k[4])
+{
+    uint64_t t[4];
+    struct p256_point kg;
+
+    p256_mul_base(&kg, k);
+    fp_inv(t, kg.Z);
+    fp_mul(t, kg.X, t);
+    fp_mul(t, t, (const uint64_t[4]){ 1, 0, 0, 0 }); // out of Montgomery form
+    mod_reduce_once(sig_r, t, 0, p256_n);
+
+    fn_mul(k_inv, k, p256_n_rr);
+    fn_inv(k_inv, k_inv);
+
+    mbedtls_platform_zeroize(t, sizeof(t));
+    mbedtls_platform_zeroize(&kg, sizeof(kg));
+    return !words_is_zero(sig_r);
+}
+
+/* s = k^-1 * (e + r * d) mod n (k^-1 in Montgomery form). Returns 0 if s is 0. */
+static int p256_sign_finish(uint64_t sig_s[4], const uint64_t sig_r[4], const uint64_t k_inv[4], const uint64_t d[4], const uint64_t e[4])
+{
+    uint64_t t[4];
+
+    fn_mul(t, sig_r, p256_n_rr);
+    fn_mul(t, t, d);
+    mod_add(t, t, e, p256_n);
+    fn_mul(sig_s, t, k_inv);
+
+    mbedtls_platform_zeroize(t, sizeof(t));
+    return !words_is_zero(sig_s);
+}
+
+/* Draws a nonce candidate from the RNG. Returns -1 on RNG failure, 0 if the candidate is out of range and 1 if it's usable. */
+static int p256_random_nonce(uint64_t k[4], int (*f_rng)(void*, unsigned char*, size_t), void* p_rng)
+{
+    unsigned char k_bytes[32];
+
+    if (f_rng(p_rng, k_bytes, sizeof(k_bytes)) != 0)
+    {
+        mbedtls_platform_zeroize(k_bytes, sizeof(k_bytes));
+        return -1;
+    }
+
+    words_from_bytes(k, k_bytes);
+    mbedtls_platform_zeroize(k_bytes, sizeof(k_bytes));
+
+    return !words_is_zero(k) && words_lt(k, p256_n);
+}
+
+int l8w8jwt_p256_sign(unsigned char signature[64], const unsigned char private_key[32], const unsigned char hash[32], int (*f_rng)(void*, unsigned char*, size_t), void* p_rng)
+{
+    int r = -1;
+    uint64_t d[4], e[4], k[4], k_inv[4], sig_r[4], sig_s[4];
+
+    words_from_bytes(d, private_key);
+    if (words_is_zero(d) || !words_lt(d, p256_n) || f_rng == NULL)
+    {
+        goto exit;
+    }
+
+    p256_hash_to_scalar(e, hash);
+
+    for (int attempt = 0; attempt < 16; ++attempt)
+    {
+        const int usable = p256_random_nonce(k, f_rng, p_rng);
+        if (usable < 0)
+        {
+            goto exit;
+        }
+
+        if (!usable || !p256_nonce(sig_r, k_inv, k) || !p256_sign_finish(sig_s, sig_r, k_inv, d, e))
+        {
+            continue;
+        }
+
+        words_to_bytes(signature, sig_r);
+        words_to_bytes(signature + 32, sig_s);
+        r = 0;
+        break;
+    }
+
+exit:
+    mbedtls_platform_zeroize(d, sizeof(d));
+    mbedtls_platform_zeroize(k, sizeof(k));
+    mbedtls_platform_zeroize(k_inv, sizeof(k_inv));
+    return r;
+}
+
+int l8w8jwt_p256_presign(unsigned char presignature[64], int (*f_rng)(void*, unsigned char*, size_t), void* p_rng)
+{
+    int r = -1;
+    uint64_t k[4], k_inv[4], sig_r[4];
+
+    if (f_rng == NULL)
+    {
+        return r;
+    }
+
+    for (int attempt = 0; attempt < 16; ++attempt)
+    {
+        const int usable = p256_random_nonce(k, f_rng, p_rng);
+        if (usable < 0)
+        {
+            break;
+        }
+
+        if (!usable || !p256_nonce(sig_r, k_inv, k))
+        {
+            continue;
+        }
+
+        words_to_bytes(presignature, k_inv);
+        words_to_bytes(presignature + 32, sig_r);
+        r = 0;
+        break;
+    }
+
+    mbedtls_platform_zeroize(k, sizeof(k));
+    mbedtls_platform_zeroize(k_inv, sizeof(k_inv));
+    return r;
+}
+
+int l8w8jwt_p256_sign_presigned(unsigned char signature[64], const unsigned char private_key[32], const unsigned char hash[32], const unsigned char presignature[64])
+{
+    int r = -1;
+    uint64_t d[4], e[4], k_inv[4], sig_r[4], sig_s[4];
+
+    words_from_bytes(d, private_key);
+    words_from_bytes(k_inv, presignature);
+    words_from_bytes(sig_r, presignature + 32);
+
+    if (words_is_zero(d) || !words_lt(d, p256_n) || words_is_zero(sig_r) || !words_lt(sig_r, p256_n) || !words_lt(k_inv, p256_n))
+    {
+        goto exit;
+    }
+
+    p256_hash_to_scalar(e, hash);
+
+    if (p256_sign_finish(sig_s, sig_r, k_inv, d, e))
+    {
+        words_to_bytes(signature, sig_r);
+        words_to_bytes(signature + 32, sig_s);
+        r = 0;
+    }
+
+exit:
+    mbedtls_platform_zeroize(d, sizeof(d));
+    mbedtls_platform_zeroize(k_inv, sizeof(k_inv));
+    return r;
+}
+
+int l8w8jwt_p256_sign_deterministic(unsigned char signature[64], const unsigned char private_key[32], const unsigned char hash[32])
+{
+    int r;
+    uint64_t e[4];
+    unsigned char h1[32];
+    struct l8w8jwt_rfc6979 rfc6979;
+
+    // bits2octets(h1): the hash reduced mod n.
+    p256_hash_to_scalar(e, hash);
+    words_to_bytes(h1, e);
+
+    r = l8w8jwt_rfc6979_init(&rfc6979, private_key, h1);
+
+    if (r == 0)
+    {
+        r = l8w8jwt_p256_sign(signature, private_key, hash, &l8w8jwt_rfc6979_generate, &rfc6979);
+    }
+
+    mbedtls_platform_zeroize(&rfc6979, sizeof(rfc6979));
+    mbedtls_platform_zeroize(h1, sizeof(h1));
+    return r;
+}
+
+int l8w8jwt_p256_verify(const unsigned char public_key[64], const unsigned char hash[32], const unsigned char signature[64])
+{
+    uint64_t sig_r[4], u1[4], u2[4];
+    struct p256_point q, a, b;
+
+    if (p256_verify_scalars(sig_r, u1, u2, hash, signature) != 0 || p256_load_public_key(&q, public_key) != 0)
+    {
+        return 1;
+    }
+
+    p256_mul_base(&a, u1);
+    p256_mul_vartime(&b, u2, &q);
+    p256_add(&a, &a, &b);
+
+    return p256_verify_finish(sig_r, &a);
+}
+
+/* Converts 8 Jacobian points (none of them at infinity) to affine coordinates with a single field inversion (Montgomery's trick). */
+static void p256_jacobian_to_affine_8(struct p256_affine r[8], const struct p256_point p[8])
+{
+    uint64_t c[8][4], inv[4], z_inv[4], z_inv2[4];
+
+    memcpy(c[0], p[0].Z, sizeof(c[0]));
+    for (int i = 1; i < 8; ++i)
+    {
+        fp_mul(c[i], c[i - 1], p[i].Z);
+    }
+
+    fp_inv(inv, c[7]);
+
+    for (int i = 7; i >= 0; --i)
+    {
+        if (i > 0)
+        {
+            fp_mul(z_inv, inv, c[i - 1]);
+            fp_mul(inv, inv, p[i].Z);
+        }
+        else
+        {
+            memcpy(z_inv, inv, sizeof(z_inv));
+        }
+
+        fp_mul(z_inv2, z_inv, z_inv);
+        fp_mul(r[i].x, p[i].X, z_inv2);
+        fp_mul(z_inv2, z_inv2, z_inv);
+        fp_mul(r[i].y, p[i].Y, z_inv2);
+    }
+}
+
+int l8w8jwt_p256_precompute(void* table, const unsigned char public_key[64])
+{
+    struct p256_affine(*rows)[8] = (struct p256_affine(*)[8])table;
+    struct p256_point q, row[8];
+
+    if (p256_load_public_key(&q, public_key) != 0)
+    {
+        return 1;
+    }
+
+    // Row i holds (j + 1) * 16^i * Q, just like l8w8jwt_p256_base does for G (with Z = 1, q is both projective and Jacobian).
+    for (int i = 0; i < 65; ++i)
+    {
+        row[0] = q;
+        p256_jacobian_dbl(&row[1], &q);
+        for (int j = 2; j < 8; ++j)
+        {
+            p256_jacobian_add(&row[j], &row[j - 1], &q);
+        }
+
+        p256_jacobian_dbl(&q, &row[7]);
+        p256_jacobian_to_affine_8(rows[i], row);
+    }
+
+    return 0;
+}
+
+/* Adds the table entry for the signed radix-16 digit d of row (d != 0). */
+static inline void p256_add_digit(struct p256_point* r, const struct p256_affine row[8], const signed char d)
+{
+    struct p256_affine t = row[(d < 0 ? -d : d) - 1];
+
+    if (d < 0)
+    {
+        fp_sub(t.y, (const uint64_t[4]){ 0 }, t.y);
+    }
+
+    p256_add_affine(r, r, &t);
+}
+
+int l8w8jwt_p256_verify_precomputed(const void* table, const unsigned char hash[32], const unsigned char signature[64])
+{
+    const struct p256_affine(*rows)[8] = (const struct p256_affine(*)[8])table;
+    uint64_t sig_r[4], u1[4], u2[4];
+    signed char e1[65], e2[65];
+    struct p256_point a;
+
+    if (p256_verify_scalars(sig_r, u1, u2, hash, signature) != 0)
+    {
+        return 1;
+    }
+
+    // Both u1 * G and u2 * Q are fixed-base multiplications now: no doublings at all, just (at most) 130 mixed additions.
+    p256_recode(e1, u1);
+    p256_recode(e2, u2);
+    p256_set_infinity(&a);
+
+    for (int i = 0; i < 65; ++i)
+    {
+        if (e1[i] != 0)
+        {
+            p256_add_digit(&a, l8w8jwt_p256_base[i], e1[i]);
+        }
+
+        if (e2[i] != 0)
+        {
+            p256_add_digit(&a, rows[i], e2[i]);
+        }
+    }
+
+    return p256_verify_finish(sig_r, &a);
+}
+
+#endif // L8W8JWT_P256
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,127 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file p256.h
+ *  @author Raphael Beck
+ *  @brief Dedicated constant-time ECDSA over NIST P-256 (fixed 64-bit limbs, no heap allocations), used for ES256. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_P256_H
+#define L8W8JWT_P256_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#ifndef L8W8JWT_ENABLE_P256_ENGINE
+/**
+ * Set this to \c 0 to always sign and verify ES256 tokens through MbedTLS' generic <code>mbedtls_ecdsa_sign</code>/<code>mbedtls_ecdsa_verify</code>. <p>
+ * Otherwise, the MbedTLS crypto provider hands ES256 to l8w8jwt's own P-256 implementation (Montgomery arithmetic on four 64-bit limbs, complete addition formulas, precomputed base point tables), which needs <code>unsigned __int128</code> (GCC/Clang on 64-bit targets; other compilers silently keep using MbedTLS).
+ */
+#define L8W8JWT_ENABLE_P256_ENGINE 1
+#endif
+
+#if L8W8JWT_ENABLE_P256_ENGINE && defined(__SIZEOF_INT128__)
+#define L8W8JWT_P256 1
+#else
+#define L8W8JWT_P256 0
+#endif
+
+#if L8W8JWT_P256
+
+/**
+ * Creates an ECDSA P-256 signature over a 32-byte hash.
+ * @param signature Where to write the raw 64-byte signature (<code>r || s</code>, big-endian) into.
+ * @param private_key The 32-byte big-endian private scalar (must be in <code>[1, n - 1]</code>).
+ * @param hash The 32-byte SHA-256 digest to sign.
+ * @param f_rng RNG function for the per-signature nonce (e.g. <code>mbedtls_ctr_drbg_random</code>).
+ * @param p_rng RNG context passed to \p f_rng
+ * @return <code>0</code> on success; anything else on failure (invalid private key or RNG failure).
+ */
+int l8w8jwt_p256_sign(unsigned char signature[64], const unsigned char private_key[32], const unsigned char hash[32], int (*f_rng)(void*, unsigned char*, size_t), void* p_rng);
+
+/**
+ * Creates a deterministic ECDSA P-256 signature over a 32-byte hash: the nonce is derived from the private key and the hash as per RFC 6979 (HMAC-SHA-256), so no RNG is needed
+ * and signing the same hash with the same key always yields the same signature.
+ * @param signature Where to write the raw 64-byte signature (<code>r || s</code>, big-endian) into.
+ * @param private_key The 32-byte big-endian private scalar (must be in <code>[1, n - 1]</code>).
+ * @param hash The 32-byte SHA-256 digest to sign.
+ * @return <code>0</code> on success; anything else on failure (invalid private key).
+ */
+int l8w8jwt_p256_sign_deterministic(unsigned char signature[64], const unsigned char private_key[32], const unsigned char hash[32]);
+
+/**
+ * Does the message-independent part of an ECDSA P-256 signature ahead of time: draws a nonce k and computes <code>r = x(k * G) mod n</code> and <code>k^-1 mod n</code>. <p>
+ * The result is secret (anyone who knows it can recover the private key from the signature it ends up in) and must be used for <strong>exactly one</strong> signature.
+ * @param presignature Where to write the 64-byte presignature into (opaque, pass it to {@link #l8w8jwt_p256_sign_presigned}).
+ * @param f_rng RNG function for the nonce.
+ * @param p_rng RNG context passed to \p f_rng
+ * @return <code>0</code> on success; anything else on RNG failure.
+ */
+int l8w8jwt_p256_presign(unsigned char presignature[64], int (*f_rng)(void*, unsigned char*, size_t), void* p_rng);
+
+/**
+ * Finishes an ECDSA P-256 signature from a presignature created by {@link #l8w8jwt_p256_presign} (only a few scalar multiplications mod n are left to do).
+ * @param signature Where to write the raw 64-byte signature (<code>r || s</code>, big-endian) into.
+ * @param private_key The 32-byte big-endian private scalar (must be in <code>[1, n - 1]</code>).
+ * @param hash The 32-byte SHA-256 digest to sign.
+ * @param presignature The presignature to consume (never reuse it afterwards, not even if this fails!).
+ * @return <code>0</code> on success; anything else on failure (in which case the caller should sign normally, using a fresh nonce).
+ */
+int l8w8jwt_p256_sign_presigned(unsigned char signature[64], const unsigned char private_key[32], const unsigned char hash[32], const unsigned char presignature[64]);
+
+/**
+ * Verifies an ECDSA P-256 signature over a 32-byte hash.
+ * @param public_key The 64-byte uncompressed public key (big-endian <code>x || y</code>, without the leading <code>0x04</code>).
+ * @param hash The 32-byte SHA-256 digest that was signed.
+ * @param signature The raw 64-byte signature (<code>r || s</code>, big-endian).
+ * @return <code>0</code> if the signature is valid; anything else if it isn't (or if the public key is not a point on the curve).
+ */
+int l8w8jwt_p256_verify(const unsigned char public_key[64], const unsigned char hash[32], const unsigned char signature[64]);
+
+/**
+ * Size (in bytes) of the precomputed public key table that {@link #l8w8jwt_p256_precompute} fills in.
+ */
+#define L8W8JWT_P256_TABLE_SIZE (65 * 8 * 64)
+
+/**
+ * Precomputes multiples of a public key (the same radix-16 comb table that the engine has built in for the base point),
+ * so that {@link #l8w8jwt_p256_verify_precomputed} can do both halves of a verification as fixed-base multiplications.
+ * @param table Where to write the table into: {@link #L8W8JWT_P256_TABLE_SIZE} bytes, aligned for <code>uint64_t</code> (e.g. straight from malloc).
+ * @param public_key The 64-byte uncompressed public key (big-endian <code>x || y</code>, without the leading <code>0x04</code>).
+ * @return <code>0</code> on success; anything else if the public key is not a point on the curve.
+ */
+int l8w8jwt_p256_precompute(void* table, const unsigned char public_key[64]);
+
+/**
+ * Verifies an ECDSA P-256 signature over a 32-byte hash using a public key table from {@link #l8w8jwt_p256_precompute}.
+ * @param table The precomputed public key table.
+ * @param hash The 32-byte SHA-256 digest that was signed.
+ * @param signature The raw 64-byte signature (<code>r || s</code>, big-endian).
+ * @return <code>0</code> if the signature is valid; anything else if it isn't.
+ */
+int l8w8jwt_p256_verify_precomputed(const void* table, const unsigned char hash[32], const unsigned char signature[64]);
+
+#endif // L8W8JWT_P256
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_P256_H
@@ -0,0 +1,680 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file p256_precomp.h
+ *  @author Raphael Beck
+ *  @brief Precomputed multiples of the P-256 base point, used by p256.c. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_P256_PRECOMP_H
+#define L8W8JWT_P256_PRECOMP_H
+
+/* Generated: l8w8jwt_p256_base[i][j] = (j + 1) * 16^i * G (affine, Montgomery form). */
+static const struct p256_affine l8w8jwt_p256_base[65][8] = {
+    {
+        { { 0x79e730d418a9143cULL, 0x75ba95fc5fedb601ULL, 0x79fb732b77622510ULL, 0x18905f76a53755c6ULL }, { 0xddf25357ce95560aULL, 0x8b4ab8e4ba19e45cULL, 0xd2e88688dd21f325ULL, 0x8571ff1825885d85ULL } },
+        { { 0x850046d410ddd64dULL, 0xaa6ae3c1a433827dULL, 0x732205038d1490d9ULL, 0xf6bb32e43dcf3a3bULL }, { 0x2f3648d361bee1a5ULL, 0x152cd7cbeb236ff8ULL, 0x19a8fb0e92042dbeULL, 0x78c577510a5b8a3bULL } },
+        { { 0xffac3f904eebc127ULL, 0xb027f84a087d81fbULL, 0x66ad77dd87cbbc98ULL, 0x26936a3fb6ff747eULL }, { 0xb04c5c1fc983a7ebULL, 0x583e47ad0861fe1aULL, 0x788208311a2ee98eULL, 0xd5f06a29e587cc07ULL } },
+        { { 0x74b0b50d46918dccULL, 0x4650a6edc623c173ULL, 0x0cdaacace8100af2ULL, 0x577362f541b0176bULL }, { 0x2d96f24ce4cbaba6ULL, 0x17628471fad6f447ULL, 0x6b6c36dee5ddd22eULL, 0x84b14c394c5ab863ULL } },
+        { { 0xbe1b8aaec45c61f5ULL, 0x90ec649a94b9537dULL, 0x941cb5aad076c20cULL, 0xc9079605890523c8ULL }, { 0xeb309b4ae7ba4f10ULL, 0x73c568efe5eb882bULL, 0x3540a9877e7a1f68ULL, 0x73a076bb2dd1e916ULL } },
+        { { 0x403947373e77664aULL, 0x55ae744f346cee3eULL, 0xd50a961a5b17a3adULL, 0x13074b5954213673ULL }, { 0x93d36220d377e44bULL, 0x299c2b53adff14b5ULL, 0xf424d44cef639f11ULL, 0xa4c9916d4a07f75fULL } },
+        { { 0x0746354ea0173b4fULL, 0x2bd20213d23c00f7ULL, 0xf43eaab50c23bb08ULL, 0x13ba5119c3123e03ULL }, { 0x2847d0303f5b9d4dULL, 0x6742f2f25da67bddULL, 0xef933bdc77c94195ULL, 0xeaedd9156e240867ULL } },
+        { { 0x27f14cd19499a78fULL, 0x462ab5c56f9b3455ULL, 0x8f90f02af02cfc6bULL, 0xb763891eb265230dULL }, { 0xf59da3a9532d4977ULL, 0x21e3327dcf9eba15ULL, 0x123c7b84be60bbf0ULL, 0x56ec12f27706df76ULL } },
+    },
+    {
+        { { 0x808b0b650bc6fb80ULL, 0x5882e0753ffe2e6bULL, 0xd5ef2f7c2c83f549ULL, 0x54d63c809103b723ULL }, { 0xf2f11bd652a23f9bULL, 0x3670c3194b0b6587ULL, 0x55c4623bb1580e9eULL, 0x64edf7b201efe220ULL } },
+        { { 0xd8c5fccfc5e3a3d8ULL, 0xbefd904c4079dfbfULL, 0xbc6d6a58fead0197ULL, 0x39227077695532a4ULL }, { 0x09e23e6ddbef42f5ULL, 0x7e449b64480a9908ULL, 0x7b969c1aad9a2e40ULL, 0x6231d7929591c2a4ULL } },
+        { { 0x6b34413077adc612ULL, 0xa7496529bbd803a0ULL, 0x1a1baaa76d8805bdULL, 0xc8403902470343adULL }, { 0x39f59f66175adff1ULL, 0x0b26d7fbb7d8c5b7ULL, 0xa875f5ce529d75e3ULL, 0x85efc7e941325cc2ULL } },
+        { { 0xdb6d96f305968b80ULL, 0x380a0913089f73b9ULL, 0x7da70b83c2c61e01ULL, 0x95fb8394569b38c7ULL }, { 0x9a3c651280edfe2fULL, 0x8f726bb98faeaf82ULL, 0x8010a4a078424bf8ULL, 0x296720440e844970ULL } },
+        { { 0x492bdc0752b3e584ULL, 0x35ff9aa8b5f86a2cULL, 0x2074213db27de573ULL, 0xc0bfffc45263832aULL }, { 0x2429c22a1d49c605ULL, 0x1b037d75b320ebfbULL, 0x52b6a1739220f428ULL, 0x2995919ca4cd2660ULL } },
+        { { 0x802b8d2333e12b70ULL, 0x6d490a4b19dd329bULL, 0x14f356cc6abc354dULL, 0x11eddf7fd0a0da0dULL }, { 0x1e208328d87fd1d8ULL, 0xfd2f4f8cfd025813ULL, 0x03b48cc47c29bca2ULL, 0x3f2a78b3241a2b71ULL } },
+        { { 0x6a9505760a99cbcaULL, 0x94e258f604a428f2ULL, 0x45ab5a4d7832ba0cULL, 0x71704d008938c167ULL }, { 0xdb97ab0ef88b8b70ULL, 0x56feb92ec00eb207ULL, 0xe70352687d367d80ULL, 0x65000c24c7973a41ULL } },
+        { { 0x63c5cb817a2ad62aULL, 0x7ef2b6b9ac62ff54ULL, 0x3749bba4b3ad9db5ULL, 0xad311f2c46d5a617ULL }, { 0xb77a8087c2ff3b6dULL, 0xb46feaf3367834ffULL, 0xf8aa266d75d6b138ULL, 0xfa38d320ec008188ULL } },
+    },
+    {
+        { { 0x486d8ffa696946fcULL, 0x50fbc6d8b9cba56dULL, 0x7e3d423e90f35a15ULL, 0x7c3da195c0dd962cULL }, { 0xe673fdb03cfd5d8bULL, 0x0704b7c2889dfca5ULL, 0xf6ce581ff52305aaULL, 0x399d49eb914d5e53ULL } },
+        { { 0x44e3811039949296ULL, 0x5b63827b361db1b5ULL, 0x3e5323ed206eaff5ULL, 0x942370d2c21f4290ULL }, { 0xf2caaf2ee0d985a1ULL, 0x192cc64b7239846dULL, 0x7c0b8f47ae6312f8ULL, 0x7dc61f9196620108ULL } },
+        { { 0x35d6a53eed4c3717ULL, 0x9f8240cf3d0ed2a3ULL, 0x8c0d4d05e5543aa5ULL, 0x45d5bbfbdd33b4b4ULL }, { 0xfa04cc73137fd28eULL, 0x862ac6efc73b3ffdULL, 0x403ff9f531f51ef2ULL, 0x34d5e0fcbc73f5a2ULL } },
+        { { 0x4f7081e144cc3addULL, 0xd5ffa1d687be82cfULL, 0x89890b6c0edd6472ULL, 0xada26e1a3ed17863ULL }, { 0x276f271563483caaULL, 0xe6924cd92f6077fdULL, 0x05a7fe980a466e3cULL, 0xf1c794b0b1902d1fULL } },
+        { { 0x33b2385c08369a90ULL, 0x2990c59b190eb4f8ULL, 0x819a6145c68eac80ULL, 0x7a786d622ec4a014ULL }, { 0x33faadbe20ac3a8dULL, 0x31a217815aba2d30ULL, 0x209d2742dba4f565ULL, 0xdb2ce9e355aa0fbbULL } },
+        { { 0xb3156bf38bd7aff1ULL, 0x1b5ee4cb1d81b146ULL, 0x7ba1ac41d628a915ULL, 0x8f3a8f9cfd89699eULL }, { 0x7329b9c9a0748be7ULL, 0x1d391c95a92e621fULL, 0xe51e6b214d10a837ULL, 0xd255f53a4947b435ULL } },
+        { { 0x0c4a58d474a86108ULL, 0xf8048a8fee4c5d90ULL, 0xe3c7c924e86d4c80ULL, 0x28c889de056a1e60ULL }, { 0x57e2662eb214a040ULL, 0xe8c48e9837e10347ULL, 0x8774286280ac748aULL, 0xf1c24022186b06f2ULL } },
+        { { 0x3d2b24b9eb7926b8ULL, 0xbff88cb3cdbe5509ULL, 0xd0f399afe4dd640bULL, 0x3c5fe1302f76ed45ULL }, { 0x6f3562f43764fb3dULL, 0x7b5af3183151b62dULL, 0xd5bd0bc7d79ce5f3ULL, 0xfdaf6b20ec66890fULL } },
+    },
+    {
+        { { 0x6772b0e5ab4b35a2ULL, 0x1d8b6001f5eeaacfULL, 0x728f7ce4795b9580ULL, 0x4a20ed2a41fb81daULL }, { 0x9f685cd44fec01e6ULL, 0x3ed7ddcca7ff50adULL, 0x460fd2640c2d97fdULL, 0x3a241426eb82f4f9ULL } },
+        { { 0x80009862d5d721d5ULL, 0x0c3357a35bd3a182ULL, 0x27f3a83b7aa2cda4ULL, 0xb58ae74ef6f83085ULL }, { 0x2a911a812e6dad6bULL, 0xde286051f43d6c5bULL, 0x4bdccc41f996c4d8ULL, 0xe7312ec00ae1e24eULL } },
+        { { 0x6faf68feaae6ee70ULL, 0x78f4cc155602b0c9ULL, 0x7e3321a86e94052aULL, 0x2fb3a0d6734d5d80ULL }, { 0xf3b98f3bb25a43baULL, 0x30bf803119ee2951ULL, 0x7ffee43321b0612aULL, 0x12f775e42eb821d0ULL } },
+        { { 0xf8d112e76e6485b3ULL, 0x4d3e24db771c52f8ULL, 0x48e3ee41684a2f6dULL, 0x7161957d21d95551ULL }, { 0x19631283cdb12a6cULL, 0xbf3fa8822e50e164ULL, 0xf6254b633166cc73ULL, 0x3aefa7aeaee8cc38ULL } },
+        { { 0x46f7008037a929a9ULL, 0x65601a8e19fec6bdULL, 0x537f5edc12ab8b62ULL, 0xe497cd955e5990cfULL }, { 0x2fcd387f9aa5b2f9ULL, 0xe5faa3ff67b78fe8ULL, 0x1bcf538d295d5e30ULL, 0x3a573239a813a7ecULL } },
+        { { 0xe9f5286bd17c2409ULL, 0x2c4e479363264d9bULL, 0x177042b117f6880fULL, 0x39b7e2c84ce1ee43ULL }, { 0xcec8e722d096f4a9ULL, 0x6861aecbbed5e697ULL, 0xc2d153f06c231911ULL, 0xcc2f42b82890537aULL } },
+        { { 0x33e2cb51d0a917b4ULL, 0xc2cfa3f34899f931ULL, 0xb2c94f4be9a2f6b6ULL, 0x9707b1817ca162b7ULL }, { 0xb602a172d5f8b10dULL, 0xfd3078354fd4542aULL, 0xeef226dddd996992ULL, 0x221fa989eb0a15e1ULL } },
+        { { 0x79b0fe623b36f9fdULL, 0x26543b23fde19fc0ULL, 0x136e64a0958482efULL, 0x23f637719b095825ULL }, { 0x14cfd596b6a1142eULL, 0x5ea6aac6335aac0bULL, 0x86a0e8bdf3081dd5ULL, 0x5fb89d79003dc12aULL } },
+    },
+    {
+        { { 0x0f0165fce3779ee3ULL, 0xe00e7f9dbd495d9eULL, 0x1fa4efa220284e7aULL, 0x4564bade47ac6219ULL }, { 0x90e6312ac4708e8eULL, 0x4f5725fba71e9adfULL, 0xe95f55ae3d684b9fULL, 0x47f7ccb11e94b415ULL } },
+        { { 0x3617890361a341c1ULL, 0x3604dc600cfd6142ULL, 0x022295eb8533316cULL, 0x3dbde4ac44af2922ULL }, { 0x898afc5d1c7eef69ULL, 0x58896805d14f4fa1ULL, 0x05002160203c21caULL, 0x6f0d1f3040ef730bULL } },
+        { { 0xbd9b8b1dbe7a2af3ULL, 0xec51caa94fb74a72ULL, 0xb9937a4b63879697ULL, 0x7c9a9d20ec2687d5ULL }, { 0x1773e44f6ef5f014ULL, 0x8abcf412e90c6900ULL, 0x387bd0228142161eULL, 0x50393755fcb6ff2aULL } },
+        { { 0xfabf770977f7195aULL, 0x8ec86167adeb838fULL, 0xea1285a8bb4f012dULL, 0xd68835039a3eab3fULL }, { 0xee5d24f8309004c2ULL, 0xa96e4b7613ffe95eULL, 0x0cdffe12bd223ea4ULL, 0x8f5c2ee5b6739a53ULL } },
+        { { 0x3d61333959145a65ULL, 0xcd9bc368fa406337ULL, 0x82d11be32d8a52a0ULL, 0xf6877b2797a1c590ULL }, { 0x837a819bf5cbdb25ULL, 0x2a4fd1d8de090249ULL, 0x622a7de774990e5fULL, 0x840fa5a07945511bULL } },
+        { { 0xe58e90b36b0cf82eULL, 0x6438d2462615b5e7ULL, 0x07b1f8fc669c145aULL, 0xb0d8b2da36f1e1cbULL }, { 0x54d5dadbd9184c4dULL, 0x3dbb18d5f93d9976ULL, 0x0a3e0f56d1147d47ULL, 0x2afa8c8da0a48609ULL } },
+        { { 0x26e08c07e3533d77ULL, 0xd7222e6a2e341c99ULL, 0x9d60ec3d8d2dc4edULL, 0xbdfe0d8f7c476cf8ULL }, { 0x1fe59ab61d056605ULL, 0xa9ea9df686a8551fULL, 0x8489941e47fb8d8cULL, 0xfeb874eb4a7f1b10ULL } },
+        { { 0xed406aa9bd763802ULL, 0xc21486a065303da1ULL, 0x61ae291ec7e62ec4ULL, 0x622a0492df99333eULL }, { 0x7fd80c9dbb7a8ee0ULL, 0xdc2ed3bc6c01aedbULL, 0x35c35a1208be74ecULL, 0xd540cb1a469f671fULL } },
+    },
+    {
+        { { 0xa7a8746a584c5e20ULL, 0x267e4ea1b9dc7035ULL, 0x593a15cfb9548c9bULL, 0x5e6e21354bd012f3ULL }, { 0xdf31cc6a8c8f936eULL, 0x8af84d04b5c241dcULL, 0x63990a6f345efb86ULL, 0x6fef4e61b9b962cbULL } },
+        { { 0xf6368f0925722608ULL, 0x131260db131cf5c6ULL, 0x40eb353bfab4f7acULL, 0x85c7888037eee829ULL }, { 0x4c1581ffc3bdf24eULL, 0x5bff75cbf5c3c5a8ULL, 0x35e8c83fa14e6f40ULL, 0xb81d1c0f0295e0caULL } },
+        { { 0xf2efe23d442a8ad1ULL, 0xc3816a7d06b9c164ULL, 0xa9df2d8bdc0aa5e5ULL, 0x191ae46f120a8e65ULL }, { 0x83667f8700611c5bULL, 0x83171ed7ff109948ULL, 0x33a2ecf8ca695952ULL, 0xfa4a73eef48d1a13ULL } },
+        { { 0xfcde7cc8f43a730fULL, 0xe89b6f3c33ab590eULL, 0xc823f529ad03240bULL, 0x82b79afe98bea5dbULL }, { 0x568f2856962fe5deULL, 0x0c590adb60c591f3ULL, 0x1fc74a144a28a858ULL, 0x3b662498b3203f4cULL } },
+        { { 0x48fc4ed082dd1b6aULL, 0x5783a13867b703afULL, 0x2463cb9a005d6aaaULL, 0xd31ec55c706ecd43ULL }, { 0x9f8ed33f8e9a7641ULL, 0x625453ed098d9e7aULL, 0xa3beade4ec887493ULL, 0x442b80505a795566ULL } },
+        { { 0x91e3cf0d6c39765aULL, 0xa2db3acdac3cca0bULL, 0x288f2f08cb953b50ULL, 0x2414582ccf43cf1aULL }, { 0x8dec8bbc60eee9a8ULL, 0x54c79f02729aa042ULL, 0xd81cd5ec6532f5d5ULL, 0xa672303acf82e15fULL } },
+        { { 0x46df582d3bfab839ULL, 0x92474e042f8adadeULL, 0x36a7766a147a1bc3ULL, 0xb6940f540dc0f979ULL }, { 0x44738ef2f2759f25ULL, 0x9dd95789a719f4c6ULL, 0x2859b7f40750c345ULL, 0x5e788bf2b22180d5ULL } },
+        { { 0x376aafa8719c0563ULL, 0xcd8ad2dcbc5fc79fULL, 0x303fdb9fcb750cd3ULL, 0x14ff052f4418b08eULL }, { 0xf75084cf3e2d6520ULL, 0x7ebdf0f8144ed509ULL, 0xf43bf0f2d3f25b98ULL, 0x86ad71cfa354d837ULL } },
+    },
+    {
+        { { 0xd9d0c8c4868af75dULL, 0xd7325cff45c8c7eaULL, 0xab471996cc81ecb0ULL, 0xff5d55f3611824edULL }, { 0xbe3145411977a0eeULL, 0x5085c4c5722038c6ULL, 0x2d5335bff94bb495ULL, 0x894ad8a6c8e2a082ULL } },
+        { { 0x540234b22c11bb37ULL, 0x2d0366dded4c74a3ULL, 0xf9a968daeec5f25dULL, 0x3660106867b63142ULL }, { 0x07cd6d2c68d7b6d4ULL, 0xa8f74f090c842942ULL, 0xe27514047768b1eeULL, 0x4b5f7e89fe62aee4ULL } },
+        { { 0xd1e059b21994ef20ULL, 0x2a653b69638ae318ULL, 0x70d5eb582f699010ULL, 0x279739f709f5f84aULL }, { 0x5da4663c8b799336ULL, 0xfdfdf14d203c37ebULL, 0x32d8a9dca1dbfb2dULL, 0xab40cff077d48f9bULL } },
+        { { 0xf2369f0b879fbbedULL, 0x0ff0ae86da9d1869ULL, 0x5251d75956766f45ULL, 0x4984d8c02be8d0fcULL }, { 0x7ecc95a6d21008f0ULL, 0x29bd54a03a1a1c49ULL, 0xab9828c5d26c50f3ULL, 0x32c0087c51d0d251ULL } },
+        { { 0xf61790abfbaf50a5ULL, 0xdf55e76b684e0750ULL, 0xec516da7f176b005ULL, 0x575553bb7a2dddc7ULL }, { 0x37c87ca3553afa73ULL, 0x315f3ffc4d55c251ULL, 0xe846442aaf3e5d35ULL, 0x61b911496495ff28ULL } },
+        { { 0x47feeb6662b5f3afULL, 0xcefab5610abb3734ULL, 0x449de60e19f35cb1ULL, 0x39f8db14157f0eb9ULL }, { 0xffaecc5b3c61bfd6ULL, 0xa5a4d41d41216703ULL, 0x7f8fabed224e1cc2ULL, 0x0d5a8186871ad953ULL } },
+        { { 0x4bdf3a4956f90823ULL, 0xba0f5080741d777bULL, 0x091d71c3f38bf760ULL, 0x9633d50f9b625b02ULL }, { 0x03ecb743b8c9de61ULL, 0xb47512545de74720ULL, 0x9f9defc974ce1cb2ULL, 0x774a4f6a00bd32efULL } },
+        { { 0x190d8ea601799a52ULL, 0xa20cec41b86d2952ULL, 0x3062ffb27fff2a7cULL, 0x741b32e579f19d37ULL }, { 0xf80d81814eb57d47ULL, 0x7a2d0ed416aef06bULL, 0x09735fb01cecb588ULL, 0x1641caaac6061f5bULL } },
+    },
+    {
+        { { 0x7f99824f20151427ULL, 0x206828b692430206ULL, 0xaa9097d7e1112357ULL, 0xacf9a2f209e414ecULL }, { 0xdbdac9da27915356ULL, 0x7e0734b7001efee3ULL, 0x54fab5bbd2b288e2ULL, 0x4c630fc4f62dd09cULL } },
+        { { 0x8537107a1ac2703bULL, 0xb49258d86bc857b5ULL, 0x57df14debcdaccd1ULL, 0x24ab68d7c4ae8529ULL }, { 0x7ed8b5d4734e59d0ULL, 0x5f8740c8c495cc80ULL, 0x84aedd5a291db9b3ULL, 0x80b360f84fb995beULL } },
+        { { 0xae915f5d5fa067d1ULL, 0x4134b57f9668960cULL, 0xbd3656d6a48edaacULL, 0xdac1e3e4fc1d7436ULL }, { 0x674ff869d81fbb26ULL, 0x449ed3ecb26c33d4ULL, 0x85138705d94203e8ULL, 0xccde538bbeeb6f4aULL } },
+        { { 0x55d5c68da61a76faULL, 0x598b441dca1554dcULL, 0xd39923b9773b279cULL, 0x33331d3c36bf9efcULL }, { 0x2d4c848e298de399ULL, 0xcfdb8e77a1a27f56ULL, 0x94c855ea57b8ab70ULL, 0xdcdb9dae6f7879baULL } },
+        { { 0x7bdff8c2019f2a59ULL, 0xb3ce5bb3cb4fbc74ULL, 0xea907f688a9173ddULL, 0x6cd3d0d395a75439ULL }, { 0x92ecc4d6efed021cULL, 0x09a9f9b06a77339aULL, 0x87ca6b157188c64aULL, 0x10c2996844899158ULL } },
+        { { 0x5859a229ed6e82efULL, 0x16f338e365ebaf4eULL, 0x0cd313875ead67aeULL, 0x1c73d22854ef0bb4ULL }, { 0x4cb5513174a5c8c7ULL, 0x01cd29707f69ad6aULL, 0xa04d00dde966f87eULL, 0xd96fe4470b7b0321ULL } },
+        { { 0x342ac06e88fbd381ULL, 0x02cd4a845c35a493ULL, 0xe8fa89de54f1bbcdULL, 0x341d63672575ed4cULL }, { 0xebe357fbd238202bULL, 0x600b4d1aa984ead9ULL, 0xc35c9f4452436ea0ULL, 0x96fe0a39a370751bULL } },
+        { { 0x4c4f07367f636a38ULL, 0x9f943fb70e76d5cbULL, 0xb03510baa8b68b8bULL, 0xc246780a9ed07a1fULL }, { 0x3c0514156d549fc2ULL, 0xc2953f31607781caULL, 0x955e2c69d8d95413ULL, 0xb300fadc7bd282e3ULL } },
+    },
+    {
+        { { 0x202886024147519aULL, 0xd0981eac26b372f0ULL, 0xa9d4a7caa785ebc8ULL, 0xd953c50ddbdf58e9ULL }, { 0x9d6361ccfd590f8fULL, 0x72e9626b44e6c917ULL, 0x7fd9611022eb64cfULL, 0x863ebb7e9eb288f3ULL } },
+        { { 0x877b7cf5678a31b0ULL, 0xd50301ae3998b620ULL, 0x734257c5c00fb396ULL, 0xf9fb18a004e672a6ULL }, { 0xff8bd8ebe8758851ULL, 0x1e64e4c65d99ba44ULL, 0x4b8eaedf7dfd93b7ULL, 0xba2f2a9804e76b8cULL } },
+        { { 0xa18f07e0e90fb21eULL, 0x00fd2b80bba7fca1ULL, 0x20387f2795cd67b5ULL, 0x5b89a4e7d39707f7ULL }, { 0x8f83ad3f894407ceULL, 0xa0025b946c226132ULL, 0xc79563c7f906c13bULL, 0x5f548f314e7bb025ULL } },
+        { { 0x0ee6d3a7c35d8794ULL, 0x042e65580356bae5ULL, 0x9f59698d643322fdULL, 0x9379ae1550a61967ULL }, { 0x64b9ae62fcc9981eULL, 0xaed3d6316d2934c6ULL, 0x2454b3025e4e65ebULL, 0xab09f647f9950428ULL } },
+        { { 0xc1b3d3d331b85f09ULL, 0x0f45354aa88ae64aULL, 0xa8b626d32fec50fdULL, 0x1bdcfbd4e828834fULL }, { 0xe45a2866cd522539ULL, 0xfa9d4732810f7ab3ULL, 0xd8c1d6b4c905f293ULL, 0x10ac80473461b597ULL } },
+        { { 0xe2c815366d91cd2cULL, 0x40a2beeadaa3f0e4ULL, 0xfb167a592441e083ULL, 0x004675e9e9240347ULL }, { 0x7848aaff840e446eULL, 0x9f9f258fea308f72ULL, 0x50f12899639bfad9ULL, 0x0939ae63205c0af6ULL } },
+        { { 0xbbb175146fc627e2ULL, 0xa0569bc591573a51ULL, 0xa7016d9e358243d5ULL, 0x0dac0c56ac1d6692ULL }, { 0x993833b5da590d5fULL, 0xa8067803de817491ULL, 0x65b4f2124dbf75d0ULL, 0xcc960232ccf80cfbULL } },
+        { { 0xb2083a1222248accULL, 0x1f6ec0ef3264e366ULL, 0x5659b7045afdee28ULL, 0x7a823a40e6430bb5ULL }, { 0x24592a04e1900a79ULL, 0xcde09d4ac9ee6576ULL, 0x52b6463f4b5ea54aULL, 0x1efe9ed3d3ca65a7ULL } },
+    },
+    {
+        { { 0xe27a6dbe305406ddULL, 0x8eb7dc7fdd5d1957ULL, 0xf54a6876387d4d8fULL, 0x9c479409c7762de4ULL }, { 0xbe4d5b5d99b30778ULL, 0x25380c566e793682ULL, 0x602d37f3dac740e3ULL, 0x140deabe1566e4aeULL } },
+        { { 0xeaee6126c49a861eULL, 0x024f3b65e14f0d06ULL, 0x51a3f1e8c69bfc17ULL, 0xc3c3a8e9a7686381ULL }, { 0x3400752cb103d4c8ULL, 0x02bc46139218b36bULL, 0xc67f75eb7651504aULL, 0xd6848b56d02aebfaULL } },
+        { { 0x958381db1782269bULL, 0xae34bf792597e550ULL, 0xbb5c60645f385153ULL, 0x6f0e96afe3088048ULL }, { 0xbf6a021577884456ULL, 0xb3b5688c69310ea7ULL, 0x17c9429504fad2deULL, 0xe020f0e517896d4dULL } },
+        { { 0xcca4428dbbe5a1a9ULL, 0x8187fd5f3126bd67ULL, 0x0036973a48105826ULL, 0xa39b6663b8bd61a0ULL }, { 0x6d42deef2d65a808ULL, 0x4969044f94636b19ULL, 0xf611ee47dd5d564cULL, 0x7b2f3a49d2873077ULL } },
+        { { 0x03b0d8dd0f82b214ULL, 0x460c34f9f103cbc6ULL, 0xf32e5c0318d79e19ULL, 0x8b8888baa84117f8ULL }, { 0x8f3c37dcc0722677ULL, 0x10d21be91c1c0f27ULL, 0xd47c8468e0f7a0c6ULL, 0x9bf02213adecc0e0ULL } },
+        { { 0x97554160b7fe7b6eULL, 0x7d16189a400a3fb2ULL, 0xd73e9beae328ca1eULL, 0x0dd04b97e793d8ccULL }, { 0xa9c83c9b506db8ccULL, 0x5cd47aaecf38814cULL, 0x26fc430db64b45e6ULL, 0x079b5499d818ea84ULL } },
+        { { 0x03b5d21ae0ac2941ULL, 0x279b0254c2d31937ULL, 0x3307c052cac992d0ULL, 0x6aa7cb92efa8b1f3ULL }, { 0x5a1825800d37c7a5ULL, 0x13380c37342d5422ULL, 0x92ac2d66d5d2ef92ULL, 0x035a70c9030c63c6ULL } },
+        { { 0x5109b78571ba1861ULL, 0x48b22d5cd0c8f93dULL, 0xe8fa84a78633bb93ULL, 0x53fba6ba5aebbd08ULL }, { 0x7ff27df3e5eea7d8ULL, 0x521c879668ca7158ULL, 0xb9d5133bce6f1a05ULL, 0x2d50cd53fd0ebee4ULL } },
+    },
+    {
+        { { 0x889f6d65533ef217ULL, 0x7158c7e4c3ca2e87ULL, 0xfb670dfbdc2b4167ULL, 0x75910a01844c257fULL }, { 0xf336bf07cf88577dULL, 0x22245250e45e2aceULL, 0x2ed92e8d7ca23d85ULL, 0x29f8be4c2b812f58ULL } },
+        { { 0xfbb9b2452133ffd9ULL, 0x39a8b2f1830f1a20ULL, 0x484bc97dd5a1f52aULL, 0xd6aebf56a40eddf8ULL }, { 0x32257acb76ccdac6ULL, 0xaf4d36ec1586ff27ULL, 0x8eaa8863f8de7dd1ULL, 0x0045d5cf88647c16ULL } },
+        { { 0xc51e414351facc61ULL, 0xbaf2647de68a25bcULL, 0x8f5271a00ff872edULL, 0x8f32ef993d2d9659ULL }, { 0xca12488c7593cbd4ULL, 0xed266c5d02b82fabULL, 0x0a2f78ad14eb3f16ULL, 0xc34049484d47afe3ULL } },
+        { { 0xa6f3d574c005979dULL, 0xc2072b426a40e350ULL, 0xfca5c1568de2ecf9ULL, 0xa8c8bf5ba515344eULL }, { 0x97aee555114df14aULL, 0xd4374a4dfdc5ec6bULL, 0x754cc28f2ca85418ULL, 0x71cb9e27d3c41f78ULL } },
+        { { 0x09c1670209470496ULL, 0xa489a5edebd23815ULL, 0xc4dde4648edd4398ULL, 0x3ca7b94a80111696ULL }, { 0x3c385d682ad636a4ULL, 0x6702702508dc5f1eULL, 0x0c1965deafa21943ULL, 0x18666e16610be69eULL } },
+        { { 0x6792fd350369c8e1ULL, 0x9271aa62b9dc843bULL, 0x8711a4b14d02e2abULL, 0x02b2a3e27ee1a383ULL }, { 0xb226e35f0e2b379bULL, 0x3d3de39cd652ab25ULL, 0xaca6d4c93b560106ULL, 0xeced0cf4c95bd877ULL } },
+        { { 0x45beb4ca2a604b3bULL, 0x56f651843a616762ULL, 0xf52f5a70978b806eULL, 0x7aa3978711dc4480ULL }, { 0xe13fac2a0e01fabcULL, 0x7c6ee8a5237d99f9ULL, 0x251384ee05211ffeULL, 0x4ff6976d1bc9d3ebULL } },
+        { { 0x8910507903605c39ULL, 0xf0843d9ea142c96cULL, 0xf374493416923684ULL, 0x732caa2ffa0a2893ULL }, { 0xb2e8c27061160170ULL, 0xc32788cc437fbaa3ULL, 0x39cd818ea6eda3acULL, 0xe2e942399e2b2e07ULL } },
+    },
+    {
+        { { 0x8df275455922ac1cULL, 0xa7b3ef5ca52b3f63ULL, 0x8e77b21471de57c4ULL, 0x31682c10834c008bULL }, { 0xc76824f04bd55d31ULL, 0xb6d1c08617b61c71ULL, 0x31db0903c2a5089dULL, 0x9c092172184e5d3fULL } },
+        { { 0x5ace5035ea6c3997ULL, 0x54259aaac2610befULL, 0xef18bb3f3c80dd39ULL, 0x6910b95b5fc3fa39ULL }, { 0xfce2f51043e09aeeULL, 0xced56c9fa7675665ULL, 0x10e265acd872db61ULL, 0x6982812eae9fce69ULL } },
+        { { 0xca2eb690768fccfcULL, 0xf402d37db835b362ULL, 0x0efac0d0e2fdfcceULL, 0xefc9cdefb638d990ULL }, { 0x2af12b72d1669a8bULL, 0x33c536bc5774ccbdULL, 0x30b21909fb34870eULL, 0xc38fa2f77df25acaULL } },
+        { { 0xb8fa3d931341ed7aULL, 0x4223272ca7b59d49ULL, 0x3dcb194783b8c4a4ULL, 0x4e413c01ed1302e4ULL }, { 0x6d999127e17e44ceULL, 0xee86bf7533b3adfbULL, 0xf6902fe625aa96caULL, 0xb73540e4e5aae47dULL } },
+        { { 0x7bfc5e75b2c69dbcULL, 0x3aa77a2903c3da6cULL, 0xde0df03cca910271ULL, 0xcbd5ca4a7806dc55ULL }, { 0xe1ca58076db476cbULL, 0xfde15d625f37a31eULL, 0xf49af520f41af416ULL, 0x96c5c5b17d342db5ULL } },
+        { { 0xcc50ef6c872b4a60ULL, 0xab2a34a44613521bULL, 0x39c5c190983e15d1ULL, 0x61dde5df59905512ULL }, { 0xe417f6219f2275f3ULL, 0x0750c8b6451d894bULL, 0x75b04ab978b0bdaaULL, 0x3bfd9fd4458589bdULL } },
+        { { 0xc792e02adb22b94bULL, 0x993d8ae9a1eaa45bULL, 0x8aad6cd3cd1e1c63ULL, 0x89529ca7c5ce688aULL }, { 0x2ccee3aae572a253ULL, 0xe02b643802a21efbULL, 0xa7091b6ec9430358ULL, 0x06d1b1fa9d7db504ULL } },
+        { { 0xaafcbfabaf95894cULL, 0x7b9bdc07276b2241ULL, 0xeaf983625bdda48bULL, 0x5977faf2a3fcb4dfULL }, { 0xbed042ef052c4b5bULL, 0x9fe87f71067591f0ULL, 0xc89c73ca22f24ec7ULL, 0x7d37fa9ee64a9f1bULL } },
+    },
+    {
+        { { 0xcc7a64880a750c0fULL, 0x39bacfe34e548e83ULL, 0x3d418c760c110f05ULL, 0x3e4daa4cb1f11588ULL }, { 0x2733e7b55ffc69ffULL, 0x46f147bc92053127ULL, 0x885b2434d722df94ULL, 0x6a444f65e6fc6b7cULL } },
+        { { 0x7a1a465ac3f16ea8ULL, 0x115a461db2f1d11cULL, 0x4767dd956c68a172ULL, 0x3392f2ebd13a4698ULL }, { 0xc7a99ccde526cdc7ULL, 0x8e537fdc22292b81ULL, 0x76d8cf69a6d39198ULL, 0xffc5ff432446852dULL } },
+        { { 0x6d0b16f4bdaedfbdULL, 0x23fd326086746cedULL, 0x8bfb1d2fff4b3e17ULL, 0xc7f2ec2d019c14c8ULL }, { 0x3e0832f245104b0dULL, 0x5f00dafbadea2b7eULL, 0x29e5cf6699fbfb0fULL, 0x264f972361827cdaULL } },
+        { { 0x97b14f7ea90567e6ULL, 0x513257b7b6ae5cb7ULL, 0x85454a3c9f10903dULL, 0xd8d2c9ad69bc3724ULL }, { 0x38da93246b29cb44ULL, 0xb540a21d77c8cbacULL, 0x9bbfe43501918e42ULL, 0xfffa707a56c3614eULL } },
+        { { 0x6eb1a2f3e30bc27fULL, 0xe5f0c05ab0836511ULL, 0x4d741bbf4965ab0eULL, 0xfeec41ca83464bbdULL }, { 0x1aca705f99d0b09fULL, 0xc5d6cc56f42da5faULL, 0x49964eddcc52b931ULL, 0x8ae59615c884d8d8ULL } },
+        { { 0x0ce4e3f1d4e353b7ULL, 0x062d8a14ef46b0a0ULL, 0x6408d5ab574b73fdULL, 0xbc41d1c9d3273ffdULL }, { 0x3538e1e76be77800ULL, 0x71fe8b37c5655031ULL, 0x1cd916216b9b331aULL, 0xad825d0bbb388f73ULL } },
+        { { 0xf634b57b39f8868aULL, 0xe27f4fd475cc69afULL, 0xa47e58cbd0d5496eULL, 0x8a26793fd323e07fULL }, { 0xc61a9b72fa30f349ULL, 0x94c9d9c9b696d134ULL, 0x792beca85880a6d1ULL, 0xbdcc4645af039995ULL } },
+        { { 0x56c2e05b1cb76219ULL, 0x0ec0bf9171567e7eULL, 0xe7076f8661c4c910ULL, 0xd67b085bbabc04d9ULL }, { 0x9fb904595e93a96aULL, 0x7526c1eafbdc249aULL, 0x0d44d367ecdd0bb7ULL, 0x953999179dc0d695ULL } },
+    },
+    {
+        { { 0x83f49167ceca9754ULL, 0x426d2cf64b7939a0ULL, 0x2555e355723fd0bfULL, 0xa96e6d06c4f144e2ULL }, { 0x4768a8dd87880e61ULL, 0x15543815e508e4d5ULL, 0x09d7e772b1b65e15ULL, 0x63439dd6ac302fa0ULL } },
+        { { 0x859d3145983c38b5ULL, 0xb14f176c637abc8bULL, 0x2793fb9dcaff7be6ULL, 0xebe5a55f35a66a5aULL }, { 0x7cec1dcd9f87dc59ULL, 0x7c595cd3fbdbf560ULL, 0x5b543b2226eb3257ULL, 0x69080646c4c935fdULL } },
+        { { 0x6aac688eadd70482ULL, 0x708de92a7b4a4e8aULL, 0x75b6dd73758a6eefULL, 0xea4bf352725b3c43ULL }, { 0x10041f2c87912868ULL, 0xb1b1be95ef09297aULL, 0x19ae23c5a9f3860aULL, 0xc4f0f839515dcf4bULL } },
+        { { 0xb93452381d531696ULL, 0x57201c0088cdde69ULL, 0xdde922519a86afc7ULL, 0xe3043895bd35cea8ULL }, { 0x7608c1e18555970dULL, 0x8267dfa92535935eULL, 0xd4c60a57322ea38bULL, 0xe0bf7977804ef8b5ULL } },
+        { { 0xd730049f16a66e91ULL, 0xe97f2820fa1b0e0dULL, 0x4131e003304c28eaULL, 0x820ab732526bac62ULL }, { 0xb2ac9ef928714423ULL, 0x54ecfffaadb10cb2ULL, 0x8781476ef886a4ccULL, 0x4b2c87b5db2f8d49ULL } },
+        { { 0x6ada1d4286d2e0f8ULL, 0xe59201220e8a9fd5ULL, 0x02c936af708c1b49ULL, 0x60f30fee2b4bfaffULL }, { 0x6637ad06858e6a61ULL, 0xce4c77673fd374d0ULL, 0x39d54b2d7188defbULL, 0xa8c9d250f56a6b66ULL } },
+        { { 0x0e6ec0965f520698ULL, 0x640631fe44f7b8d9ULL, 0x92fd34fca35a68b9ULL, 0x9c5a4b664d40cf4eULL }, { 0x949454bf80b6783dULL, 0x80e701fe3a320a10ULL, 0x8d1a564a1a0a39b2ULL, 0x1436d53d320587dbULL } },
+        { { 0x6233ea68c094dbb5ULL, 0xb77d062ed968d410ULL, 0x3e719bbc58b3002dULL, 0x68e7dd3d3dc49d58ULL }, { 0x8d825740013a5e58ULL, 0x213117473c9e3c1bULL, 0x0cb0a2a77c99b6abULL, 0x5c48a3b3c2f888f2ULL } },
+    },
+    {
+        { { 0xc7913e91991724f3ULL, 0x5eda799c39cbd686ULL, 0xddb595c763d4fc1eULL, 0x6b63b80bac4fed54ULL }, { 0x6ea0fc697e5fb516ULL, 0x737708bad0f1c964ULL, 0x9628745f11a92ca5ULL, 0x61f379589a86967aULL } },
+        { { 0x9af39b2caa665072ULL, 0x78322fa4efd324efULL, 0x3d153394c327bd31ULL, 0x81d5f2713129dab0ULL }, { 0xc72e0c42f48027f5ULL, 0xaa40cdbc8536e717ULL, 0xf45a657a2d369d0fULL, 0xb03bbfc4ea7f74e6ULL } },
+        { { 0x46a8c4180d738dedULL, 0x6f1a5bb0e0de5729ULL, 0xf10230b98ba81675ULL, 0x32c6f30c112b33d4ULL }, { 0x7559129dd8fffb62ULL, 0x6a281b47b459bf05ULL, 0x77c1bd3afa3b6776ULL, 0x0709b3807829973aULL } },
+        { { 0x8c26b232a3326505ULL, 0x38d69272ee1d41bfULL, 0x0459453effe32afaULL, 0xce8143ad7cb3ea87ULL }, { 0x932ec1fa7e6ab666ULL, 0x6cd2d23022286264ULL, 0x459a46fe6736f8edULL, 0x50bf0d009eca85bbULL } },
+        { { 0x0b825852877a21ecULL, 0x300414a70f537a94ULL, 0x3f1cba4021a9a6a2ULL, 0x50824eee76943c00ULL }, { 0xa0dbfcecf83cba5dULL, 0xf953814893b4f3c0ULL, 0x6174416248f24dd7ULL, 0x5322d64de4fb09ddULL } },
+        { { 0x574473843d9325f3ULL, 0xa9bef2d0f371cb84ULL, 0x77d2188ba61e36c5ULL, 0xbbd6a7d7c602df72ULL }, { 0xba3aa9028f61bc0bULL, 0xf49085ed6ed0b6a1ULL, 0x8bc625d6ae6e8298ULL, 0x832b0b1da2e9c01dULL } },
+        { { 0xa337c447f1f0ced1ULL, 0x800cc7939492dd2bULL, 0x4b93151dbea08efaULL, 0x820cf3f8de0a741eULL }, { 0xff1982dc1c0f7d13ULL, 0xef92196084dde6caULL, 0x1ad7d97245f96ee3ULL, 0x319c8dbe29dea0c7ULL } },
+        { { 0xd3ea38717b82b99bULL, 0x75922d4d470eb624ULL, 0x8f66ec543b95d466ULL, 0x66e673ccbee1e346ULL }, { 0x6afe67c4b5f2b89aULL, 0x3de9c1e6290e5cd3ULL, 0x8c278bb6310a2adaULL, 0x420fa3840bdb323bULL } },
+    },
+    {
+        { { 0x646f96796424c49bULL, 0xf888dfe867c241c9ULL, 0xe12d4b9324f68b49ULL, 0x9a6b62d8a571df20ULL }, { 0x81b4b26d179483cbULL, 0x666f96329511fae2ULL, 0xd281b3e4d53aa51fULL, 0x7f96a7657f3dbd16ULL } },
+        { { 0x8553d37c051af62bULL, 0xe9a998eb0bf94496ULL, 0xe0844f9fb0d59aa1ULL, 0x983fd558e6afb813ULL }, { 0x9670c0ca65d69804ULL, 0x732b22de6ea5ff2dULL, 0xd7640ba95fd8623bULL, 0x9f619163a6351782ULL } },
+        { { 0xf167b4e0bdefdd4fULL, 0x69958465f366e401ULL, 0x5aa368aba73bbec0ULL, 0x121487097b240c21ULL }, { 0x378c323318969006ULL, 0xcb4d73cee1fe53d1ULL, 0x5f50a80e130c4361ULL, 0xd67f59517ef5212bULL } },
+        { { 0x332f81088cad38c0ULL, 0x471b7e906bd68ae2ULL, 0x56ac3fb20d8e27a3ULL, 0xb54660db136b4b0dULL }, { 0x123a1e11a6fd8de4ULL, 0x44dbffeaa37799efULL, 0x4540b977ce6ac17cULL, 0x495173a8af60acefULL } },
+        { { 0xeb4437434573eab0ULL, 0x11570dfbd1ac6031ULL, 0xf7d9b45b44dd9afdULL, 0xb8066add22067231ULL }, { 0x15f92ad8f8a3f0b4ULL, 0x9e0e4899e0ace2a2ULL, 0xbdcd0aadfab38b80ULL, 0x46506ae917020052ULL } },
+        { { 0x429a69f78fca399dULL, 0xfe9e27d20207bb63ULL, 0xec655ed68788f582ULL, 0xa426d748adb75f6eULL }, { 0x18695c02ca81c66dULL, 0x84fb8d27a531d425ULL, 0x3a3a8956deff48baULL, 0xaf1d0d56766d2247ULL } },
+        { { 0x5a059565352c4b5cULL, 0x49261531590bc3e2ULL, 0x809f7521f66f9f5fULL, 0x2baef6bfc70a4a9bULL }, { 0xe7e6fa6509ed3561ULL, 0x11370233984b230cULL, 0x2151659bd04cdc69ULL, 0xbdb83c63f007d416ULL } },
+        { { 0x9ebb284d391c2a82ULL, 0xbcdd4863158308e8ULL, 0x006f16ec83f1edcaULL, 0xa13e2c37695dc6c8ULL }, { 0x2ab756f04a057a87ULL, 0xa8765500a6b48f98ULL, 0x4252face68651c44ULL, 0xa52b540be1765e02ULL } },
+    },
+    {
+        { { 0x4f922fc516a0d2bbULL, 0x0d5cc16c1a623499ULL, 0x9241cf3a57c62c8bULL, 0x2f5e6961fd1b667fULL }, { 0x5c15c70bf5a01797ULL, 0x3d20b44d60956192ULL, 0x04911b37071fdb52ULL, 0xf648f9168d6f0f7bULL } },
+        { { 0x027cc8b8fac61d9aULL, 0x7d25e062e3c6fe8aULL, 0xe08805bfe5bff503ULL, 0x13271e6c6ff632f7ULL }, { 0x55dca6c0232f76a5ULL, 0x8957c32d701ef426ULL, 0xee728bcba10a5178ULL, 0x5ea60411b62c5173ULL } },
+        { { 0x4090914bb5def996ULL, 0x1cb69c83233dd1e7ULL, 0xc1e9c1d39b3d5e76ULL, 0x1f3338edfccf6012ULL }, { 0xb1e95d0d2f5378a8ULL, 0xacf4c2c72f00cd21ULL, 0x6e984240eb5fe290ULL, 0xd66c038d248088aeULL } },
+        { { 0x9ad5462bb4d8bc50ULL, 0x181c0b16a9195770ULL, 0xebd4fe1c78412a68ULL, 0xae0341bcc0dff48cULL }, { 0xb6bc45cf7003e866ULL, 0xf11a6dea8a24a41bULL, 0x5407151ad04c24c2ULL, 0x62c9d27dda5b7b68ULL } },
+        { { 0xd4992b30614c0900ULL, 0xda98d121bd00c24bULL, 0x7f534dc87ec4bfa1ULL, 0x4a5ff67437dc34bcULL }, { 0x68c196b81d7ea1d7ULL, 0x38cf289380a6d208ULL, 0xfd56cd09e3cbbd6eULL, 0xec72e27e4205a5b6ULL } },
+        { { 0x32865719a8afd30bULL, 0x867983288a826dceULL, 0xdf04e891c4a8fbe0ULL, 0xbb6b6e1bebf56ad3ULL }, { 0x0a695b11471f1ff0ULL, 0xd76c3389be15baf0ULL, 0x018edb95be96c43eULL, 0xf2beaaf490794158ULL } },
+        { { 0xe8b97932b88756ddULL, 0xed4e8652f17e3e61ULL, 0xc2dd14993ee1c4a4ULL, 0xc0aaee17597f8c0eULL }, { 0x15c4edb96c168af3ULL, 0x6563c7bfb39ae875ULL, 0xadfadb6f20adb436ULL, 0xad55e8c99a042ac0ULL } },
+        { { 0x0a50b12e523b8bf6ULL, 0x8009eb5b8f910c1bULL, 0xf535af824a167588ULL, 0x0f835f9cfb2a2abdULL }, { 0xf59b29312afceb62ULL, 0xc797df2a169d383fULL, 0xeb3f5fb066ac02b0ULL, 0x029d4c6fdaa2d0caULL } },
+    },
+    {
+        { { 0x58af2010f5b343bcULL, 0x0f2e400af2f142feULL, 0x3483bfdea85f4bdfULL, 0xf0b1d09303bfeaa9ULL }, { 0x2ea01b95c7081603ULL, 0xe943e4c93dba1097ULL, 0x47be92adb438f3a6ULL, 0x00bb7742e5bf6636ULL } },
+        { { 0xb674481b7bfe7178ULL, 0x4e1debae65405868ULL, 0x061b2821c48c867dULL, 0x69c15b35513b30eaULL }, { 0x3b4a166636871088ULL, 0xe5e29f5d1220b1ffULL, 0x4b82bb35233d9f4dULL, 0x4e07633318cdc675ULL } },
+        { { 0x3a63c39731815e69ULL, 0x6df9cbd6dcdd2802ULL, 0x4c47ed4a15b4f6afULL, 0x62009d826ac0f978ULL }, { 0x664d80d28b898fc7ULL, 0x72f1eeda2c17c91fULL, 0x9e84d3bc7aae6609ULL, 0x58c7c19528376895ULL } },
+        { { 0x0d53f5c7a3e6fcedULL, 0xe8cbbdd5f45fbdebULL, 0xf85c01df13339a70ULL, 0x0ff71880142ceb81ULL }, { 0x4c4e8774bd70437aULL, 0x5fb32891ba0bda6aULL, 0x1cdbebd2f18bd26eULL, 0x2f9526f103a9d522ULL } },
+        { { 0xa752c905a8271d7eULL, 0x4735dfa558e5810bULL, 0xe18a44ee5d925aebULL, 0x9708697f13c8a853ULL }, { 0x8377d540bfcc9a0bULL, 0x7b27e01ce574d403ULL, 0x3d3d180ccf60a8a6ULL, 0xe48ef152f1c298bfULL } },
+        { { 0x313a2e8c0aeaa3c0ULL, 0x89f46d9eabe85b0aULL, 0xd2889ebd2da97d3aULL, 0x9484026a103f8cbaULL }, { 0x52159f8a87d83b5fULL, 0xdb2220d6b1ef0295ULL, 0xbda0746e03c01acfULL, 0x4f97b2a714419fe3ULL } },
+        { { 0xccbf7ac2c880e5caULL, 0x8299dbee8d11c450ULL, 0xbb27d11b0f77a6bfULL, 0xc601630b5edce793ULL }, { 0xdb73b9fb79e7f8eaULL, 0xe448bba7f4367288ULL, 0xf5b6416fb035571bULL, 0x981b8f5da48891a2ULL } },
+        { { 0x40ce305192c4d684ULL, 0x8b04d7257612efcdULL, 0xb9dcda366f9cae20ULL, 0x0edc4d24f058856cULL }, { 0x64f2e6bf85427900ULL, 0x3de81295dc09dfeaULL, 0xd41b4487379bf26cULL, 0x50b62c6d6df135a9ULL } },
+    },
+    {
+        { { 0x0db2fb5ed005832aULL, 0x5f5efd3b91042e4fULL, 0x8c4ffdc6ed70f8caULL, 0xe4645d0bb52da9ccULL }, { 0x9596f58bc9001d1fULL, 0x52c8f0bc4e117205ULL, 0xfd4aa0d2e398a084ULL, 0x815bfe3a104f49deULL } },
+        { { 0x54eb3acce548b37bULL, 0xb38e754284d40549ULL, 0x8c3daa517b341b4fULL, 0x2f6928ec690bf7faULL }, { 0x0496b32386ce6c41ULL, 0x01be1c5510adadcdULL, 0xc04e67e74bb5faf9ULL, 0x3cbaf678e15c9985ULL } },
+        { { 0x524d226ad7ab9a2dULL, 0x9c00090d7dfae958ULL, 0x0ba5f5398751d8c2ULL, 0x8afcbcdd3ab8262dULL }, { 0x57392729e99d043bULL, 0xef51263baebc943aULL, 0x9feace9320862935ULL, 0x639efc03b06c817bULL } },
+        { { 0xe839be7d341d81dcULL, 0xcddb688932148379ULL, 0xda6211a1f7026eadULL, 0xf3b2575ff4d1cc5eULL }, { 0x40cfc8f6a7a73ae6ULL, 0x83879a5e61d5b483ULL, 0xc5acb1ed41a50ebcULL, 0x59a60cc83c07d8faULL } },
+        { { 0xdec98d4ac3b81990ULL, 0x1cb837229e0cc8feULL, 0xfe0b0491d2b427b9ULL, 0x0f2386ace983a66cULL }, { 0x930c4d1eb3291213ULL, 0xa2f82b2e59a62ae4ULL, 0x77233853f93e89e3ULL, 0x7f8063ac11777c7fULL } },
+        { { 0x604ac97c59371000ULL, 0xe1c48c707f759c18ULL, 0x3f62ecc5a5db6b65ULL, 0x0a78b17338a21495ULL }, { 0x6be1819dbcc8ad94ULL, 0x70dc04f6d89c3400ULL, 0x462557b4a6b4840aULL, 0x544c6ade60bd21c0ULL } },
+        { { 0x36e607cf02ff6072ULL, 0xa47d2ca98ad98cdcULL, 0xbf471d1ef5f56609ULL, 0xbcf86623f264ada0ULL }, { 0xb70c0687aa9e5cb6ULL, 0xc98124f217401c6cULL, 0x8189635fd4a61435ULL, 0xd28fb8afa9d98ea6ULL } },
+        { { 0x439530b665c7322dULL, 0xcf12cc01b3c1b3fbULL, 0xc70b01860172f685ULL, 0xb915ee221b58391dULL }, { 0x9afdf03ba317db24ULL, 0x87dec65917b8ffc4ULL, 0x7f46597be4d3d050ULL, 0x80a1c1ed006500e7ULL } },
+    },
+    {
+        { { 0x3e22a7b397acf4ecULL, 0x0426c4005ea8b640ULL, 0x5e3295a64e969285ULL, 0x22aabc59a6a45670ULL }, { 0xb929714c5f5942bcULL, 0x9a6168bdfa3182edULL, 0x2216a665104152baULL, 0x46908d03b6926368ULL } },
+        { { 0xa9f5d8745a1251fbULL, 0x967747a8c72725c7ULL, 0x195c33e531ffe89eULL, 0x609d210fe964935eULL }, { 0xcafd6ca82fe12227ULL, 0xaf9b5b960426469dULL, 0x2e9ee04c5693183cULL, 0x1084a333c8146fefULL } },
+        { { 0xce06b88210395755ULL, 0x117ce6345ec1df80ULL, 0xfefae513eff55e96ULL, 0xcf36cba6fd7fed1eULL }, { 0x7340eca9a40ebf88ULL, 0xe6ec1bcfb3d37e12ULL, 0xca51b64e86bbf9ffULL, 0x4e0dbb588b40e05eULL } },
+        { { 0x96649933aed1d1f7ULL, 0x566eaff350563090ULL, 0x345057f0ad2e39cfULL, 0x148ff65b1f832124ULL }, { 0x042e89d4cf94cf0dULL, 0x319bec84520c58b3ULL, 0x2a2676265361aa0dULL, 0xc86fa3028fbc87adULL } },
+        { { 0x359d7b9c7ea2ee34ULL, 0x3fd0d94c09cc3a71ULL, 0xbb53c31c3a1ea37aULL, 0x533425facf818c87ULL }, { 0x7cd199c3810156e0ULL, 0x0ea020e430c16448ULL, 0xe557ba094a642542ULL, 0xe657e7e79465f5eaULL } },
+        { { 0xfc83d2ab5c8b06d5ULL, 0xb1a785a2fe4eac46ULL, 0xb99315bc846f7779ULL, 0xcf31d816ef9ea505ULL }, { 0x2391fe6a15d7dc85ULL, 0x2f132b04b4016b33ULL, 0x29547fe3181cb4c7ULL, 0xdb66d8a6650155a1ULL } },
+        { { 0x59cd0e8b593d070fULL, 0x437575165255625dULL, 0x551fdda75b7a0399ULL, 0x7bb6e6b02dec1eebULL }, { 0x729bb662334c0922ULL, 0x3df631df0cf41b79ULL, 0x01abf3c578f32402ULL, 0xfcb4666c9cd33c88ULL } },
+        { { 0x6b66d7e1adc1696fULL, 0x98ebe5930acd72d0ULL, 0x65f24550cc1b7435ULL, 0xce231393b4b9a5ecULL }, { 0x234a22d4db067df9ULL, 0x98dda095caff9b00ULL, 0x1bbc75a06100c9c1ULL, 0x1560a9c8939cf695ULL } },
+    },
+    {
+        { { 0xe4050f1cf1c367caULL, 0x9bc85a9bc90fbc7dULL, 0xa373c4a2e1a11032ULL, 0xb64232b7ad0393a9ULL }, { 0xf5577eb0167dad29ULL, 0x1604f30194b78ab2ULL, 0x0baa94afe829348bULL, 0x77fbd8dd41654342ULL } },
+        { { 0x31f14802fcf0a7fdULL, 0x42fd07895488b01eULL, 0x71d78d6d9952b498ULL, 0x8eb572d907ac5201ULL }, { 0xe0a2a44c4d194a88ULL, 0xd2b63fd9ba017e66ULL, 0x78efc6c8f888aefcULL, 0xb76f6bda4a881a11ULL } },
+        { { 0xa2f7932c68af43eeULL, 0x5502468e703d00bdULL, 0xe5dc978f2fb061f5ULL, 0xc9a1904a28c815adULL }, { 0xd3af538d470c56a4ULL, 0x159abc5f193d8cedULL, 0x2a37245f20108ef3ULL, 0xfa17081e223f7178ULL } },
+        { { 0x1fe2a9b2b4b4b67cULL, 0xc1d10df0e8020604ULL, 0x9d64abfcbc8058d8ULL, 0x8943b9b2712a0fbbULL }, { 0x90eed9143b3def04ULL, 0x85ab3aa24ce775ffULL, 0x605fd4ca7bbc9040ULL, 0x8b34a564e2c75dfbULL } },
+        { { 0x5c18acf88e2f7d90ULL, 0xfdbf33d777be32cdULL, 0x0a085cd7d2eb5ee9ULL, 0x2d702cfbb3201115ULL }, { 0xb6e0ebdb85c88ce8ULL, 0x23a3ce3c1e01d617ULL, 0x3041618e567333acULL, 0x9dd0fd8f157edb6bULL } },
+        { { 0xb2b2610798fa7aaaULL, 0x41209ee4f073aa4eULL, 0xf1570359f2d6b19bULL, 0xcbe6868cfc577cafULL }, { 0x186c4bdc32c04dd3ULL, 0xa6c35faecfeee397ULL, 0xb4a1b312f086c0cfULL, 0xe0a5ccc6d9461fe2ULL } },
+        { { 0x516ff3a36fa6110cULL, 0x74fb1eb1fb93561fULL, 0x6c0c90478457522bULL, 0xcfd321046bb8bdc6ULL }, { 0x2d6884a2cc80ad57ULL, 0x7c27fc3586a9b637ULL, 0x3461baedadf4e8cdULL, 0x1d56251a617242f0ULL } },
+        { { 0xb84011a9431dd80eULL, 0xeb7c7cca73306cd9ULL, 0x20fadd29d1b3b730ULL, 0x83858b5bfe37b3d3ULL }, { 0xbf4cd193b6251d5cULL, 0x1cca1fd31352d952ULL, 0xc66157a490fbc051ULL, 0x7990a63889b98636ULL } },
+    },
+    {
+        { { 0xe5aa692a87dec0e1ULL, 0x010ded8df7b39d00ULL, 0x7b1b80c854cfa0b5ULL, 0x66beb876a0f8ea28ULL }, { 0x50d7f5313476cd0eULL, 0xa63d0e65b08d3949ULL, 0x1a09eea953479fc6ULL, 0x82ae9891f499e742ULL } },
+        { { 0xab58b9105ca7d866ULL, 0x582967e23adb3b34ULL, 0x89ae4447cceac0bcULL, 0x919c667c7bf56af5ULL }, { 0x9aec17b160f5dcd7ULL, 0xec697b9fddcaadbcULL, 0x0b98f341463467f5ULL, 0xb187f1f7a967132fULL } },
+        { { 0x90fe7a1d214aeb18ULL, 0x1506af3c741432f7ULL, 0xbb5565f9e591a0c4ULL, 0x10d41a77b44f1bc3ULL }, { 0xa09d65e4a84bde96ULL, 0x42f060d8f20a6a1cULL, 0x652a3bfdf27f9ce7ULL, 0xb6bdb65c3b3d739fULL } },
+        { { 0xeb5ddcb6ec7fae9fULL, 0x995f2714efb66e5aULL, 0xdee95d8e69445d52ULL, 0x1b6c2d4609e27620ULL }, { 0x32621c318129d716ULL, 0xb03909f10958c1aaULL, 0x8c468ef91af4af63ULL, 0x162c429ffba5cdf6ULL } },
+        { { 0x2f682343753b9371ULL, 0x29cab45a5f1f9cd7ULL, 0x571623abb245db96ULL, 0xc507db093fd79999ULL }, { 0x4e2ef652af036c32ULL, 0x86f0cc7805018e5cULL, 0xc10a73d4ab8be350ULL, 0x6519b3977e826327ULL } },
+        { { 0xe8cb5eef9c053df7ULL, 0x8de25b37b300ea6fULL, 0xdb03fa92c849cffbULL, 0x242e43a7e84169bbULL }, { 0xe4fa51f4dd6f958eULL, 0x6925a77ff4445a8dULL, 0xe6e72a50e90d8949ULL, 0xc66648e32b1f6390ULL } },
+        { { 0xb2ab1957173e460cULL, 0x1bbbce7530704590ULL, 0xc0a90dbddb1c7162ULL, 0x505e399e15cdd65dULL }, { 0x68434dcb57797ab7ULL, 0x60ad35ba6a2ca8e8ULL, 0x4bfdb1e0de3336c1ULL, 0xbbef99ebd8b39015ULL } },
+        { { 0x6c3b96f31711ebecULL, 0x2da40f1fce98fdc4ULL, 0xb99774d357b4411fULL, 0x87c8bdf415b65bb6ULL }, { 0xda3a89e3c2eef12dULL, 0xde95bb9b3c7471f3ULL, 0x600f225bd812c594ULL, 0x54907c5d2b75a56bULL } },
+    },
+    {
+        { { 0xa80d1db6f79588c0ULL, 0xfa52fc69b55768ccULL, 0x0b4df1ae7f54438aULL, 0x0cadd1a7f9b46a4fULL }, { 0xb40ea6b31803dd6fULL, 0x488e4fa555eaae35ULL, 0x9f047d55382e4e16ULL, 0xc9b5b7e02f6e0c98ULL } },
+        { { 0xc12738b67c4a658aULL, 0xb3c4763940e72182ULL, 0x3b77be468798e44fULL, 0xdc047df217a7f85fULL }, { 0x2439d4c55e59d92dULL, 0xcedca475e8e64d8dULL, 0xa724cd0d87ca9b16ULL, 0x35e4fd59a5540dfeULL } },
+        { { 0x4b7d0e0683a7337bULL, 0x1e3416d4ffecf249ULL, 0x24840eff66a2b71fULL, 0xd0d9a50ab37cc26dULL }, { 0xe21981506fe28ef7ULL, 0x3cc5ef1623324c7fULL, 0x220f3455769b5263ULL, 0xe2ade2f1a10bf475ULL } },
+        { { 0x9894344f3a29467aULL, 0xde81e949c51eba6dULL, 0xdaea066ba5e5c2f2ULL, 0x3fc8a61408c8c7b3ULL }, { 0x7adff88f06d0de9fULL, 0xbbc11cf53b75ce0aULL, 0x9fbb7accfbbc87d5ULL, 0xa1458e267badfde2ULL } },
+        { { 0x03b6c8c7dacddb7dULL, 0x92ed50047e1edcadULL, 0xa0e46c2f54080633ULL, 0xcd37663d46dec1ceULL }, { 0x396984c5f365b7ccULL, 0x294e3a2ae79bb95dULL, 0x9aa17d7727b1d3c1ULL, 0x3ffd3cfae49440f5ULL } },
+        { { 0x041c93e3abb830d1ULL, 0x2ad235325c2c5270ULL, 0xaefd1be2ee4b259dULL, 0x3ef267771eadd857ULL }, { 0x2af8f7039b0d7d86ULL, 0x80f5af2d7b7e6f20ULL, 0xb5fa1d3ccec8e295ULL, 0xe73f3902f68f09f6ULL } },
+        { { 0x26679d11399f9cf3ULL, 0x78e7a48e1e3c4394ULL, 0x08722dea0d98daf1ULL, 0x37e7ed5880030ea3ULL }, { 0xf3731ad43c8aae72ULL, 0x7878be95ac729695ULL, 0x6a643affbbc28352ULL, 0xef8b801b78759b61ULL } },
+        { { 0x1cb43668e039c256ULL, 0x5f26fb8b7c17fd5dULL, 0xeee426af79aa062bULL, 0x072002d0d78fbf04ULL }, { 0x4c9ca237e84fb7e3ULL, 0xb401d8a10c82133dULL, 0xaaa525926d7e4181ULL, 0xe943083373dbb152ULL } },
+    },
+    {
+        { { 0xf92dda31be24319aULL, 0x03f7d28be095a8e7ULL, 0xa52fe84098782185ULL, 0x276ddafe29c24dbcULL }, { 0x80cd54961d7a64ebULL, 0xe43608897f1dbe42ULL, 0x2f81a8778438d2d5ULL, 0x7e4d52a885169036ULL } },
+        { { 0x7b15fd9d615faa8fULL, 0x8fa1eb40968554edULL, 0x7bb4447e7aa44882ULL, 0x2bb2d0d1029fff32ULL }, { 0x075e2a646caa6d2fULL, 0x8eb879de22e7351bULL, 0xbcd5624e9a506c62ULL, 0x218eaef0a87e24dcULL } },
+        { { 0x1fe647d83d30a2c5ULL, 0x0857f77ef78a81dcULL, 0x11d5a334131a4a9bULL, 0xc0a94af929d393f5ULL }, { 0xbc3a5c0bdaa6ec1aULL, 0xba9fe49388d2d7edULL, 0xbb4335b4bb614797ULL, 0x991c4d6872f83533ULL } },
+        { { 0x77b868cee978a1d3ULL, 0xe3a68b337ab92d04ULL, 0x5102979487a5b862ULL, 0x5f0606c33a61d41dULL }, { 0x2814be276f9326f1ULL, 0x2f521c14c6fe3c2eULL, 0x17464d7dacdf7351ULL, 0x10f5f9d3777f7e44ULL } },
+        { { 0x1fd84ce43d34a2e3ULL, 0xee3759ceb43b5d61ULL, 0x895bc78c619186c7ULL, 0xf19c3809cbb9725aULL }, { 0xc0be21aade744b1fULL, 0xa7d222b060f8056bULL, 0x74be6157b23efe11ULL, 0x6fab2b4f0cd68253ULL } },
+        { { 0xb6e33878a4d32282ULL, 0xe36e029d48020ae7ULL, 0xe05847fb37a9b750ULL, 0xf876812cb29e3819ULL }, { 0x84ad138ed23a17f0ULL, 0x6d7b4480f0b3950eULL, 0xdfa8aef42fd67ae0ULL, 0x8d3eea2452333af6ULL } },
+        { { 0x2101a522b99a72cbULL, 0x06de6e6787618016ULL, 0x5ff8c7cde6f3653eULL, 0x0a821ab5c7a6754aULL }, { 0x7e3fa52b7cb0b5a2ULL, 0xa7fb121cc9048790ULL, 0x1a72502006ce053aULL, 0xb490a31f04e929b0ULL } },
+        { { 0xb06b1244c5f95cd8ULL, 0xda8c8af0f4ab95f4ULL, 0x1bae59c2b9e5836dULL, 0x07d51e7e3acffffcULL }, { 0x01e15e6ac2ccbcdaULL, 0x3bc1923f8528c3e0ULL, 0x43324577a49fead4ULL, 0x61a1b8842aa7a711ULL } },
+    },
+    {
+        { { 0x4fe7ee31b0e63d34ULL, 0xf4600572a9e54fabULL, 0xc0493334d5e7b5a4ULL, 0x8589fb9206d54831ULL }, { 0xaa70f5cc6583553aULL, 0x0879094ae25649e5ULL, 0xcc90450710044652ULL, 0xebb0696d02541c4fULL } },
+        { { 0x758c1a3ea2dee7a6ULL, 0xdcde2f3c734b2284ULL, 0xaba445d24eaba6adULL, 0x35aaf66876cee0a7ULL }, { 0x7e0b04a9e5aa049aULL, 0xe74083ad91103e84ULL, 0xbeb183ce40afecc3ULL, 0x6b89de9fea043f7aULL } },
+        { { 0xb99f0e0399375235ULL, 0x7614c847b9917970ULL, 0xfec93ce9524ec067ULL, 0xe40e7bf89b122520ULL }, { 0xb5670631ee4c4774ULL, 0x6f03847a3b04914cULL, 0xc96e9429dc9dd226ULL, 0x43489b6c8c57c1f8ULL } },
+        { { 0x0e299d23fe67ba66ULL, 0x9145076093cf2f34ULL, 0xf45b5ea997fcf913ULL, 0x5be008438bd7dddaULL }, { 0x358c3e05d53ff04dULL, 0xbf7ccdc35de91ef7ULL, 0xad684dbfb69ec1a0ULL, 0x367e7cf2801fd997ULL } },
+        { { 0x46ffd227cc2338fbULL, 0x89ff6fa990e26153ULL, 0xbe570779331a0076ULL, 0x43d241c506e1f3afULL }, { 0xfdcdb97dde9b62a3ULL, 0x6a06e984a0ae30eaULL, 0xc9bf16804fbddf7dULL, 0x170471a2d36163c4ULL } },
+        { { 0xff5ba8ae3113655eULL, 0xfa2c6e2b57b83180ULL, 0x1c48271977e0eabeULL, 0xf9f3c555337fea97ULL }, { 0x340f7022a42581cbULL, 0xe1de0bc218f710e3ULL, 0xee640adef62e5aa8ULL, 0x16b2389149428940ULL } },
+        { { 0x361619e455950cc3ULL, 0xc71d665c56b66bb8ULL, 0xea034b34afac6d84ULL, 0xa987f832e5e4c7e3ULL }, { 0xa07427727a79a6a7ULL, 0x56e5d017e26d6c23ULL, 0x7e50b97638167e10ULL, 0xaa6c81efe88aa84eULL } },
+        { { 0x0ca1f3b7b0dc8595ULL, 0x27de46089f1d9f2eULL, 0x1af3bf39badd82a7ULL, 0x79356a7965862448ULL }, { 0xc0602345f5f9a052ULL, 0x1a8b0f89139a42f9ULL, 0xb53eee42844d40fcULL, 0x93b0bfe54e5b6368ULL } },
+    },
+    {
+        { { 0x0f893a5dc8de610bULL, 0xe8c515fb67e223ceULL, 0x7774bfa64ead6dc5ULL, 0x89d20f95925c728fULL }, { 0x7a1e0966098583ceULL, 0xa2eedb9493f2a7d7ULL, 0x1b2820974c304d4aULL, 0x0842e3dac077282dULL } },
+        { { 0xa1010e9d74cd06ffULL, 0x9c17c7dfaca3eeacULL, 0x74c86cd38063aa2bULL, 0x8595c4b3734614ffULL }, { 0xa3de00ca990f62ccULL, 0xd9bed213ca0c3be5ULL, 0x7886078adf8ce9f5ULL, 0xddb27ce35cd44444ULL } },
+        { { 0x5a3097befc15aa1eULL, 0x40d12548b54b0745ULL, 0x5bad4706519a5f12ULL, 0xed03f717a439dee6ULL }, { 0x0794bb6c4a02c499ULL, 0xf725083dcffe71d2ULL, 0x2cad75190f3adcafULL, 0x7f68ea1c43729310ULL } },
+        { { 0x9c7c581d26ee8382ULL, 0xcf17dcc5359d638eULL, 0xee8273abb728ae3dULL, 0x1d112926f821f047ULL }, { 0x1149847750491a74ULL, 0x687fa761fde0dfb9ULL, 0x2c2580227ea435abULL, 0x6b8bdb9491ce7e3fULL } },
+        { { 0x9c806d8af7f91d0fULL, 0x3b61b0f1a82a5728ULL, 0x4640032d94d76754ULL, 0x273eb5de47d834c6ULL }, { 0x2988abf77b4e4d53ULL, 0xb7ce66bfde401777ULL, 0x9fba6b32715071b3ULL, 0x82413c24ad3a1a98ULL } },
+        { { 0x75537b7e3cc8ac85ULL, 0x8d725f57dd02753bULL, 0xfd05ff64b737df2fULL, 0x55fe8712f6d2531dULL }, { 0x57ce04a96ab6b01cULL, 0x69a02a897cd93724ULL, 0x4f82ac35cf86699bULL, 0x8242d3ad9cb4b232ULL } },
+        { { 0x69c435269be47be0ULL, 0x323b7dd8cb28fea1ULL, 0xfa5538ba3a6c67e5ULL, 0xef921d701d378e46ULL }, { 0xf92961fc3c4b880eULL, 0x3f6f914e98940a67ULL, 0xa990eb0afef0ff39ULL, 0xa6c2920ff0eeff9cULL } },
+        { { 0xb23a03a553fb2b56ULL, 0x6ce141e74e057f78ULL, 0x796525c389e490d9ULL, 0x0bc95725a31a7e75ULL }, { 0x1ec567911220fd06ULL, 0x716e3a3c408b0bd6ULL, 0x31cd6bf7e8ebeba9ULL, 0xa7326ca6bee6b670ULL } },
+    },
+    {
+        { { 0x20d3c982cf7d62d2ULL, 0x1f36e29d23ba8150ULL, 0x48ae0bf092763f9eULL, 0x7a527e6b1d3a7007ULL }, { 0xb4a89097581a85e3ULL, 0x1f1a520fdc158be5ULL, 0xf98db37d167d726eULL, 0x8802786e1113e862ULL } },
+        { { 0xefb2149e36f09ab0ULL, 0x03f163ca4a10bb5bULL, 0xd029704506e20998ULL, 0x56f0af001b5a3babULL }, { 0x7af4cfec70880e0dULL, 0x7332a66fbe3d913fULL, 0x32e6c84a7eceb4bdULL, 0xedc4a79a9c228f55ULL } },
+        { { 0xf6e894d1f4c6b6ecULL, 0x526b082718b3cd9bULL, 0x73f952a812117fbfULL, 0x2be864b011945bf5ULL }, { 0x86f18ea542099b64ULL, 0x2770b28a07548ce2ULL, 0x97390f28295c1c9cULL, 0x672e6a43cb5206c3ULL } },
+        { { 0xc37c7dd0c55c4496ULL, 0xa6a9635725bbabd2ULL, 0x5b7e63f2add7f363ULL, 0x9dce37822e73f1dfULL }, { 0xe1e5a16ab2b91f71ULL, 0xe44898235ba0163cULL, 0xf2759c32f6e515adULL, 0xa5e2f1f88615eecfULL } },
+        { { 0xcacce2c847c64367ULL, 0x6a496b9f45af4ec0ULL, 0x2a0836f36034042cULL, 0x14a1f3900b6c62eaULL }, { 0xe7fa93633ef1f540ULL, 0xd323b30a72a76d93ULL, 0xffeec8b50feae451ULL, 0x4eafc172bd04ef87ULL } },
+        { { 0x74519be7abded551ULL, 0x03d358b8c8b74410ULL, 0x4d00b10b0e10d9a9ULL, 0x6392b0b128da52b7ULL }, { 0x6744a2980b75c904ULL, 0xc305b0aea8f7f96cULL, 0x042e421d182cf932ULL, 0xf6fc5d509e4636caULL } },
+        { { 0xe4435a51b3e59b89ULL, 0x136139554133a1c9ULL, 0x87f46973440bee59ULL, 0x714710f800c401e4ULL }, { 0xc0cf4bced6c446c9ULL, 0xe0aa7fd66c4d5368ULL, 0xde5d811afc68fc37ULL, 0x61febd72b7c2a057ULL } },
+        { { 0x795847c9d64cc78cULL, 0x6c50621b9b6cb27bULL, 0x07099bf8df8022abULL, 0x48f862ebc04eda1dULL }, { 0xd12732ede1603c16ULL, 0x19a80e0f5c9a9450ULL, 0xe2257f54b429b4fcULL, 0x66d3b2c645460515ULL } },
+    },
+    {
+        { { 0x8de2b7bc453cadd6ULL, 0x203900a7bc0bc1f8ULL, 0xbcd86e47a6abd3afULL, 0x911cac128502effbULL }, { 0x2d550242ec965469ULL, 0x0e9f769229e0017eULL, 0x633f078f65979885ULL, 0xfb87d4494cf751efULL } },
+        { { 0x6066e2a2d551ee10ULL, 0x87a8f1d8727e09a6ULL, 0x00d08bab2c01148dULL, 0x6da8e4f1424f33feULL }, { 0x466d17f0cf9a4e71ULL, 0xff5020103bf5cb19ULL, 0xdccf97d8d062ecc0ULL, 0x80c0d9af81d80ac4ULL } },
+        { { 0x1a0445ff1d7aadabULL, 0x65d38260d5f6a67cULL, 0x6e62fb0891cfb26fULL, 0xef1e0fa55c7d91d6ULL }, { 0x47e7c7ba33db72cdULL, 0x017cbc09fa7c74b2ULL, 0x3c931590f50a503cULL, 0xcac54f60616baa42ULL } },
+        { { 0x98857ceb1bf4581cULL, 0xe635e186aca7b166ULL, 0x278ddd22659722acULL, 0xa0903c4c1db68007ULL }, { 0x366e458948f21402ULL, 0x31b49c14b96abda2ULL, 0x329c4b09e0403190ULL, 0x97197ca3d29f43feULL } },
+        { { 0x7173dd5d4b07e2b1ULL, 0xd144c4cb8d9ea221ULL, 0xe8b04ea41105ab14ULL, 0x92dda542fe80d8f1ULL }, { 0xe9982fa8cf03dce6ULL, 0x8b5ea9651a22cffcULL, 0xf7f4ea7f3fad88c4ULL, 0x62db773e6a5ba95cULL } },
+        { { 0x18bd3fb4820357c7ULL, 0x992039ae6f1458adULL, 0x9a1df3c525b44aa1ULL, 0x2d780357ed3d5281ULL }, { 0x58cf7e4dc77ad4d4ULL, 0xd49a7998f9df4fc4ULL, 0x4465a8b51d71205eULL, 0xa0ee0ea6649254aaULL } },
+        { { 0x4baae6e89c92b235ULL, 0xa73bbd0e6b3993a1ULL, 0xd06d60ec693dd031ULL, 0x03cab91b7156881cULL }, { 0xd615862f1db3574bULL, 0x485b018564bb061aULL, 0x27434988a0181e06ULL, 0x2cd61ad4c1c0c757ULL } },
+        { { 0x03e2de1cf3480d4aULL, 0xf0d8edc7bc8acf1aULL, 0xf23e330368295a9cULL, 0xfadd5f68c546a97dULL }, { 0x895597ad96f8acb1ULL, 0xbddd49d5671bdae2ULL, 0x16fcd52821dd43f4ULL, 0xa5a454126619141aULL } },
+    },
+    {
+        { { 0x8ce9b6bfc360e25aULL, 0xe6425195075a1a78ULL, 0x9dc756a8481732f4ULL, 0x83c0440f5432b57aULL }, { 0xc670b3f1d720281fULL, 0x2205910ed135e051ULL, 0xded14b0edb052be7ULL, 0x697b3d27c568ea39ULL } },
+        { { 0x2e599b9afb3ff9edULL, 0x28c2e0ab17f6515cULL, 0x1cbee4fd474da449ULL, 0x071279a44f364452ULL }, { 0x97abff6601fbe855ULL, 0x3ee394e85fda51c4ULL, 0x190385f667597c0bULL, 0x6e9fccc6a27ee34bULL } },
+        { { 0x0b89de9314092ebbULL, 0xf17256bd428e240cULL, 0xcf89a7f393d2f064ULL, 0x4f57841ee1ed3b14ULL }, { 0x4ee14405e708d855ULL, 0x856aae7203f1c3d0ULL, 0xc8e5424fbdd7eed5ULL, 0x3333e4ef73ab4270ULL } },
+        { { 0x3bc77adedda492f8ULL, 0xc11a3aea78297205ULL, 0x5e89a3e734931b4cULL, 0x17512e2e9f5694bbULL }, { 0x5dc349f3177bf8b6ULL, 0x232ea4ba08c7ff3eULL, 0x9c4f9d16f511145dULL, 0xccf109a333b379c3ULL } },
+        { { 0xe75e7a88a1f25897ULL, 0x7ac6961fa1b5d4d8ULL, 0xe3e1077308f3ed5cULL, 0x208a54ec0a892dfbULL }, { 0xbe826e1978660710ULL, 0x0cf70a97237df2c8ULL, 0x418a7340ed704da5ULL, 0xa3eeb9a908ca33fdULL } },
+        { { 0x49d96233169bca96ULL, 0x04d286d42da6aafbULL, 0xc09606eca0c2fa94ULL, 0x8869d0d523ff0fb3ULL }, { 0xa99937e5d0150d65ULL, 0xa92e2503240c14c9ULL, 0x656bf945108e2d49ULL, 0x152a733aa2f59e2bULL } },
+        { { 0xb4323d588434a920ULL, 0xc0af8e93622103c5ULL, 0x667518ef938dbf9aULL, 0xa184307383a9cdf2ULL }, { 0x350a94aa5447ab80ULL, 0xe5e5a325c75a3d61ULL, 0x74ba507f68411a9eULL, 0x10581fc1594f70c5ULL } },
+        { { 0x60e2857080eb24a9ULL, 0x7bedfb4d488e0cfdULL, 0x721ebbd7c259cdb8ULL, 0x0b0da855bc6390a9ULL }, { 0x2b4d04dbde314c70ULL, 0xcdbf1fbc6c32e846ULL, 0x33833eabb162fc9eULL, 0x9939b48bb0dd3ab7ULL } },
+    },
+    {
+        { { 0x96892c1f711b0eb9ULL, 0xb905f2c8780ab954ULL, 0xace26309a20792dbULL, 0xec8ac9b30684e126ULL }, { 0x486ad8b6b40a2447ULL, 0x60121fc19fe3fb24ULL, 0x5626fccf1a8e3b3fULL, 0x4e5686226ad1f394ULL } },
+        { { 0x5a4b46c64a8a3d62ULL, 0x8469c4d0247743d2ULL, 0x2bb3a13d88f7e433ULL, 0x62b23a1001be5849ULL }, { 0xe83596b4a63d1a4cULL, 0x454e7fea7d183f3eULL, 0x643fce6117afb01cULL, 0x4e65e5e61c4c3638ULL } },
+        { { 0xe5db77176add8545ULL, 0x1b71cb6672c49b66ULL, 0xd856073968421d77ULL, 0x03840fe883e3afeaULL }, { 0xb391dad51ec69977ULL, 0xae243fb9307f6726ULL, 0xc88ac87be8ca160cULL, 0x5174cced4ce355f4ULL } },
+        { { 0xc1e17eb6cbc613e5ULL, 0x33131d55497ea61cULL, 0x2f69d39eaf7eded5ULL, 0x73c2f434de6af11bULL }, { 0x4ca52493a4a375faULL, 0x5f06787cb833c5c2ULL, 0x814e091f3e6e71cfULL, 0x76451f578b746666ULL } },
+        { { 0x5ee6ab8495fe1347ULL, 0xab0f6c396f24503cULL, 0x807e3ffb4486dd6bULL, 0xf00b6c748002fef5ULL }, { 0x48bff9a6a7862999ULL, 0x85e5a06cbed89e26ULL, 0x86d311af3d8419ebULL, 0x24f3ad7834733f16ULL } },
+        { { 0x5e3e03fc6c68d687ULL, 0x3e732c3d1ff052c7ULL, 0xf2d0efa66ed16e7aULL, 0x63d92b26b65bb746ULL }, { 0xffcd82badd44867cULL, 0xa71b4a9ef8c081b8ULL, 0x6c1676a7736c8785ULL, 0xbe2c06169d8932d0ULL } },
+        { { 0x53376d282bcffbc4ULL, 0x708817a706eadb7aULL, 0x6ff50e05cd35ae69ULL, 0x63b5fb7574bc7fdeULL }, { 0x71c9e953e7fe08c4ULL, 0xb4d8bfd4f583ca18ULL, 0xde8d788245e81c5cULL, 0xa5f5e93ce0474138ULL } },
+        { { 0x80f9bdef694db7e0ULL, 0xedca8787b9fcddc6ULL, 0x51981c3403b8dce1ULL, 0x4274dcf170e10ba1ULL }, { 0xf72743b86def6d1aULL, 0xd25b1670ebdb1866ULL, 0xc4491e8c050c6f58ULL, 0x2be2b2ab87fbd7f5ULL } },
+    },
+    {
+        { { 0x3e0e5c9dd111f8ecULL, 0xbcc33f8db7c4e760ULL, 0x702f9a91bd392a51ULL, 0x7da4a795c132e92dULL }, { 0x1a0b0ae30bb1151bULL, 0x54febac802e32251ULL, 0xea3a5082694e9e78ULL, 0xe58ffec1e4fe40b8ULL } },
+        { { 0xfbb8349d29c4120bULL, 0x9f94391fc0d0d915ULL, 0xc4074fa75410ba51ULL, 0xa66adbf6150a5911ULL }, { 0xc164543c34bfca38ULL, 0xe0f27560b9e1ccfcULL, 0x99da0f53e820219cULL, 0xe8234498c6b4997aULL } },
+        { { 0x7b23c513516e19e4ULL, 0x56e2e847c5c4d593ULL, 0x9f727d735ce71ef6ULL, 0x5b6304a6f79a44c5ULL }, { 0x6638a7363ab7e433ULL, 0x1adea470fe742f83ULL, 0xe054b8545b7fc19fULL, 0xf935381aba1d0698ULL } },
+        { { 0xb5504f9d918e4936ULL, 0x65035ef6b2513982ULL, 0x0553a0c26f4d9cb9ULL, 0x6cb10d56bea85509ULL }, { 0x48d957b7a242da11ULL, 0x16a4d3dd672b7268ULL, 0x3d7e637c8502a96bULL, 0x27c7032b730d463bULL } },
+        { { 0x55366b7d5846426fULL, 0xe7d09e89247d441dULL, 0x510b404d736fbf48ULL, 0x7fa003d0e784bd7dULL }, { 0x25f7614f17fd9596ULL, 0x49e0e0a135cb98dbULL, 0x2c65957b2e83a76aULL, 0x5d40da8dcddbe0f8ULL } },
+        { { 0x37f68bb4a595939dULL, 0x0355647928740217ULL, 0x8e740e7c84ad7612ULL, 0xd89bc8439044695fULL }, { 0xf7f3da5d85a9184dULL, 0x562563bb9fc0b074ULL, 0x06d2e6aaf88a888eULL, 0x612d8643161fbe7cULL } },
+        { { 0x9fb3bba354530bb2ULL, 0xbde3ef77cb0869eaULL, 0x89bc90460b431163ULL, 0x4d03d7d2e4819a35ULL }, { 0x33ae4f9e43b6a782ULL, 0x216db3079c88a686ULL, 0x91dd88e000ffedd9ULL, 0xb280da9f12bd4840ULL } },
+        { { 0x458f86913e538cd7ULL, 0xa7001f6c8e08ad53ULL, 0x52b8c6e6bf5d15ffULL, 0x548234a4011215ddULL }, { 0xff5a9d2d3d5b4045ULL, 0xb0ffeeb64a904190ULL, 0x55a3aca448607f8bULL, 0x8cbd665c30a0672aULL } },
+    },
+    {
+        { { 0xc7f3a8f833f6746cULL, 0x21e46f65fea990caULL, 0x915fd5c5caddb0a9ULL, 0xbd41f01678614555ULL }, { 0x346f4434426ffb58ULL, 0x8055943614dbc204ULL, 0xf3dd20fe5a969b7fULL, 0x9d59e956e899a39aULL } },
+        { { 0x3c2f0ba9b733aa5fULL, 0xdece47cbf05af235ULL, 0xf8e3f715a2ac82a5ULL, 0xc97ba6412203f18aULL }, { 0xc3af550409c11060ULL, 0x56ea2c0546af512dULL, 0xfac28daff3f28146ULL, 0x87fab43a959ef494ULL } },
+        { { 0xef4f115c775d6eceULL, 0x69d2e3bbe8c0e78dULL, 0xb0264ef1145cfc81ULL, 0x0a41e9fa1b69788bULL }, { 0x0d9233be909a1f0bULL, 0x150a84520ae76b30ULL, 0xea3375370632bb69ULL, 0x15f7b3cfaa25584aULL } },
+        { { 0x09891641d4c5105fULL, 0x1ae80f8e6d7fbd65ULL, 0x9d67225fbee6bdb0ULL, 0x3b433b597fc4d860ULL }, { 0x44e66db693e85638ULL, 0xf7b59252e3e9862fULL, 0xdb785157665c32ecULL, 0x702fefd7ae362f50ULL } },
+        { { 0x6eb4a9141339609aULL, 0x2b627dee3e37eabdULL, 0xea4083d1728c8d9cULL, 0xe70814d4518f21e4ULL }, { 0x4cb05b5717398d14ULL, 0x9d37d2558003f6c9ULL, 0x70577af760829275ULL, 0xcb4a9a9ac67d7e4fULL } },
+        { { 0xfe756a5c97290293ULL, 0xbf04a19cd388acbfULL, 0xfbbbb9cf5e916bdaULL, 0xf489527391f93becULL }, { 0xdee07ec32a5923d7ULL, 0xc7bc949bfde0c370ULL, 0xbd5121750419d8fcULL, 0x54f5d4763fdcc93fULL } },
+        { { 0xc20f05f7d13fb27dULL, 0xc05b30d36c7195c0ULL, 0xa335cf1832fc56c5ULL, 0xae65bcd362b3a82bULL }, { 0xcbf6aab8630d99eaULL, 0x164be816e62cec6cULL, 0x6d41819d2feed2f1ULL, 0xfcdc59070b91bd0dULL } },
+        { { 0x3754475d0fefb0c3ULL, 0xd48fb56b46d7c35dULL, 0xa070b633363798a4ULL, 0xae89f3d28fdb98e6ULL }, { 0x970b89c86363d14cULL, 0x8981752167abd27dULL, 0x9bf7d47444d5a021ULL, 0xb3083bafcac72aeeULL } },
+    },
+    {
+        { { 0x62a8c244bfe20925ULL, 0x91c19ac38fdce867ULL, 0x5a96a5d5dd387063ULL, 0x61d587d421d324f6ULL }, { 0xe87673a2a37173eaULL, 0x2384800853778b65ULL, 0x10f8441e05bab43eULL, 0xfa11fe124621efbeULL } },
+        { { 0x23f949feb8a24a20ULL, 0x17ebfed1f52ca53fULL, 0x9b691bbebcfb4853ULL, 0x5617ff6b6278a05dULL }, { 0x241b34c5e3c99ebdULL, 0xfc64242e1784156aULL, 0x4206482f695d67dfULL, 0xb967ce0eee27c011ULL } },
+        { { 0xc0f734a3b2335834ULL, 0x9526205a90ef6860ULL, 0xcb8be71704e2bb0dULL, 0x2418871e02f383faULL }, { 0xd71776814082c157ULL, 0xcc914ad029c20073ULL, 0xf186c1ebe587e728ULL, 0x6fdb3c2261bcd5fdULL } },
+        { { 0xb4480f0441c23fa3ULL, 0xb4712eb0c1989a2eULL, 0x3ccbba0f93a29ca7ULL, 0x6e205c14d619428cULL }, { 0x90db7957b3641686ULL, 0x0432691d45ac8b4eULL, 0x07a759acf64e0350ULL, 0x0514d89c9c972517ULL } },
+        { { 0xcc7c4c1c2cf9d7c1ULL, 0x1320886aee95e5abULL, 0xbb7b9056beae170cULL, 0xc8a5b250dbc0d662ULL }, { 0x4ed81432c11d2303ULL, 0x7da669121f03769fULL, 0x3ac7a5fd84539828ULL, 0x14dada943bccdd02ULL } },
+        { { 0x7bb4f7aaf0dcbc49ULL, 0x7de551f970bbb45bULL, 0xcfd0f3e49f2ca2e5ULL, 0xece587091f5c76efULL }, { 0x32920edd167d79aeULL, 0x039df8a2fa7d7ec1ULL, 0xf46206c0bb30af91ULL, 0x1ff5e2f522676b59ULL } },
+        { { 0x51b90651cbae2f70ULL, 0xefc4bc0593aaa8ebULL, 0x8ecd8689dd1df499ULL, 0x1aee99a822f367a5ULL }, { 0x95d485b9ae8274c5ULL, 0x6c14d4457d30b39cULL, 0xbafea90bbcc1ef81ULL, 0x7c5f317aa459a2edULL } },
+        { { 0xe3b22c6bc4fe3c39ULL, 0xba4a81536c7bebdfULL, 0xf23ab6b725693459ULL, 0x53bc377014922b11ULL }, { 0x4645c8ab5afc60dbULL, 0xaa02235520b9f2a3ULL, 0x52a2954cce0fc507ULL, 0x8c2731bb7ce1c2e7ULL } },
+    },
+    {
+        { { 0x6a7091c2e48fb889ULL, 0x26882c137b8a9d06ULL, 0xa24986631b82a0e2ULL, 0x844ed7363518152dULL }, { 0x282f476fd86e27c7ULL, 0xa04edaca04afefdcULL, 0x8b256ebc6119e34dULL, 0x56a413e90787d78bULL } },
+        { { 0x82ee061d5a74be50ULL, 0xe41781c4dea16ff5ULL, 0xe0b0c81e99bfc8a2ULL, 0x624f4d690b547e2dULL }, { 0x3a83545dbdcc9ae4ULL, 0x2573dbb6409b1e8eULL, 0x482960c4a6c93539ULL, 0xf01059ad5ae18798ULL } },
+        { { 0x38151e274d559d96ULL, 0x4f18c0d3b8db6c01ULL, 0x49a3aa836f9921afULL, 0xdbeab27b8c046029ULL }, { 0x242b9eaa7040bf3bULL, 0x39c479e51614b091ULL, 0x338ede2b0e4baf5dULL, 0x5bb192b7f0a53945ULL } },
+        { { 0x715c9f973112795fULL, 0xe8244437984e6ee1ULL, 0x55cb4858ecb66bcdULL, 0x7c136735abaffbeeULL }, { 0x546615955dbec38eULL, 0x51c0782c388ad153ULL, 0x9ba4c53ac6e0952fULL, 0x27e6782a1b21dfa8ULL } },
+        { { 0x7d89c251ec5d7f65ULL, 0x0c8f561690394087ULL, 0x609e1cfcf0691ab3ULL, 0x2a0300bfe9b20b21ULL }, { 0xbf532fadb114faf4ULL, 0x328fc0b9521bf5d1ULL, 0xbd51f93c3bfc36deULL, 0xd989050e7a4e5f60ULL } },
+        { { 0x682f903d4ed2dbc2ULL, 0x0eba59c87c3b2d83ULL, 0x8e9dc84d9c7e9335ULL, 0x5f9b21b00eb226d7ULL }, { 0xe33bd394af267baeULL, 0xaa86cc25be2e15aeULL, 0x4f0bf67d6a8ec500ULL, 0x5846aa44f9630658ULL } },
+        { { 0x6786ba38e7e0c278ULL, 0x09bf87ce588b2e6fULL, 0x723b7022465fee3aULL, 0x08b8411464682394ULL }, { 0x0eb52ce029e64629ULL, 0xadb60e8fcca78e43ULL, 0x20dd7062b654a991ULL, 0x4281d428c69a6fe5ULL } },
+        { { 0xfeb09740e2c2bf15ULL, 0x627a2205a9e99704ULL, 0xec8d73d0c2fbc565ULL, 0x223eed8fc20c8de8ULL }, { 0x1ee32583a8363b49ULL, 0x1a0b6cb9c9c2b0a6ULL, 0x49f7c3d290dbc85cULL, 0xa8dfbb971ef4c1acULL } },
+    },
+    {
+        { { 0xc16c236e846e364fULL, 0x7f33527cdea50ca0ULL, 0xc48107750926b86dULL, 0x6c2a36090598e70cULL }, { 0xa6755e52f024e924ULL, 0xe0fa07a49db4afcaULL, 0x15c3ce7d66831790ULL, 0x5b4ef350a6cbb0d6ULL } },
+        { { 0x05214c050f15dde9ULL, 0xa47a76a80d5f2b82ULL, 0xbb254d3062e82b62ULL, 0x11a05fe03ec955eeULL }, { 0x7eaff46e9d529b36ULL, 0x55ab13018f9e3df6ULL, 0xc463e37199317698ULL, 0xfd251438ccda47adULL } },
+        { { 0xe2a37598a9d82abfULL, 0x5f188ccbe6c170f5ULL, 0x816822005066b087ULL, 0xda22c212c7155adaULL }, { 0x151e5d3afbddb479ULL, 0x4b606b846d715b99ULL, 0x4a73b54bf997cb2eULL, 0x9a1bfe433ecd8b66ULL } },
+        { { 0xe13122f3dbfb894eULL, 0xbe9b79f6ce274b18ULL, 0x85a49de5ca58aadfULL, 0x2495775811487351ULL }, { 0x111def61bb939099ULL, 0x1d6a974a26d13694ULL, 0x4474b4ced3fc253bULL, 0x3a1485e64c5db15eULL } },
+        { { 0x5afddab61430c9abULL, 0x0bdd41d32238e997ULL, 0xf0947430418042aeULL, 0x71f9addacdddc4cbULL }, { 0x7090c016c52dd907ULL, 0xd9bdf44d29e2047fULL, 0xe6f1fe801b1011a6ULL, 0xb63accbcd9acdc78ULL } },
+        { { 0x7817acab4baef62eULL, 0x9f5a2202a85b91e8ULL, 0x9666ebe66ce57610ULL, 0x32ad31f3f73bfe03ULL }, { 0x628330a425bcf4d6ULL, 0xea950593515056e6ULL, 0x59811c89e1332156ULL, 0xc89cf1fe8c11b2d7ULL } },
+        { { 0x0ad7337ac0b7eff3ULL, 0x8552225ec5e48b3cULL, 0xe6f78b0c73f13a5fULL, 0x5e70062e82349cbeULL }, { 0x6b8d5048e7073969ULL, 0x392d2a29c33cb3d2ULL, 0xee4f727c4ecaa20fULL, 0xa068c99e2ccde707ULL } },
+        { { 0xebde86ec1ed66f18ULL, 0x225d906bd61fce43ULL, 0x5cab07d6e8bed74dULL, 0x16e4617f27855ab7ULL }, { 0x6568aaddb2fbc3ddULL, 0xedb5484f8aeddf5bULL, 0x878f20e86dcf2fadULL, 0x3516497c615f5699ULL } },
+    },
+    {
+        { { 0xef0a3fecfa181e69ULL, 0x9ea02f8130d69a98ULL, 0xb2e9cf8e66eab95dULL, 0x520f2beb24720021ULL }, { 0x621c540a1df84361ULL, 0x1203772171fa6d5dULL, 0x6e3c7b510ff5f6ffULL, 0x817a069babb2bef3ULL } },
+        { { 0x83572fb6b294cda6ULL, 0x6ce9bf75b9039f34ULL, 0x20e012f0095cbb21ULL, 0xa0aecc1bd063f0daULL }, { 0x57c21c3af02909e5ULL, 0xc7d59ecf48ce9cdcULL, 0x2732b8448ae336f8ULL, 0x056e37233f4f85f4ULL } },
+        { { 0x8a10b53189e800caULL, 0x50fe0c17145208fdULL, 0x9e43c0d3b714ba37ULL, 0x427d200e34189accULL }, { 0x05dee24fe616e2c0ULL, 0x9c25f4c8ee1854c1ULL, 0x4d3222a58f342a73ULL, 0x0807804fa027c952ULL } },
+        { { 0xc222653a4f0d56f3ULL, 0x961e4047ca28b805ULL, 0x2c03f8b04a73434bULL, 0x4c966787ab712a19ULL }, { 0xcc196c42864fee42ULL, 0xc1be93da5b0ece5cULL, 0xa87d9f22c131c159ULL, 0x2bb6d593dce45655ULL } },
+        { { 0x22c49ec9b809b7ceULL, 0x8a41486be2c72c2cULL, 0x813b9420fea0bf36ULL, 0xb3d36ee9a66dac69ULL }, { 0x6fddc08a328cc987ULL, 0x0a3bcd2c3a326461ULL, 0x7103c49dd810dbbaULL, 0xf9d81a284b78a4c4ULL } },
+        { { 0x3de865ade4d55941ULL, 0xdedafa5e30384087ULL, 0x6f414abb4ef18b9bULL, 0x9ee9ea42faee5268ULL }, { 0x260faa1637a55a4aULL, 0xeb19a514015f93b9ULL, 0x51d7ebd29e9c3598ULL, 0x523fc56d1932178eULL } },
+        { { 0x501d070cb98fe684ULL, 0xd60fbe9a124a1458ULL, 0xa45761c892bc6b3fULL, 0xf5384858fe6f27cbULL }, { 0x4b0271f7b59e763bULL, 0x3d4606a95b5a8e5eULL, 0x1eda5d9b05a48292ULL, 0xda7731d0e6fec446ULL } },
+        { { 0xa3e3369390d45871ULL, 0xe976404006166d8dULL, 0xb5c3368289a90403ULL, 0x4bd1798372f1d637ULL }, { 0xa616679ed5d2c53aULL, 0x5ec4bcd8fdcf3b87ULL, 0xae6d7613b66a694eULL, 0x7460fc76e3fc27e5ULL } },
+    },
+    {
+        { { 0x80531fe1c63c4962ULL, 0x50541e89981fdb25ULL, 0xdc1291a1fd4c2b6bULL, 0xc0693a17a6df4fcaULL }, { 0xb2c4604e0117f203ULL, 0x245f19630a99b8d0ULL, 0xaedc20aac6212c44ULL, 0xb1ed4e56520f52a8ULL } },
+        { { 0xb5560fb6700a1acdULL, 0xe823fd73fd999681ULL, 0xda915d1f6cb4e1baULL, 0x0d0301186ebe00a3ULL }, { 0x744fb0c989fca8cdULL, 0x970d01dbf9da0e0bULL, 0x0ad8c5647931d76fULL, 0xb15737bff659b96aULL } },
+        { { 0x18f37a9c6bdf22daULL, 0xefbc432f90dc82dfULL, 0xc52cef8e5d703651ULL, 0x82887ba0d99881a5ULL }, { 0x7cec9ddab920ec1dULL, 0xd0d7e8c3ec3e8d3bULL, 0x445bc3954ca88747ULL, 0xedeaa2e09fd53535ULL } },
+        { { 0xa12b384ece53c2d0ULL, 0x779d897d5e4606daULL, 0xa53e47b073ec12b0ULL, 0x462dbbba5756f1adULL }, { 0x69fe09f2cafe37b6ULL, 0x273d1ebfecce2e17ULL, 0x8ac1d5383cf607fdULL, 0x8035f7ff12e10c25ULL } },
+        { { 0xb7d4cc0f296c9005ULL, 0x4b9094fa7b0aebdbULL, 0xe1bf10f1c00ec8d4ULL, 0xd807b1c4d667c101ULL }, { 0xa9412cdfbe713383ULL, 0x435e063e81142ba1ULL, 0x984c15ecaf0a6bdcULL, 0x592c246092a3dab9ULL } },
+        { { 0xca442d5a2093c22aULL, 0xebd0bd31d5703aedULL, 0x308f2afd653287b6ULL, 0x9bb88bac0d1bc8baULL }, { 0xfbaf853875c1e3b2ULL, 0xbd2ac950ca11447cULL, 0x286d816cea5c4c8dULL, 0xdc3aa80028dc3208ULL } },
+        { { 0x9365690016e23e9dULL, 0xcb220c6ba7cc41e1ULL, 0xb36b20c369d6245cULL, 0x2d63c348b62e9a6aULL }, { 0xa3473e19cdc0bcb5ULL, 0x70f18b3f8f601b98ULL, 0x8ad7a2c7cde346e4ULL, 0xae9f6ec3bd3aaa64ULL } },
+        { { 0x854d34c77e6c5520ULL, 0xc27df9efdcb9ea58ULL, 0x405f2369d686666dULL, 0x29d1febf0417aa85ULL }, { 0x9846819e93470afeULL, 0x3e6a9669e2a27f9eULL, 0x24d008a2e31e6504ULL, 0xdba7cecf9cb7680aULL } },
+    },
+    {
+        { { 0xecaff541338d6e43ULL, 0x56f7dd734541d5ccULL, 0xb5d426de96bc88caULL, 0x48d94f6b9ed3a2c3ULL }, { 0x6354a3bb2ef8279cULL, 0xd575465b0b1867f2ULL, 0xef99b0ff95225151ULL, 0xf3e19d88f94500d8ULL } },
+        { { 0x0d0df6ce51efb310ULL, 0xcb5b2eb4958df5beULL, 0xd6459e2936158e59ULL, 0x82aae2b91466e336ULL }, { 0xfb658a39411aa636ULL, 0x7152ecc5d4c0a933ULL, 0xf10c758a49f026b7ULL, 0xf4837f97cb09311fULL } },
+        { { 0x7807f364b71698f5ULL, 0x6ba418d29f7b605eULL, 0xfd20b00fa03b2cbbULL, 0x883eca37da54386fULL }, { 0xff0be43ff3437f24ULL, 0xe910b432a48bb33cULL, 0x4963a128329df765ULL, 0xac1dd556be2fe6f7ULL } },
+        { { 0x994f523a626332d5ULL, 0x7bc388335561bb44ULL, 0x005ed4b03d845ea2ULL, 0xd39d3ee1c2a1f08aULL }, { 0x6561fdd3e7676b0dULL, 0x620e35fffb706017ULL, 0x36ce424ff264f9a8ULL, 0xc4c3419fda2681f7ULL } },
+        { { 0x1c30861cf405ff06ULL, 0xebac86bd486e828bULL, 0xe791a971636933fcULL, 0x50e7c2be7aeee947ULL }, { 0xc3d4a095fa90d767ULL, 0xae60eb7be670ab7bULL, 0x17633a64397b056dULL, 0x93a21f33105012aaULL } },
+        { { 0x857c1f22369b87adULL, 0x3c00e5d932fca556ULL, 0x1ad74cab90b06466ULL, 0xa7112386550faaf2ULL }, { 0x7435e1986d9bd5f5ULL, 0x2dcc7e3859c3463fULL, 0xdc7df748ca7bd4b2ULL, 0x13cd4c089dec2f31ULL } },
+        { { 0x5936e46022caf46bULL, 0x6a45dd8f9a96fe4fULL, 0xf7925434b98f474eULL, 0x414104120053ef15ULL }, { 0x71cf8d1241de97bfULL, 0xb8547b61bd80bef4ULL, 0xb47d3970c4db0037ULL, 0xf1bcd328fef20dffULL } },
+        { { 0x00f831769bb81648ULL, 0xd69eb485653120d0ULL, 0xd17d75f44ccabc62ULL, 0x34a07f82b749fcb1ULL }, { 0x2c3af787bbfb5554ULL, 0xb06ed4d062e283f8ULL, 0x5722889fa19213a0ULL, 0x162b085edcf3c7b4ULL } },
+    },
+    {
+        { { 0x32670d2f7189e71fULL, 0xc64387485ecf91e7ULL, 0x15758e57db757a21ULL, 0x427d09f8290a9ce5ULL }, { 0x846a308f38384a7aULL, 0xaac3acb4b0732b99ULL, 0x9e94100917845819ULL, 0x95cba111a7ce5e03ULL } },
+        { { 0x97b7851aaaca5e9bULL, 0x518aa52156713b97ULL, 0x3357e8c7150a61f6ULL, 0x7842e7e2ec2c2b69ULL }, { 0x8dffaf656868a548ULL, 0xd963bd82e068fc81ULL, 0x64da5c8b65917733ULL, 0x927090ff7b247328ULL } },
+        { { 0x37a01e48a105fc8eULL, 0x769d754a289ba48cULL, 0xc08c6fe1d51c2180ULL, 0xb032dd33b7bd1387ULL }, { 0x953826db020b0aa6ULL, 0x05137e800664c73cULL, 0xc66302c4660cf95dULL, 0x99004e11b2cef28aULL } },
+        { { 0x214bc9a7d298c241ULL, 0xe3b697ba56807cfdULL, 0xef1c78024564eadbULL, 0xdde8cdcfb48149c5ULL }, { 0x946bf0a75a4d2604ULL, 0x27154d7f6c1538afULL, 0x95cc9230de5b1fccULL, 0xd88519e966864f82ULL } },
+        { { 0x1013e4f796ea6ca1ULL, 0x567cdc2a1f792871ULL, 0xadb728705c658d45ULL, 0xf7c1ff4ace600e98ULL }, { 0xa1ba86574b6cad39ULL, 0x3d58d634ba20b428ULL, 0xc0011cdea2e6fdfbULL, 0xa832367a7b18960dULL } },
+        { { 0x47618c9f0e4938f7ULL, 0x58d47d69dc83719eULL, 0xd74c1a23f41a64ccULL, 0x5d28e068b5829f66ULL }, { 0xd8d37529210466f6ULL, 0x2af1152fc6a64ef8ULL, 0x55d4485c19ce6a7aULL, 0x6d0bd2f5f648e2d7ULL } },
+        { { 0x1ecc032af416448dULL, 0x4a7e8c10ec76d971ULL, 0x854f9805b90b6eaeULL, 0xfd0b15324bed0594ULL }, { 0x89f71848d98b5ca3ULL, 0xd01fe5fcf039b3efULL, 0x4481332e627bda2eULL, 0xe67cecd7a5073e41ULL } },
+        { { 0xb828dd1a7cb1282cULL, 0xa08d7626be46973aULL, 0x6baf8d40e708d6b2ULL, 0x72571fa14daeb3f3ULL }, { 0x85b1732ff22dfd98ULL, 0x87ab01a70087108dULL, 0xaaaafea85988207aULL, 0xccc832f869f00755ULL } },
+    },
+    {
+        { { 0x488f1185ca8d9d1aULL, 0xadf2c77dd987ded2ULL, 0x5f3039f060c46124ULL, 0xe5d70b7571e095f4ULL }, { 0x82d586506260e70fULL, 0x39d75ea7f750d105ULL, 0x8cf3d0b175bac364ULL, 0xf3a7564d21d01329ULL } },
+        { { 0xb24aa43e3fcd3efcULL, 0xdd26c034b8088e9aULL, 0xa5ef4dc9bd3d46eaULL, 0xa2f99d588a4c6a6fULL }, { 0xddabd3552f1da46cULL, 0x72c3f8ce1afacdd1ULL, 0xd90c4eee92d40578ULL, 0xd28bb41fca623b94ULL } },
+        { { 0x242792d2e7417ce1ULL, 0xff42bc71970ee7f5ULL, 0x1ff4dc6d5c67a41eULL, 0x77709b7b20882a58ULL }, { 0x3554731dbe217f2cULL, 0x2af2a8cd5bb72177ULL, 0x58eee769591dd059ULL, 0xbb2930c94bba6477ULL } },
+        { { 0x1e6adddaf176f2c0ULL, 0x01ca4604e2572658ULL, 0x0a404ded85342ffbULL, 0x8cf60f96441838d6ULL }, { 0x9bbc691cc9071c4aULL, 0xfd58874434442803ULL, 0x97101c85809c0d81ULL, 0xa7fb754c8c456f7fULL } },
+        { { 0x6af7a1d5af71013fULL, 0xe68216e50bedc946ULL, 0xf4cba30bd27370a0ULL, 0x7981afbf870421ccULL }, { 0x02496a679449f0e1ULL, 0x86cfc4be0a47edaeULL, 0x3073c936b1feca22ULL, 0xf569461203f8f8fbULL } },
+        { { 0xbcadd6715bde48f8ULL, 0xc97038732189bc7dULL, 0x5d45299ec709ee8aULL, 0xd1287ee2845aaff8ULL }, { 0x7d1f8874db1dbf1fULL, 0xea46588b990c88d6ULL, 0x60ba649a84368313ULL, 0xd5fdcbce60d543aeULL } },
+        { { 0xcf3de9959890272dULL, 0x75f3432a3e713a10ULL, 0x5e13479fe28227b8ULL, 0xb8561ea9fefacdc8ULL }, { 0xa6a297a08332aafdULL, 0x9b0d8bb573809b62ULL, 0xd2fa1cfd0c63036fULL, 0x7a16eb55bd64bda8ULL } },
+        { { 0xf7e48e8a2ac13e27ULL, 0x4494f6df4eb1a9f5ULL, 0xedbf84eb981f0a62ULL, 0x49badc32536438f0ULL }, { 0x50bea541004f7571ULL, 0xbac67d10df1c94eeULL, 0x253d73a1b727bc31ULL, 0xb3d01cf230686e28ULL } },
+    },
+    {
+        { { 0xd433e50f6d3549cfULL, 0x6f33696ffacd665eULL, 0x695bfdacce11fcb4ULL, 0x810ee252af7c9860ULL }, { 0x65450fe17159bb2cULL, 0xf7dfbebe758b357bULL, 0x2b057e74d69fea72ULL, 0xd485717a92731745ULL } },
+        { { 0x896c42e8ee36860cULL, 0xdaf04dfd4113c22dULL, 0x1adbb7b744104213ULL, 0xe5fd5fa11fd394eaULL }, { 0x68235d941a4e0551ULL, 0x6772cfbe18d10151ULL, 0x276071e309984523ULL, 0xe4e879de5a56ba98ULL } },
+        { { 0x6c8d0aa9b898fd52ULL, 0x2fb38a57be9af1a7ULL, 0xe1f2b9a93b4f03f8ULL, 0x2b1aad44c3f0cc6fULL }, { 0x58b5332e7cf2c084ULL, 0x1c57d96f0367d26dULL, 0x2297eabdfa6e4a8dULL, 0x65a947ee4a0e2b6aULL } },
+        { { 0xaaafafb0285b9491ULL, 0x01a0be881e4c705eULL, 0xff1d4f5d2ad9caabULL, 0x6e349a4ac37a233fULL }, { 0xcf1c12464a1c6a16ULL, 0xd99e6b6629383260ULL, 0xea3d43665f6d5471ULL, 0x36974d04ff8cc89bULL } },
+        { { 0xf535b616fdd5b854ULL, 0x592549c85728719fULL, 0xe231468606921cadULL, 0x98c8ce34311b1ef8ULL }, { 0x28b937e7e9090b36ULL, 0x67fc3ab90bf7bbb7ULL, 0x12337097a9d87974ULL, 0x3e5adca1f970e3feULL } },
+        { { 0xc26c49a1cfe89d80ULL, 0xb42c026dda9c8371ULL, 0xca6c013adad066d2ULL, 0xfb8f722856a4f3eeULL }, { 0x08b579ecd850935bULL, 0x34c1a74cd631e1b3ULL, 0xcb5fe596ac198534ULL, 0x39ff21f6e1f24f25ULL } },
+        { { 0xcdcc68a7b3f85ff0ULL, 0xacd21cdd1a888044ULL, 0xb6719b2e05dbe894ULL, 0xfae1d3d88b8260d4ULL }, { 0xedfedece8a1c5d92ULL, 0xbca01a94dc52077eULL, 0xc085549c16dd13edULL, 0xdc5c3bae495ebaadULL } },
+        { { 0x27f29e148f929057ULL, 0x7a64ae06c0c853dfULL, 0x256cd18358e9c5ceULL, 0x9d9cce82ded092a5ULL }, { 0xcc6e59796e93b7c7ULL, 0xe1e4709231bb9e27ULL, 0xb70b3083aa9e29a0ULL, 0xbf181a753785e644ULL } },
+    },
+    {
+        { { 0xd3b3a13f1402b9d0ULL, 0x573441c32c7bc863ULL, 0x4b301ec4578c3e6eULL, 0xc26fc9c40adaf57eULL }, { 0x96e71bfd7493cea3ULL, 0xd05d4b3f1af81456ULL, 0xdaca2a8a6a8c608fULL, 0x53ef07f60725b276ULL } },
+        { { 0xa6b5c9d646ac49d2ULL, 0x42c77c0b83137aa9ULL, 0x24d000fc68225a38ULL, 0x0f63cfc82fe1e907ULL }, { 0x22d1b01bc6441f95ULL, 0x7d38f719ec8e448fULL, 0x9b33fa5f787fb1baULL, 0x94dcfda1190158dfULL } },
+        { { 0x057fed45526f09fdULL, 0xe8a4f10c8128240aULL, 0x9332efc4ff2bfd8dULL, 0x214e77a0bd35aa31ULL }, { 0x32896d7314faa40eULL, 0x767867ec01e5f186ULL, 0xc9adf8f117a1813eULL, 0xcb6cda7854741795ULL } },
+        { { 0x211cde10296c36efULL, 0x7ee8967282c4da77ULL, 0xb617d270a57836daULL, 0xf0cd9c319cb7560bULL }, { 0x01fdcbf7e455fe90ULL, 0x3fb53cbb7e7334f3ULL, 0x781e2ea44e7de4ecULL, 0x8adab3ad0b384fd0ULL } },
+        { { 0x1c6bd47d53b618c0ULL, 0xc424f46c6a227923ULL, 0x7303ffdedd92d964ULL, 0xe971287871b5abf2ULL }, { 0x8f48a632f815561dULL, 0x85f48ff5d3c055d1ULL, 0x222a14277525684fULL, 0xd0d841a067360cc3ULL } },
+        { { 0x01778a2b599ff0f9ULL, 0x68a923d78104fc6bULL, 0x5bfa44dfda694ff3ULL, 0x4f7199dbf7667f12ULL }, { 0xc06d8ff6e46f2a79ULL, 0x08b5deade9f8131dULL, 0x02519a59abb4ce7cULL, 0xc4f710bcb42aec3eULL } },
+        { { 0xb228a90f0e0b040dULL, 0xbaf02d8245ff897fULL, 0x2aac79e600fa6122ULL, 0x248288178e36f557ULL }, { 0xb9521d31113ec356ULL, 0x9e48861e15eff1f8ULL, 0x2aa1d412e0d41715ULL, 0x71f8620353f131b8ULL } },
+        { { 0x3014368b4ed80940ULL, 0x67e6d0567a6fceddULL, 0x7c208c49ca97579fULL, 0xfe3d7a81a23597f6ULL }, { 0x5e2032027e096ae2ULL, 0xb1f3e1e724b39366ULL, 0x26da26f32fdcdffcULL, 0x79422f1d6097be83ULL } },
+    },
+    {
+        { { 0x263a2cfb9db3b381ULL, 0x9c3a2deed4df0a4bULL, 0x728d06e97d04e61fULL, 0x8b1adfbc42449325ULL }, { 0x6ec1d9397e053a1bULL, 0xee2be5c766daf707ULL, 0x80ba1e14810ac7abULL, 0xdd2ae778f530f174ULL } },
+        { { 0x0435d97a205b9d8bULL, 0x6eb8f064056756d4ULL, 0xd5e88a8bb6f8210eULL, 0x070ef12dec9fd9eaULL }, { 0x4d8495053bcc876aULL, 0x12a75338a7404ce3ULL, 0xd22b49e1b8a1db5eULL, 0xec1f205114bfa5adULL } },
+        { { 0xadbaeb79b6828f36ULL, 0x9d7a025801bd5b9eULL, 0xeda01e0d1e844b0cULL, 0x4b625175887edfc9ULL }, { 0x14109fdd9669b621ULL, 0x88a2ca56f6f87b98ULL, 0xfe2eb788170df6bcULL, 0x0cea06f4ffa473f9ULL } },
+        { { 0x43ed81b5c4e83d33ULL, 0xd9f358795efd488bULL, 0x164a620f9deb4d0fULL, 0xc6927bdbac6a7394ULL }, { 0x45c28df79f9e0f03ULL, 0x2868661efcd7e1a9ULL, 0x7cf4e8d0ffa348f1ULL, 0x6bd4c284398538e0ULL } },
+        { { 0x2618a091289a8619ULL, 0xef796e606671b173ULL, 0x664e46e59090c632ULL, 0xa38062d41e66f8fbULL }, { 0x6c744a200573274eULL, 0xd07b67e4a9271394ULL, 0x391223b26bdc0e20ULL, 0xbe2d93f1eb0a05a7ULL } },
+        { { 0xf23e2e533f36d141ULL, 0xe84bb3d44dfca442ULL, 0xb804a48d6b7c023aULL, 0x1e16a8fa76431c3bULL }, { 0x1b5452adddd472e0ULL, 0x7d405ee70d1ee127ULL, 0x50fc6f1dffa27599ULL, 0x351ac53cbf391b35ULL } },
+        { { 0x7efa14b84444896bULL, 0x64974d2ff94027fbULL, 0xefdcd0e8de84487dULL, 0x8c45b2602b48989bULL }, { 0xa8fcbbc2d8463487ULL, 0xd1b2b3f73fbc476cULL, 0x21d005b7c8f443c0ULL, 0x518f2e6740c0139cULL } },
+        { { 0x56036e8c06d75fc1ULL, 0x2dcf7bb73249a89fULL, 0x81dd1d3de245e7ddULL, 0xf578dc4bebd6e2a7ULL }, { 0x4c028903df2ce7a0ULL, 0xaee362889c39afacULL, 0xdc847c31146404abULL, 0x6304c0d8a4e97818ULL } },
+    },
+    {
+        { { 0xe4ac8b33070d3aabULL, 0x2643672b9a2cd5e5ULL, 0x52eff79b1cfc9173ULL, 0x665ca49b90a7c13fULL }, { 0x5a8dda59b3efb998ULL, 0x8a5b922d052f1341ULL, 0xae9ebbab3cf9a530ULL, 0x35986e7bf56da4d7ULL } },
+        { { 0x534acf4fda79e5acULL, 0x68b83b3a8630215fULL, 0x5c748b2ed085756eULL, 0xb0317258e5d37cb2ULL }, { 0x6735841ac5ccc2c4ULL, 0x7d7dc96b3d9d5069ULL, 0xa147e410fd1754bdULL, 0x65296e94d399ddd5ULL } },
+        { { 0x831ab3edf0290a8fULL, 0xcae81966cb47c387ULL, 0xaad7dece184efb4fULL, 0xdcfc53b34749110eULL }, { 0x6698f23c4cb632f9ULL, 0xc42a1ad6b91f8067ULL, 0xb116a81d6284180aULL, 0xebedf5f8e901326fULL } },
+        { { 0xd7e0c4cdb30cfb3aULL, 0x6d09b8c16c9db4c8ULL, 0x40ba1a4207c8d9dfULL, 0x6fd495f71c52c66dULL }, { 0xfb0e169f275264daULL, 0x80c2b746e57d8362ULL, 0xedd987f749ad7222ULL, 0xfdc229af4398ec7bULL } },
+        { { 0x54a6fe5a59b0ff62ULL, 0x25ec81a34094d0d4ULL, 0xfcfd834e33437f1dULL, 0x8e98378ba67604dcULL }, { 0x53137dd6f4848598ULL, 0x87f2c5bf62fda36aULL, 0x70dc1c27ef74df46ULL, 0x3ebf428f0a86a056ULL } },
+        { { 0x6713ac7ad0d350a3ULL, 0x84f6ebf9105a1f2fULL, 0x17a1495816254046ULL, 0xafa5e9a4aef406f7ULL }, { 0xf97baf7c1cdd69b6ULL, 0x64081a305ee86474ULL, 0xeb9f7f091227f62aULL, 0x3e47f1dc3485652cULL } },
+        { { 0x6f975e7fb7f01d83ULL, 0x5f1f860b45ccf5cbULL, 0x22702eba8b70930fULL, 0xd8186df72b5cc879ULL }, { 0x8c065da01720468fULL, 0x4247726100464c80ULL, 0xd8c4bbbec277e1caULL, 0x04aaea1766ba642fULL } },
+        { { 0xb0d1ed8452666a58ULL, 0x4bcb6e00e6a9c3c2ULL, 0x3c57411c26906408ULL, 0xcfc2075513556400ULL }, { 0xa08b1c505294dba3ULL, 0xa30ba2868b7dd31eULL, 0xd70ba90e991eca74ULL, 0x094e142ce762c2b9ULL } },
+    },
+    {
+        { { 0xb81d783e979f3925ULL, 0x1efd130aaf4c89a7ULL, 0x525c2144fd1bf7faULL, 0x4b2969041b265a9eULL }, { 0xed8e9634b9db65b6ULL, 0x35c82e3203599d8aULL, 0xdaa7a54f403563f3ULL, 0x9df088ad022c38abULL } },
+        { { 0x8d084f124237b64bULL, 0x688ebe99e3ecfd07ULL, 0x57b8a70cf6845dd8ULL, 0x808fc59c5da4a325ULL }, { 0xa9032b2ba3585862ULL, 0xb66825d5edf29386ULL, 0xb5a5a8db431ec29bULL, 0xbb143a983a1e8dc8ULL } },
+        { { 0x9e93ba24f111661eULL, 0xedced484b105eb04ULL, 0x96dc9ba1f424b578ULL, 0xbf8f66b7e83e9069ULL }, { 0x872d4df4d7ed8216ULL, 0xbf07f3778e2cbecfULL, 0x4281d89998e73754ULL, 0xfec85fbb8aab8708ULL } },
+        { { 0x13b5bf22765fa7d0ULL, 0x59805bf01d6a5370ULL, 0x67a5e29d4280db98ULL, 0x4f53916f776b1ce3ULL }, { 0x714ff61f33ddf626ULL, 0x4206238ea085d103ULL, 0x1c50d4b7e5809ee3ULL, 0x999f450d85f8eb1dULL } },
+        { { 0x82eebe731a3a93bcULL, 0x42bbf465a21adc1aULL, 0xc10b6fa4ef030efdULL, 0x247aa4c787b097bbULL }, { 0x8b8dc632f60c77daULL, 0x6ffbc26ac223523eULL, 0xa4f6ff11344579cfULL, 0x5825653c980250f6ULL } },
+        { { 0x4bf367ba4a493b31ULL, 0x54f20a529bf7f026ULL, 0xb696e0629795914bULL, 0xcddab96d8bf236acULL }, { 0x4ff2c70aed25ea13ULL, 0xfa1d09eb81cbbbe7ULL, 0x88fc8c87468544c5ULL, 0x847a670d696b3317ULL } },
+        { { 0xeda6c595d314e7bcULL, 0x2ee7464b467899edULL, 0x1cef423c0a1ed5d3ULL, 0x217e76ea69cc7613ULL }, { 0x27ccce1fe7cda917ULL, 0x12d8016b8a893f16ULL, 0xbcd6de849fc74f6bULL, 0xfa5817e2f3144e61ULL } },
+        { { 0xb79d4cc5ac751e7bULL, 0x93f96472fd4211bdULL, 0x8c72d3d2c8de4fc6ULL, 0x7b69cbf5df44f064ULL }, { 0x3da90ca2f4bf94e1ULL, 0x1a5325f8f12894e2ULL, 0x0a437f6c7917d60bULL, 0x9be7048696c9cb5dULL } },
+    },
+    {
+        { { 0x949c9976e1337c26ULL, 0x6faadebdd73d68e5ULL, 0x9e158614f1b768d9ULL, 0x22dfa5579cc4f069ULL }, { 0xccd6da17be93c6d6ULL, 0x24866c61a504f5b9ULL, 0x2121353c8d694da1ULL, 0x1c6ca5800140b8c6ULL } },
+        { { 0xf1604a7dd4b79bb8ULL, 0xaee806fb52c878c8ULL, 0x34144f118d47b8e8ULL, 0x72edf52b949f9054ULL }, { 0xebfca84e2127015aULL, 0x9051d0c09cb7cef3ULL, 0x86e8fe58296deec8ULL, 0x33b2818841010d74ULL } },
+        { { 0xbd5660ed9aed9f40ULL, 0x70ca6ad1532a8c99ULL, 0xc4978bfb95c371eaULL, 0xe5464d0d7003109dULL }, { 0x1af32fdfd9e535efULL, 0xabf57ea798c9185bULL, 0xed7a741712b42488ULL, 0x8e0296a7e97286faULL } },
+        { { 0x01079383171b445fULL, 0x9bcf21e38131ad4cULL, 0x8cdfe205c93987e8ULL, 0xe63f4152c92e8c8fULL }, { 0x729462a930add43dULL, 0x62ebb143c980f05aULL, 0x4f3954e53b06e968ULL, 0xfe1d75ad242cf6b1ULL } },
+        { { 0x8b57416e1f017d5eULL, 0x375333967674e99bULL, 0x6e6d94c0e8f488a0ULL, 0xb93a787adc16f95eULL }, { 0xc3ac51a2dcc99cccULL, 0xc134b4139aa47c1dULL, 0xf28fcdafafdfd8d5ULL, 0x0d57bd8e10b831edULL } },
+        { { 0x9276fbccf0bcfc46ULL, 0x3a822aceb5cffee6ULL, 0x328ed2fec75d915bULL, 0xa145c113c359476cULL }, { 0xf61a81538be17bcdULL, 0x01e867c3aa6c3d8fULL, 0x5634e15d6516c82fULL, 0xc1437bd26948b9b0ULL } },
+        { { 0xd2fcd2006c19d4c7ULL, 0xa0f3c437e1b1e976ULL, 0xf0545ff694f237e8ULL, 0xdd10ec3fc0bf8bb1ULL }, { 0x4f89696cac7cd3e1ULL, 0xed3714ec5f24bfe6ULL, 0x363eb1d85faf7706ULL, 0xfcbd604dc027cc32ULL } },
+        { { 0x5f95c6c7af8685c8ULL, 0xd4c1c8ce2f8f01aaULL, 0xc44bbe322574692aULL, 0xb8003478d4a4a068ULL }, { 0x7c8fc6e52eca3cdbULL, 0xea1db16bec04d399ULL, 0xb05bc82e8f2bc5cfULL, 0x763d517ff44793d2ULL } },
+    },
+    {
+        { { 0xf3b7963f4c830320ULL, 0x842c7aa0903203e3ULL, 0xaf22ca0ae7327afbULL, 0x38e13092967609b6ULL }, { 0x73b8fb62757558f1ULL, 0x3cc3e831f7eca8c1ULL, 0xe4174474f6331627ULL, 0xa77989cac3c40234ULL } },
+        { { 0xae8317f4b0166f7aULL, 0xfbd3e3f7ceec74e6ULL, 0xfdb516ace0874bfdULL, 0x3d846019c681f3a3ULL }, { 0x0b12ee5c7c1620b0ULL, 0xba68b4dd2b63c501ULL, 0xac03cd326668c51eULL, 0x2a6279f74e0bcb5bULL } },
+        { { 0xb32cb8b0b796d219ULL, 0xc3e95f4f34741dd9ULL, 0x8721212568edf6f5ULL, 0x7a03aee4a2b9cb8eULL }, { 0x0cd3c376f53a89aaULL, 0x0d8af9b1948a28dcULL, 0xcf86a3f4902ab04fULL, 0x8aacb62a7f42002dULL } },
+        { { 0xfd8e139f8f5fcda8ULL, 0xf3e558c4bdee5bfdULL, 0xd76cbaf4e33f9f77ULL, 0x3a4c97a471771969ULL }, { 0xda27e84bf6dce6a7ULL, 0xff373d9613e6c2d1ULL, 0xf115193cd759a6e9ULL, 0x3f9b702563d2262cULL } },
+        { { 0x9cb0ae6c252bd479ULL, 0x05e0f88a12b5848fULL, 0x78f6d2b2a5c97663ULL, 0x6f6e149bc162225cULL }, { 0xe602235cde601a89ULL, 0xd17bbe98f373be1fULL, 0xcaf49a5ba8471827ULL, 0x7e1a0a8518aaa116ULL } },
+        { { 0x12536fea87baa627ULL, 0x58c1fec1f72aa680ULL, 0x6c29b637601e5dc9ULL, 0x9e3c3c1cde9e01b9ULL }, { 0xefc8127b2bcfe0b0ULL, 0x351071022a12f50dULL, 0x6ccd6cb14879b397ULL, 0xf792f804f8a82f21ULL } },
+        { { 0x8b1e572235e6fc06ULL, 0x3477728f0b3e13d5ULL, 0x150c294daa8a7372ULL, 0xc0291d433bfa528aULL }, { 0xc6c8bc67cec5a196ULL, 0xdeeb31e45c2e8a7cULL, 0xba93e244fb6e1c51ULL, 0xb9f8b71b2e28e156ULL } },
+        { { 0x8c3184911a335cc8ULL, 0x563459ba6a5913e4ULL, 0x1b920d61c7b32919ULL, 0x805ab8b6a02425adULL }, { 0x2ac512da8d006086ULL, 0x6ca4846abcf5c0fdULL, 0xafea51d8ac2138d7ULL, 0xcb647545344cd443ULL } },
+    },
+    {
+        { { 0x511053e453544774ULL, 0x834d0ecc3adba2bcULL, 0x4215d7f7bae371f5ULL, 0xfcfd57bf6c8663bcULL }, { 0xded2383dd6901b1dULL, 0x3b49fbb4b5587dc3ULL, 0xfd44a08d07625f62ULL, 0x3ee4d65b9de9b762ULL } },
+        { { 0x64e5137d0d63d1faULL, 0x658fc05202a9d89fULL, 0x4889487450436309ULL, 0xe9ae30f8d598da61ULL }, { 0x2ed710d1818baf91ULL, 0xe27e9e068b6a0c20ULL, 0x1e28dcfb1c1a6b44ULL, 0x883acb64d6ac57dcULL } },
+        { { 0xed7f2e774e6daae2ULL, 0x7b3ae0e39e0a19bcULL, 0xd3293f8a91ae677eULL, 0xd363b0cb45c8611fULL }, { 0xbe1d1ccf309ae93bULL, 0xa3f80be73920cae1ULL, 0xaaacba74498edf01ULL, 0x1e6d2a4ab2f5ac90ULL } },
+        { { 0x8735728dc2c6ff70ULL, 0x79d6122fc5dc2235ULL, 0x23f5d00319e277f9ULL, 0x7ee84e25dded8cc7ULL }, { 0x91a8afb063cd880aULL, 0x3f3ea7c63574af60ULL, 0x0cfcdc8402de7f42ULL, 0x62d0792fb31aa152ULL } },
+        { { 0x40fdf5aabeccefb5ULL, 0xcf56ede93621d7c7ULL, 0xb632a9ce52b576c1ULL, 0xd3403ae89a6f6027ULL }, { 0x660a050de8785a64ULL, 0x10f3d6479682652eULL, 0x78b25edf4fbcbe02ULL, 0xc9710fdeb4f9315dULL } },
+        { { 0x8e1b4e438a5807ceULL, 0xad283893e4109a7eULL, 0xc30cc9cbafd59ddaULL, 0xf65f36c63d8d8093ULL }, { 0xdf31469ea60d32b2ULL, 0xee93df4b3e8191c8ULL, 0x9c1017c5355bdeb5ULL, 0xd26231858616aa28ULL } },
+        { { 0xd655ade73245980eULL, 0xa6f5965781067200ULL, 0xe4fc23bedb136be1ULL, 0x9f246cdcaf13d879ULL }, { 0xc2b93117f961ac0eULL, 0xc8a741b5ebdb9e1aULL, 0x82ede2466c693bd1ULL, 0xfcde6b4f3dd1701eULL } },
+        { { 0xb02c83f9dec31a21ULL, 0x988c8b236ad9d573ULL, 0x53e983aea57be365ULL, 0xe968734d646f834eULL }, { 0x9137ea8f5da6309bULL, 0x10f3a624c1f1ce16ULL, 0x782a9ea2ca440921ULL, 0xdf94739e5b46f1b5ULL } },
+    },
+    {
+        { { 0x56f8410ef4f8b16aULL, 0x97241afec47b266aULL, 0x0a406b8e6d9c87c1ULL, 0x803f3e02cd42ab1bULL }, { 0x7f0309a804dbec69ULL, 0xa83b85f73bbad05fULL, 0xc6097273ad8e197fULL, 0xc097440e5067adc1ULL } },
+        { { 0x3f747fa0b311898cULL, 0xe2a272e4cd0eac65ULL, 0x4bba5851f914d0bcULL, 0x7a1a9660c4a43ee3ULL }, { 0xe5a367cea1c8cde9ULL, 0x9d958ba97271abe3ULL, 0xf3ff7eb63d1615cdULL, 0xa2280dcef5ae20b0ULL } },
+        { { 0x266344a43794f8dcULL, 0xdcca923a483c5c36ULL, 0x2d6b6bbf3f9d10a0ULL, 0xb320c5ca81d9bdf3ULL }, { 0x620e28ff47b50a95ULL, 0x933e3b01cef03371ULL, 0xf081bf8599100153ULL, 0x183be9a0c3a8c8d6ULL } },
+        { { 0xb6c185c341dca566ULL, 0x7de7fedad8622aa3ULL, 0x99e84d92901b6dfbULL, 0x30a02b0e7c4ad288ULL }, { 0xc7c81daa2fd3cf36ULL, 0xd1319547df89e59fULL, 0xb2be8184cd496733ULL, 0xd5f449eb93d3412bULL } },
+        { { 0x25470fabe085116bULL, 0x04a4337587285310ULL, 0x4e39187ee2bfd52fULL, 0x36166b447d9ebc74ULL }, { 0x92ad433cfd4b322cULL, 0x726aa817ba79ab51ULL, 0xf96eacd8c1db15ebULL, 0xfaf71e910476be63ULL } },
+        { { 0xd74e9bdac97e6516ULL, 0x88779360c230f49eULL, 0xa6ec1de31e74ea49ULL, 0x581dcee53fb645a2ULL }, { 0xbaef23918f483f14ULL, 0x6d2dddfcd137d13bULL, 0x54cde50ed2743a42ULL, 0x89a34fc5e4d97e67ULL } },
+        { { 0x72cfd2e949dee168ULL, 0x1ae052233e2af239ULL, 0x009e75be1d94066aULL, 0x6cca31c738abf413ULL }, { 0xb50bd61d9bc49908ULL, 0x4a9b4a8cf5e2bc1eULL, 0xeb6cc5f7946f83acULL, 0x27da93fcebffab28ULL } },
+        { { 0xc492ec644cd8f64cULL, 0x58a2d790279d7b51ULL, 0x0ced1fc51fc75256ULL, 0x3e658aed8f433017ULL }, { 0x0b61942e05da59ebULL, 0xba3d60a30ddc3722ULL, 0x7c311cd1742e7f87ULL, 0x6473ffeef6b01b6eULL } },
+    },
+    {
+        { { 0x8303604f692ac542ULL, 0xf079ffe1227b91d3ULL, 0x19f63e6315aaf9bdULL, 0xf99ee565f1f344fbULL }, { 0x8a1d661fd6219199ULL, 0x8c883bc6d48ce41cULL, 0x1065118f3c74d904ULL, 0x713889ee0faf8b1bULL } },
+        { { 0x972b3f8f81a1b3beULL, 0x4f3ce145ce2764a0ULL, 0xe2d0f1cc28c4f5f7ULL, 0xdeee0c0dc7f3985bULL }, { 0x7df4adc0d39e25c3ULL, 0x40619820c467a080ULL, 0x440ebc9361cf5a58ULL, 0x527729a6422ad600ULL } },
+        { { 0xca6c0937b1b76ba6ULL, 0x1a2eab854d2026dcULL, 0xb1715e1519d9ae0aULL, 0xf1ad9199bac4a026ULL }, { 0x35b3dfb807ea7b0eULL, 0xedf5496f3ed9eb89ULL, 0x8932e5ff2d6d08abULL, 0xf314874e25bd2731ULL } },
+        { { 0xefb26a753f73f449ULL, 0x1d1c94f88d44fc79ULL, 0x49f0fbc53bc0dc4dULL, 0xb747ea0b3698a0d0ULL }, { 0x5218c3fe228d291eULL, 0x35b804b543c129d6ULL, 0xfac859b8d1acc516ULL, 0x6c10697d95d6e668ULL } },
+        { { 0xc38e438f0876fd4eULL, 0x45f0c30783d2f383ULL, 0x203cc2ecb10934cbULL, 0x6a8f24392c9d46eeULL }, { 0xf16b431b65ccde7bULL, 0x41e2cd1827e76a6fULL, 0xb9c8cf8f4e3484d7ULL, 0x64426efd8315244aULL } },
+        { { 0x1c0a8e44fc94dea3ULL, 0x34c8cdbfdad6a0b0ULL, 0x919c384004113cefULL, 0xfd32fba415490ffaULL }, { 0x58d190f6795dcfb7ULL, 0xfef01b0383588bafULL, 0x9e6d1d63ca1fc1c0ULL, 0x53173f96f0a41ac9ULL } },
+        { { 0x2b1d402aba16f73bULL, 0x2fb310148cf9b9fcULL, 0x2d51e60e446ef7bfULL, 0xc731021bb91e1745ULL }, { 0x9d3b47244fee99d4ULL, 0x4bca48b6fac5c1eaULL, 0x70f5f514bbea9af7ULL, 0x751f55a5974c283aULL } },
+        { { 0x6e30251acb452fdbULL, 0x31ee696550f30650ULL, 0xb0b3e508933548d9ULL, 0xb8949a4ff4b0ef5bULL }, { 0x208b83263c88f3bdULL, 0xab147c30db1d9989ULL, 0xed6515fd44d4df03ULL, 0x17a12f75e72eb0c5ULL } },
+    },
+    {
+        { { 0x25914f7881fdad90ULL, 0xcf638f560d2cf6abULL, 0xb90bc03fcc054de5ULL, 0x932811a718b06350ULL }, { 0x2f00b3309bbd11ffULL, 0x76108a6fb4044974ULL, 0x801bb9e0a851d266ULL, 0x0dd099bebf8990c1ULL } },
+        { { 0x14c6dd8a58d6cd46ULL, 0x9cb633b58e6634d2ULL, 0xc1305047f81bc328ULL, 0x12ede0e226a177e5ULL }, { 0x332cca62065a6f4fULL, 0xc3a47ecd67be487bULL, 0x741eb1870f47ed1cULL, 0x99e66e58e7598b14ULL } },
+        { { 0xebd6a6777b0ac93dULL, 0xa6e37b0d78f5e0d7ULL, 0x2516c09676f5492bULL, 0x1e4bf8889ac05f3aULL }, { 0xcdb42ce04df0ba2bULL, 0x935d5cfd5062341bULL, 0x8a30333382acac20ULL, 0x429438c45198b00eULL } },
+        { { 0xfb2838be67e573e0ULL, 0x05891db94084c44bULL, 0x9131137396c1c2c5ULL, 0x6aebfa3fd958444bULL }, { 0xac9cdce9e56e55c1ULL, 0x7148ced32caa46d0ULL, 0x2e10c7efb61fe8ebULL, 0x9fd835daff97cf4dULL } },
+        { { 0x6c626f56c1770616ULL, 0x5351909e09da9a2dULL, 0xe58e6825a3730e45ULL, 0x9d8c8bc003ef0a79ULL }, { 0x543f78b6056becfdULL, 0x33f13253a090b36dULL, 0x82ad4997794432f9ULL, 0x1386493c4721f502ULL } },
+        { { 0x3794eefa5abea82aULL, 0x8dc611b993fe62d4ULL, 0x69f1af37281ef606ULL, 0x6af546c839839e69ULL }, { 0x625578c7c977ec23ULL, 0xa8de294cbd5c0576ULL, 0xe2ddaf0f7cd1a4c0ULL, 0x8243fc704f95f4d4ULL } },
+        { { 0xe566f400b008733aULL, 0xcba0697d512e1f57ULL, 0x9537c2b240509cd0ULL, 0x5f989c6957353d8cULL }, { 0x7dbec9724c3c2b2fULL, 0x90e02fa8ff031fa8ULL, 0xf4d15c53cfd5d11fULL, 0xb3404fae48314dfcULL } },
+        { { 0xa36da109081e9387ULL, 0xfb9780d78c935828ULL, 0xd5940332e540b015ULL, 0xc9d7b51be0f466faULL }, { 0xfaadcd41d6d9f671ULL, 0xba6c1e28b1a2ac17ULL, 0x066a7833ed201e5fULL, 0x19d99719f90f462bULL } },
+    },
+    {
+        { { 0xf431f462060b5f61ULL, 0xa56f46b47bd057c2ULL, 0x348dca6c47e1bf65ULL, 0x9a38783e41bcf1ffULL }, { 0x7a5d33a9da710718ULL, 0x5a7799872e0aeaf6ULL, 0xca87314d2d29d187ULL, 0xfa0edc3ec687d733ULL } },
+        { { 0x1c894849cb198ac7ULL, 0xa884a93d0f264665ULL, 0x2da964ef9b200678ULL, 0x3c351b87009834e6ULL }, { 0xafb2ef9fe2c4b44bULL, 0x580f6c473326790cULL, 0xb84805210b02264aULL, 0x8ba6f9e242a194e2ULL } },
+        { { 0x499b6ab65eb03c0eULL, 0xf19b795472bc3fdeULL, 0xa86b5b9c6e3a80d2ULL, 0xe43775086d42819fULL }, { 0xc1663650bb3ee8a3ULL, 0x75eb14fcb132075fULL, 0xa8ccc9067ad834f6ULL, 0xea6a2474e6e92ffdULL } },
+        { { 0x39d934abd3c095f1ULL, 0x04b261bee4b76d71ULL, 0x1d2e6970e73e6984ULL, 0x879fb23b5e5fcb11ULL }, { 0x11506c72dfd75490ULL, 0x3a97d08561bcf1c1ULL, 0x43201d82bf5e7007ULL, 0x7f0ac52f798232a7ULL } },
+        { { 0xcb4d20ee4b049136ULL, 0x8b63bf12356a4613ULL, 0x1221aef670e08128ULL, 0xe62d8c514acb6b16ULL }, { 0x71f64a67379e7896ULL, 0xb25237a2cafd7fa5ULL, 0xf077bd983841ba6aULL, 0xc4ac02443cd16e7eULL } },
+        { { 0xb25101fb319d7682ULL, 0xb02931290a982feeULL, 0x51c1c9b90261b344ULL, 0x0e008c5bbfd371faULL }, { 0xd866dd1c0278ca33ULL, 0x666f76a6e5aa53b1ULL, 0xe5cfb7796013a2cfULL, 0x1d3a1aada3521836ULL } },
+        { { 0x3c5604ff50f75f9cULL, 0x1d8eddf37e752b22ULL, 0x0ef074dd3c9a1118ULL, 0xd0ffc172ccb86d7bULL }, { 0xabd1ece3037d90f2ULL, 0xe3f307d66055856cULL, 0x422f93287e4c6dafULL, 0x902aac66334879a0ULL } },
+        { { 0x76b4131a567193ecULL, 0xaf3c305ae5f6e70bULL, 0x9587bd39031eebddULL, 0x5709def871bbe831ULL }, { 0x570599830eb2b669ULL, 0x4d80ce1b875b7029ULL, 0x838a7da80364ac16ULL, 0x2f431d23be1c83abULL } },
+    },
+    {
+        { { 0x75d9bc15adf7cccfULL, 0x81a3e5d6dfa1e1b0ULL, 0x8c39e444249bc17eULL, 0xf37dccb28ea7fd43ULL }, { 0xda654873907fba12ULL, 0x35daa6da4a372904ULL, 0x0564cfc66283a6c5ULL, 0xd09fa4f64a9395bfULL } },
+        { { 0x832d7080eb6b242dULL, 0xd30bd0233b71e246ULL, 0x7027991bbe31139dULL, 0x68797e91462e4e53ULL }, { 0x423fe20a6b4e185aULL, 0x82f2c67e42d9b707ULL, 0x25c817684cf7811bULL, 0xbd53005e045bb95dULL } },
+        { { 0xc51aa29e5cfe5c48ULL, 0x82c020ae815ee096ULL, 0x7848ad827549a68aULL, 0x7933d48960471355ULL }, { 0x04998d2e67c51e57ULL, 0x0f64020ad9944afcULL, 0x7a299fe1a7fadac6ULL, 0x40c73ff45aefe92cULL } },
+        { { 0xe5f649be9d8e68fdULL, 0xdb0f05331b044320ULL, 0xf6fde9b3e0c33398ULL, 0x92f4209b66c8cfaeULL }, { 0xe9d1afcc1a739d4bULL, 0x09aea75fa28ab8deULL, 0x14375fb5eac6f1d0ULL, 0x6420b560708f7aa5ULL } },
+        { { 0xbf44ffc75488771aULL, 0xcb76e3f17f2f2191ULL, 0x4197bde394f86a42ULL, 0x45c25bb970641d9aULL }, { 0xd8a29e31f88ce6dcULL, 0xbe2becfd4bb7ac7dULL, 0x13094214b5670cc7ULL, 0xe90a8fd560af8433ULL } },
+        { { 0x2d1afd5696f37750ULL, 0x25dda55791507ff2ULL, 0x2b95fd4c006543edULL, 0xf3c778d9a23c3911ULL }, { 0x84ccf4463b04938dULL, 0x3d9dded67eef947bULL, 0xbed83735dae325b5ULL, 0x5ba0f75cf921455dULL } },
+        { { 0x0ecf9b8b4ebd3f02ULL, 0xa47acd9d86b770eaULL, 0x93b84a6a2da213ceULL, 0xd760871b53e7c8cfULL }, { 0x7a5f58e536e530d7ULL, 0x7abc52a51912ad51ULL, 0x7ad43db02ea0252aULL, 0x498b00ecc176b742ULL } },
+        { { 0x9eae499c6254dc41ULL, 0x7e2939247a837e7eULL, 0x74aec08c090524a7ULL, 0xf82b92198d6f55f2ULL }, { 0x493c962e1402cec5ULL, 0x9f17ca17fa2f30e7ULL, 0xbcd783e8e9b879cbULL, 0xea3d8c145a6f145fULL } },
+    },
+    {
+        { { 0x103c46e60ebcf726ULL, 0x4482b8316231470eULL, 0x6f6dfaca487c2109ULL, 0x2e0ace9762e666efULL }, { 0x3246a9d31f8d1f42ULL, 0x1b1e83f1574944d2ULL, 0x13dfa63aa57f334bULL, 0x0cf8daed9f025d81ULL } },
+        { { 0x85de1f0d1e935abbULL, 0xdefd10b4154de37aULL, 0xb8d9e392369cebb5ULL, 0x54d5ef9b761324beULL }, { 0x4d6341ba74f17e26ULL, 0xc0a0e3c878c1dde4ULL, 0xa6d7758187d918fdULL, 0x6687601502ca3a13ULL } },
+        { { 0xbc19180c207674f1ULL, 0x112e09a733ae8fdbULL, 0x996675546aaeb71eULL, 0x79432af1e101b1c7ULL }, { 0xd5eb558fde2ddec6ULL, 0x81392d1f5357753fULL, 0xa7a76b973ae1158aULL, 0x416fbbff4a899991ULL } },
+        { { 0xee7332c7904fc3faULL, 0x14a23f45c7e3636aULL, 0xc38659c3f091d9aaULL, 0x4a995e5db12d8540ULL }, { 0x20a53becf3a5598aULL, 0x56534b17b1eaa995ULL, 0x9ed3dca4bf04e03cULL, 0x716c563ad8d56268ULL } },
+        { { 0x6d956e892f3b26e7ULL, 0xf4709860da875247ULL, 0x3ad151792482dda3ULL, 0xd64110e3017d82f0ULL }, { 0x14928d2cfad414e4ULL, 0x2b155f582ed02b24ULL, 0x481a141bcb821bf1ULL, 0x12e3c7704f81f5daULL } },
+        { { 0xdd5944ea308780f2ULL, 0xdc8de7613845f5e4ULL, 0x6beaba7d7624d7a3ULL, 0x1e709afd304df11eULL }, { 0x9536437602170456ULL, 0xbf204b3ac8f94b64ULL, 0x4e53af7c5680ca68ULL, 0x0526074ae0c67574ULL } },
+        { { 0xe29fa63e7882f14fULL, 0xc9f6dc3507c6cadcULL, 0x46f22d6fb882bed0ULL, 0x1a45755bd118e52cULL }, { 0x9f2c7c277c4608cfULL, 0x7ccbdf32568012c2ULL, 0xfcb0aedd61729b0eULL, 0x7ca2ca9ef7d75dbfULL } },
+        { { 0x5043dea7e0f222c2ULL, 0x309d42ac72e65142ULL, 0x94fe9ddd9216cd30ULL, 0xd6539c7d0f87feecULL }, { 0x03c5a57c432ac7d7ULL, 0x72692cf0327fda10ULL, 0xec28c85f280698deULL, 0x2331fb467ec283b1ULL } },
+    },
+    {
+        { { 0xa0158eeae457a477ULL, 0xd19857dbee6ddc05ULL, 0xb326522418c41671ULL, 0x3ffdfc7e3c2c0d58ULL }, { 0x3a3a525426ee7cdaULL, 0x341b0869df02c3a8ULL, 0xa023bf42723bbfc8ULL, 0x3d15002a14452691ULL } },
+        { { 0x5ef7324c85edfa30ULL, 0x2597655487d4f3daULL, 0x352f5bc0dcb50c86ULL, 0x8f6927b04832a96cULL }, { 0xd08ee1ba55f2f94cULL, 0x6a996f99344b45faULL, 0xe133cb8da8aa455dULL, 0x5d0721ec758dc1f7ULL } },
+        { { 0xf3cae7e9262a3539ULL, 0x78a49d1d6670d59eULL, 0x37de0f63c1c5e1b9ULL, 0x3072c30c69cb7c1cULL }, { 0x1d278a5277c850e6ULL, 0x84f15f8f1f6a3de6ULL, 0x46a8bb45592ca7adULL, 0x1912e3eee4d424b8ULL } },
+        { { 0x6ba7a92079e5fb67ULL, 0xe1331feb70aa725eULL, 0x5080ccf57df5d837ULL, 0xe4cae01d7ff72e21ULL }, { 0xd9243ee60412a77dULL, 0x06ff7cacdf449025ULL, 0xbe75f7cd23ef5a31ULL, 0xbc9578220ddef7a8ULL } },
+        { { 0xdc988086365e668bULL, 0xada8dcdaaabda5fbULL, 0xbc146b4c255f1fbeULL, 0x9cfcde29cf34cfc3ULL }, { 0xacbb453e7e85d1e4ULL, 0x9ca09679f92358b5ULL, 0x15fc2d96240823ffULL, 0x8d65adf70c11d11eULL } },
+        { { 0x8cf7230cb0ce1c55ULL, 0x5b534d050bbfb607ULL, 0xee1ef1130e16363bULL, 0x27e0aa7ab4999e82ULL }, { 0xce1dac2d79362c41ULL, 0x67920c9091bb6cb0ULL, 0x1e648d632223df24ULL, 0x0f7d9eefe32e8f28ULL } },
+        { { 0x775557f10296f4fdULL, 0x1dca76a3ea51b436ULL, 0xf3e98f60fb950805ULL, 0x31ff32ea831cf7f1ULL }, { 0x643e7bf18d2c714bULL, 0x64b5c3392e9d2acaULL, 0xa9fd9ccc6adc2d23ULL, 0xfc2397eccc721b9bULL } },
+        { { 0x6943f39afa833834ULL, 0x22951722a6328562ULL, 0x81d63dd54170fc10ULL, 0x9f5fa58faecc2e6dULL }, { 0xb66c8725e77d9a3bULL, 0x11235cea6384ebe0ULL, 0x06a8c1185845e24aULL, 0x0137b286ebd093b1ULL } },
+    },
+    {
+        { { 0xdb567d6ac42bd6d2ULL, 0x6df86468bb1f96aeULL, 0x0efe5b1a4843b28eULL, 0x961bbb056379b240ULL }, { 0xb6caf5f070a6a26bULL, 0x70686c0d328e6e39ULL, 0x80da06cf895fc8d3ULL, 0x804d8810b363fdc9ULL } },
+        { { 0x63b99ce74462007dULL, 0xb8ab48a54cb5f5b7ULL, 0x9ec673d2f55edde7ULL, 0xd1567f748cfaefdaULL }, { 0x46381b6b0887bcecULL, 0x694497cee178f3c2ULL, 0x5e6525e31e6266cbULL, 0x5931de26697d6413ULL } },
+        { { 0x14e49da11f17a34cULL, 0x5420ab39235a1456ULL, 0xb76372412f50363bULL, 0x7b15d623c3fabb6eULL }, { 0xa0ef40b1e274e49cULL, 0x5cf5074496b1860aULL, 0xd6583fbf66afe5a4ULL, 0x44240510f47e3e9aULL } },
+        { { 0x142b55021a93507aULL, 0xb4cd11878d3c06cfULL, 0xdf70e76a91ec3f40ULL, 0x484e81ad4e7553c2ULL }, { 0x830f87b5272e9d6eULL, 0xea1c93e5c6ff514aULL, 0x67cc2adcc4192a8eULL, 0xc77e27e242f4535aULL } },
+        { { 0xb5358b1e48ac2840ULL, 0x18311294ecba9477ULL, 0xda58f990a6946b43ULL, 0x3098baf99ab41819ULL }, { 0x66c4c1584198da52ULL, 0xab4fc17c146bfd1bULL, 0x2f0a4c3cbf36a908ULL, 0x2ae9e34b58cf7838ULL } },
+        { { 0x45eb40ec0ccced58ULL, 0x25cd4b9c0da44f98ULL, 0x43e06458871812c6ULL, 0x99f80d5516cef651ULL }, { 0x571340c9ce6dc153ULL, 0x138d5117d8665521ULL, 0xacdb45bc4e07014dULL, 0x2f34bb3884b60b91ULL } },
+        { { 0x417499e84a34f239ULL, 0x15fdb83cb90402d5ULL, 0xb75f46bf433aa832ULL, 0xb61e15af63215db1ULL }, { 0xaabe59d4a127f89aULL, 0x5d541e0c07e816daULL, 0xaaba0659a618b692ULL, 0x5532773317266026ULL } },
+        { { 0x8cda9cf2d0c05199ULL, 0x502fbc22fae78454ULL, 0xc0bda9dff572a182ULL, 0x5f9b71b86158b372ULL }, { 0xe0f33a592b82dd07ULL, 0x763027359523032eULL, 0x7fe1a721c4505a32ULL, 0x7b6e3e82f796409fULL } },
+    },
+    {
+        { { 0xe3417bc035d0b34aULL, 0x440b386b8327c0a7ULL, 0x8fb7262dac0362d1ULL, 0x2c41114ce0cdf943ULL }, { 0x2ba5cef1ad95a0b1ULL, 0xc09b37a867d54362ULL, 0x26d6cdd201e486c9ULL, 0x20477abf42ff9297ULL } },
+        { { 0xa004dcb3292a9287ULL, 0xddc15cf677b092c7ULL, 0x083a8464806c0605ULL, 0x4a68df703db997b0ULL }, { 0x9c134e4505bf7dd0ULL, 0xa4e63d398ccf7f8cULL, 0xa6e6517f41b5f8afULL, 0xaa8b9342ad7bc1ccULL } },
+        { { 0x126f35b51e706ad9ULL, 0xb99cebb4c3a9ebdfULL, 0xa75389afbf608d90ULL, 0x76113c4fc6c89858ULL }, { 0x80de8eb097e2b5aaULL, 0x7e1022cc63b91304ULL, 0x3bdab6056ccc066cULL, 0x33cbb144b2edf900ULL } },
+        { { 0xc41764717af715d2ULL, 0xe2f7f594d0134a96ULL, 0x2c1873efa41ec956ULL, 0xe4e7b4f677821304ULL }, { 0xe5c8ff9788d5374aULL, 0x2b915e6380823d5bULL, 0xea6bc755b2ee8fe2ULL, 0x6657624ce7112651ULL } },
+        { { 0x157af101dace5acaULL, 0xc4fdbcf211a6a267ULL, 0xdaddf340c49c8609ULL, 0x97e49f52e9604a65ULL }, { 0x9be8e790937e2ad5ULL, 0x846e2508326e17f1ULL, 0x3f38007a0bbbc0dcULL, 0xcf03603fb11e16d6ULL } },
+        { { 0xd6f800e07442f1d5ULL, 0x475607d166e0e3abULL, 0x82807f16b7c64047ULL, 0x8858e1e3a749883dULL }, { 0x5859120b8231ee10ULL, 0x1b80e7eb638a1eceULL, 0xcb72525ac6aa73a4ULL, 0xa7cdea3d844423acULL } },
+        { { 0x5ed0c007f8ae7c38ULL, 0x6db07a5c3d740192ULL, 0xbe5e9c2a5fe36db3ULL, 0xd5b9d57a76e95046ULL }, { 0x54ac32e78eba20f2ULL, 0xef11ca8f71b9a352ULL, 0x305e373eff98a658ULL, 0xffe5a100823eb667ULL } },
+        { { 0x57477b11e51732d2ULL, 0xdfd6eb282538fc0eULL, 0x5c43b0cc3b39eec5ULL, 0x6af12778cb36cc57ULL }, { 0x70b0852d06c425aeULL, 0x6df92f8c5c221b9bULL, 0x6c8d4f9ece826d9cULL, 0xf59aba7bb49359c3ULL } },
+    },
+    {
+        { { 0xc37e2c2e421d3aa4ULL, 0xf926407ce84fa840ULL, 0x18abc03d1454e41cULL, 0x26605ecd3f7af644ULL }, { 0x242341a6d6a5eabfULL, 0x1edb84f4216b668eULL, 0xd836edb804010102ULL, 0x5b337ce7945e1d8cULL } },
+        { { 0x4c076b86d23ddc82ULL, 0x03fd344c7e0143f0ULL, 0xa95362ff317af2c5ULL, 0x0add3db7e18b7a4fULL }, { 0x9c673e3f8260e01bULL, 0xfbeb49e554a1cc91ULL, 0x91351bf292f2e433ULL, 0xc755e7ec851141ebULL } },
+        { { 0x349ae368da9f3804ULL, 0x470f07fea164349cULL, 0xd52f4cc98562baa5ULL, 0xc74a9e862b290df3ULL }, { 0xd3a1aa3543471a24ULL, 0x239446beb8194511ULL, 0xbec2dd0081dcd44dULL, 0xca3d7f0fc42ac82dULL } },
+        { { 0x2bf5db47f23206d5ULL, 0x2f6d34201d260152ULL, 0x17b876533f8ff89aULL, 0x5157c30c378fa458ULL }, { 0x7517c5c52d4fb936ULL, 0xef22f7ace6518cdcULL, 0xdeb483e6bf847a64ULL, 0xf508455892e0fa89ULL } },
+        { { 0xb418c2a69b583160ULL, 0xbe74fcd4b4e59194ULL, 0xf178eeaa3c83e3ffULL, 0xe051f895e296f29bULL }, { 0xd023523806ceb84aULL, 0x5ace48cee111fe6bULL, 0x40e43a491c045545ULL, 0xf3fa86dddd522146ULL } },
+        { { 0x959616fa908ec5b5ULL, 0x882d661da01ab12dULL, 0xc49f60824382ae8aULL, 0x5cdf92eb5d133f5eULL }, { 0x98cecc425ef6c9c1ULL, 0xb52d6682664d84eeULL, 0x9e285ed86f25b8c4ULL, 0xeb80cdc748debe88ULL } },
+        { { 0x2d9794c1ec222ba0ULL, 0xc3dff42f523e5d48ULL, 0x4a7cd5700fe4846bULL, 0xefc5b113ff135174ULL }, { 0x2630b25bc6b05e85ULL, 0x0a6d3029654cd077ULL, 0xb4f1f54f32d8b89dULL, 0xde3baff21627fc27ULL } },
+        { { 0xab9659d8df7304d4ULL, 0xb71bcf1bff210e8eULL, 0xa9a2438bd73fbd60ULL, 0x4595cd1f5d11b4deULL }, { 0x9c0d329a4835859dULL, 0x4a0f0d2d7dbb6e56ULL, 0xc6038e5edf928a4eULL, 0xc94296218f5ad154ULL } },
+    },
+    {
+        { { 0x91213462f23f2d92ULL, 0x6cab71bd60b94078ULL, 0x6bdd0a63176cde20ULL, 0x54c9b20cee4d54bcULL }, { 0x3cd2d8aa9f2ac02fULL, 0x03f8e617206eedb0ULL, 0xc7f68e1693086434ULL, 0x831469c592dd3db9ULL } },
+        { { 0x7aa7a1583ae9c1bdULL, 0xe0af6d98e37ce240ULL, 0xe54342d928ab38b4ULL, 0xe8b750070a1c98caULL }, { 0xefce86afe02358f2ULL, 0x31b8b856ea921228ULL, 0x052a19120a1c67fcULL, 0xb4069ea4e3aead59ULL } },
+        { { 0x4a9090cde36d0757ULL, 0xf722d7b1d9a29382ULL, 0xfb7fb04c04b48ddfULL, 0x628ad2a7ebe16f43ULL }, { 0xcd3fbfb520226040ULL, 0x6c34ecb15104b6c4ULL, 0x30c0754ec903c188ULL, 0xec336b082d23cab0ULL } },
+        { { 0x9f51439e558df019ULL, 0x230da4baac712b27ULL, 0x518919e355185a24ULL, 0x4dcefcdd84b78f50ULL }, { 0xa7d90fb2a47d4c5aULL, 0x55ac9abfb30e009eULL, 0xfd2fc35974eed273ULL, 0xb72d824cdbea8fafULL } },
+        { { 0xd213f923cbb13d1bULL, 0x98799f425bfb9bfeULL, 0x1ae8ddc9701144a9ULL, 0x0b8b3bb64c5595eeULL }, { 0x0ea9ef2e3ecebb21ULL, 0x17cb6c4b3671f9a7ULL, 0x47ef464f726f1d1fULL, 0x171b94846943a276ULL } },
+        { { 0x779b8552de7e5c19ULL, 0xfab28609c1c0256cULL, 0x64f58eeeabd4743dULL, 0x4e8ef8387b6cc93bULL }, { 0xee650d264cb1bf3dULL, 0x4c1f9d0973dedf61ULL, 0xaef7c9d7bfb70cedULL, 0x1ec0507e1641de1eULL } },
+        { { 0xc9941109a607419dULL, 0xfaa71e62bb6bca80ULL, 0x34158c1307c431f3ULL, 0x594abebc992bc47aULL }, { 0x6dfea691eb78399fULL, 0x48aafb353f42cba4ULL, 0xedcd65af077c04f0ULL, 0x1a29a366e884491aULL } },
+        { { 0x549db2b5ef7d9289ULL, 0x2480d4a8197f015aULL, 0x61d5590bc40493b6ULL, 0x3a55b52e6f780331ULL }, { 0x40eb8115309eadb0ULL, 0xdea7de5a92e5c625ULL, 0x64d631f0cc6a3d5aULL, 0x9d5e9d7c93e8dd61ULL } },
+    },
+    {
+        { { 0x196860411e84e0e5ULL, 0xa5db84d3aea34c93ULL, 0xf9d5bb197073a732ULL, 0xb8d2fe566bcfd7c0ULL }, { 0x45775f36f3eb82faULL, 0x8cb20cccfdff8b58ULL, 0x1659b65f8374c110ULL, 0xb8b4a422330c789aULL } },
+        { { 0xc4f4cda3af2ebc2fULL, 0xa0af843dcb4efe24ULL, 0x53b857c19ccd10b1ULL, 0xddc9d1eb914d3e04ULL }, { 0x7bdec8bb62771debULL, 0x829277aa91c5aa81ULL, 0x7af18dd6832391aeULL, 0x1740f316c71a84caULL } },
+        { { 0x2d500910cab91f1eULL, 0xbedd9e444d1cd216ULL, 0xd634b74fedd02252ULL, 0xbd60f8e11258617aULL }, { 0xd8c7537b9e05614aULL, 0xfd26c766e7af5fc5ULL, 0x0660b581582bd926ULL, 0x87019244acf07fc8ULL } },
+        { { 0x8928e99aeeaf8c49ULL, 0xee7aa73d6e24d728ULL, 0x4c5007c2e72b156cULL, 0x5fcf57c5ed408a1dULL }, { 0x9f719e39b6057604ULL, 0x7d343c01c2868bbfULL, 0x2cca254b7e103e2dULL, 0xe6eb38a9f131bea2ULL } },
+        { { 0x0ba4e3520a981b0dULL, 0x1c354cb3bd1a41a4ULL, 0x1aabaa3adf9fab9cULL, 0x0701a7d153c418d5ULL }, { 0xdd1a7cefdcf2b921ULL, 0x6ceef0b3bcf48061ULL, 0x1083b598de25cce6ULL, 0x890a54c7e90a5e34ULL } },
+        { { 0x405718db4f6d01b1ULL, 0xe73c6bc28f11e8a0ULL, 0xac11bb8ca0591a3bULL, 0x12d09a5a0acc4531ULL }, { 0xcbf174eee7de13f4ULL, 0x177e2be6044fd682ULL, 0x65f574cb1c48af70ULL, 0xce5966929961cb7cULL } },
+        { { 0xc59eed6c048752a1ULL, 0x41f2702ea01341b4ULL, 0x6e35903b9dc6b092ULL, 0x4291aba81f5b5b23ULL }, { 0x8173aa70a653d61dULL, 0xd1b648d44f2eb51eULL, 0x31b7ce065ab93f8fULL, 0xa55408ee99e2f4feULL } },
+        { { 0xb33e624f8be762b4ULL, 0x2a9ee4d1058e3413ULL, 0x968e636967d805faULL, 0x9848949b7db8bfd7ULL }, { 0x5308d7e5d23a8417ULL, 0x892f3b1df3e29da5ULL, 0xc95c139e3dee471fULL, 0x8631594dd757e089ULL } },
+    },
+    {
+        { { 0x1083e2ea1f095615ULL, 0x0a28ad7714e68c33ULL, 0x6bfc02523d8818beULL, 0xb585113af35850cdULL }, { 0x7d935f0b30df8aa1ULL, 0xaddda07c4ab7e3acULL, 0x92c34299552f00cbULL, 0xc33ed1de2909df6cULL } },
+        { { 0x2dc40d483e07113cULL, 0x6e4a5d397d8b63aeULL, 0x5582a94b79684c2bULL, 0x932b33d4622da26cULL }, { 0xf534f6510dbbf08dULL, 0x211d07c964c23a52ULL, 0x0eeece0fee5bdc9bULL, 0xdf178168f7015558ULL } },
+        { { 0xabe7905a83cdd60eULL, 0x50602fb5a1170184ULL, 0x689886cdb023642aULL, 0xd568d090a6e1fb00ULL }, { 0x5b1922c70259217fULL, 0x93831cd9c43141e4ULL, 0xdfca35870c95f86eULL, 0xdec2057a568ae828ULL } },
+        { { 0x568f8925913cc16dULL, 0x18bc5b6de1a26f5aULL, 0xdfa413bef5f499aeULL, 0xf8835decc3f0ae84ULL }, { 0xb6e60bd865a40ab0ULL, 0x65596439194b377eULL, 0xbcd8562592084a69ULL, 0x5ce433b94f23ede0ULL } },
+        { { 0x860d523d42e06189ULL, 0xbf0779414e3aff13ULL, 0x0b616dcac1b20650ULL, 0xe66dd6d12131300dULL }, { 0xd4a0fd67ff99abdeULL, 0xc9903550c7aac50dULL, 0x022ecf8b7c46b2d7ULL, 0x3333b1e83abf92afULL } },
+        { { 0xc0da65e784d6365dULL, 0xbcb7443f8f759fb8ULL, 0x35c712b17ae81930ULL, 0x80428dff4c6e08abULL }, { 0xf19dafefa4faf843ULL, 0xced8538dffa9855fULL, 0x20ac409cbe3ac7ceULL, 0x358c1fb6882da71eULL } },
+        { { 0xefecdef7be42a582ULL, 0xd3fc608065046be6ULL, 0xc9af13c809e8dba9ULL, 0x1e6c9847641491ffULL }, { 0x3b574925d30c31f7ULL, 0xb7eb72baac2a2122ULL, 0x776a0dacef0859e7ULL, 0x06fec31421900942ULL } },
+        { { 0x324794b07e50122bULL, 0xdd744f8b4af07ca5ULL, 0x30a12f08d63fc97bULL, 0x39650f1a76626d9dULL }, { 0x101b47f71fa38477ULL, 0x3d815f19d4dc124fULL, 0x1569ae95b26eb58aULL, 0xc3cde18895fb1887ULL } },
+    },
+    {
+        { { 0x02b37a952f41deffULL, 0x0e44a59ae63b89b7ULL, 0x673257dc143ff951ULL, 0x19c02205d752baf4ULL }, { 0x46c23069c4b7d692ULL, 0x2e6392c3fd1502acULL, 0x6057b1a21b220846ULL, 0xe51ff9460c1b5b63ULL } },
+        { { 0x6e85cb51566c5c43ULL, 0xcff9c9193597f046ULL, 0x9354e90c4994d94aULL, 0xe0a393322147927dULL }, { 0x8427fac10dc1eb2bULL, 0x88cfd8c22ff319faULL, 0xe2d4e68401965274ULL, 0xfa2e067d67aaa746ULL } },
+        { { 0xb9dc857c5b0f7bd4ULL, 0x6990c2c9108ea1cdULL, 0x84730b83b984c7a9ULL, 0x552723d2eab18a78ULL }, { 0x9752c2e2919ba0f9ULL, 0x075a3bd94bf40890ULL, 0x71e52a04a6d98212ULL, 0x3fb6607a9f18a4c8ULL } },
+        { { 0xb6d92a7f3e5f9f11ULL, 0x9afe153ad6cb3b8eULL, 0x4d1a6dd7ddf800bdULL, 0xf6c13cc0caf17e19ULL }, { 0x15f6c58e325fc3eeULL, 0x71095400a31dc3b2ULL, 0x168e7c07afa3d3e7ULL, 0x3f8417a194c7ae2dULL } },
+        { { 0xf47b75216ce400bbULL, 0xf72919f7caf07d99ULL, 0x95b86e0600ce62e0ULL, 0x11872baf8fcfd00eULL }, { 0x049b21eb211f7dc6ULL, 0xb8900e5654ebd6f6ULL, 0x7c38cea4162d78daULL, 0x9a586c9e0bfa3da0ULL } },
+        { { 0xec234772813b230dULL, 0x634d0f5f17344427ULL, 0x11548ab1d77fc56aULL, 0x7fab1750ce06af77ULL }, { 0xb62c10a74f7c4f83ULL, 0xa7d2edc4220a67d9ULL, 0x1c404170921209a0ULL, 0x0b9815a0face59f0ULL } },
+        { { 0xad3883e151c3ebe5ULL, 0xdb14d5c7d25d7be8ULL, 0x23e44911558ea8c9ULL, 0x3a68529f3f45c6abULL }, { 0xeb18a1dc149f75b8ULL, 0x9b8946a1079c7cb2ULL, 0x27ad2a191157a94eULL, 0x84b14f461106f85aULL } },
+        { { 0x2842589b319540c3ULL, 0x18490f59a283d6f8ULL, 0xa2731f84daae9fcbULL, 0x3db6d960c3683ba0ULL }, { 0xc85c63bb14611069ULL, 0xb19436af0788bf05ULL, 0x905459df347460d2ULL, 0x73f6e094e11a7db1ULL } },
+    },
+    {
+        { { 0xf306a3c8ee3c76cbULL, 0x3cf11623d32a1f6eULL, 0xe6d5ab646863e956ULL, 0x3b8a4cbe5c005c26ULL }, { 0xdcd529a59ce6bb27ULL, 0xc4afaa5204d4b16fULL, 0xb0624a267923798dULL, 0x85e56df66b307fabULL } },
+        { { 0xb2330fef4e4ca463ULL, 0xbcef72873566cc63ULL, 0xd161d2cacf780900ULL, 0x135dc5395b54827dULL }, { 0x638f052e27bf1bc6ULL, 0x10a224f007dfa06cULL, 0xe973586d6d3321daULL, 0x8b0c573826152c8fULL } },
+        { { 0x896895959884aaf7ULL, 0xb1959be307b348a6ULL, 0x96250e573c147c87ULL, 0xae0efb3add0c61f8ULL }, { 0xed00745eca8c325eULL, 0x3c911696ecff3f70ULL, 0x73acbc65319ad41dULL, 0x7b01a020f0b1c7efULL } },
+        { { 0x9910ba6b23a5d896ULL, 0x1fe19e357fe4364eULL, 0x6e1da8c39a33c677ULL, 0x15b4488b29fd9fd0ULL }, { 0x1f4392541a1f22bfULL, 0x920a8a70ab8163e8ULL, 0x3fd1b24907e5658eULL, 0xf2c4f79cb6ec839bULL } },
+        { { 0x262143b5224c08dcULL, 0x2bbb09b481b50c91ULL, 0xc16ed709aca8c84fULL, 0xa6210d9db2850ca8ULL }, { 0x6d8df67a09cb54d6ULL, 0x91eef6e0500919a4ULL, 0x90f613810f132857ULL, 0x9acede47f8d5028bULL } },
+        { { 0x84cea0691416a6a5ULL, 0x8f860c7943ef881cULL, 0x41311f8a38038a5dULL, 0xe78c2ec0fc612067ULL }, { 0x494d2e815ad73581ULL, 0xb4cc9e0059604097ULL, 0xff558aecf3612cbaULL, 0x35beef7a9e36c39eULL } },
+        { { 0x45e21446de673629ULL, 0x57f7aa1e703c2d21ULL, 0xa0e99b7f98c868c7ULL, 0x4e42f66d8b641676ULL }, { 0x602884dc91077896ULL, 0xa0d690cfc2c9885bULL, 0xfeb4da333b9a5187ULL, 0x5f789598153c87eeULL } },
+        { { 0x8b5c619c76497ee8ULL, 0x5d2b0ac6c717370eULL, 0x98204cb64fcf68e1ULL, 0x0bdec21162bc6792ULL }, { 0x6973ccefa63b1011ULL, 0xf9e3fa97e0de1ac5ULL, 0x5efb693e3d0e0c8bULL, 0x037248e9d2d4fcb4ULL } },
+    },
+    {
+        { { 0x80802dc91ec34f9eULL, 0xd8772d3533810603ULL, 0x3f06d66c530cb4f3ULL, 0x7be5ed0dc475c129ULL }, { 0xcb9e3c1931e82b10ULL, 0xc63d2857c9ff6b4cULL, 0xb92118c692a1b45eULL, 0x0aec44147285bbcaULL } },
+        { { 0xfc189ae71e29a3efULL, 0xcbe906f04c93302eULL, 0xd0107914ceaae10eULL, 0xb7a23f34b68e19f8ULL }, { 0xe9d875c2efd2119dULL, 0x03198c6efcadc9c8ULL, 0x65591bf64da17113ULL, 0x3cf0bbf83d443038ULL } },
+        { { 0xae485bb72b724759ULL, 0x945353e1b2d4c63aULL, 0x82159d07de7d6f2cULL, 0x389caef34ec5b109ULL }, { 0x4a8ebb53db65ef14ULL, 0x2dc2cb7edd99de43ULL, 0x816fa3ed83f2405fULL, 0x73429bb9c14208a3ULL } },
+        { { 0xb618d590b01e6e27ULL, 0x047e2ccde180b2dcULL, 0xd1b299b504aea4a9ULL, 0x412c9e1e9fa403a4ULL }, { 0x88d28a3679407552ULL, 0x49c50136f332b8e3ULL, 0x3a1b6fcce668de19ULL, 0x178851bc75122b97ULL } },
+        { { 0xb1e13752fb85fa4cULL, 0xd61257ce383c8ce9ULL, 0xd43da670d2f74daeULL, 0xa35aa23fbf846bbbULL }, { 0x5e74235d4421fc83ULL, 0xf6df8ee0c363473bULL, 0x34d7f52a3c4aa158ULL, 0x50d05aab9bc6d22eULL } },
+        { { 0x8c56e735a64785f4ULL, 0xbc56637b5f29cd07ULL, 0x53b2bb803ee35067ULL, 0x50235a0fdc919270ULL }, { 0x191ab6d8f2c4aa65ULL, 0xc34758318396023bULL, 0x80400ba5f0f805baULL, 0x8881065b5ec0f80fULL } },
+        { { 0xc370e522cc1b5e83ULL, 0xde2d4ad1860b8bfbULL, 0xad364df067b256dfULL, 0x8f12502ee0138997ULL }, { 0x503fa0dc7783920aULL, 0xe80014adc0bc866aULL, 0x3f89b744d3064ba6ULL, 0x03511dcdcba5dba5ULL } },
+        { { 0x197dd46d95a7b1a2ULL, 0x9c4e7ad63c6341fbULL, 0x426eca29484c2eceULL, 0x9211e489de7f4f8aULL }, { 0x14997f6ec78ef1f4ULL, 0x2b2c091006574586ULL, 0x17286a6e1c3eede8ULL, 0x25f92e470f60e018ULL } },
+    },
+    {
+        { { 0xb4e370af3aeac968ULL, 0xe4f7fee9c4b63266ULL, 0xb4acd4c2e3ac5664ULL, 0xf8910bd2ceb38cbfULL }, { 0x1c3ae50cc9c0726eULL, 0x15309569d97b40bfULL, 0x70884b7ffd5a5a1bULL, 0x3890896aef8314cdULL } },
+        { { 0x5ced3c9f82e4c634ULL, 0x8efb83143a4464f8ULL, 0xe706381b7a1dca25ULL, 0x6cd15a3c5a2a412bULL }, { 0x9347a8fdbfcd8fb5ULL, 0x31db2eef6e54cd22ULL, 0xc4aeb11ef8d8932fULL, 0x11e7c1ed344411afULL } },
+        { { 0x996884f5903fa271ULL, 0xe6da0fd2b9da921eULL, 0xa6f2f2695db01e54ULL, 0x1ee3e9bd6876214eULL }, { 0xa26e181ce27a9497ULL, 0x36d254e48e215e04ULL, 0x42f32a6c252cabcaULL, 0x9948148780b57614ULL } },
+        { { 0xab41b43a43228d83ULL, 0x24ae1c304ad63f99ULL, 0x8e525f1a46a51229ULL, 0x14af860fcd26d2b4ULL }, { 0xd6baef613f714aa1ULL, 0xf51865adeb78795eULL, 0xd3e21fcee6a9d694ULL, 0x82ceb1dd8a37b527ULL } },
+        { { 0x4a665bfd2f9fd51aULL, 0x7f2f1fe2481b97f7ULL, 0xcad05d69ad36ce50ULL, 0x314fc2a4844f4dedULL }, { 0xd5593d8cb55fc5c6ULL, 0xe3510ce8bfb1e23dULL, 0xf9b7be6937453cceULL, 0xd3541b7969fae631ULL } },
+        { { 0x99296525eca445dfULL, 0xf1af24f22cdfa4c6ULL, 0xf5b4eb61eba6d3bcULL, 0x4560910c98972cc7ULL }, { 0x54751c32093eaa32ULL, 0x018313497d3c67bbULL, 0x3bd90ce62d871110ULL, 0x75fc863a538baa7eULL } },
+        { { 0x711b8a4176a9f05dULL, 0x06ca4e4b9011d488ULL, 0x543bc62ba248a65eULL, 0x017535ffc9290894ULL }, { 0x840b84ce406851d7ULL, 0xafa3acdf90e960b4ULL, 0xac3394af7128fd34ULL, 0x54eb4d5b2ac0f92cULL } },
+        { { 0xdb09e87355dbd4b3ULL, 0x1f8799286639bbb1ULL, 0xb83e47e51c651962ULL, 0xd4ef0fb6c43fb574ULL }, { 0x27d3b9d8f1bfb12aULL, 0x6ab877e86e5e8b72ULL, 0x8eebdc9d157b9014ULL, 0x4c2110053aa5cb64ULL } },
+    },
+};
+
+#endif // L8W8JWT_P256_PRECOMP_H
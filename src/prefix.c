@@ -0,0 +1,217 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/algs.h"
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/prefix.h"
+#include "l8w8jwt/retcodes.h"
+#include "sha2.h"
+
+#include <string.h>
+#include <mbedtls/platform_util.h>
+
+struct l8w8jwt_prefix_context
+{
+    int alg;
+
+    /* Private copy of the constant prefix (tokens are only hashed from the midstate if they start with exactly these bytes). */
+    char* prefix;
+    size_t prefix_length;
+
+    /* HMAC only: private copy of the key (used for checking that the caller passed the same key). */
+    unsigned char* hmac_key;
+    size_t hmac_key_length;
+
+    struct l8w8jwt_sha2_midstate midstate;
+};
+
+static inline mbedtls_md_type_t md_type_from_alg(const int alg)
+{
+    switch (alg)
+    {
+        case L8W8JWT_ALG_HS256:
+        case L8W8JWT_ALG_RS256:
+        case L8W8JWT_ALG_PS256:
+        case L8W8JWT_ALG_ES256:
+        case L8W8JWT_ALG_ES256K:
+            return MBEDTLS_MD_SHA256;
+        case L8W8JWT_ALG_HS384:
+        case L8W8JWT_ALG_RS384:
+        case L8W8JWT_ALG_PS384:
+        case L8W8JWT_ALG_ES384:
+            return MBEDTLS_MD_SHA384;
+        case L8W8JWT_ALG_HS512:
+        case L8W8JWT_ALG_RS512:
+        case L8W8JWT_ALG_PS512:
+        case L8W8JWT_ALG_ES512:
+            return MBEDTLS_MD_SHA512;
+        default:
+            return MBEDTLS_MD_NONE;
+    }
+}
+
+static inline int is_hmac_alg(const int alg)
+{
+    return alg == L8W8JWT_ALG_HS256 || alg == L8W8JWT_ALG_HS384 || alg == L8W8JWT_ALG_HS512;
+}
+
+int l8w8jwt_prefix_context_create(const int alg, const unsigned char* hmac_key, size_t hmac_key_length, const char* prefix, const size_t prefix_length, struct l8w8jwt_prefix_context** out_prefix_context)
+{
+    int r;
+
+    if (prefix == NULL || out_prefix_context == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    const mbedtls_md_type_t md_type = md_type_from_alg(alg);
+    if (md_type == MBEDTLS_MD_NONE)
+    {
+        return alg == L8W8JWT_ALG_ED25519 ? L8W8JWT_UNSUPPORTED_ALG : L8W8JWT_INVALID_ARG;
+    }
+
+    const int hmac = is_hmac_alg(alg);
+
+    if (hmac)
+    {
+        if (hmac_key == NULL)
+        {
+            return L8W8JWT_NULL_ARG;
+        }
+
+        if (hmac_key_length == 0)
+        {
+            return L8W8JWT_INVALID_ARG;
+        }
+
+        /* Same as in the encoder/decoder: a trailing NUL-terminator included in the length is not part of the key. */
+        hmac_key_length -= hmac_key[hmac_key_length - 1] == '\0';
+    }
+
+    if (prefix_length == 0)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    struct l8w8jwt_prefix_context* prefix_context = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_prefix_context));
+    if (prefix_context == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    prefix_context->alg = alg;
+    prefix_context->prefix_length = prefix_length;
+    prefix_context->prefix = l8w8jwt_malloc(prefix_length);
+
+    if (hmac)
+    {
+        prefix_context->hmac_key_length = hmac_key_length;
+        prefix_context->hmac_key = l8w8jwt_malloc(hmac_key_length + 1);
+    }
+
+    if (prefix_context->prefix == NULL || (hmac && prefix_context->hmac_key == NULL))
+    {
+        l8w8jwt_prefix_context_free(prefix_context);
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    memcpy(prefix_context->prefix, prefix, prefix_length);
+
+    if (hmac)
+    {
+        memcpy(prefix_context->hmac_key, hmac_key, hmac_key_length);
+    }
+
+    r = l8w8jwt_sha2_midstate_init(&prefix_context->midstate, md_type, hmac ? prefix_context->hmac_key : NULL, hmac_key_length, (const unsigned char*)prefix, prefix_length);
+    if (r != 0)
+    {
+        l8w8jwt_prefix_context_free(prefix_context);
+        return L8W8JWT_SHA2_FAILURE;
+    }
+
+    *out_prefix_context = prefix_context;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_prefix_context_create_from_token(const int alg, const unsigned char* hmac_key, const size_t hmac_key_length, const char* jwt, const size_t jwt_length, struct l8w8jwt_prefix_context** out_prefix_context)
+{
+    if (jwt == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    const char* dot = memchr(jwt, '.', jwt_length);
+    if (dot == NULL)
+    {
+        return L8W8JWT_DECODE_FAILED_INVALID_TOKEN_FORMAT;
+    }
+
+    return l8w8jwt_prefix_context_create(alg, hmac_key, hmac_key_length, jwt, (size_t)(dot - jwt) + 1, out_prefix_context);
+}
+
+void l8w8jwt_prefix_context_free(struct l8w8jwt_prefix_context* prefix_context)
+{
+    if (prefix_context == NULL)
+    {
+        return;
+    }
+
+    l8w8jwt_sha2_midstate_free(&prefix_context->midstate);
+
+    if (prefix_context->hmac_key != NULL)
+    {
+        mbedtls_platform_zeroize(prefix_context->hmac_key, prefix_context->hmac_key_length);
+        l8w8jwt_free(prefix_context->hmac_key);
+    }
+
+    l8w8jwt_free(prefix_context->prefix);
+
+    mbedtls_platform_zeroize(prefix_context, sizeof(struct l8w8jwt_prefix_context));
+    l8w8jwt_free(prefix_context);
+}
+
+int l8w8jwt_prefix_context_digest(const struct l8w8jwt_prefix_context* prefix_context, const int alg, const unsigned char* hmac_key, const size_t hmac_key_length, const unsigned char* data, const size_t data_length, unsigned char* out)
+{
+    if (prefix_context == NULL || prefix_context->alg != alg)
+    {
+        return 1;
+    }
+
+    if (data_length < prefix_context->prefix_length || memcmp(data, prefix_context->prefix, prefix_context->prefix_length) != 0)
+    {
+        return 1;
+    }
+
+    if (prefix_context->hmac_key != NULL && (hmac_key_length != prefix_context->hmac_key_length || memcmp(hmac_key, prefix_context->hmac_key, hmac_key_length) != 0))
+    {
+        return 1;
+    }
+
+    if (l8w8jwt_sha2_midstate_finish(&prefix_context->midstate, data + prefix_context->prefix_length, data_length - prefix_context->prefix_length, out) != 0)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,296 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "presign.h"
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/retcodes.h"
+
+#if L8W8JWT_PRESIGNATURES
+
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/platform_util.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#define L8W8JWT_PRESIGN_FORK_CHECK 1
+#else
+#define L8W8JWT_PRESIGN_FORK_CHECK 0
+#endif
+
+struct l8w8jwt_presignature_pool
+{
+    /* Power of 2. */
+    size_t capacity;
+
+    /* Free-running counters: the consumer owns head, the producer owns tail (tail - head = number of filled slots). */
+    atomic_size_t head;
+    atomic_size_t tail;
+
+    /* Held by whichever thread is currently refilling. */
+    atomic_flag refilling;
+
+    unsigned char (*slots)[64];
+
+    /* Only used while holding the refilling flag. */
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context ctr_drbg;
+
+#if L8W8JWT_PRESIGN_FORK_CHECK
+    /* Pid of the process that seeded the DRBG and filled the slots: a forked child must neither use the parent's presignatures nor continue its DRBG output (both would repeat ECDSA nonces). */
+    atomic_long pid;
+#endif
+};
+
+#if L8W8JWT_PRESIGN_FORK_CHECK
+
+/* Must be called while holding the refilling flag: discards every queued presignature and reseeds the DRBG if the pool was inherited through a fork(). */
+static int l8w8jwt_presignature_pool_check_pid(struct l8w8jwt_presignature_pool* pool)
+{
+    const long pid = (long)getpid();
+
+    if (atomic_load_explicit(&pool->pid, memory_order_acquire) == pid)
+    {
+        return 0;
+    }
+
+    /* Nothing consumes while the pid mismatches, so the producer may also reset the head's side of the ring here. */
+    mbedtls_platform_zeroize(pool->slots, pool->capacity * 64);
+    atomic_store_explicit(&pool->tail, atomic_load_explicit(&pool->head, memory_order_relaxed), memory_order_relaxed);
+
+    if (mbedtls_ctr_drbg_reseed(&pool->ctr_drbg, (const unsigned char*)&pid, sizeof(pid)) != 0)
+    {
+        return 1;
+    }
+
+    atomic_store_explicit(&pool->pid, pid, memory_order_release);
+    return 0;
+}
+
+#endif
+
+int l8w8jwt_presignature_pool_create(const size_t capacity, struct l8w8jwt_presignature_pool** out_pool)
+{
+    if (capacity == 0 || capacity > (SIZE_MAX >> 7) || out_pool == NULL)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    struct l8w8jwt_presignature_pool* pool = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_presignature_pool));
+    if (pool == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    pool->capacity = 1;
+    while (pool->capacity < capacity)
+    {
+        pool->capacity <<= 1;
+    }
+
+    atomic_init(&pool->head, 0);
+    atomic_init(&pool->tail, 0);
+    atomic_flag_clear(&pool->refilling);
+
+#if L8W8JWT_PRESIGN_FORK_CHECK
+    atomic_init(&pool->pid, (long)getpid());
+#endif
+
+    mbedtls_entropy_init(&pool->entropy);
+    mbedtls_ctr_drbg_init(&pool->ctr_drbg);
+
+    pool->slots = l8w8jwt_calloc(pool->capacity, 64);
+    if (pool->slots == NULL)
+    {
+        l8w8jwt_presignature_pool_free(pool);
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    if (mbedtls_ctr_drbg_seed(&pool->ctr_drbg, mbedtls_entropy_func, &pool->entropy, (const unsigned char*)"l8w8jwt_presign_pers.!#@", 24) != 0)
+    {
+        l8w8jwt_presignature_pool_free(pool);
+        return L8W8JWT_MBEDTLS_CTR_DRBG_SEED_FAILURE;
+    }
+
+    *out_pool = pool;
+    return L8W8JWT_SUCCESS;
+}
+
+void l8w8jwt_presignature_pool_free(struct l8w8jwt_presignature_pool* pool)
+{
+    if (pool == NULL)
+    {
+        return;
+    }
+
+    if (pool->slots != NULL)
+    {
+        mbedtls_platform_zeroize(pool->slots, pool->capacity * 64);
+        l8w8jwt_free(pool->slots);
+    }
+
+    mbedtls_ctr_drbg_free(&pool->ctr_drbg);
+    mbedtls_entropy_free(&pool->entropy);
+
+    mbedtls_platform_zeroize(pool, sizeof(struct l8w8jwt_presignature_pool));
+    l8w8jwt_free(pool);
+}
+
+int l8w8jwt_presignature_pool_refill(struct l8w8jwt_presignature_pool* pool, const size_t max_count, size_t* out_added)
+{
+    int r = L8W8JWT_SUCCESS;
+    size_t added = 0;
+
+    if (pool == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (atomic_flag_test_and_set_explicit(&pool->refilling, memory_order_acquire))
+    {
+        goto exit;
+    }
+
+#if L8W8JWT_PRESIGN_FORK_CHECK
+    if (l8w8jwt_presignature_pool_check_pid(pool) != 0)
+    {
+        r = L8W8JWT_MBEDTLS_CTR_DRBG_SEED_FAILURE;
+        atomic_flag_clear_explicit(&pool->refilling, memory_order_release);
+        goto exit;
+    }
+#endif
+
+    size_t tail = atomic_load_explicit(&pool->tail, memory_order_relaxed);
+
+    while (added < max_count)
+    {
+        if (tail - atomic_load_explicit(&pool->head, memory_order_acquire) >= pool->capacity)
+        {
+            break;
+        }
+
+        if (l8w8jwt_p256_presign(pool->slots[tail & (pool->capacity - 1)], mbedtls_ctr_drbg_random, &pool->ctr_drbg) != 0)
+        {
+            r = L8W8JWT_SIGNATURE_CREATION_FAILURE;
+            break;
+        }
+
+        atomic_store_explicit(&pool->tail, ++tail, memory_order_release);
+        ++added;
+    }
+
+    atomic_flag_clear_explicit(&pool->refilling, memory_order_release);
+
+exit:
+    if (out_added != NULL)
+    {
+        *out_added = added;
+    }
+
+    return r;
+}
+
+int l8w8jwt_presignature_pool_take(struct l8w8jwt_presignature_pool* pool, unsigned char out_presignature[64])
+{
+#if L8W8JWT_PRESIGN_FORK_CHECK
+    if (atomic_load_explicit(&pool->pid, memory_order_acquire) != (long)getpid())
+    {
+        /* Inherited from the parent process: never hand those out. Discard them right away unless a refill is already busy doing so. */
+        if (!atomic_flag_test_and_set_explicit(&pool->refilling, memory_order_acquire))
+        {
+            l8w8jwt_presignature_pool_check_pid(pool);
+            atomic_flag_clear_explicit(&pool->refilling, memory_order_release);
+        }
+
+        return 0;
+    }
+#endif
+
+    const size_t head = atomic_load_explicit(&pool->head, memory_order_relaxed);
+
+    if (head == atomic_load_explicit(&pool->tail, memory_order_acquire))
+    {
+        return 0;
+    }
+
+    unsigned char* slot = pool->slots[head & (pool->capacity - 1)];
+
+    memcpy(out_presignature, slot, 64);
+    mbedtls_platform_zeroize(slot, 64);
+
+    atomic_store_explicit(&pool->head, head + 1, memory_order_release);
+    return 1;
+}
+
+size_t l8w8jwt_presignature_pool_available(struct l8w8jwt_presignature_pool* pool)
+{
+    const size_t head = atomic_load_explicit(&pool->head, memory_order_acquire);
+    return atomic_load_explicit(&pool->tail, memory_order_acquire) - head;
+}
+
+#else
+
+int l8w8jwt_presignature_pool_create(const size_t capacity, struct l8w8jwt_presignature_pool** out_pool)
+{
+    (void)capacity;
+    (void)out_pool;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+void l8w8jwt_presignature_pool_free(struct l8w8jwt_presignature_pool* pool)
+{
+    (void)pool;
+}
+
+int l8w8jwt_presignature_pool_refill(struct l8w8jwt_presignature_pool* pool, const size_t max_count, size_t* out_added)
+{
+    (void)pool;
+    (void)max_count;
+
+    if (out_added != NULL)
+    {
+        *out_added = 0;
+    }
+
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_presignature_pool_take(struct l8w8jwt_presignature_pool* pool, unsigned char out_presignature[64])
+{
+    (void)pool;
+    (void)out_presignature;
+    return 0;
+}
+
+size_t l8w8jwt_presignature_pool_available(struct l8w8jwt_presignature_pool* pool)
+{
+    (void)pool;
+    return 0;
+}
+
+#endif // L8W8JWT_PRESIGNATURES
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,90 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+
+/**
+ *  @file presign.h
+ *  @author Raphael Beck
+ *  @brief Bounded single-producer/single-consumer pool of ES256 presignatures (see p256.h), filled at idle time and drained when signing. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_PRESIGN_H
+#define L8W8JWT_PRESIGN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "p256.h"
+
+#include <stddef.h>
+
+#if L8W8JWT_P256 && !defined(__STDC_NO_ATOMICS__)
+#define L8W8JWT_PRESIGNATURES 1
+#else
+#define L8W8JWT_PRESIGNATURES 0
+#endif
+
+/**
+ * The pool holds one presignature per slot. Only a single thread consumes (the one that signs), while refilling can happen concurrently
+ * from any other thread: concurrent refills don't block, the late ones just return without adding anything. <br>
+ * A pool inherited through a <code>fork()</code> never hands out the parent's presignatures: the child discards them and reseeds the DRBG before producing new ones.
+ */
+struct l8w8jwt_presignature_pool;
+
+/**
+ * Allocates a presignature pool and seeds its own CTR_DRBG (refilling never touches the signing key's RNG).
+ * @param capacity Maximum number of presignatures to hold (rounded up to the next power of 2).
+ * @param out_pool Where to write the pool into.
+ * @return Return code as defined in retcodes.h (<code>L8W8JWT_UNSUPPORTED_ALG</code> if the library was built without the P-256 engine or without C11 atomics).
+ */
+int l8w8jwt_presignature_pool_create(size_t capacity, struct l8w8jwt_presignature_pool** out_pool);
+
+/**
+ * Securely zeroes and frees a presignature pool (<code>NULL</code> is ignored). Make sure no thread is still refilling it!
+ * @param pool The pool to free.
+ */
+void l8w8jwt_presignature_pool_free(struct l8w8jwt_presignature_pool* pool);
+
+/**
+ * Precomputes up to \p max_count presignatures (fewer if the pool fills up).
+ * @param pool The pool to refill.
+ * @param max_count Maximum number of presignatures to add.
+ * @param out_added [OPTIONAL] Where to write the number of presignatures that were actually added into.
+ * @return Return code as defined in retcodes.h
+ */
+int l8w8jwt_presignature_pool_refill(struct l8w8jwt_presignature_pool* pool, size_t max_count, size_t* out_added);
+
+/**
+ * Takes a presignature out of the pool (consumer side).
+ * @param pool The pool to take from.
+ * @param out_presignature Where to write the presignature into.
+ * @return <code>1</code> if a presignature was taken; <code>0</code> if the pool is empty.
+ */
+int l8w8jwt_presignature_pool_take(struct l8w8jwt_presignature_pool* pool, unsigned char out_presignature[64]);
+
+/**
+ * Gets the number of presignatures currently in the pool (just a snapshot while another thread refills it).
+ * @param pool The pool.
+ * @return The number of available presignatures.
+ */
+size_t l8w8jwt_presignature_pool_available(struct l8w8jwt_presignature_pool* pool);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_PRESIGN_H
@@ -0,0 +1,574 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/psa.h"
+#include "l8w8jwt/algs.h"
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/encode.h"
+#include "l8w8jwt/retcodes.h"
+#include "psa_backend.h"
+
+#if L8W8JWT_USE_PSA_CRYPTO
+
+#include <string.h>
+#include <psa/crypto.h>
+#include <mbedtls/pk.h>
+#include <mbedtls/ecp.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/x509_crt.h>
+#include <mbedtls/platform_util.h>
+
+static inline psa_algorithm_t psa_hash_alg_from_alg(const int alg)
+{
+    switch (alg)
+    {
+        case L8W8JWT_ALG_HS256:
+        case L8W8JWT_ALG_RS256:
+        case L8W8JWT_ALG_PS256:
+        case L8W8JWT_ALG_ES256:
+        case L8W8JWT_ALG_ES256K:
+            return PSA_ALG_SHA_256;
+        case L8W8JWT_ALG_HS384:
+        case L8W8JWT_ALG_RS384:
+        case L8W8JWT_ALG_PS384:
+        case L8W8JWT_ALG_ES384:
+            return PSA_ALG_SHA_384;
+        case L8W8JWT_ALG_HS512:
+        case L8W8JWT_ALG_RS512:
+        case L8W8JWT_ALG_PS512:
+        case L8W8JWT_ALG_ES512:
+            return PSA_ALG_SHA_512;
+        default:
+            return PSA_ALG_NONE;
+    }
+}
+
+/* The PSA algorithm for a JWT alg. For PS* verification (and the key policy), any salt length is accepted. */
+static inline psa_algorithm_t psa_alg_from_alg(const int alg, const int verify)
+{
+    const psa_algorithm_t hash_alg = psa_hash_alg_from_alg(alg);
+
+    switch (alg)
+    {
+        case L8W8JWT_ALG_HS256:
+        case L8W8JWT_ALG_HS384:
+        case L8W8JWT_ALG_HS512:
+            return PSA_ALG_HMAC(hash_alg);
+        case L8W8JWT_ALG_RS256:
+        case L8W8JWT_ALG_RS384:
+        case L8W8JWT_ALG_RS512:
+            return PSA_ALG_RSA_PKCS1V15_SIGN(hash_alg);
+        case L8W8JWT_ALG_PS256:
+        case L8W8JWT_ALG_PS384:
+        case L8W8JWT_ALG_PS512:
+#ifdef PSA_ALG_RSA_PSS_ANY_SALT
+            return verify ? PSA_ALG_RSA_PSS_ANY_SALT(hash_alg) : PSA_ALG_RSA_PSS(hash_alg);
+#else
+            (void)verify;
+            return PSA_ALG_RSA_PSS(hash_alg);
+#endif
+        case L8W8JWT_ALG_ES256:
+        case L8W8JWT_ALG_ES384:
+        case L8W8JWT_ALG_ES512:
+        case L8W8JWT_ALG_ES256K:
+            return PSA_ALG_ECDSA(hash_alg);
+        default:
+            return PSA_ALG_NONE;
+    }
+}
+
+/* Gets the expected PSA curve family and key bits for an ES* alg. */
+static inline int ecc_params_from_alg(const int alg, psa_ecc_family_t* out_family, size_t* out_bits)
+{
+    switch (alg)
+    {
+        case L8W8JWT_ALG_ES256:
+            *out_family = PSA_ECC_FAMILY_SECP_R1;
+            *out_bits = 256;
+            return 1;
+        case L8W8JWT_ALG_ES384:
+            *out_family = PSA_ECC_FAMILY_SECP_R1;
+            *out_bits = 384;
+            return 1;
+        case L8W8JWT_ALG_ES512:
+            *out_family = PSA_ECC_FAMILY_SECP_R1;
+            *out_bits = 521;
+            return 1;
+        case L8W8JWT_ALG_ES256K:
+            *out_family = PSA_ECC_FAMILY_SECP_K1;
+            *out_bits = 256;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+static inline int is_hmac_alg(const int alg)
+{
+    return alg == L8W8JWT_ALG_HS256 || alg == L8W8JWT_ALG_HS384 || alg == L8W8JWT_ALG_HS512;
+}
+
+static inline int is_rsa_alg(const int alg)
+{
+    return alg >= L8W8JWT_ALG_RS256 && alg <= L8W8JWT_ALG_PS512;
+}
+
+static inline mbedtls_svc_key_id_t svc_key_id(const uint32_t key_id)
+{
+    return mbedtls_svc_key_id_make(0, (psa_key_id_t)key_id);
+}
+
+/* Converts a parsed MbedTLS key into the PSA import format (written into the end of "buffer") and fills in the matching key attributes. */
+static int pk_to_psa(const int alg, mbedtls_pk_context* pk, const int private_key, unsigned char* buffer, const size_t buffer_size, const unsigned char** out_data, size_t* out_data_length, psa_key_attributes_t* attributes)
+{
+    int r;
+
+    if (is_rsa_alg(alg))
+    {
+        if (!mbedtls_pk_can_do(pk, MBEDTLS_PK_RSA) || mbedtls_pk_get_bitlen(pk) < 2048)
+        {
+            return L8W8JWT_WRONG_KEY_TYPE;
+        }
+
+        if (private_key)
+        {
+            /* RSAPrivateKey (PKCS#1) DER is exactly what PSA expects for RSA key pairs. */
+            r = mbedtls_pk_write_key_der(pk, buffer, buffer_size);
+            if (r <= 0)
+            {
+                return L8W8JWT_KEY_PARSE_FAILURE;
+            }
+
+            *out_data = buffer + buffer_size - r;
+            *out_data_length = (size_t)r;
+            psa_set_key_type(attributes, PSA_KEY_TYPE_RSA_KEY_PAIR);
+        }
+        else
+        {
+            /* For RSA, this writes the RSAPublicKey (PKCS#1) structure that PSA expects. */
+            unsigned char* p = buffer + buffer_size;
+            r = mbedtls_pk_write_pubkey(&p, buffer, pk);
+            if (r <= 0)
+            {
+                return L8W8JWT_KEY_PARSE_FAILURE;
+            }
+
+            *out_data = p;
+            *out_data_length = (size_t)r;
+            psa_set_key_type(attributes, PSA_KEY_TYPE_RSA_PUBLIC_KEY);
+        }
+
+        psa_set_key_bits(attributes, mbedtls_pk_get_bitlen(pk));
+        return L8W8JWT_SUCCESS;
+    }
+
+    psa_ecc_family_t family;
+    size_t bits;
+
+    if (!ecc_params_from_alg(alg, &family, &bits) || !mbedtls_pk_can_do(pk, MBEDTLS_PK_ECDSA))
+    {
+        return L8W8JWT_WRONG_KEY_TYPE;
+    }
+
+    mbedtls_ecp_keypair* ec = mbedtls_pk_ec(*pk);
+    const mbedtls_ecp_group_id expected_curve = alg == L8W8JWT_ALG_ES256K ? MBEDTLS_ECP_DP_SECP256K1 : alg == L8W8JWT_ALG_ES384 ? MBEDTLS_ECP_DP_SECP384R1 : alg == L8W8JWT_ALG_ES512 ? MBEDTLS_ECP_DP_SECP521R1 : MBEDTLS_ECP_DP_SECP256R1;
+
+    if (ec->MBEDTLS_PRIVATE(grp).id != expected_curve)
+    {
+        return L8W8JWT_WRONG_KEY_TYPE;
+    }
+
+    if (private_key)
+    {
+        /* PSA expects the raw private scalar for ECC key pairs. */
+        const size_t d_length = PSA_BITS_TO_BYTES(bits);
+
+        r = mbedtls_mpi_write_binary(&ec->MBEDTLS_PRIVATE(d), buffer, d_length);
+        if (r != 0)
+        {
+            return L8W8JWT_KEY_PARSE_FAILURE;
+        }
+
+        *out_data = buffer;
+        *out_data_length = d_length;
+        psa_set_key_type(attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(family));
+    }
+    else
+    {
+        /* For EC keys, this writes the uncompressed public point that PSA expects. */
+        unsigned char* p = buffer + buffer_size;
+        r = mbedtls_pk_write_pubkey(&p, buffer, pk);
+        if (r <= 0)
+        {
+            return L8W8JWT_KEY_PARSE_FAILURE;
+        }
+
+        *out_data = p;
+        *out_data_length = (size_t)r;
+        psa_set_key_type(attributes, PSA_KEY_TYPE_ECC_PUBLIC_KEY(family));
+    }
+
+    psa_set_key_bits(attributes, bits);
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_psa_import_key(const int alg, const unsigned char* key, size_t key_length, const unsigned char* key_pw, const size_t key_pw_length, const uint32_t persistent_key_id, uint32_t* out_key_id)
+{
+    int r;
+
+    if (key == NULL || out_key_id == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (key_length == 0 || key_length > L8W8JWT_MAX_KEY_SIZE)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    const psa_algorithm_t psa_alg = psa_alg_from_alg(alg, 1);
+    if (psa_alg == PSA_ALG_NONE)
+    {
+        return alg == L8W8JWT_ALG_ED25519 ? L8W8JWT_UNSUPPORTED_ALG : L8W8JWT_INVALID_ARG;
+    }
+
+    if (psa_crypto_init() != PSA_SUCCESS)
+    {
+        return L8W8JWT_MBEDTLS_CTR_DRBG_SEED_FAILURE;
+    }
+
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+    psa_set_key_algorithm(&attributes, psa_alg);
+
+    if (persistent_key_id != 0)
+    {
+        psa_set_key_id(&attributes, svc_key_id(persistent_key_id));
+    }
+
+    mbedtls_pk_context pk;
+    mbedtls_pk_init(&pk);
+
+    mbedtls_x509_crt crt;
+    mbedtls_x509_crt_init(&crt);
+
+    mbedtls_entropy_context entropy;
+    mbedtls_entropy_init(&entropy);
+
+    mbedtls_ctr_drbg_context ctr_drbg;
+    mbedtls_ctr_drbg_init(&ctr_drbg);
+
+    /* Big enough for the PEM key copy (+ NUL-terminator) as well as for its DER re-encoding. */
+    const size_t buffer_size = L8W8JWT_MAX_KEY_SIZE + 1;
+    unsigned char* buffer = l8w8jwt_calloc(1, buffer_size);
+    unsigned char* der = l8w8jwt_calloc(1, buffer_size);
+
+    if (buffer == NULL || der == NULL)
+    {
+        r = L8W8JWT_OUT_OF_MEM;
+        goto exit;
+    }
+
+    const unsigned char* data = NULL;
+    size_t data_length = 0;
+
+    if (is_hmac_alg(alg))
+    {
+        /* A trailing NUL-terminator included in the length is not part of the HMAC secret. */
+        key_length -= key[key_length - 1] == '\0';
+
+        if (key_length == 0)
+        {
+            r = L8W8JWT_INVALID_ARG;
+            goto exit;
+        }
+
+        data = key;
+        data_length = key_length;
+
+        psa_set_key_type(&attributes, PSA_KEY_TYPE_HMAC);
+        psa_set_key_bits(&attributes, PSA_BYTES_TO_BITS(key_length));
+        psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_MESSAGE | PSA_KEY_USAGE_VERIFY_MESSAGE);
+    }
+    else
+    {
+        r = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func, &entropy, (const unsigned char*)"l8w8jwt_mbedtls_pers.!#@", 24);
+        if (r != 0)
+        {
+            r = L8W8JWT_MBEDTLS_CTR_DRBG_SEED_FAILURE;
+            goto exit;
+        }
+
+        /* MbedTLS requires the NUL-terminator to be included in the PEM-formatted key string. */
+        memcpy(buffer, key, key_length);
+        key_length += buffer[key_length - 1] != '\0';
+
+        mbedtls_pk_context* parsed = &pk;
+        int private_key = mbedtls_pk_parse_key(&pk, buffer, key_length, key_pw, key_pw_length, mbedtls_ctr_drbg_random, &ctr_drbg) == 0;
+
+        if (!private_key)
+        {
+            mbedtls_pk_free(&pk);
+            mbedtls_pk_init(&pk);
+
+            if (strstr((const char*)buffer, "-----BEGIN CERTIFICATE-----") != NULL)
+            {
+                r = mbedtls_x509_crt_parse(&crt, buffer, key_length);
+                parsed = &crt.pk;
+            }
+            else
+            {
+                r = mbedtls_pk_parse_public_key(&pk, buffer, key_length);
+            }
+
+            if (r != 0)
+            {
+                r = L8W8JWT_KEY_PARSE_FAILURE;
+                goto exit;
+            }
+        }
+
+        r = pk_to_psa(alg, parsed, private_key, der, buffer_size, &data, &data_length, &attributes);
+        if (r != L8W8JWT_SUCCESS)
+        {
+            goto exit;
+        }
+
+        psa_set_key_usage_flags(&attributes, private_key ? PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH : PSA_KEY_USAGE_VERIFY_HASH);
+    }
+
+    mbedtls_svc_key_id_t key_id;
+    if (psa_import_key(&attributes, data, data_length, &key_id) != PSA_SUCCESS)
+    {
+        r = L8W8JWT_KEY_PARSE_FAILURE;
+        goto exit;
+    }
+
+    *out_key_id = (uint32_t)MBEDTLS_SVC_KEY_ID_GET_KEY_ID(key_id);
+    r = L8W8JWT_SUCCESS;
+
+exit:
+    psa_reset_key_attributes(&attributes);
+    mbedtls_x509_crt_free(&crt);
+    mbedtls_pk_free(&pk);
+    mbedtls_ctr_drbg_free(&ctr_drbg);
+    mbedtls_entropy_free(&entropy);
+
+    if (buffer != NULL)
+    {
+        mbedtls_platform_zeroize(buffer, buffer_size);
+        l8w8jwt_free(buffer);
+    }
+
+    if (der != NULL)
+    {
+        mbedtls_platform_zeroize(der, buffer_size);
+        l8w8jwt_free(der);
+    }
+
+    return r;
+}
+
+int l8w8jwt_psa_destroy_key(const uint32_t key_id)
+{
+    if (key_id == 0)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    if (psa_crypto_init() != PSA_SUCCESS)
+    {
+        return L8W8JWT_MBEDTLS_CTR_DRBG_SEED_FAILURE;
+    }
+
+    return psa_destroy_key(svc_key_id(key_id)) == PSA_SUCCESS ? L8W8JWT_SUCCESS : L8W8JWT_INVALID_ARG;
+}
+
+int l8w8jwt_psa_get_signature_length(const int alg, const uint32_t key_id, size_t* out_signature_length)
+{
+    int r = L8W8JWT_WRONG_KEY_TYPE;
+
+    if (psa_alg_from_alg(alg, 0) == PSA_ALG_NONE)
+    {
+        return alg == L8W8JWT_ALG_ED25519 ? L8W8JWT_UNSUPPORTED_ALG : L8W8JWT_INVALID_ARG;
+    }
+
+    if (psa_crypto_init() != PSA_SUCCESS)
+    {
+        return L8W8JWT_MBEDTLS_CTR_DRBG_SEED_FAILURE;
+    }
+
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+    if (psa_get_key_attributes(svc_key_id(key_id), &attributes) != PSA_SUCCESS)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    const psa_key_type_t type = psa_get_key_type(&attributes);
+    const size_t bits = psa_get_key_bits(&attributes);
+
+    if (is_hmac_alg(alg))
+    {
+        if (type == PSA_KEY_TYPE_HMAC)
+        {
+            *out_signature_length = PSA_HASH_LENGTH(psa_hash_alg_from_alg(alg));
+            r = L8W8JWT_SUCCESS;
+        }
+    }
+    else if (is_rsa_alg(alg))
+    {
+        if (PSA_KEY_TYPE_IS_RSA(type) && bits >= 2048)
+        {
+            *out_signature_length = PSA_BITS_TO_BYTES(bits);
+            r = L8W8JWT_SUCCESS;
+        }
+    }
+    else
+    {
+        psa_ecc_family_t family;
+        size_t expected_bits;
+
+        if (ecc_params_from_alg(alg, &family, &expected_bits) && PSA_KEY_TYPE_IS_ECC(type) && PSA_KEY_TYPE_ECC_GET_FAMILY(type) == family && bits == expected_bits)
+        {
+            *out_signature_length = 2 * PSA_BITS_TO_BYTES(bits);
+            r = L8W8JWT_SUCCESS;
+        }
+    }
+
+    psa_reset_key_attributes(&attributes);
+    return r;
+}
+
+int l8w8jwt_psa_mac(const int alg, const uint32_t key_id, const unsigned char* input, const size_t input_length, unsigned char* out, const size_t out_size)
+{
+    size_t mac_length = 0;
+    return psa_mac_compute(svc_key_id(key_id), psa_alg_from_alg(alg, 0), input, input_length, out, out_size, &mac_length) == PSA_SUCCESS ? L8W8JWT_SUCCESS : L8W8JWT_SIGNATURE_CREATION_FAILURE;
+}
+
+int l8w8jwt_psa_sign_hash(const int alg, const uint32_t key_id, const unsigned char* hash, const size_t hash_length, unsigned char* out, const size_t out_size)
+{
+    size_t signature_length = 0;
+    return psa_sign_hash(svc_key_id(key_id), psa_alg_from_alg(alg, 0), hash, hash_length, out, out_size, &signature_length) == PSA_SUCCESS ? L8W8JWT_SUCCESS : L8W8JWT_SIGNATURE_CREATION_FAILURE;
+}
+
+/* Tells a signature that doesn't match (or is malformed) apart from one that couldn't be checked. */
+static int verify_result(const psa_status_t status)
+{
+    switch (status)
+    {
+        case PSA_SUCCESS:
+            return 0;
+        case PSA_ERROR_INVALID_SIGNATURE:
+        case PSA_ERROR_INVALID_ARGUMENT:
+            return 1;
+        case PSA_ERROR_INSUFFICIENT_MEMORY:
+            return L8W8JWT_OUT_OF_MEM;
+        default:
+            return L8W8JWT_INVALID_ARG;
+    }
+}
+
+int l8w8jwt_psa_verify_mac(const int alg, const uint32_t key_id, const unsigned char* input, const size_t input_length, const unsigned char* signature, const size_t signature_length)
+{
+    return verify_result(psa_mac_verify(svc_key_id(key_id), psa_alg_from_alg(alg, 1), input, input_length, signature, signature_length));
+}
+
+int l8w8jwt_psa_verify_hash(const int alg, const uint32_t key_id, const unsigned char* hash, const size_t hash_length, const unsigned char* signature, const size_t signature_length)
+{
+    return verify_result(psa_verify_hash(svc_key_id(key_id), psa_alg_from_alg(alg, 1), hash, hash_length, signature, signature_length));
+}
+
+#else // !L8W8JWT_USE_PSA_CRYPTO
+
+int l8w8jwt_psa_import_key(const int alg, const unsigned char* key, const size_t key_length, const unsigned char* key_pw, const size_t key_pw_length, const uint32_t persistent_key_id, uint32_t* out_key_id)
+{
+    (void)alg;
+    (void)key;
+    (void)key_length;
+    (void)key_pw;
+    (void)key_pw_length;
+    (void)persistent_key_id;
+    (void)out_key_id;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_psa_destroy_key(const uint32_t key_id)
+{
+    (void)key_id;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_psa_get_signature_length(const int alg, const uint32_t key_id, size_t* out_signature_length)
+{
+    (void)alg;
+    (void)key_id;
+    (void)out_signature_length;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_psa_mac(const int alg, const uint32_t key_id, const unsigned char* input, const size_t input_length, unsigned char* out, const size_t out_size)
+{
+    (void)alg;
+    (void)key_id;
+    (void)input;
+    (void)input_length;
+    (void)out;
+    (void)out_size;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_psa_sign_hash(const int alg, const uint32_t key_id, const unsigned char* hash, const size_t hash_length, unsigned char* out, const size_t out_size)
+{
+    (void)alg;
+    (void)key_id;
+    (void)hash;
+    (void)hash_length;
+    (void)out;
+    (void)out_size;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_psa_verify_mac(const int alg, const uint32_t key_id, const unsigned char* input, const size_t input_length, const unsigned char* signature, const size_t signature_length)
+{
+    (void)alg;
+    (void)key_id;
+    (void)input;
+    (void)input_length;
+    (void)signature;
+    (void)signature_length;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_psa_verify_hash(const int alg, const uint32_t key_id, const unsigned char* hash, const size_t hash_length, const unsigned char* signature, const size_t signature_length)
+{
+    (void)alg;
+    (void)key_id;
+    (void)hash;
+    (void)hash_length;
+    (void)signature;
+    (void)signature_length;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+#endif // L8W8JWT_USE_PSA_CRYPTO
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,70 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file psa_backend.h
+ *  @author Raphael Beck
+ *  @brief Internal signing/verification functions for keys that live in the PSA key store. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_PSA_BACKEND_H
+#define L8W8JWT_PSA_BACKEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Checks that a PSA key is compatible with the passed JWT alg and gets the size of the signatures it produces.
+ * @param alg The JWT alg.
+ * @param key_id The PSA key ID.
+ * @param out_signature_length Where to write the signature (or MAC) length into.
+ * @return Return code as defined in retcodes.h
+ */
+int l8w8jwt_psa_get_signature_length(int alg, uint32_t key_id, size_t* out_signature_length);
+
+/**
+ * Computes the HMAC of a signing input (HS* algs).
+ * @return Return code as defined in retcodes.h
+ */
+int l8w8jwt_psa_mac(int alg, uint32_t key_id, const unsigned char* input, size_t input_length, unsigned char* out, size_t out_size);
+
+/**
+ * Signs an already hashed signing input (RS*, PS* and ES* algs).
+ * @return Return code as defined in retcodes.h
+ */
+int l8w8jwt_psa_sign_hash(int alg, uint32_t key_id, const unsigned char* hash, size_t hash_length, unsigned char* out, size_t out_size);
+
+/**
+ * Verifies the HMAC of a signing input (in constant time).
+ * @return <code>0</code> if the MAC is valid; <code>1</code> if it isn't; an l8w8jwt return code if it couldn't be checked (e.g. <code>L8W8JWT_OUT_OF_MEM</code>).
+ */
+int l8w8jwt_psa_verify_mac(int alg, uint32_t key_id, const unsigned char* input, size_t input_length, const unsigned char* signature, size_t signature_length);
+
+/**
+ * Verifies a signature over an already hashed signing input.
+ * @return <code>0</code> if the signature is valid; <code>1</code> if it isn't; an l8w8jwt return code if it couldn't be checked (e.g. <code>L8W8JWT_OUT_OF_MEM</code>).
+ */
+int l8w8jwt_psa_verify_hash(int alg, uint32_t key_id, const unsigned char* hash, size_t hash_length, const unsigned char* signature, size_t signature_length);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_PSA_BACKEND_H
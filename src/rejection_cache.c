@@ -0,0 +1,212 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/retcodes.h"
+#include "l8w8jwt/timehelper.h"
+#include "verification_cache_backend.h"
+#include "digest_cache.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+struct l8w8jwt_rejection_cache_entry
+{
+    unsigned char digest[32];
+
+    /* Point in time after which the entry is stale (0 means empty). */
+    int64_t expires_at;
+};
+
+struct l8w8jwt_rejection_cache
+{
+    /* Critical sections are four digest comparisons long. */
+    struct l8w8jwt_digest_cache table;
+
+    int64_t ttl_seconds;
+};
+
+int l8w8jwt_rejection_cache_create(const size_t max_entries, const uint32_t ttl_seconds, struct l8w8jwt_rejection_cache** out_rejection_cache)
+{
+    if (out_rejection_cache == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (ttl_seconds == 0)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    struct l8w8jwt_rejection_cache* cache = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_rejection_cache));
+    if (cache == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    int r = l8w8jwt_digest_cache_init(&cache->table, max_entries, sizeof(struct l8w8jwt_rejection_cache_entry));
+    if (r != L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_free(cache);
+        return r;
+    }
+
+    cache->ttl_seconds = ttl_seconds;
+
+    *out_rejection_cache = cache;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_rejection_cache_get_stats(const struct l8w8jwt_rejection_cache* rejection_cache, struct l8w8jwt_rejection_cache_stats* out_stats)
+{
+    if (rejection_cache == NULL || out_stats == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    struct l8w8jwt_rejection_cache* cache = (struct l8w8jwt_rejection_cache*)rejection_cache;
+
+    out_stats->hits = atomic_load_explicit(&cache->table.hits, memory_order_relaxed);
+    out_stats->misses = atomic_load_explicit(&cache->table.misses, memory_order_relaxed);
+    out_stats->evictions = atomic_load_explicit(&cache->table.evictions, memory_order_relaxed);
+
+    return L8W8JWT_SUCCESS;
+}
+
+void l8w8jwt_rejection_cache_free(struct l8w8jwt_rejection_cache* rejection_cache)
+{
+    if (rejection_cache == NULL)
+    {
+        return;
+    }
+
+    l8w8jwt_digest_cache_destroy(&rejection_cache->table);
+    l8w8jwt_free(rejection_cache);
+}
+
+int l8w8jwt_rejection_cache_contains(struct l8w8jwt_rejection_cache* rejection_cache, const unsigned char digest[32])
+{
+    struct l8w8jwt_rejection_cache* cache = rejection_cache;
+
+    const int64_t now = (int64_t)l8w8jwt_time(NULL);
+    const size_t bucket = l8w8jwt_digest_cache_bucket(&cache->table, digest);
+    const struct l8w8jwt_rejection_cache_entry* entries = l8w8jwt_digest_cache_entry_at(&cache->table, bucket, 0);
+
+    int found = 0;
+
+    l8w8jwt_digest_cache_lock(&cache->table, bucket);
+
+    for (size_t way = 0; way < L8W8JWT_DIGEST_CACHE_WAYS; ++way)
+    {
+        if (entries[way].expires_at >= now && memcmp(entries[way].digest, digest, 32) == 0)
+        {
+            found = 1;
+            break;
+        }
+    }
+
+    l8w8jwt_digest_cache_unlock(&cache->table, bucket);
+
+    l8w8jwt_digest_cache_count(found ? &cache->table.hits : &cache->table.misses);
+    return found;
+}
+
+void l8w8jwt_rejection_cache_put(struct l8w8jwt_rejection_cache* rejection_cache, const unsigned char digest[32])
+{
+    struct l8w8jwt_rejection_cache* cache = rejection_cache;
+
+    const int64_t now = (int64_t)l8w8jwt_time(NULL);
+    const size_t bucket = l8w8jwt_digest_cache_bucket(&cache->table, digest);
+    struct l8w8jwt_rejection_cache_entry* entries = l8w8jwt_digest_cache_entry_at(&cache->table, bucket, 0);
+
+    l8w8jwt_digest_cache_lock(&cache->table, bucket);
+
+    /* Refresh the token's own entry if it's there already, otherwise replace the one that expires first (stale ones always do). */
+    struct l8w8jwt_rejection_cache_entry* victim = entries;
+
+    for (size_t way = 0; way < L8W8JWT_DIGEST_CACHE_WAYS; ++way)
+    {
+        if (memcmp(entries[way].digest, digest, 32) == 0)
+        {
+            victim = &entries[way];
+            break;
+        }
+
+        if (entries[way].expires_at < victim->expires_at)
+        {
+            victim = &entries[way];
+        }
+    }
+
+    if (victim->expires_at >= now && memcmp(victim->digest, digest, 32) != 0)
+    {
+        l8w8jwt_digest_cache_count(&cache->table.evictions);
+    }
+
+    memcpy(victim->digest, digest, 32);
+    victim->expires_at = now + cache->ttl_seconds;
+
+    l8w8jwt_digest_cache_unlock(&cache->table, bucket);
+}
+
+#else
+
+int l8w8jwt_rejection_cache_create(const size_t max_entries, const uint32_t ttl_seconds, struct l8w8jwt_rejection_cache** out_rejection_cache)
+{
+    (void)max_entries;
+    (void)ttl_seconds;
+    (void)out_rejection_cache;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_rejection_cache_get_stats(const struct l8w8jwt_rejection_cache* rejection_cache, struct l8w8jwt_rejection_cache_stats* out_stats)
+{
+    (void)rejection_cache;
+    (void)out_stats;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+void l8w8jwt_rejection_cache_free(struct l8w8jwt_rejection_cache* rejection_cache)
+{
+    (void)rejection_cache;
+}
+
+int l8w8jwt_rejection_cache_contains(struct l8w8jwt_rejection_cache* rejection_cache, const unsigned char digest[32])
+{
+    (void)rejection_cache;
+    (void)digest;
+    return 0;
+}
+
+void l8w8jwt_rejection_cache_put(struct l8w8jwt_rejection_cache* rejection_cache, const unsigned char digest[32])
+{
+    (void)rejection_cache;
+    (void)digest;
+}
+
+#endif // !defined(__STDC_NO_ATOMICS__)
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,704 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/retcodes.h"
+#include "l8w8jwt/revocation.h"
+#include "sha2.h"
+
+#include <stdio.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <io.h>
+#include <fcntl.h>
+#include <process.h>
+#include <sys/stat.h>
+#include <windows.h>
+#define L8W8JWT_REVOCATION_MMAP 1
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define L8W8JWT_REVOCATION_MMAP 1
+#else
+#define L8W8JWT_REVOCATION_MMAP 0
+#endif
+
+/* File layout: header, then block_count 64-byte Bloom filter blocks, then entry_count sorted 64-bit fingerprints (the fingerprint section). */
+#define L8W8JWT_REVOCATION_HEADER_SIZE 64
+#define L8W8JWT_REVOCATION_BLOCK_SIZE 64
+#define L8W8JWT_REVOCATION_BITS_PER_ENTRY 10
+#define L8W8JWT_REVOCATION_PROBES 7
+#define L8W8JWT_REVOCATION_VERSION 1
+
+static const unsigned char L8W8JWT_REVOCATION_MAGIC[8] = { 'L', '8', 'W', '8', 'R', 'E', 'V', 'K' };
+
+static inline uint64_t l8w8jwt_load64_le(const unsigned char* in)
+{
+    uint64_t r = 0;
+    for (int i = 7; i >= 0; --i)
+    {
+        r = (r << 8) | in[i];
+    }
+    return r;
+}
+
+static inline void l8w8jwt_store64_le(unsigned char* out, uint64_t in)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        out[i] = (unsigned char)(in >> (8 * i));
+    }
+}
+
+/*
+ * Entry hash: SHA-256 over a domain separator and the jti (or the issuer's length, the issuer and the subject).
+ * Bytes 0-7 are the fingerprint in the fingerprint section, 8-15 pick the filter block, and 16-23 hold the seven 9-bit probe positions within that block.
+ */
+static int l8w8jwt_revocation_hash(const char* jti, const size_t jti_length, const char* iss, const size_t iss_length, const char* sub, const size_t sub_length, unsigned char out[32])
+{
+    struct l8w8jwt_sha2_context ctx;
+    unsigned char prefix[9] = { 0x00 };
+
+    int r = l8w8jwt_sha2_starts(&ctx, MBEDTLS_MD_SHA256);
+
+    if (jti != NULL)
+    {
+        prefix[0] = 0x01;
+        r = r != 0 ? r : l8w8jwt_sha2_update(&ctx, prefix, 1);
+        r = r != 0 ? r : l8w8jwt_sha2_update(&ctx, (const unsigned char*)jti, jti_length);
+    }
+    else
+    {
+        prefix[0] = 0x02;
+        l8w8jwt_store64_le(prefix + 1, (uint64_t)iss_length);
+        r = r != 0 ? r : l8w8jwt_sha2_update(&ctx, prefix, sizeof(prefix));
+        r = r != 0 ? r : l8w8jwt_sha2_update(&ctx, (const unsigned char*)iss, iss_length);
+        r = r != 0 ? r : l8w8jwt_sha2_update(&ctx, (const unsigned char*)sub, sub_length);
+    }
+
+    r = r != 0 ? r : l8w8jwt_sha2_finish(&ctx, out);
+    l8w8jwt_sha2_free(&ctx);
+
+    return r;
+}
+
+static inline unsigned char* l8w8jwt_revocation_block(unsigned char* bloom, const uint64_t block_count, const unsigned char hash[32])
+{
+    return bloom + (l8w8jwt_load64_le(hash + 8) % block_count) * L8W8JWT_REVOCATION_BLOCK_SIZE;
+}
+
+static int l8w8jwt_revocation_compare_fingerprints(const void* a, const void* b)
+{
+    const uint64_t x = *(const uint64_t*)a;
+    const uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/* How many names to try for the temporary file before giving up (each one is only taken if a concurrent or crashed writer holds it). */
+#define L8W8JWT_REVOCATION_TMP_ATTEMPTS 1000
+
+/* Creates (exclusively) a new file next to path, named path.<pid>.<n>.tmp: writers never share one, even when several of them publish the same list at once. */
+static FILE* l8w8jwt_revocation_create_tmp_file(const char* path, char* tmp_path, const size_t tmp_path_size)
+{
+#if defined(_WIN32)
+    const unsigned long pid = (unsigned long)_getpid();
+#elif defined(__unix__) || defined(__APPLE__)
+    const unsigned long pid = (unsigned long)getpid();
+#else
+    const unsigned long pid = 0;
+#endif
+
+    for (unsigned int n = 0; n < L8W8JWT_REVOCATION_TMP_ATTEMPTS; ++n)
+    {
+        snprintf(tmp_path, tmp_path_size, "%s.%lu.%u.tmp", path, pid, n);
+
+#if defined(_WIN32)
+        const int fd = _open(tmp_path, _O_WRONLY | _O_CREAT | _O_EXCL | _O_BINARY, _S_IREAD | _S_IWRITE);
+        FILE* file = fd != -1 ? _fdopen(fd, "wb") : NULL;
+#elif defined(__unix__) || defined(__APPLE__)
+        const int fd = open(tmp_path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        FILE* file = fd != -1 ? fdopen(fd, "wb") : NULL;
+#else
+        const int fd = -1;
+        FILE* file = fopen(tmp_path, "wbx");
+#endif
+
+        if (file != NULL)
+        {
+            return file;
+        }
+
+        if (fd != -1)
+        {
+#if defined(_WIN32)
+            _close(fd);
+#elif defined(__unix__) || defined(__APPLE__)
+            close(fd);
+#endif
+            remove(tmp_path);
+            return NULL;
+        }
+
+        if (errno != EEXIST)
+        {
+            return NULL;
+        }
+    }
+
+    return NULL;
+}
+
+/* Flushes the file all the way to the disk, so that a crash right after the rename can't leave a truncated list behind under the final name. */
+static int l8w8jwt_revocation_sync(FILE* file)
+{
+    if (fflush(file) != 0)
+    {
+        return 0;
+    }
+
+#if defined(_WIN32)
+    return _commit(_fileno(file)) == 0;
+#elif defined(__unix__) || defined(__APPLE__)
+    return fsync(fileno(file)) == 0;
+#else
+    return 1;
+#endif
+}
+
+int l8w8jwt_revocation_list_write(const char* path, const struct l8w8jwt_revocation_entry* entries, const size_t entries_count)
+{
+    if (path == NULL || (entries == NULL && entries_count != 0))
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (entries_count > SIZE_MAX / L8W8JWT_REVOCATION_BITS_PER_ENTRY / sizeof(uint64_t))
+    {
+        return L8W8JWT_OVERFLOW;
+    }
+
+    int r = L8W8JWT_SUCCESS;
+    FILE* file = NULL;
+
+    const uint64_t block_count = 1 + (uint64_t)entries_count * L8W8JWT_REVOCATION_BITS_PER_ENTRY / (8 * L8W8JWT_REVOCATION_BLOCK_SIZE);
+
+    /* Room for the ".<pid>.<n>.tmp" suffix. */
+    const size_t tmp_path_size = strlen(path) + 48;
+    char* tmp_path = l8w8jwt_malloc(tmp_path_size);
+    unsigned char* bloom = l8w8jwt_calloc((size_t)block_count, L8W8JWT_REVOCATION_BLOCK_SIZE);
+    uint64_t* fingerprints = l8w8jwt_malloc(entries_count * sizeof(uint64_t) + 1);
+
+    if (tmp_path == NULL || bloom == NULL || fingerprints == NULL)
+    {
+        r = L8W8JWT_OUT_OF_MEM;
+        goto exit;
+    }
+
+    for (size_t i = 0; i < entries_count; ++i)
+    {
+        const struct l8w8jwt_revocation_entry* entry = &entries[i];
+        unsigned char hash[32];
+
+        if (entry->jti == NULL && (entry->iss == NULL || entry->sub == NULL))
+        {
+            r = L8W8JWT_INVALID_ARG;
+            goto exit;
+        }
+
+        if (l8w8jwt_revocation_hash(entry->jti, entry->jti_length, entry->iss, entry->iss_length, entry->sub, entry->sub_length, hash) != 0)
+        {
+            r = L8W8JWT_SHA2_FAILURE;
+            goto exit;
+        }
+
+        unsigned char* block = l8w8jwt_revocation_block(bloom, block_count, hash);
+        const uint64_t probes = l8w8jwt_load64_le(hash + 16);
+
+        for (int k = 0; k < L8W8JWT_REVOCATION_PROBES; ++k)
+        {
+            const unsigned int bit = (unsigned int)(probes >> (9 * k)) & 511;
+            block[bit >> 3] |= (unsigned char)(1 << (bit & 7));
+        }
+
+        fingerprints[i] = l8w8jwt_load64_le(hash);
+    }
+
+    qsort(fingerprints, entries_count, sizeof(uint64_t), &l8w8jwt_revocation_compare_fingerprints);
+
+    size_t unique_count = 0;
+
+    for (size_t i = 0; i < entries_count; ++i)
+    {
+        if (unique_count == 0 || fingerprints[unique_count - 1] != fingerprints[i])
+        {
+            fingerprints[unique_count++] = fingerprints[i];
+        }
+    }
+
+    unsigned char header[L8W8JWT_REVOCATION_HEADER_SIZE] = { 0x00 };
+
+    memcpy(header, L8W8JWT_REVOCATION_MAGIC, sizeof(L8W8JWT_REVOCATION_MAGIC));
+    header[8] = L8W8JWT_REVOCATION_VERSION;
+    header[12] = L8W8JWT_REVOCATION_PROBES;
+    l8w8jwt_store64_le(header + 16, block_count);
+    l8w8jwt_store64_le(header + 24, (uint64_t)unique_count);
+    l8w8jwt_store64_le(header + 32, L8W8JWT_REVOCATION_HEADER_SIZE);
+    l8w8jwt_store64_le(header + 40, L8W8JWT_REVOCATION_HEADER_SIZE + block_count * L8W8JWT_REVOCATION_BLOCK_SIZE);
+
+    file = l8w8jwt_revocation_create_tmp_file(path, tmp_path, tmp_path_size);
+    if (file == NULL)
+    {
+        r = L8W8JWT_INVALID_ARG;
+        goto exit;
+    }
+
+    int ok = fwrite(header, 1, sizeof(header), file) == sizeof(header);
+    ok = ok && fwrite(bloom, L8W8JWT_REVOCATION_BLOCK_SIZE, (size_t)block_count, file) == block_count;
+
+    /* Fingerprints are stored little-endian regardless of the host's byte order. */
+    for (size_t i = 0; ok && i < unique_count; ++i)
+    {
+        unsigned char le[8];
+        l8w8jwt_store64_le(le, fingerprints[i]);
+        ok = fwrite(le, 1, sizeof(le), file) == sizeof(le);
+    }
+
+    ok = ok && l8w8jwt_revocation_sync(file);
+    ok = fclose(file) == 0 && ok;
+    file = NULL;
+
+    if (!ok)
+    {
+        remove(tmp_path);
+        r = L8W8JWT_INVALID_ARG;
+        goto exit;
+    }
+
+#if defined(_WIN32)
+    /* Fails while another filter still has the old file mapped (see revocation.h). */
+    ok = MoveFileExA(tmp_path, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    ok = rename(tmp_path, path) == 0;
+#endif
+
+    if (!ok)
+    {
+        remove(tmp_path);
+        r = L8W8JWT_INVALID_ARG;
+        goto exit;
+    }
+
+exit:
+    if (file != NULL)
+    {
+        fclose(file);
+        remove(tmp_path);
+    }
+
+    l8w8jwt_free(tmp_path);
+    l8w8jwt_free(bloom);
+    l8w8jwt_free(fingerprints);
+    return r;
+}
+
+#if L8W8JWT_REVOCATION_MMAP && !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+struct l8w8jwt_revocation_mapping
+{
+    const unsigned char* base;
+    size_t size;
+
+    const unsigned char* bloom;
+    const unsigned char* fingerprints;
+    uint64_t block_count;
+    uint64_t entry_count;
+
+    /* One reference is held by the filter (while this is its current mapping), plus one per check in flight. */
+    atomic_size_t references;
+};
+
+struct l8w8jwt_revocation_filter
+{
+    /* Guards swapping the current mapping and taking references to it. */
+    atomic_flag lock;
+
+    struct l8w8jwt_revocation_mapping* current;
+
+    char* path;
+};
+
+static void l8w8jwt_revocation_unmap(struct l8w8jwt_revocation_mapping* mapping)
+{
+    if (mapping->base != NULL)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(mapping->base);
+#else
+        munmap((void*)mapping->base, mapping->size);
+#endif
+    }
+
+    l8w8jwt_free(mapping);
+}
+
+static int l8w8jwt_revocation_map(const char* path, struct l8w8jwt_revocation_mapping** out_mapping)
+{
+    struct l8w8jwt_revocation_mapping* mapping = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_revocation_mapping));
+    if (mapping == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        l8w8jwt_free(mapping);
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < L8W8JWT_REVOCATION_HEADER_SIZE || (uint64_t)file_size.QuadPart > SIZE_MAX)
+    {
+        CloseHandle(file);
+        l8w8jwt_free(mapping);
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    HANDLE file_mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+
+    if (file_mapping == NULL)
+    {
+        l8w8jwt_free(mapping);
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    /* The view keeps the file mapping alive. */
+    mapping->base = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+    mapping->size = (size_t)file_size.QuadPart;
+    CloseHandle(file_mapping);
+
+    if (mapping->base == NULL)
+    {
+        l8w8jwt_free(mapping);
+        return L8W8JWT_INVALID_ARG;
+    }
+#else
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        l8w8jwt_free(mapping);
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < L8W8JWT_REVOCATION_HEADER_SIZE || (uint64_t)st.st_size > SIZE_MAX)
+    {
+        close(fd);
+        l8w8jwt_free(mapping);
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    /* The mapping stays valid after closing the file (and after the file is replaced by a newer version). */
+    void* base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (base == MAP_FAILED)
+    {
+        l8w8jwt_free(mapping);
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    mapping->base = base;
+    mapping->size = (size_t)st.st_size;
+#endif
+
+    /* The header is all that needs checking: the rest is used in place. */
+    const unsigned char* header = mapping->base;
+
+    const uint64_t block_count = l8w8jwt_load64_le(header + 16);
+    const uint64_t entry_count = l8w8jwt_load64_le(header + 24);
+    const uint64_t bloom_offset = l8w8jwt_load64_le(header + 32);
+    const uint64_t fingerprints_offset = l8w8jwt_load64_le(header + 40);
+    const uint64_t size = (uint64_t)mapping->size;
+
+    if //
+    (
+        memcmp(header, L8W8JWT_REVOCATION_MAGIC, sizeof(L8W8JWT_REVOCATION_MAGIC)) != 0 //
+        || header[8] != L8W8JWT_REVOCATION_VERSION //
+        || header[12] != L8W8JWT_REVOCATION_PROBES //
+        || block_count == 0 //
+        || bloom_offset != L8W8JWT_REVOCATION_HEADER_SIZE //
+        || block_count > (size - bloom_offset) / L8W8JWT_REVOCATION_BLOCK_SIZE //
+        || fingerprints_offset != bloom_offset + block_count * L8W8JWT_REVOCATION_BLOCK_SIZE //
+        || entry_count > (size - fingerprints_offset) / 8 //
+    )
+    {
+        l8w8jwt_revocation_unmap(mapping);
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    mapping->bloom = mapping->base + bloom_offset;
+    mapping->fingerprints = mapping->base + fingerprints_offset;
+    mapping->block_count = block_count;
+    mapping->entry_count = entry_count;
+
+    atomic_init(&mapping->references, 1);
+
+    *out_mapping = mapping;
+    return L8W8JWT_SUCCESS;
+}
+
+static struct l8w8jwt_revocation_mapping* l8w8jwt_revocation_acquire(struct l8w8jwt_revocation_filter* filter)
+{
+    while (atomic_flag_test_and_set_explicit(&filter->lock, memory_order_acquire))
+    {
+    }
+
+    struct l8w8jwt_revocation_mapping* mapping = filter->current;
+    atomic_fetch_add_explicit(&mapping->references, 1, memory_order_relaxed);
+
+    atomic_flag_clear_explicit(&filter->lock, memory_order_release);
+    return mapping;
+}
+
+static void l8w8jwt_revocation_release(struct l8w8jwt_revocation_mapping* mapping)
+{
+    if (atomic_fetch_sub_explicit(&mapping->references, 1, memory_order_acq_rel) == 1)
+    {
+        l8w8jwt_revocation_unmap(mapping);
+    }
+}
+
+static int l8w8jwt_revocation_mapping_contains(const struct l8w8jwt_revocation_mapping* mapping, const unsigned char hash[32])
+{
+    const unsigned char* block = l8w8jwt_revocation_block((unsigned char*)mapping->bloom, mapping->block_count, hash);
+    const uint64_t probes = l8w8jwt_load64_le(hash + 16);
+
+    for (int k = 0; k < L8W8JWT_REVOCATION_PROBES; ++k)
+    {
+        const unsigned int bit = (unsigned int)(probes >> (9 * k)) & 511;
+
+        if (!(block[bit >> 3] & (1 << (bit & 7))))
+        {
+            return 0;
+        }
+    }
+
+    /* Probably revoked: the fingerprint section has the final word. */
+    const uint64_t fingerprint = l8w8jwt_load64_le(hash);
+
+    uint64_t lo = 0;
+    uint64_t hi = mapping->entry_count;
+
+    while (lo < hi)
+    {
+        const uint64_t mid = lo + (hi - lo) / 2;
+        const uint64_t value = l8w8jwt_load64_le(mapping->fingerprints + mid * 8);
+
+        if (value == fingerprint)
+        {
+            return 1;
+        }
+
+        if (value < fingerprint)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return 0;
+}
+
+int l8w8jwt_revocation_filter_open(const char* path, struct l8w8jwt_revocation_filter** out_revocation_filter)
+{
+    if (path == NULL || out_revocation_filter == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    struct l8w8jwt_revocation_filter* filter = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_revocation_filter));
+    if (filter == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    const size_t path_length = strlen(path);
+
+    filter->path = l8w8jwt_malloc(path_length + 1);
+    if (filter->path == NULL)
+    {
+        l8w8jwt_free(filter);
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    memcpy(filter->path, path, path_length + 1);
+    atomic_flag_clear(&filter->lock);
+
+    int r = l8w8jwt_revocation_map(path, &filter->current);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_free(filter->path);
+        l8w8jwt_free(filter);
+        return r;
+    }
+
+    *out_revocation_filter = filter;
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_revocation_filter_reload(struct l8w8jwt_revocation_filter* revocation_filter, const char* path)
+{
+    if (revocation_filter == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    struct l8w8jwt_revocation_mapping* mapping = NULL;
+
+    int r = l8w8jwt_revocation_map(path != NULL ? path : revocation_filter->path, &mapping);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        return r;
+    }
+
+    while (atomic_flag_test_and_set_explicit(&revocation_filter->lock, memory_order_acquire))
+    {
+    }
+
+    struct l8w8jwt_revocation_mapping* old_mapping = revocation_filter->current;
+    revocation_filter->current = mapping;
+
+    atomic_flag_clear_explicit(&revocation_filter->lock, memory_order_release);
+
+    /* Checks that still use the old mapping unmap it when they're done. */
+    l8w8jwt_revocation_release(old_mapping);
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_revocation_filter_check(struct l8w8jwt_revocation_filter* revocation_filter, const char* jti, const size_t jti_length, const char* iss, const size_t iss_length, const char* sub, const size_t sub_length)
+{
+    if (revocation_filter == NULL)
+    {
+        return 0;
+    }
+
+    unsigned char jti_hash[32];
+    unsigned char subject_hash[32];
+
+    const int check_jti = jti != NULL && l8w8jwt_revocation_hash(jti, jti_length, NULL, 0, NULL, 0, jti_hash) == 0;
+    const int check_subject = iss != NULL && sub != NULL && l8w8jwt_revocation_hash(NULL, 0, iss, iss_length, sub, sub_length, subject_hash) == 0;
+
+    if (!check_jti && !check_subject)
+    {
+        return 0;
+    }
+
+    struct l8w8jwt_revocation_mapping* mapping = l8w8jwt_revocation_acquire(revocation_filter);
+
+    const int revoked = (check_jti && l8w8jwt_revocation_mapping_contains(mapping, jti_hash)) || (check_subject && l8w8jwt_revocation_mapping_contains(mapping, subject_hash));
+
+    l8w8jwt_revocation_release(mapping);
+    return revoked;
+}
+
+size_t l8w8jwt_revocation_filter_get_entry_count(struct l8w8jwt_revocation_filter* revocation_filter)
+{
+    if (revocation_filter == NULL)
+    {
+        return 0;
+    }
+
+    struct l8w8jwt_revocation_mapping* mapping = l8w8jwt_revocation_acquire(revocation_filter);
+    const size_t entry_count = (size_t)mapping->entry_count;
+    l8w8jwt_revocation_release(mapping);
+
+    return entry_count;
+}
+
+void l8w8jwt_revocation_filter_free(struct l8w8jwt_revocation_filter* revocation_filter)
+{
+    if (revocation_filter == NULL)
+    {
+        return;
+    }
+
+    l8w8jwt_revocation_release(revocation_filter->current);
+    l8w8jwt_free(revocation_filter->path);
+    l8w8jwt_free(revocation_filter);
+}
+
+#else
+
+int l8w8jwt_revocation_filter_open(const char* path, struct l8w8jwt_revocation_filter** out_revocation_filter)
+{
+    (void)path;
+    (void)out_revocation_filter;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_revocation_filter_reload(struct l8w8jwt_revocation_filter* revocation_filter, const char* path)
+{
+    (void)revocation_filter;
+    (void)path;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+int l8w8jwt_revocation_filter_check(struct l8w8jwt_revocation_filter* revocation_filter, const char* jti, const size_t jti_length, const char* iss, const size_t iss_length, const char* sub, const size_t sub_length)
+{
+    (void)revocation_filter;
+    (void)jti;
+    (void)jti_length;
+    (void)iss;
+    (void)iss_length;
+    (void)sub;
+    (void)sub_length;
+    return 0;
+}
+
+size_t l8w8jwt_revocation_filter_get_entry_count(struct l8w8jwt_revocation_filter* revocation_filter)
+{
+    (void)revocation_filter;
+    return 0;
+}
+
+void l8w8jwt_revocation_filter_free(struct l8w8jwt_revocation_filter* revocation_filter)
+{
+    (void)revocation_filter;
+}
+
+#endif // L8W8JWT_REVOCATION_MMAP && !defined(__STDC_NO_ATOMICS__)
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,915 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "secp256k1.h"
+
+#if L8W8JWT_SECP256K1
+
+#include "ecc256.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <mbedtls/platform_util.h>
+
+/*
+ * Field elements (mod p) and scalars (mod n) are four little-endian 64-bit words.
+ * Field elements are kept in Montgomery form (a * 2^256 mod p) and always fully reduced, so they can be compared with memcmp.
+ */
+
+struct secp256k1_affine
+{
+    uint64_t x[4];
+    uint64_t y[4];
+};
+
+/* Homogeneous projective (x = X / Z, y = Y / Z) when signing, Jacobian (x = X / Z^2, y = Y / Z^3) when verifying. */
+struct secp256k1_point
+{
+    uint64_t X[4];
+    uint64_t Y[4];
+    uint64_t Z[4];
+};
+
+static const uint64_t secp256k1_p[4] = { 0xfffffffefffffc2fULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL };
+static const uint64_t secp256k1_n[4] = { 0xbfd25e8cd0364141ULL, 0xbaaedce6af48a03bULL, 0xfffffffffffffffeULL, 0xffffffffffffffffULL };
+
+/* -p^-1 mod 2^64 and -n^-1 mod 2^64 */
+#define SECP256K1_P_INV 0xd838091dd2253531ULL
+#define SECP256K1_N_INV 0x4b0dff665588b13fULL
+
+/* 2^512 mod p and 2^512 mod n (for converting into Montgomery form) */
+static const uint64_t secp256k1_p_rr[4] = { 0x000007a2000e90a1ULL, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL };
+static const uint64_t secp256k1_n_rr[4] = { 0x896cf21467d7d140ULL, 0x741496c20e7cf878ULL, 0xe697f5e45bcd07c6ULL, 0x9d671cd581c69bc5ULL };
+
+/* 1, b = 7 and 3b in Montgomery form (mod p), 1 in Montgomery form (mod n) */
+static const uint64_t secp256k1_p_one[4] = { 0x00000001000003d1ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL };
+static const uint64_t secp256k1_n_one[4] = { 0x402da1732fc9bebfULL, 0x4551231950b75fc4ULL, 0x0000000000000001ULL, 0x0000000000000000ULL };
+static const uint64_t secp256k1_b[4] = { 0x0000000700001ab7ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL };
+static const uint64_t secp256k1_b3[4] = { 0x0000001500005025ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL };
+
+/* p - n and (n - 1) / 2 */
+static const uint64_t secp256k1_p_minus_n[4] = { 0x402da1722fc9baeeULL, 0x4551231950b75fc4ULL, 0x0000000000000001ULL, 0x0000000000000000ULL };
+static const uint64_t secp256k1_n_half[4] = { 0xdfe92f46681b20a0ULL, 0x5d576e7357a4501dULL, 0xffffffffffffffffULL, 0x7fffffffffffffffULL };
+
+/*
+ * The endomorphism phi(x, y) = (beta * x, y) equals multiplication by lambda (beta^3 = 1 mod p, lambda^3 = 1 mod n).
+ * beta is in Montgomery form; the remaining constants are plain scalars for splitting k into k1 + k2 * lambda with |k1|, |k2| < 2^128
+ * (g1 and g2 are round(2^384 * b2 / n) and round(2^384 * -b1 / n) for the lattice basis (a1, b1), (a2, b2) of the GLV paper).
+ */
+static const uint64_t secp256k1_beta[4] = { 0x58a4361c8e81894eULL, 0x03fde1631c4b80afULL, 0xf8e98978d02e3905ULL, 0x7a4a36aebcbb3d53ULL };
+static const uint64_t secp256k1_minus_lambda[4] = { 0xe0cfc810b51283cfULL, 0xa880b9fc8ec739c2ULL, 0x5ad9e3fd77ed9ba4ULL, 0xac9c52b33fa3cf1fULL };
+static const uint64_t secp256k1_minus_b1[4] = { 0x6f547fa90abfe4c3ULL, 0xe4437ed6010e8828ULL, 0x0000000000000000ULL, 0x0000000000000000ULL };
+static const uint64_t secp256k1_minus_b2[4] = { 0xd765cda83db1562cULL, 0x8a280ac50774346dULL, 0xfffffffffffffffeULL, 0xffffffffffffffffULL };
+static const uint64_t secp256k1_g1[4] = { 0xe893209a45dbb031ULL, 0x3daa8a1471e8ca7fULL, 0xe86c90e49284eb15ULL, 0x3086d221a7d46bcdULL };
+static const uint64_t secp256k1_g2[4] = { 0x1571b4ae8ac47f71ULL, 0x221208ac9df506c6ULL, 0x6f547fa90abfe4c4ULL, 0xe4437ed6010e8828ULL };
+
+#include "secp256k1_precomp.h"
+
+static inline void fp_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mont_mul(r, a, b, secp256k1_p, SECP256K1_P_INV);
+}
+
+static inline void fp_add(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mod_add(r, a, b, secp256k1_p);
+}
+
+static inline void fp_sub(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mod_sub(r, a, b, secp256k1_p);
+}
+
+static inline void fp_neg(uint64_t r[4], const uint64_t a[4])
+{
+    fp_sub(r, (const uint64_t[4]){ 0 }, a);
+}
+
+/* r = a^-1 (Montgomery form in and out) */
+static void fp_inv(uint64_t r[4], const uint64_t a[4])
+{
+    static const uint64_t p_minus_2[4] = { 0xfffffffefffffc2dULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL };
+    l8w8jwt_ecc256_mont_pow(r, a, p_minus_2, secp256k1_p, SECP256K1_P_INV, secp256k1_p_one);
+}
+
+static inline void fn_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    mont_mul(r, a, b, secp256k1_n, SECP256K1_N_INV);
+}
+
+/* r = a^-1 * 2^256 mod n, for a in Montgomery form */
+static void fn_inv(uint64_t r[4], const uint64_t a[4])
+{
+    static const uint64_t n_minus_2[4] = { 0xbfd25e8cd036413fULL, 0xbaaedce6af48a03bULL, 0xfffffffffffffffeULL, 0xffffffffffffffffULL };
+    l8w8jwt_ecc256_mont_pow(r, a, n_minus_2, secp256k1_n, SECP256K1_N_INV, secp256k1_n_one);
+}
+
+/*
+ * Complete mixed addition for prime order short Weierstrass curves with a = 0
+ * (Renes, Costello, Batina: "Complete addition formulas for prime order elliptic curves", algorithm 8).
+ * Valid for all a (including the point at infinity (0 : 1 : 0) and b itself), so there are no secret-dependent branches.
+ */
+static void secp256k1_add_affine(struct secp256k1_point* r, const struct secp256k1_point* a, const struct secp256k1_affine* b)
+{
+    uint64_t t0[4], t1[4], t2[4], t3[4], t4[4], x3[4], y3[4], z3[4], u[4];
+
+    fp_mul(t0, a->X, b->x);
+    fp_mul(t1, a->Y, b->y);
+
+    fp_add(t3, b->x, b->y);
+    fp_add(u, a->X, a->Y);
+    fp_mul(t3, t3, u);
+    fp_add(u, t0, t1);
+    fp_sub(t3, t3, u);
+
+    fp_mul(t4, b->y, a->Z);
+    fp_add(t4, t4, a->Y);
+
+    fp_mul(y3, b->x, a->Z);
+    fp_add(y3, y3, a->X);
+
+    fp_add(u, t0, t0);
+    fp_add(t0, u, t0);
+    fp_mul(t2, secp256k1_b3, a->Z);
+    fp_add(z3, t1, t2);
+    fp_sub(t1, t1, t2);
+    fp_mul(y3, secp256k1_b3, y3);
+
+    fp_mul(x3, t4, y3);
+    fp_mul(u, t3, t1);
+    fp_sub(x3, u, x3);
+
+    fp_mul(y3, y3, t0);
+    fp_mul(u, t1, z3);
+    fp_add(y3, u, y3);
+
+    fp_mul(t0, t0, t3);
+    fp_mul(z3, z3, t4);
+    fp_add(z3, z3, t0);
+
+    memcpy(r->X, x3, sizeof(x3));
+    memcpy(r->Y, y3, sizeof(y3));
+    memcpy(r->Z, z3, sizeof(z3));
+}
+
+static inline void secp256k1_point_cmov(struct secp256k1_point* r, const struct secp256k1_point* a, const uint64_t mask)
+{
+    words_cmov(r->X, a->X, mask);
+    words_cmov(r->Y, a->Y, mask);
+    words_cmov(r->Z, a->Z, mask);
+}
+
+/* Splits a scalar into 65 signed radix-16 digits in [-8, 8). */
+static void secp256k1_recode(signed char e[65], const uint64_t k[4])
+{
+    signed char carry = 0;
+
+    for (int i = 0; i < 64; ++i)
+    {
+        e[i] = (signed char)((k[i / 16] >> (4 * (i % 16))) & 15);
+    }
+
+    for (int i = 0; i < 64; ++i)
+    {
+        e[i] = (signed char)(e[i] + carry);
+        carry = (signed char)((e[i] + 8) >> 4);
+        e[i] = (signed char)(e[i] - carry * 16);
+    }
+
+    e[64] = carry;
+}
+
+/* Constant-time lookup of |d| * 16^row * G (negated if d < 0); returns an all-ones mask if d == 0 (nothing to add). */
+static uint64_t secp256k1_select_base(struct secp256k1_affine* t, const int row, const signed char d)
+{
+    const int64_t sign_mask = (int64_t)d >> 63;
+    const uint64_t abs_d = (uint64_t)(((int64_t)d ^ sign_mask) - sign_mask);
+    uint64_t neg_y[4];
+
+    memset(t, 0x00, sizeof(struct secp256k1_affine));
+
+    for (uint64_t i = 0; i < 8; ++i)
+    {
+        const uint64_t mask = (uint64_t)0 - (uint64_t)(((abs_d ^ (i + 1)) - 1) >> 63);
+        words_cmov(t->x, l8w8jwt_secp256k1_base[row][i].x, mask);
+        words_cmov(t->y, l8w8jwt_secp256k1_base[row][i].y, mask);
+    }
+
+    fp_neg(neg_y, t->y);
+    words_cmov(t->y, neg_y, (uint64_t)sign_mask);
+
+    return (uint64_t)0 - (uint64_t)((abs_d - 1) >> 63);
+}
+
+/* r = k * G in homogeneous projective coordinates (constant time) */
+static void secp256k1_mul_base(struct secp256k1_point* r, const uint64_t k[4])
+{
+    signed char e[65];
+    struct secp256k1_affine t;
+    struct secp256k1_point sum;
+
+    secp256k1_recode(e, k);
+
+    memset(r, 0x00, sizeof(struct secp256k1_point));
+    memcpy(r->Y, secp256k1_p_one, sizeof(r->Y));
+
+    for (int i = 0; i < 65; ++i)
+    {
+        const uint64_t skip = secp256k1_select_base(&t, i, e[i]);
+        secp256k1_add_affine(&sum, r, &t);
+        secp256k1_point_cmov(r, &sum, ~skip);
+    }
+
+    mbedtls_platform_zeroize(e, sizeof(e));
+    mbedtls_platform_zeroize(&t, sizeof(t));
+    mbedtls_platform_zeroize(&sum, sizeof(sum));
+}
+
+/*
+ * Variable-time Jacobian arithmetic for verification, where everything is public
+ * ("dbl-2009-l", "add-2007-bl" and "madd-2007-bl" from the EFD). Z == 0 is the point at infinity.
+ */
+
+static void secp256k1_jacobian_dbl(struct secp256k1_point* r, const struct secp256k1_point* a)
+{
+    uint64_t A[4], B[4], C[4], D[4], E[4], t0[4];
+
+    fp_mul(A, a->X, a->X);
+    fp_mul(B, a->Y, a->Y);
+    fp_mul(C, B, B);
+
+    fp_add(t0, a->X, B);
+    fp_mul(t0, t0, t0);
+    fp_sub(t0, t0, A);
+    fp_sub(t0, t0, C);
+    fp_add(D, t0, t0);
+
+    fp_add(E, A, A);
+    fp_add(E, E, A);
+
+    fp_mul(r->Z, a->Y, a->Z);
+    fp_add(r->Z, r->Z, r->Z);
+
+    fp_mul(t0, E, E);
+    fp_sub(t0, t0, D);
+    fp_sub(r->X, t0, D);
+
+    fp_sub(t0, D, r->X);
+    fp_mul(t0, E, t0);
+    fp_add(C, C, C);
+    fp_add(C, C, C);
+    fp_add(C, C, C); // 8 * C
+    fp_sub(r->Y, t0, C);
+}
+
+static void secp256k1_jacobian_add(struct secp256k1_point* r, const struct secp256k1_point* a, const struct secp256k1_point* b)
+{
+    uint64_t z1z1[4], z2z2[4], u1[4], u2[4], s1[4], s2[4], h[4], i[4], j[4], rr[4], v[4], t0[4];
+
+    if (words_is_zero(a->Z))
+    {
+        *r = *b;
+        return;
+    }
+
+    if (words_is_zero(b->Z))
+    {
+        *r = *a;
+        return;
+    }
+
+    fp_mul(z1z1, a->Z, a->Z);
+    fp_mul(z2z2, b->Z, b->Z);
+    fp_mul(u1, a->X, z2z2);
+    fp_mul(u2, b->X, z1z1);
+    fp_mul(s1, a->Y, b->Z);
+    fp_mul(s1, s1, z2z2);
+    fp_mul(s2, b->Y, a->Z);
+    fp_mul(s2, s2, z1z1);
+
+    fp_sub(h, u2, u1);
+    fp_sub(rr, s2, s1);
+
+    if (words_is_zero(h))
+    {
+        if (words_is_zero(rr))
+        {
+            secp256k1_jacobian_dbl(r, a);
+            return;
+        }
+
+        memset(r, 0x00, sizeof(struct secp256k1_point));
+        return;
+    }
+
+    fp_add(i, h, h);
+    fp_mul(i, i, i);
+    fp_mul(j, h, i);
+    fp_add(rr, rr, rr);
+    fp_mul(v, u1, i);
+
+    fp_add(t0, a->Z, b->Z);
+    fp_mul(t0, t0, t0);
+    fp_sub(t0, t0, z1z1);
+    fp_sub(t0, t0, z2z2);
+    fp_mul(r->Z, t0, h);
+
+    fp_mul(r->X, rr, rr);
+    fp_sub(r->X, r->X, j);
+    fp_sub(r->X, r->X, v);
+    fp_sub(r->X, r->X, v);
+
+    fp_sub(t0, v, r->X);
+    fp_mul(t0, rr, t0);
+    fp_mul(s1, s1, j);
+    fp_add(s1, s1, s1);
+    fp_sub(r->Y, t0, s1);
+}
+
+/* r = a + (x, y) for an affine point (x, y) */
+static void secp256k1_jacobian_add_affine(struct secp256k1_point* r, const struct secp256k1_point* a, const uint64_t x[4], const uint64_t y[4])
+{
+    uint64_t z1z1[4], u2[4], s2[4], h[4], hh[4], i[4], j[4], rr[4], v[4], t0[4];
+
+    if (words_is_zero(a->Z))
+    {
+        memcpy(r->X, x, sizeof(r->X));
+        memcpy(r->Y, y, sizeof(r->Y));
+        memcpy(r->Z, secp256k1_p_one, sizeof(r->Z));
+        return;
+    }
+
+    fp_mul(z1z1, a->Z, a->Z);
+    fp_mul(u2, x, z1z1);
+    fp_mul(s2, y, a->Z);
+    fp_mul(s2, s2, z1z1);
+
+    fp_sub(h, u2, a->X);
+    fp_sub(rr, s2, a->Y);
+
+    if (words_is_zero(h))
+    {
+        if (words_is_zero(rr))
+        {
+            secp256k1_jacobian_dbl(r, a);
+            return;
+        }
+
+        memset(r, 0x00, sizeof(struct secp256k1_point));
+        return;
+    }
+
+    fp_mul(hh, h, h);
+    fp_add(i, hh, hh);
+    fp_add(i, i, i);
+    fp_mul(j, h, i);
+    fp_add(rr, rr, rr);
+    fp_mul(v, a->X, i);
+
+    fp_add(t0, a->Z, h);
+    fp_mul(t0, t0, t0);
+    fp_sub(t0, t0, z1z1);
+    fp_sub(r->Z, t0, hh);
+
+    fp_mul(t0, a->Y, j);
+    fp_add(t0, t0, t0);
+
+    fp_mul(r->X, rr, rr);
+    fp_sub(r->X, r->X, j);
+    fp_sub(r->X, r->X, v);
+    fp_sub(r->X, r->X, v);
+
+    fp_sub(v, v, r->X);
+    fp_mul(v, rr, v);
+    fp_sub(r->Y, v, t0);
+}
+
+/* r = round(k * g / 2^384), for the GLV split */
+static void secp256k1_mul_shift_384(uint64_t r[4], const uint64_t k[4], const uint64_t g[4])
+{
+    uint64_t t[8] = { 0 };
+
+    for (int i = 0; i < 4; ++i)
+    {
+        uint64_t carry = 0;
+        for (int j = 0; j < 4; ++j)
+        {
+            carry = mac(&t[i + j], t[i + j], k[i], g[j], carry);
+        }
+        t[i + 4] = carry;
+    }
+
+    const uint64_t round = t[5] >> 63;
+    uint64_t carry = adc(&r[0], t[6], round, 0);
+    carry = adc(&r[1], t[7], 0, carry);
+    r[2] = carry;
+    r[3] = 0;
+}
+
+/*
+ * Splits k into k1 + k2 * lambda (mod n), with both halves returned as magnitudes below 2^128 and their signs in neg1 and neg2
+ * (Gallant, Lambert, Vanstone: "Faster point multiplication on elliptic curves with efficient endomorphisms").
+ */
+static void secp256k1_split(uint64_t k1[4], int* neg1, uint64_t k2[4], int* neg2, const uint64_t k[4])
+{
+    uint64_t c1[4], c2[4], t[4];
+
+    secp256k1_mul_shift_384(c1, k, secp256k1_g1);
+    secp256k1_mul_shift_384(c2, k, secp256k1_g2);
+
+    // k2 = c1 * -b1 + c2 * -b2, k1 = k - k2 * lambda (Montgomery multiplication with one operand in Montgomery form yields plain products).
+    fn_mul(c1, c1, secp256k1_n_rr);
+    fn_mul(c1, c1, secp256k1_minus_b1);
+    fn_mul(c2, c2, secp256k1_n_rr);
+    fn_mul(c2, c2, secp256k1_minus_b2);
+    mod_add(k2, c1, c2, secp256k1_n);
+
+    fn_mul(t, k2, secp256k1_n_rr);
+    fn_mul(t, t, secp256k1_minus_lambda);
+    mod_add(k1, k, t, secp256k1_n);
+
+    *neg1 = words_lt(secp256k1_n_half, k1);
+    if (*neg1)
+    {
+        mod_sub(k1, (const uint64_t[4]){ 0 }, k1, secp256k1_n);
+    }
+
+    *neg2 = words_lt(secp256k1_n_half, k2);
+    if (*neg2)
+    {
+        mod_sub(k2, (const uint64_t[4]){ 0 }, k2, secp256k1_n);
+    }
+}
+
+/* Width-w NAF of a scalar below 2^129: odd digits in (-2^(w-1), 2^(w-1)), at least w - 1 zeros between two nonzero ones. */
+static void secp256k1_wnaf(signed char naf[130], const uint64_t k[4], const int w)
+{
+    int carry = 0;
+
+    memset(naf, 0x00, 130);
+
+    for (int bit = 0; bit < 130;)
+    {
+        if ((int)((k[bit / 64] >> (bit % 64)) & 1) == carry)
+        {
+            ++bit;
+            continue;
+        }
+
+        int width = w < 130 - bit ? w : 130 - bit;
+
+        // The window may straddle two words (bit + width <= 135, which still lies within k).
+        uint64_t bits = k[bit / 64] >> (bit % 64);
+        if (bit % 64 + width > 64)
+        {
+            bits |= k[bit / 64 + 1] << (64 - bit % 64);
+        }
+
+        int digit = (int)(bits & (((uint64_t)1 << width) - 1)) + carry;
+        carry = (digit >> (w - 1)) & 1;
+        digit -= carry << w;
+
+        naf[bit] = (signed char)digit;
+        bit += width;
+    }
+}
+
+/* Adds the odd multiple |d| * P from a table of Jacobian points P, 3P, 5P, ... (negated if d < 0, or if neg is set). */
+static inline void secp256k1_add_digit(struct secp256k1_point* acc, const struct secp256k1_point* table, const int d, const int neg)
+{
+    struct secp256k1_point t = table[(d < 0 ? -d : d) / 2];
+
+    if ((d < 0) != neg)
+    {
+        fp_neg(t.Y, t.Y);
+    }
+
+    secp256k1_jacobian_add(acc, acc, &t);
+}
+
+/* Like secp256k1_add_digit(), but with l8w8jwt_secp256k1_base_odd as the table (phi(P) instead of P if endo is set). */
+static inline void secp256k1_add_base_digit(struct secp256k1_point* acc, const int d, const int neg, const int endo)
+{
+    const struct secp256k1_affine* t = &l8w8jwt_secp256k1_base_odd[(d < 0 ? -d : d) / 2];
+    uint64_t x[4], y[4];
+
+    if (endo)
+    {
+        fp_mul(x, t->x, secp256k1_beta);
+    }
+    else
+    {
+        memcpy(x, t->x, sizeof(x));
+    }
+
+    if ((d < 0) != neg)
+    {
+        fp_neg(y, t->y);
+    }
+    else
+    {
+        memcpy(y, t->y, sizeof(y));
+    }
+
+    secp256k1_jacobian_add_affine(acc, acc, x, y);
+}
+
+/*
+ * r = u1 * G + u2 * Q in Jacobian coordinates (variable time: only used for verification, where everything is public). <p>
+ * Both scalars are split into 128-bit halves, so that one pass of ~129 doublings over the four interleaved wNAFs
+ * (width 8 for G and phi(G) from the precomputed table, width 5 for Q and phi(Q)) replaces two full 256-bit multiplications.
+ */
+static void secp256k1_mul_double_vartime(struct secp256k1_point* r, const uint64_t u1[4], const uint64_t u2[4], const struct secp256k1_point* q)
+{
+    signed char naf_g1[130], naf_g2[130], naf_q1[130], naf_q2[130];
+    struct secp256k1_point table_q[8], table_phi_q[8]; // Q, 3Q, 5Q, ..., 15Q (and their images under phi)
+    struct secp256k1_point q2;
+    uint64_t a1[4], a2[4], b1[4], b2[4];
+    int neg_a1, neg_a2, neg_b1, neg_b2;
+    int i;
+
+    secp256k1_split(a1, &neg_a1, a2, &neg_a2, u1);
+    secp256k1_split(b1, &neg_b1, b2, &neg_b2, u2);
+
+    secp256k1_wnaf(naf_g1, a1, 8);
+    secp256k1_wnaf(naf_g2, a2, 8);
+    secp256k1_wnaf(naf_q1, b1, 5);
+    secp256k1_wnaf(naf_q2, b2, 5);
+
+    table_q[0] = *q;
+    secp256k1_jacobian_dbl(&q2, q);
+    for (i = 1; i < 8; ++i)
+    {
+        secp256k1_jacobian_add(&table_q[i], &table_q[i - 1], &q2);
+    }
+
+    // phi(X : Y : Z) = (beta * X : Y : Z) in Jacobian coordinates too.
+    for (i = 0; i < 8; ++i)
+    {
+        table_phi_q[i] = table_q[i];
+        fp_mul(table_phi_q[i].X, table_q[i].X, secp256k1_beta);
+    }
+
+    memset(r, 0x00, sizeof(struct secp256k1_point));
+
+    for (i = 129; i >= 0 && !(naf_g1[i] | naf_g2[i] | naf_q1[i] | naf_q2[i]); --i)
+    {
+    }
+
+    for (; i >= 0; --i)
+    {
+        secp256k1_jacobian_dbl(r, r);
+
+        if (naf_g1[i])
+        {
+            secp256k1_add_base_digit(r, naf_g1[i], neg_a1, 0);
+        }
+
+        if (naf_g2[i])
+        {
+            secp256k1_add_base_digit(r, naf_g2[i], neg_a2, 1);
+        }
+
+        if (naf_q1[i])
+        {
+            secp256k1_add_digit(r, table_q, naf_q1[i], neg_b1);
+        }
+
+        if (naf_q2[i])
+        {
+            secp256k1_add_digit(r, table_phi_q, naf_q2[i], neg_b2);
+        }
+    }
+}
+
+/* Reduces a big-endian hash into a scalar mod n (ES256K hashes are exactly as long as n, so no truncation is needed). */
+static inline void secp256k1_hash_to_scalar(uint64_t e[4], const unsigned char hash[32])
+{
+    words_from_bytes(e, hash);
+    mod_reduce_once(e, e, 0, secp256k1_n);
+}
+
+/* Parses and validates an uncompressed public key (big-endian x || y) into Montgomery form with Z = 1. Returns 0 if it's a point on the curve. */
+static int secp256k1_load_public_key(struct secp256k1_point* q, const unsigned char public_key[64])
+{
+    uint64_t t0[4], t1[4];
+
+    words_from_bytes(q->X, public_key);
+    words_from_bytes(q->Y, public_key + 32);
+
+    if (!words_lt(q->X, secp256k1_p) || !words_lt(q->Y, secp256k1_p))
+    {
+        return 1;
+    }
+
+    fp_mul(q->X, q->X, secp256k1_p_rr);
+    fp_mul(q->Y, q->Y, secp256k1_p_rr);
+    memcpy(q->Z, secp256k1_p_one, sizeof(q->Z));
+
+    // y^2 = x^3 + 7
+    fp_mul(t0, q->Y, q->Y);
+    fp_mul(t1, q->X, q->X);
+    fp_mul(t1, t1, q->X);
+    fp_add(t1, t1, secp256k1_b);
+
+    return memcmp(t0, t1, sizeof(t0)) != 0;
+}
+
+/* Parses the signature and computes u1 = e / s and u2 = r / s. Returns 0 if r and s are both in [1, n - 1]. */
+static int secp256k1_verify_scalars(uint64_t sig_r[4], uint64_t u1[4], uint64_t u2[4], const unsigned char hash[32], const unsigned char signature[64])
+{
+    uint64_t e[4], sig_s[4], w[4];
+
+    words_from_bytes(sig_r, signature);
+    words_from_bytes(sig_s, signature + 32);
+
+    if (words_is_zero(sig_r) || words_is_zero(sig_s) || !words_lt(sig_r, secp256k1_n) || !words_lt(sig_s, secp256k1_n))
+    {
+        return 1;
+    }
+
+    secp256k1_hash_to_scalar(e, hash);
+    fn_mul(w, sig_s, secp256k1_n_rr);
+    fn_inv(w, w);
+    fn_mul(u1, e, w);
+    fn_mul(u2, sig_r, w);
+
+    return 0;
+}
+
+/*
+ * Checks the result of u1 * G + u2 * Q (with x = X / z, i.e. z = Z for projective and z = Z^2 for Jacobian coordinates) against r.
+ * Instead of inverting z, this checks whether X == r * z (or (r + n) * z, if r + n is still a field element). Returns 0 if the signature is valid.
+ */
+static int secp256k1_verify_finish(const uint64_t sig_r[4], const uint64_t X[4], const uint64_t z[4])
+{
+    uint64_t t[4];
+
+    fp_mul(t, sig_r, secp256k1_p_rr);
+    fp_mul(t, t, z);
+    if (memcmp(t, X, sizeof(t)) == 0)
+    {
+        return 0;
+    }
+
+    if (words_lt(sig_r, secp256k1_p_minus_n))
+    {
+        mod_add(t, sig_r, secp256k1_n, secp256k1_p);
+        fp_mul(t, t, secp256k1_p_rr);
+        fp_mul(t, t, z);
+        if (memcmp(t, X, sizeof(t)) == 0)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+int l8w8jwt_secp256k1_sign(unsigned char signature[64], const unsigned char private_key[32], const unsigned char hash[32], int (*f_rng)(void*, unsigned char*, size_t), void* p_rng)
+{
+    int r = -1;
+    uint64_t d[4], e[4], k[4], k_inv[4], sig_r[4], sig_s[4], t[4];
+    unsigned char k_bytes[32];
+    struct secp256k1_point kg;
+
+    words_from_bytes(d, private_key);
+    if (words_is_zero(d) || !words_lt(d, secp256k1_n) || f_rng == NULL)
+    {
+        goto exit;
+    }
+
+    secp256k1_hash_to_scalar(e, hash);
+
+    for (int attempt = 0; attempt < 16; ++attempt)
+    {
+        if (f_rng(p_rng, k_bytes, sizeof(k_bytes)) != 0)
+        {
+            goto exit;
+        }
+
+        words_from_bytes(k, k_bytes);
+        if (words_is_zero(k) || !words_lt(k, secp256k1_n))
+        {
+            continue;
+        }
+
+        // r = x(k * G) mod n
+        secp256k1_mul_base(&kg, k);
+        fp_inv(t, kg.Z);
+        fp_mul(t, kg.X, t);
+        fp_mul(t, t, (const uint64_t[4]){ 1, 0, 0, 0 }); // out of Montgomery form
+        mod_reduce_once(sig_r, t, 0, secp256k1_n);
+
+        if (words_is_zero(sig_r))
+        {
+            continue;
+        }
+
+        // s = k^-1 * (e + r * d) mod n
+        fn_mul(k_inv, k, secp256k1_n_rr);
+        fn_inv(k_inv, k_inv);
+        fn_mul(t, sig_r, secp256k1_n_rr);
+        fn_mul(t, t, d);
+        mod_add(t, t, e, secp256k1_n);
+        fn_mul(sig_s, t, k_inv);
+
+        if (words_is_zero(sig_s))
+        {
+            continue;
+        }
+
+        words_to_bytes(signature, sig_r);
+        words_to_bytes(signature + 32, sig_s);
+        r = 0;
+        break;
+    }
+
+exit:
+    mbedtls_platform_zeroize(d, sizeof(d));
+    mbedtls_platform_zeroize(k, sizeof(k));
+    mbedtls_platform_zeroize(k_inv, sizeof(k_inv));
+    mbedtls_platform_zeroize(k_bytes, sizeof(k_bytes));
+    mbedtls_platform_zeroize(t, sizeof(t));
+    mbedtls_platform_zeroize(&kg, sizeof(kg));
+    return r;
+}
+
+int l8w8jwt_secp256k1_sign_deterministic(unsigned char signature[64], const unsigned char private_key[32], const unsigned char hash[32])
+{
+    int r;
+    uint64_t e[4];
+    unsigned char h1[32];
+    struct l8w8jwt_rfc6979 rfc6979;
+
+    // bits2octets(h1): the hash reduced mod n.
+    secp256k1_hash_to_scalar(e, hash);
+    words_to_bytes(h1, e);
+
+    r = l8w8jwt_rfc6979_init(&rfc6979, private_key, h1);
+
+    if (r == 0)
+    {
+        r = l8w8jwt_secp256k1_sign(signature, private_key, hash, &l8w8jwt_rfc6979_generate, &rfc6979);
+    }
+
+    mbedtls_platform_zeroize(&rfc6979, sizeof(rfc6979));
+    mbedtls_platform_zeroize(h1, sizeof(h1));
+    return r;
+}
+
+int l8w8jwt_secp256k1_verify(const unsigned char public_key[64], const unsigned char hash[32], const unsigned char signature[64])
+{
+    uint64_t sig_r[4], u1[4], u2[4], zz[4];
+    struct secp256k1_point q, a;
+
+    if (secp256k1_verify_scalars(sig_r, u1, u2, hash, signature) != 0 || secp256k1_load_public_key(&q, public_key) != 0)
+    {
+        return 1;
+    }
+
+    secp256k1_mul_double_vartime(&a, u1, u2, &q);
+
+    if (words_is_zero(a.Z))
+    {
+        return 1;
+    }
+
+    fp_mul(zz, a.Z, a.Z);
+    return secp256k1_verify_finish(sig_r, a.X, zz);
+}
+
+/* Converts 8 Jacobian points (none of them at infinity) to affine coordinates with a single field inversion (Montgomery's trick). */
+static void secp256k1_jacobian_to_affine_8(struct secp256k1_affine r[8], const struct secp256k1_point p[8])
+{
+    uint64_t c[8][4], inv[4], z_inv[4], z_inv2[4];
+
+    memcpy(c[0], p[0].Z, sizeof(c[0]));
+    for (int i = 1; i < 8; ++i)
+    {
+        fp_mul(c[i], c[i - 1], p[i].Z);
+    }
+
+    fp_inv(inv, c[7]);
+
+    for (int i = 7; i >= 0; --i)
+    {
+        if (i > 0)
+        {
+            fp_mul(z_inv, inv, c[i - 1]);
+            fp_mul(inv, inv, p[i].Z);
+        }
+        else
+        {
+            memcpy(z_inv, inv, sizeof(z_inv));
+        }
+
+        fp_mul(z_inv2, z_inv, z_inv);
+        fp_mul(r[i].x, p[i].X, z_inv2);
+        fp_mul(z_inv2, z_inv2, z_inv);
+        fp_mul(r[i].y, p[i].Y, z_inv2);
+    }
+}
+
+int l8w8jwt_secp256k1_precompute(void* table, const unsigned char public_key[64])
+{
+    struct secp256k1_affine(*rows)[8] = (struct secp256k1_affine(*)[8])table;
+    struct secp256k1_point q, row[8];
+
+    if (secp256k1_load_public_key(&q, public_key) != 0)
+    {
+        return 1;
+    }
+
+    // Row i holds (j + 1) * 16^i * Q, just like l8w8jwt_secp256k1_base does for G.
+    for (int i = 0; i < 65; ++i)
+    {
+        row[0] = q;
+        secp256k1_jacobian_dbl(&row[1], &q);
+        for (int j = 2; j < 8; ++j)
+        {
+            secp256k1_jacobian_add(&row[j], &row[j - 1], &q);
+        }
+
+        secp256k1_jacobian_dbl(&q, &row[7]);
+        secp256k1_jacobian_to_affine_8(rows[i], row);
+    }
+
+    return 0;
+}
+
+/* Adds the table entry for the signed radix-16 digit d of row (d != 0), using the complete formulas. */
+static inline void secp256k1_add_row_digit(struct secp256k1_point* r, const struct secp256k1_affine row[8], const signed char d)
+{
+    struct secp256k1_affine t = row[(d < 0 ? -d : d) - 1];
+
+    if (d < 0)
+    {
+        fp_neg(t.y, t.y);
+    }
+
+    secp256k1_add_affine(r, r, &t);
+}
+
+int l8w8jwt_secp256k1_verify_precomputed(const void* table, const unsigned char hash[32], const unsigned char signature[64])
+{
+    const struct secp256k1_affine(*rows)[8] = (const struct secp256k1_affine(*)[8])table;
+    uint64_t sig_r[4], u1[4], u2[4];
+    signed char e1[65], e2[65];
+    struct secp256k1_point a;
+
+    if (secp256k1_verify_scalars(sig_r, u1, u2, hash, signature) != 0)
+    {
+        return 1;
+    }
+
+    // Both u1 * G and u2 * Q are fixed-base multiplications now: no doublings at all, just (at most) 130 mixed additions.
+    secp256k1_recode(e1, u1);
+    secp256k1_recode(e2, u2);
+
+    memset(&a, 0x00, sizeof(a));
+    memcpy(a.Y, secp256k1_p_one, sizeof(a.Y));
+
+    for (int i = 0; i < 65; ++i)
+    {
+        if (e1[i] != 0)
+        {
+            secp256k1_add_row_digit(&a, l8w8jwt_secp256k1_base[i], e1[i]);
+        }
+
+        if (e2[i] != 0)
+        {
+            secp256k1_add_row_digit(&a, rows[i], e2[i]);
+        }
+    }
+
+    if (words_is_zero(a.Z))
+    {
+        return 1;
+    }
+
+    return secp256k1_verify_finish(sig_r, a.X, a.Z);
+}
+
+#endif // L8W8JWT_SECP256K1
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
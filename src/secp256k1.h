@@ -0,0 +1,108 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file secp256k1.h
+ *  @author Raphael Beck
+ *  @brief Dedicated ECDSA over secp256k1 (fixed 64-bit limbs, GLV endomorphism for verification), used for ES256K. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_SECP256K1_H
+#define L8W8JWT_SECP256K1_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#ifndef L8W8JWT_ENABLE_SECP256K1_ENGINE
+/**
+ * Set this to \c 0 to always sign and verify ES256K tokens through MbedTLS' generic <code>mbedtls_ecdsa_sign</code>/<code>mbedtls_ecdsa_verify</code>. <p>
+ * Otherwise, the MbedTLS crypto provider hands ES256K to l8w8jwt's own secp256k1 implementation: constant-time signing with precomputed base point tables,
+ * and verification that splits both scalars into 128-bit halves using the curve's efficiently computable endomorphism (GLV) and evaluates all four halves in one interleaved wNAF pass.
+ * Like the P-256 engine, this needs <code>unsigned __int128</code> (GCC/Clang on 64-bit targets; other compilers silently keep using MbedTLS).
+ */
+#define L8W8JWT_ENABLE_SECP256K1_ENGINE 1
+#endif
+
+#if L8W8JWT_ENABLE_SECP256K1_ENGINE && defined(__SIZEOF_INT128__)
+#define L8W8JWT_SECP256K1 1
+#else
+#define L8W8JWT_SECP256K1 0
+#endif
+
+#if L8W8JWT_SECP256K1
+
+/**
+ * Creates an ECDSA secp256k1 signature over a 32-byte hash.
+ * @param signature Where to write the raw 64-byte signature (<code>r || s</code>, big-endian) into.
+ * @param private_key The 32-byte big-endian private scalar (must be in <code>[1, n - 1]</code>).
+ * @param hash The 32-byte SHA-256 digest to sign.
+ * @param f_rng RNG function for the per-signature nonce (e.g. <code>mbedtls_ctr_drbg_random</code>).
+ * @param p_rng RNG context passed to \p f_rng
+ * @return <code>0</code> on success; anything else on failure (invalid private key or RNG failure).
+ */
+int l8w8jwt_secp256k1_sign(unsigned char signature[64], const unsigned char private_key[32], const unsigned char hash[32], int (*f_rng)(void*, unsigned char*, size_t), void* p_rng);
+
+/**
+ * Creates a deterministic ECDSA secp256k1 signature over a 32-byte hash (RFC 6979 nonce, HMAC-SHA-256).
+ * @param signature Where to write the raw 64-byte signature (<code>r || s</code>, big-endian) into.
+ * @param private_key The 32-byte big-endian private scalar (must be in <code>[1, n - 1]</code>).
+ * @param hash The 32-byte SHA-256 digest to sign.
+ * @return <code>0</code> on success; anything else on failure (invalid private key).
+ */
+int l8w8jwt_secp256k1_sign_deterministic(unsigned char signature[64], const unsigned char private_key[32], const unsigned char hash[32]);
+
+/**
+ * Verifies an ECDSA secp256k1 signature over a 32-byte hash.
+ * @param public_key The 64-byte uncompressed public key (big-endian <code>x || y</code>, without the leading <code>0x04</code>).
+ * @param hash The 32-byte SHA-256 digest that was signed.
+ * @param signature The raw 64-byte signature (<code>r || s</code>, big-endian).
+ * @return <code>0</code> if the signature is valid; anything else if it isn't (or if the public key is not a point on the curve).
+ */
+int l8w8jwt_secp256k1_verify(const unsigned char public_key[64], const unsigned char hash[32], const unsigned char signature[64]);
+
+/**
+ * Size (in bytes) of the precomputed public key table that {@link #l8w8jwt_secp256k1_precompute} fills in.
+ */
+#define L8W8JWT_SECP256K1_TABLE_SIZE (65 * 8 * 64)
+
+/**
+ * Precomputes multiples of a public key (the same radix-16 comb table that the engine has built in for the base point),
+ * so that {@link #l8w8jwt_secp256k1_verify_precomputed} can do both halves of a verification as fixed-base multiplications.
+ * @param table Where to write the table into: {@link #L8W8JWT_SECP256K1_TABLE_SIZE} bytes, aligned for <code>uint64_t</code> (e.g. straight from malloc).
+ * @param public_key The 64-byte uncompressed public key (big-endian <code>x || y</code>, without the leading <code>0x04</code>).
+ * @return <code>0</code> on success; anything else if the public key is not a point on the curve.
+ */
+int l8w8jwt_secp256k1_precompute(void* table, const unsigned char public_key[64]);
+
+/**
+ * Verifies an ECDSA secp256k1 signature over a 32-byte hash using a public key table from {@link #l8w8jwt_secp256k1_precompute}.
+ * @param table The precomputed public key table.
+ * @param hash The 32-byte SHA-256 digest that was signed.
+ * @param signature The raw 64-byte signature (<code>r || s</code>, big-endian).
+ * @return <code>0</code> if the signature is valid; anything else if it isn't.
+ */
+int l8w8jwt_secp256k1_verify_precomputed(const void* table, const unsigned char hash[32], const unsigned char signature[64]);
+
+#endif // L8W8JWT_SECP256K1
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_SECP256K1_H
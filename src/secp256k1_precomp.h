@@ -0,0 +1,748 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file secp256k1_precomp.h
+ *  @author Raphael Beck
+ *  @brief Precomputed multiples of the secp256k1 base point, used by secp256k1.c. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_SECP256K1_PRECOMP_H
+#define L8W8JWT_SECP256K1_PRECOMP_H
+
+/* Generated: l8w8jwt_secp256k1_base[i][j] = (j + 1) * 16^i * G (affine, Montgomery form). */
+static const struct secp256k1_affine l8w8jwt_secp256k1_base[65][8] = {
+    {
+        { { 0xd7362e5a487e2097ULL, 0x231e295329bc66dbULL, 0x979f48c033fd129cULL, 0x9981e643e9089f48ULL }, { 0xb15ea6d2d3dbabe2ULL, 0x8dfc5d5d1f1dc64dULL, 0x70b6b59aac19c136ULL, 0xcf3f851fd4a582d6ULL } },
+        { { 0x4e0640c981048d2cULL, 0x71354afc88b285a0ULL, 0xce0b62e1e0140404ULL, 0xf918623ccba0ee23ULL }, { 0x7d12d622ffaccfbfULL, 0x84fd25167dc75ce1ULL, 0x4b3a0f64bda2cc65ULL, 0x3c7f7712157b9313ULL } },
+        { { 0x2379d4bbd5fea781ULL, 0x066ceafb22eb7bc4ULL, 0x5940d07385985972ULL, 0x9497730fcdf4c0adULL }, { 0xaf18b0b0613f55a9ULL, 0xac4964cdc5a1f91fULL, 0xcc6048bd84885650ULL, 0x3ec28dcd9215ec76ULL } },
+        { { 0x3daa13e8af6a0bfdULL, 0x37571e4d3b9b132fULL, 0xde9fbe79f9b379e0ULL, 0x1957e6951ca769b7ULL }, { 0x1372e87e5bf5eae9ULL, 0x746dd1bf9400d136ULL, 0xc3e5bac23d6a1839ULL, 0x4c9a2dbb209e02b9ULL } },
+        { { 0x212347fcbea19bc6ULL, 0x58d7334ddc284cdaULL, 0x20ce358572dd41ddULL, 0x8ed284d3aae7f96fULL }, { 0x9e5e784800dfd9e7ULL, 0x59aaa8d8aad35cc5ULL, 0x011d0b107f8dbfd2ULL, 0x1fd437ae583630c0ULL } },
+        { { 0xd409e08fe568f5bcULL, 0x534e4de75355fe43ULL, 0x5d84dcf301b5b366ULL, 0x5c8088490f91fa73ULL }, { 0x5dee0bf9c6a6b4caULL, 0x7ba780ad82ae93beULL, 0xb9a0411797c737a7ULL, 0x0175b14f2060a9c3ULL } },
+        { { 0x07ece566caa4cb22ULL, 0xca934f8716c087c4ULL, 0x4da362224e1d6bd5ULL, 0x5f402433d73866e0ULL }, { 0x4777d1124a77d752ULL, 0x879d7639f1097263ULL, 0xf2fd13d87291ab04ULL, 0xc8043a670ba1a73bULL } },
+        { { 0xf23162063e0b48a5ULL, 0x7a060c0bfa606728ULL, 0x376af358ab408c8bULL, 0xc3088630cfa83a8cULL }, { 0xceb03c71452c2cfbULL, 0x7b292c94ece7dd34ULL, 0x75193c47f1ea48b2ULL, 0x85b43f9979490860ULL } },
+    },
+    {
+        { { 0x41a38518efe247fbULL, 0x78d77162cf43dec5ULL, 0x952ed69488f3f45aULL, 0xb7f2007d526d9948ULL }, { 0xb252bfb837528726ULL, 0x35538b908855c928ULL, 0xe6e1d02ce631ad75ULL, 0xa46b9ec0f2e973c0ULL } },
+        { { 0x7c2cd2b54d6a3d31ULL, 0xacc8229d708ed243ULL, 0x93e19cc4fe000a29ULL, 0x98d1c0e47be6cf23ULL }, { 0x7d04a29f553f37eeULL, 0x7674374a341f8cabULL, 0x408bc0f94e530eb0ULL, 0xbd734a1a4359aeabULL } },
+        { { 0x44e9157911b93177ULL, 0x4f830ca098772e8eULL, 0xe27a77c09f7a0825ULL, 0x67f338a8324f752bULL }, { 0x8300d9846306576aULL, 0xae2754732a87a305ULL, 0xd265a3edae4252b8ULL, 0x63d34ea8c4e44cf4ULL } },
+        { { 0xd8c0c00badc5e138ULL, 0xad6f0e400a1a959cULL, 0x317b23fa350f79dcULL, 0xa48bbcf71f86167cULL }, { 0x8a4e4fb7038d6070ULL, 0xdba32df911f6a91fULL, 0x9117a04bde169768ULL, 0x8c5413fb65165458ULL } },
+        { { 0xb60595c235d5ce17ULL, 0xe4a5fe5a9280f7f1ULL, 0x4b3e3ac460642368ULL, 0xa1a594a4a994892eULL }, { 0xa4b899744fd8366aULL, 0xaacb39b44ee22d9aULL, 0x3a722da52edfdd0dULL, 0x8a77303602abfaceULL } },
+        { { 0xa37e927a6e4c9409ULL, 0xd6319c71881700b0ULL, 0x84de75918f77ce38ULL, 0x1a9f59404c9d6ee7ULL }, { 0x7a765936b90dba8eULL, 0x4fba6879ad8cc1ceULL, 0xadab7d4fbff4a396ULL, 0x6cea78b7010744e2ULL } },
+        { { 0xead24668d54ea7afULL, 0x781c3762b14b8fc2ULL, 0xa2b4919e0b751eb1ULL, 0x5485450751ec1669ULL }, { 0x23d46eed8f211747ULL, 0x28a1007c8d715faaULL, 0x8d49d1804e6d9864ULL, 0x96f44616b752226eULL } },
+        { { 0xeda00fa5ec3affbcULL, 0x24baa6dda27cf329ULL, 0x4de65a27831fe184ULL, 0x45530b36ceacef82ULL }, { 0xbee2fc9a32b46bb1ULL, 0xa15e982da1c18ac5ULL, 0x8cdaad292cd58757ULL, 0x7e92c43520968b2fULL } },
+    },
+    {
+        { { 0x4cfcb4bd9f1074ecULL, 0x1835086b7c2024c9ULL, 0xc31c9d2f4edff79fULL, 0x2579cef38ff606e4ULL }, { 0xb48c82cecc1b198dULL, 0x627c2be007e10df3ULL, 0xe023b6f049955153ULL, 0x1b512c3a42dfcd74ULL } },
+        { { 0x0bfe04a84c547dfbULL, 0x4aad02f81775f100ULL, 0x867081c61d838e77ULL, 0xec18b94b4713f604ULL }, { 0xe154230eaa749885ULL, 0x0be67ab5ef0dd49eULL, 0x7fe3818474c34d95ULL, 0x331b6e9b27763e71ULL } },
+        { { 0xe5cdf281731bf60bULL, 0xe7736e570acfb943ULL, 0x961e71aafc924055ULL, 0x8b925240cdb7af38ULL }, { 0xde5e8553370ffeb3ULL, 0xec3404bfa011c79eULL, 0xd87083b4d90833f5ULL, 0xc3d9a1f2ff6b0b65ULL } },
+        { { 0xadb47b9d5bb2a131ULL, 0x18668fe168ddbbeaULL, 0x9cb9f68786a0679aULL, 0xc00f5a0f4033b7e8ULL }, { 0xc215ebe6edce153cULL, 0x4f227ec0293549ddULL, 0xb6190f9094db5f97ULL, 0xe50530cc3e4dc133ULL } },
+        { { 0xe8486f409825134bULL, 0x29c1817fb3565685ULL, 0x2f5059ff04327ce7ULL, 0x78240cc1296f9fedULL }, { 0x40ed9b4c92b4e0c2ULL, 0xe4bf2e4cafdd2fc1ULL, 0x700cdd31694f5d7cULL, 0x44dbc200f313bb4aULL } },
+        { { 0x0fe439c71e2e0e15ULL, 0x8bc9648752e9093bULL, 0x0629be5fee097557ULL, 0xc272bf6c8b81090bULL }, { 0xce4b3357a661a982ULL, 0x54cd9970a42ebeadULL, 0x155d69406af0d229ULL, 0x7f041ba0cdc01d62ULL } },
+        { { 0x8535f0e3a605868fULL, 0xe4e8eac15fdbec4dULL, 0x6d4045636c51d587ULL, 0xf84c0d829385abc5ULL }, { 0xc8ed7566b4db1764ULL, 0xfe5ee68c50dc9c90ULL, 0x8a43ae933cf20ad3ULL, 0x97e50af19f57e898ULL } },
+        { { 0x7de2cebd0f9832c2ULL, 0x6d395846aaadd62fULL, 0xa908234a2b3f4371ULL, 0xf8c2f19024b2b7b7ULL }, { 0x52b723950f9a0344ULL, 0xe11536a3d7adab7eULL, 0x22a165029cbf6ea0ULL, 0x22dc4b14168e68f1ULL } },
+    },
+    {
+        { { 0x116c7687bbc21801ULL, 0xa001a156834431edULL, 0x919bd70b4a6e9f8aULL, 0xa09c0bde99755bf7ULL }, { 0x4714b6ca7b90f619ULL, 0xfe233422662644c3ULL, 0x9658dc8daad44dabULL, 0x14307be489bce3f5ULL } },
+        { { 0x80ffeb19b3f0aae1ULL, 0xc03325d7b4b720bdULL, 0x663940c4be7b2361ULL, 0xc35df455e6f0c5c9ULL }, { 0x6ca7dfd92d3f13e6ULL, 0x980cd80bf0a4cc8aULL, 0x861e5afbf991aaedULL, 0x5172f60db0067652ULL } },
+        { { 0xd2965cc49dd74772ULL, 0xaadc7538cfc88200ULL, 0xa20229b9925becdaULL, 0xdb3983e0b4c6696aULL }, { 0x65a740eb134f8de3ULL, 0xac2363e8469ca3d6ULL, 0xa5f569990b4f669cULL, 0x574e83f1845c5e5eULL } },
+        { { 0x749f73b06b2ac5d0ULL, 0x28d321824861c6c0ULL, 0x6c39f5e0f89a609fULL, 0xfd624ceaeda196b0ULL }, { 0x875485b037a47e15ULL, 0x324cd765629f2067ULL, 0x3ab968eb37aae611ULL, 0x6c2e7ce8d09ae889ULL } },
+        { { 0xfe19c066362fd421ULL, 0xa6e4f62754d3f89eULL, 0x1957d786832b3fceULL, 0x1ccacfeb34d49328ULL }, { 0xbf010c37d54ca3e6ULL, 0x47f2fe70dd752bd4ULL, 0xa56a150fbc280c5aULL, 0x7f3ff6f939d33a53ULL } },
+        { { 0x8a68b090d49ad892ULL, 0x0b4a9c4e4c81e66eULL, 0xc74a426bc437aaadULL, 0x6206eceda6e13178ULL }, { 0x0dd2eb6459b72466ULL, 0x0d2baab12022e7a3ULL, 0x19d578e637442fc5ULL, 0x3453ab80532d7fcbULL } },
+        { { 0x45052713a24ab7dcULL, 0x53e10dc0c0014470ULL, 0x395f135e59003e6aULL, 0xa1fdd1999fe6bff3ULL }, { 0x0984ed314a931687ULL, 0x128e93ad5e573574ULL, 0x17944ece879e143dULL, 0x009b476325df68ceULL } },
+        { { 0x6b260bbfa6757d7aULL, 0x993ff46b1930d6a4ULL, 0xc8e8a1edb3e5216eULL, 0x00d4c6a641ee668cULL }, { 0x273938faae8088d8ULL, 0x68b15374a4b5047fULL, 0xfe18ecda874d8d54ULL, 0x508f9f7804862d3eULL } },
+    },
+    {
+        { { 0x472e3968c233e953ULL, 0x1c45ee21fc87d728ULL, 0xb3e4b0ac7afd029cULL, 0x48a5c6c230aecdacULL }, { 0x43b7f34f5de465f9ULL, 0x21a5ec7a4bc742b0ULL, 0x1f22f9382ceb7a9bULL, 0xa0ae9d2208a0867eULL } },
+        { { 0x1d910ba68477c0eaULL, 0xa39fa521b63549adULL, 0x097ddc650598761bULL, 0x62eb1f6c1fd6a297ULL }, { 0x8a2ea43e0cf8b987ULL, 0xc6b0f39b86090af1ULL, 0x4d8e8d733ff90728ULL, 0x6295e1cf76e99c7aULL } },
+        { { 0x8134a9bb81551783ULL, 0x416d384f588330c0ULL, 0x94876f60637f2c44ULL, 0xd0bc50d23e297d5aULL }, { 0xb0c308c846755d74ULL, 0xb9d36414b95404bdULL, 0xfe21d7cfdc18beb9ULL, 0xfee4f74a02e57fc2ULL } },
+        { { 0x4198dc4fadd553daULL, 0xb2573c15b709812cULL, 0x45eef966d467dd29ULL, 0xbde3321a23315592ULL }, { 0x57f5392e557d2333ULL, 0x9615d43ea05e9a82ULL, 0xa647d9ca97e16953ULL, 0xbbd3daf8a9add060ULL } },
+        { { 0x978b53855b298d61ULL, 0x7cd10a2a10acbfdeULL, 0xe225eb45328d5f02ULL, 0x09fa229a17114557ULL }, { 0x1ee45919c753e8beULL, 0x6cf8504518337823ULL, 0xb63b8bfa6da4b3cdULL, 0x0e08994c46dd396bULL } },
+        { { 0x6d4aeea4056d818dULL, 0xda936f4529e743c1ULL, 0x6ad0fce13a3b0275ULL, 0x2253dc6329b4e7daULL }, { 0xc4d5301622c8e826ULL, 0x569c4620865f6313ULL, 0x6e4f8d02c5e341d9ULL, 0x8170c527f14f776dULL } },
+        { { 0x7f7dcb2989b86cacULL, 0x26856130cf34fe91ULL, 0x22065842d82cb82cULL, 0x71992d80b4adceb6ULL }, { 0xfece4806f9d88870ULL, 0x7a0a1c353e7065a8ULL, 0x513318471f77bc2aULL, 0xdb49c8ea5e8ab62fULL } },
+        { { 0x95cdc2c6faa8508dULL, 0x46e632ebddc4127dULL, 0xb3f1ca5e1840794dULL, 0x0cc561e9c579b1bdULL }, { 0xca6f7ed0867f4afaULL, 0x70d106284f4631f6ULL, 0x13a5eeac1b63f977ULL, 0xa74227aa0ec7c8ffULL } },
+    },
+    {
+        { { 0xd53d5d0472ed7345ULL, 0xbcff12d439515ff5ULL, 0x7a4d9d08b3b5828cULL, 0xf899a71b1bac7debULL }, { 0x6137eef2ba436c62ULL, 0x0d85465e5e7f89abULL, 0x1ed24e35f6d34352ULL, 0x6737dbe3c1601124ULL } },
+        { { 0xd063ff04eb09f91bULL, 0x1fdccac2a7c4e3d6ULL, 0x70c880eaa01dd4b0ULL, 0x8d6116f0fede8ed9ULL }, { 0x4f9b552ca0ac9df8ULL, 0x4c40f2a9a609996dULL, 0x34e1c988a732a8bfULL, 0xe3bf0f02c1dad6a6ULL } },
+        { { 0x723b7c7964727d73ULL, 0x273acebab21a366aULL, 0x52bb492250cd2cfbULL, 0xa24b55fa0b64b761ULL }, { 0x4aed6807266f7bb5ULL, 0x7e232c20cf67241bULL, 0x21fe3578b3b76cc0ULL, 0x3df4119582ec9a9dULL } },
+        { { 0xd0c2419f6d86153cULL, 0x231930a8b707ee22ULL, 0x4bd3094f73b0e729ULL, 0x6598e204dd2d59c1ULL }, { 0x3fc65a239d72d2d3ULL, 0xd5d9825428f01f75ULL, 0x57c84a68fe361ea7ULL, 0xbfae09c8c8340d90ULL } },
+        { { 0x06908e0dd7025992ULL, 0x5a83405c2c613728ULL, 0x30f4abf4c704b367ULL, 0x6070e00379c4a4f5ULL }, { 0x126ce1f0f02ba458ULL, 0x4cd496dd5cb90f5fULL, 0xfb4884dc6ee31cc4ULL, 0x2df0bffb185e0f36ULL } },
+        { { 0x8484bd224d510690ULL, 0x7e9df071ed07d3e9ULL, 0xee65b114e46df4e5ULL, 0xd0a82236612542cbULL }, { 0xe0c848c21c024c5eULL, 0xf781cd2fdf509289ULL, 0x6da514062f137399ULL, 0xa62e8b007042ee56ULL } },
+        { { 0x84f73c281235ff02ULL, 0x82ad64d428e0d879ULL, 0x0695cf5441feb6fcULL, 0x0d1b80f501b30f63ULL }, { 0x14823ec46200c5faULL, 0x55f3a7c79489b1dbULL, 0x26dc42caf32a660eULL, 0x9a8f9a716b59093aULL } },
+        { { 0x078f84b0ff02af5fULL, 0x1cc32b8e0f98986bULL, 0x37122fcda4748fbdULL, 0x5284c6248b822a9aULL }, { 0x4477515f51bb2de8ULL, 0x768b4d3857450169ULL, 0x9f1b455c8ea94210ULL, 0xe1e3dfab25acf4ebULL } },
+    },
+    {
+        { { 0xf1f30e53ae61cf74ULL, 0x1108822731948505ULL, 0x172e66b4dffb9e31ULL, 0xdf9ff060a70bfc59ULL }, { 0x4e514b1e987f9994ULL, 0xae3d6b90b7bcb26dULL, 0xffbd8d2b1faa21c5ULL, 0x46508fb2b42b5e11ULL } },
+        { { 0xdac9fedfc8fdb1caULL, 0x4e2372d71c023806ULL, 0xb6209e17ed781195ULL, 0xdd19cbb4be645868ULL }, { 0xd00d02b22367ec3eULL, 0x1f15380220f5184eULL, 0xd08bdaa15fe86666ULL, 0xa0aa7d33db261a6cULL } },
+        { { 0xafb219d24955d9f7ULL, 0xc8cd02e1f8b61ab0ULL, 0x0653b5e2656b7953ULL, 0x663fc69153963a49ULL }, { 0x4cdd8ec89698c7f7ULL, 0xf8bf910554d0e85dULL, 0x09358777b91448edULL, 0x12d14331d1b78395ULL } },
+        { { 0x807c4992441083caULL, 0x2c48e9c9271f3aa8ULL, 0x6c14a14278e145c6ULL, 0x91360a8ac855f8ecULL }, { 0x5aca2af76bc35034ULL, 0x3e4db0f1fe99621fULL, 0x103d39c73b8a239aULL, 0x81c6b8dadc0b1203ULL } },
+        { { 0xcf94d8d4b16672e6ULL, 0xf5a613b6fee90949ULL, 0x00174a1e081078e0ULL, 0x47d2d003ae9b8e33ULL }, { 0x136df2a0056210c6ULL, 0x0ff481c0d39bf6d1ULL, 0x282a83010dbbd8ccULL, 0x52a2d3558533b8d6ULL } },
+        { { 0xe6e6cc85515be081ULL, 0x815d6368837404beULL, 0x7c65f6afaf5874e7ULL, 0x5ebadcd57b41e998ULL }, { 0x281acd43ee87df45ULL, 0xbc2e5f49a7104d2aULL, 0xccecd64135af9348ULL, 0xeda934800d76730aULL } },
+        { { 0x8d2db8dd3cf5c5d7ULL, 0xb69668614a1868eaULL, 0xcedc1996643a45f9ULL, 0xdbf0258715d60e5eULL }, { 0x1935ec86f0fdbd28ULL, 0x56e2e4d29d928044ULL, 0x65f6b107837f5585ULL, 0xf2315214f6c91fd5ULL } },
+        { { 0xac9e378ee1d4cd32ULL, 0x422d0c1be5c66fadULL, 0x58ddd8297a2176ccULL, 0xd9ced3f21f2c9af3ULL }, { 0x6a271698017fac80ULL, 0xe2b707f1c785fadfULL, 0x604ac7f2998a199cULL, 0xd292efdae73a0fdcULL } },
+    },
+    {
+        { { 0xf4f0250d77b6e2edULL, 0xa1dcd50a06ad9e0aULL, 0x5ae11d44a2d18bfaULL, 0xbd22cee0955924a7ULL }, { 0x7336db5e3d232d71ULL, 0xca473ec3798d3edcULL, 0x38aa2a3125fdaf3fULL, 0xd1e1ad45e9f40c01ULL } },
+        { { 0xae863d1a3eb2dbcaULL, 0x119280b9c05e6183ULL, 0xb3636741b29a523fULL, 0xcba31d0483ee9338ULL }, { 0xa782e9dabfc6a5d2ULL, 0xd3266e189203414cULL, 0xb69c6b48740fdc53ULL, 0xbec0d59743bc15edULL } },
+        { { 0x0e9b3d080e61e1ccULL, 0xe3adfcfd3ffb2a93ULL, 0x555be66fb800d5a0ULL, 0xc910b56dde7ffe34ULL }, { 0xc1f653583e7d150eULL, 0x958defcb3364f59dULL, 0x14d6aee093d82602ULL, 0x64e6859087abe6a9ULL } },
+        { { 0xb097726a22376827ULL, 0xe6b946d4af1ba09aULL, 0xc023d28604cc2dadULL, 0x4991ddae7912926aULL }, { 0x564db45ec7f90d00ULL, 0xf810acca720ddc70ULL, 0xff8ef73cb4f4f9e3ULL, 0x4e72ab52a6474b56ULL } },
+        { { 0xb441a838cb76d5eeULL, 0x08b557fa448db7e9ULL, 0x95d983ead7644ed9ULL, 0x6e22a4a079bd26aeULL }, { 0xe8e925afcb50cc6fULL, 0xf127bd3b8ad75730ULL, 0x837e036bf06da637ULL, 0x4bb795a7f414f78fULL } },
+        { { 0xfad5aa9ad43b07a9ULL, 0x84fc5084f7c2d583ULL, 0x1018af0120f4c9e8ULL, 0xf628df2a3ff473acULL }, { 0x7a4c4c246d5cee38ULL, 0xa568ff06751e2f4dULL, 0x3cbee46e4a906a53ULL, 0xf40507eefc9f0fb3ULL } },
+        { { 0x40c42c0bf4ee70c8ULL, 0x531c6c04d3bf850cULL, 0xdafa10595fbdd774ULL, 0x6c89465c12b24339ULL }, { 0xa98c6b4259d4b3d5ULL, 0x91e58b84379c9f4eULL, 0x2140a3549fc6e446ULL, 0x6d557c9c66dfbdeeULL } },
+        { { 0xb4028f921e7b0132ULL, 0x15c3ebada129b871ULL, 0x00e771b626da4ac2ULL, 0xc4ba5efd9a10d361ULL }, { 0x93982e79e44b597cULL, 0x2cd7fec6334b9d0eULL, 0xa9030fc62e29b81bULL, 0xa51325161d621df1ULL } },
+    },
+    {
+        { { 0x9f30222b47476977ULL, 0xaf4095525fe1d2ddULL, 0x9ef9133702cd5d56ULL, 0xb3b436f386109b4eULL }, { 0x0b4f8ebaac8dc00cULL, 0x349b5f127619927fULL, 0x98f120c4a670b81dULL, 0x2f2479a7c394b509ULL } },
+        { { 0xf9065b1817fb2c3fULL, 0xbaa506d8bb30cff5ULL, 0x4cc3fc6e16e0251dULL, 0x3f1d3f188bff86c2ULL }, { 0xd33d0391b78b064bULL, 0xc63f14011a233126ULL, 0x0aa7081db3b87f92ULL, 0x62f17da77f000171ULL } },
+        { { 0xc7155e11fc3ee5c2ULL, 0x36e8efe11ae69f50ULL, 0x498e34dbf80108daULL, 0xdb5dcc909d6ace8dULL }, { 0x177d4c2716e08e66ULL, 0x867cbd65a22d77dcULL, 0x42383b71d75a980cULL, 0x3651d4a0fd9485cfULL } },
+        { { 0xc7829ea4baf20e49ULL, 0x53842d74695921e6ULL, 0xaa34cc99e731d4c3ULL, 0x6b3672681533aaa6ULL }, { 0xc620d219da5709a1ULL, 0xa8dcb67db62f9483ULL, 0x651aed2de269adbeULL, 0x5df6563844506fc9ULL } },
+        { { 0x1d2efd2e8575f04bULL, 0xe0d550b82c63fb78ULL, 0x8792b2790492c198ULL, 0x7dea745b805e85ccULL }, { 0x34a03e6d0c5a24f5ULL, 0x5131b06cbcf27dc5ULL, 0x74b716f934562966ULL, 0x0ff2cc3cbd33346bULL } },
+        { { 0xe85f02743fe87d71ULL, 0x1a9310410f31c2b7ULL, 0x5cbef65b047a83b3ULL, 0xe0eed60786dda041ULL }, { 0xe1154e9dabd857e5ULL, 0xb02f7430eeb28618ULL, 0xce95e9043de0541cULL, 0x5f4393a66c622d33ULL } },
+        { { 0x7ae64bdd58931210ULL, 0x11c83d9116bb3c63ULL, 0x9a59df143feff2a8ULL, 0xedb4899e63846539ULL }, { 0x568f71ca6bdebcb5ULL, 0x301608c3e16a0a89ULL, 0x74412ac455c86cb8ULL, 0x99dec8fa9584483cULL } },
+        { { 0x257cbb5a8a920b0cULL, 0x4f80e557b4613386ULL, 0x51f71ff256f595a0ULL, 0x7e17e81a4530aacdULL }, { 0x4750d6def98a3685ULL, 0xabd27708d3065a36ULL, 0x791e48de6b1e9af8ULL, 0x76af6ee9bca94409ULL } },
+    },
+    {
+        { { 0xc3f3edf57c24708aULL, 0xa2bdd58a729aed26ULL, 0xf6a154cc23a0a78aULL, 0x1fa558161ac906f6ULL }, { 0x43a53c18f8862578ULL, 0x609b54e610b5662fULL, 0x799f90a5a917fb59ULL, 0x6324a09c39ec4c70ULL } },
+        { { 0xc27978605119187eULL, 0x90d6557dfaf02439ULL, 0xcfd8ae5fe0adbbe8ULL, 0x437a7bd0b087b69cULL }, { 0x02c7ad93784da25aULL, 0x608be925a7ee1047ULL, 0xc1b14459e07b67aeULL, 0x5ff419a334d84e59ULL } },
+        { { 0xdaecb8e704543248ULL, 0x26480e25ed25202eULL, 0xfa2edfa8d76790adULL, 0xbf541c55b6d0d99bULL }, { 0x66f006521b13a756ULL, 0xb223a80ee52f23d2ULL, 0xae65cadebd112873ULL, 0xd5493e1122a5f935ULL } },
+        { { 0xd65476fd3861e021ULL, 0x52f846d64c46858aULL, 0xc05647c3d28aaff0ULL, 0x7619286cd8c4e5a5ULL }, { 0x5a07a707bde4c525ULL, 0xada62460ae488084ULL, 0xc8a026c48b282577ULL, 0x6f22abba66be4dc0ULL } },
+        { { 0xb7802c7ad055c424ULL, 0x16d2f41d8f65ad90ULL, 0x67950df3c768af4dULL, 0x77830c6fe0ad0bcdULL }, { 0x2336e106bf8d2412ULL, 0xb98e8dfc85ca88acULL, 0x0e7e9545e95e2f7cULL, 0xb5e79cf57b53597fULL } },
+        { { 0xea5525c767da8c11ULL, 0x22b0b25454055c34ULL, 0x615376d8709cb9f2ULL, 0x1249adf4f5dde98bULL }, { 0xdc249fa134ee5d1cULL, 0xb28e9180e1fe0af2ULL, 0xa7c011009f7a7eb0ULL, 0x021b8666585e14bbULL } },
+        { { 0x7c035129bc6e166fULL, 0x15ed999ddb0b7458ULL, 0xa6cf86ebbd5bbeb3ULL, 0xad43e5029ff12f47ULL }, { 0x4327f71455132772ULL, 0x3a2092de532bffb0ULL, 0xe504269c17e79a40ULL, 0xa7fa7a66fe6212c8ULL } },
+        { { 0x5410fd7d904f8ff3ULL, 0xf41e2341c2ea9b82ULL, 0x3cf9d9868a8e0a61ULL, 0x88cee032905523d5ULL }, { 0x99e18cbf90500e56ULL, 0xc8f503a954b36dc8ULL, 0x3e47846c9acbd7c3ULL, 0x3d12d02d59044ba5ULL } },
+    },
+    {
+        { { 0xb4cbe1f9a31d9e68ULL, 0x753e44ad81a39a40ULL, 0x24942a08955bbf75ULL, 0x237e206f5f040b8bULL }, { 0x463c8a168a3e0d60ULL, 0x51296c3fb66b0f39ULL, 0x1436c2e876ca47b8ULL, 0x67b2db2a4267c78eULL } },
+        { { 0xd768a66cea5908bfULL, 0x7cb5e512eb0d786aULL, 0x32f9b0b1ebcd49f6ULL, 0xf806f94a4503f651ULL }, { 0x054b98043cdbdb9dULL, 0xb57ec65d9f86dc68ULL, 0xdfc7db252b5d1585ULL, 0xd5db3f73bd703bc2ULL } },
+        { { 0x82dc87c968b5d6e5ULL, 0x767ad90fc0d5b00eULL, 0xa22fc4a2f430d85fULL, 0xf767ae2a44edddedULL }, { 0x6534930e6aa4ae2cULL, 0x0fd06a4f83835e85ULL, 0xd45fa9d45fc5dcbdULL, 0x180b43dc52e5003dULL } },
+        { { 0x7ab495bc4129572cULL, 0x4289b0a50d5137d9ULL, 0x53ccf567db487d1aULL, 0x09f113c2e1db2c41ULL }, { 0xb690faa57ed1e6dbULL, 0x5a1d2e66fa691934ULL, 0x137b2a603dbac5baULL, 0x6db7f694c0f893f4ULL } },
+        { { 0x8aaa5564147e2901ULL, 0xf35d4745ac0ba42fULL, 0x5369599784d90619ULL, 0xd47482a0390da26aULL }, { 0xce0c2719a551b4feULL, 0xe7a7ed5003889a62ULL, 0x28e6b681e6f268d3ULL, 0x75843cc225af46d8ULL } },
+        { { 0x03835c3aa7bd271bULL, 0x25e569eafe290d5fULL, 0x1174b814836289abULL, 0xecc76c1c932bd1cfULL }, { 0xd491daef26ecccb2ULL, 0x87b565cdfbfcbdb9ULL, 0x491913215146a17aULL, 0xa7e1c1f260b28130ULL } },
+        { { 0xc415db9e2cf3f659ULL, 0xb199014d8992a840ULL, 0xc0000d26f4b0b18aULL, 0xc964b8c966e954d3ULL }, { 0x2794cb2cec7da8f2ULL, 0xcb22251cdc3377dcULL, 0xf82a51c46ff18f63ULL, 0x57b660ec9020be85ULL } },
+        { { 0x5c205af8814121a8ULL, 0x9d4309f36eca3cf1ULL, 0x4c8277be19c46f7fULL, 0x9e8f6db65f603436ULL }, { 0x852871efd2402997ULL, 0x322f8a8b8eaf049dULL, 0x83eb828b2aee808eULL, 0x879cff57869396afULL } },
+    },
+    {
+        { { 0xfbb078b09cf3a610ULL, 0x6885d7d5b186da90ULL, 0x95ed09e995203846ULL, 0x16a106b326026494ULL }, { 0x5197f54b47bbfbe4ULL, 0x41056d98b63c5137ULL, 0xa2490613ccfa9b0cULL, 0x660bd8145ee9146fULL } },
+        { { 0x91018dec677fa8a8ULL, 0x1b96f6d669473bdfULL, 0x18fe61276df7a88cULL, 0x058b1bdb750e7dacULL }, { 0x7fb0ce1ba31a3108ULL, 0x55ed7c610dbc3ff8ULL, 0xe29b0dbc4b1a54feULL, 0x69c554ac610987cfULL } },
+        { { 0x29665eafd74adf62ULL, 0xabf7ebd2b5e65a35ULL, 0xfa7349729b28897cULL, 0x1fb7be6494cc53deULL }, { 0x2c965c9aa046f0cdULL, 0x30d20759b7825d93ULL, 0x9ad6fab17f202308ULL, 0xac4e7e7d6687e64fULL } },
+        { { 0x8ab509c1f753150aULL, 0xb5738e4c08453c11ULL, 0xe75bc57f39433bd4ULL, 0x25c1b8e06b323296ULL }, { 0x5fe6c386aa3bb357ULL, 0xe59d1de93c447acfULL, 0xe8a4304ae166ace1ULL, 0x28f397f3f3697af9ULL } },
+        { { 0x772e609d9d13cd7cULL, 0x0078c6ee692b094cULL, 0xa65bebccf636431aULL, 0xc3f33c627a004bc8ULL }, { 0xc8f7d02ebb2873baULL, 0xf94713c3decdae1bULL, 0x0788445a9365469dULL, 0x5bb3af6b49976891ULL } },
+        { { 0xdb82a8b4517bb70dULL, 0x0adffb8ca3f57688ULL, 0x8b2132ee3083273eULL, 0x2cd8715b9e916271ULL }, { 0xa55491d0624769ddULL, 0xa9d03db69fea3ea5ULL, 0xaa784140ccf844b5ULL, 0x10fb3e5aaae950d4ULL } },
+        { { 0xc170b473322b782fULL, 0xd6702d75bb4963fcULL, 0x045b497d9cae193dULL, 0x401505f604bf304eULL }, { 0x1c381826089992c9ULL, 0x07658a7cff88b6d0ULL, 0x3450ca8762377637ULL, 0xd762c36dde142ea4ULL } },
+        { { 0x29a703acfe9879e5ULL, 0xcc7f5c07e0fbd943ULL, 0xf2531ea132b77e29ULL, 0x312735ee32f4295fULL }, { 0xdc2a8357a2e525a9ULL, 0xf720f228ecbc8ab4ULL, 0x381526cbcbd8796dULL, 0x7c76ac3d75e0e134ULL } },
+    },
+    {
+        { { 0xb6be30d6f8690928ULL, 0x88b68810434ea2e8ULL, 0x3bd453bf4619fa9dULL, 0xf4f354d265a85a7dULL }, { 0x91c6edb76254c4d6ULL, 0xae770d165317107eULL, 0xccadedeaa81c00a8ULL, 0xe646640ced889ed1ULL } },
+        { { 0x4fe0a88b7435f8beULL, 0x9e51a80bd00a39abULL, 0x17895b4053ae3439ULL, 0xe5b769ac63177687ULL }, { 0xb24d8149b4419d5aULL, 0xaf3cdff35e863840ULL, 0xb5e37ee83a65e949ULL, 0x9404d7901ddc8491ULL } },
+        { { 0x8244d9921bcf53a5ULL, 0xc895dce20f4b77c7ULL, 0xa04260ba53778cebULL, 0x0e309d31c9eaaaa3ULL }, { 0x240597499194ea30ULL, 0xfc23cf5034d6dd6eULL, 0x82ef6c7b810daad0ULL, 0xc55aba338ed9675bULL } },
+        { { 0x51950cbb40c47099ULL, 0x90ad3d8a0a9b4a87ULL, 0x544c3e23ae1eb361ULL, 0x1269b5afa18ce64fULL }, { 0x584bed44da9ac0afULL, 0xce3beee93d717c65ULL, 0x63f33d45f1a3d771ULL, 0x79542c046baf45dcULL } },
+        { { 0x2f836f4bae9711a4ULL, 0x4827e23c946948d4ULL, 0x731a8af3a2f3bfb2ULL, 0xaeb7decb048b4fefULL }, { 0xa80f051deda16508ULL, 0x9f0473b70732396eULL, 0x00c30d117f6d74fcULL, 0x2d2c25ffae9bed5fULL } },
+        { { 0xce7206d4c2eacdc5ULL, 0xb5d6b7a46e04b447ULL, 0x4a93a8b89334c66dULL, 0xbb1eb0ecef6cc8f6ULL }, { 0x05a64f57f126dfceULL, 0x523f2dd704e0a471ULL, 0x2d0d6a542efecb7dULL, 0xe24a7ab958f33498ULL } },
+        { { 0x577e5ced3e899cbbULL, 0x3d6888b5a8588455ULL, 0x83de9e9fec08f299ULL, 0x1a56e5f18cac68fbULL }, { 0x61651b669fb95ffeULL, 0x8859922459bb331bULL, 0x033488c0785fd724ULL, 0xa06ea37368415cfeULL } },
+        { { 0xb30d3154c5c27031ULL, 0x46dd0e3f756cd6c6ULL, 0x1f04aa20bf0d1086ULL, 0x5e033931af490e76ULL }, { 0x133ef88978b15ef9ULL, 0x23e9249eaf1407a4ULL, 0xae3d0578336fc35bULL, 0xb2036a029abea7bcULL } },
+    },
+    {
+        { { 0x9ff47ea65a491212ULL, 0xb73df5ee9b99db72ULL, 0xfc2b420f22c654ebULL, 0x99d30dc90a3c3c7fULL }, { 0xdc38d58aff60c8b4ULL, 0x88840754a82c9b1eULL, 0xec5a5d57cc17b854ULL, 0xf66af64fc944a199ULL } },
+        { { 0x6f4ef69900ff6bc0ULL, 0x49f1efed5253ccecULL, 0x01591591b6aeff80ULL, 0x68df46c894c45f30ULL }, { 0x7bfafb219a914825ULL, 0x096f8e5eb11e3ae4ULL, 0x79a8615e29be22f6ULL, 0x27ba8d9ac64b3624ULL } },
+        { { 0x6a5541d8a7653ea3ULL, 0x852c403e2001defcULL, 0xc00a872a1f9919f8ULL, 0x7ad62f633597fa24ULL }, { 0xf17c9c39036b7112ULL, 0x2b286a2f9fcbc34aULL, 0x798f8b80f0371dd4ULL, 0xb15fd6ac8468d228ULL } },
+        { { 0x7409cadfe38d8467ULL, 0xaf089305f874c06dULL, 0xe237f9af86274217ULL, 0x333526281ec3e3d8ULL }, { 0x5e1d7ec5c3fd78d8ULL, 0x54bf72f7e36af166ULL, 0xfa21fdc1cabe1ab2ULL, 0x59327c5fa48ff343ULL } },
+        { { 0x63519941e1e8d2b2ULL, 0xfef2e524a670a757ULL, 0xa02b171049240195ULL, 0x5094d956ed9fd86cULL }, { 0x30604e4fffdc3267ULL, 0x848862b462251341ULL, 0xdc91bee3b4ac8dd3ULL, 0x87c719672d86d787ULL } },
+        { { 0xfd16541251f4ac49ULL, 0x8de303977f3d4d43ULL, 0x15dc38680c2ca7c6ULL, 0x4babcd3a13eced29ULL }, { 0x2de9b7325dff92ccULL, 0xa1b5dec8a941985dULL, 0x04a117a2db3553f4ULL, 0x0940b4a5e44549d6ULL } },
+        { { 0x542160568a23e947ULL, 0xcd8e9278c6410a9eULL, 0xb699eeace97ef6e6ULL, 0xc550df2c63752ed0ULL }, { 0x26ff4f36c3d5c820ULL, 0x3b65ce72c2370fafULL, 0x86097526c50931b7ULL, 0xaddfa2f22a05c84dULL } },
+        { { 0x5c92d1957d292089ULL, 0xb2d11755973362e2ULL, 0xe02d49fad3feb4c4ULL, 0xfd9a00270c215642ULL }, { 0xd06976a21eccfa9cULL, 0x3090e7cdb8e81d80ULL, 0xebc4ede69daa9002ULL, 0xf3525b9be537c812ULL } },
+    },
+    {
+        { { 0xf459f7b3f825a5fdULL, 0x4595b420413a74f6ULL, 0x6b766e52094a50e1ULL, 0xe415457989fb31e8ULL }, { 0x45e46b7fd180dfb0ULL, 0x33e40fb4e2f5450fULL, 0x080c953d28afd08cULL, 0x7598eaa14c9519a8ULL } },
+        { { 0x02479b1e16e9e6d2ULL, 0xb1d6219dbcade03dULL, 0xdc6acf7b90e35bf5ULL, 0xbf0735f36e783aa3ULL }, { 0x393fc398c5baa77dULL, 0x5d3dc1be5897d9aaULL, 0x3ba028b995846d7aULL, 0x986fd6412ea0ecf1ULL } },
+        { { 0xf68bb6adcf253d88ULL, 0x7232fc8ff8a6b0feULL, 0x40000163e2d39fb4ULL, 0x6f29fb8d9ca0725fULL }, { 0x59d669a40614d077ULL, 0xe115da8d4b6d578aULL, 0x3313523283a272b5ULL, 0x9a6f2b25155c59ecULL } },
+        { { 0xa519bf551b42ef1dULL, 0x06d8b643c27da179ULL, 0x3897633b13c66d44ULL, 0x0f05909eb601f991ULL }, { 0x2c6a65365dc3f8f6ULL, 0xd33124163ed0a6eaULL, 0x6845bb2299fc2341ULL, 0xce5e37dbb00980d7ULL } },
+        { { 0x75ccac9015cfcddcULL, 0x8d4cf698f1d0b218ULL, 0x13d8056d70bef9e8ULL, 0x657278197f4701beULL }, { 0x7a91f372eaedc832ULL, 0xebb63c41a0784147ULL, 0x96f1754c919dbd15ULL, 0x6a19841df72a4718ULL } },
+        { { 0x4e112715aeb6af41ULL, 0x7d3ed2fb6c5205fdULL, 0xed2c26850511a84eULL, 0x4d8f50fc6d870d63ULL }, { 0xd563122f5e7f3eeeULL, 0x305bbec20de61125ULL, 0x6bd9ff85bec29080ULL, 0x76e821fa069e573fULL } },
+        { { 0xe2630698563e5ef7ULL, 0xc39a5d58372aaa98ULL, 0xedba16a107476b7bULL, 0x4f76607822dde27bULL }, { 0x9a40f350e70b447dULL, 0x1932fa393ae1a820ULL, 0x098fa4853043b4c6ULL, 0x85ad1d78b0c2a84eULL } },
+        { { 0x6dd33d862efaa7c4ULL, 0xc6a9cff570e0b486ULL, 0xc8385ff71007fe8cULL, 0x149d2919cc47f615ULL }, { 0x9c32c8ef1da795bbULL, 0x52baf59e82d6827fULL, 0xf0ac589583e96d6fULL, 0x8a6ccf8f65643257ULL } },
+    },
+    {
+        { { 0x8b651ce58f8cfac9ULL, 0xe7688f8881beda93ULL, 0xef334ff50d656e1eULL, 0xa374d8d85ec25f80ULL }, { 0x9e13eae379c03819ULL, 0xaf5831c18d4dab3cULL, 0x88deb51df6e90c26ULL, 0x87a61f17823f5310ULL } },
+        { { 0x6db7491f33e3eb81ULL, 0xfab69b8d1d01759dULL, 0xa8b52594b17c9baeULL, 0x36210cb3f6efb30cULL }, { 0xc5545b121f950168ULL, 0x5ee71cdb2df60ba8ULL, 0xe7642e69c7f87caaULL, 0x54e006bf8999648fULL } },
+        { { 0x0426236497239c58ULL, 0x124db7c09181765bULL, 0xa7b5d21a8bdc8297ULL, 0x1998f669684f23c3ULL }, { 0xf27a606339fd52b8ULL, 0xb234c77af77c78a1ULL, 0x768c0fb078f05350ULL, 0xfdd391801b5e5d18ULL } },
+        { { 0x866ea46d69f216fbULL, 0x64a5d28a4ac99446ULL, 0x8c3ea2e0055dbf41ULL, 0xe38acecbbddaa65fULL }, { 0xf1802eee26632b9aULL, 0x626bb951bc3f0465ULL, 0x82e6ac2da26eadf6ULL, 0x5c6d543ce3874052ULL } },
+        { { 0xf15adfe1951ab7adULL, 0xd760a27091f8be57ULL, 0x974f7ecbe2da421eULL, 0x6b41a29883e7bbe0ULL }, { 0xaaf40bb40467e682ULL, 0x735ed4b61bf34e2dULL, 0x8d7cec0f40689777ULL, 0xf8ef58a59a20cfb3ULL } },
+        { { 0x6e9dad0056971658ULL, 0x819335e2bede65ebULL, 0xf4eb7d2714a1fb14ULL, 0x5d41fb1941c61598ULL }, { 0x60e4f57eed7181caULL, 0x539f5dd22420d5a6ULL, 0xdf3b3e2f9051939cULL, 0x8f27e6ceab63b01cULL } },
+        { { 0x33be69093a134039ULL, 0x84255b1df04dd006ULL, 0xbe2da53dfb23fde9ULL, 0xaa9227621d7272b0ULL }, { 0x4512e3ba9d836751ULL, 0xb204522cea4d6dadULL, 0x87df6050aa016939ULL, 0xb90072212f7d3b93ULL } },
+        { { 0x5752669cfec4f694ULL, 0x350bc0e9d6931168ULL, 0x2439a6d5c8ddb9cfULL, 0xf63a69558ae0bb1dULL }, { 0xcbe2cbc340d3e479ULL, 0x96658df6eb98b4eeULL, 0xdd94fc99243a2f9fULL, 0xef71178186192cb2ULL } },
+    },
+    {
+        { { 0xb6b50eda272e9751ULL, 0x3fe27c6a195edbf5ULL, 0x9cdd9c462ef8a9cfULL, 0x4c276680ccc851a3ULL }, { 0xc8e079a46f0a9ef3ULL, 0x614800006b0ba84cULL, 0xdced315c48b8fa3eULL, 0x911a49b77f23719cULL } },
+        { { 0x9c2dc74a062cc6deULL, 0xad363af24d4b0c6fULL, 0xefd5d6f24cc5d6e0ULL, 0xff4ee6847710d86dULL }, { 0xac77740b35836984ULL, 0x3d90a19d760b044fULL, 0x7ee58462dd69d798ULL, 0xd5bccfdc730e783aULL } },
+        { { 0x58a746cc23eb95d8ULL, 0xb295913233a5c0b2ULL, 0x33af25d495c8c842ULL, 0xc1d584228d5372f1ULL }, { 0x035f6c6815b3caceULL, 0x68986e01cb068d90ULL, 0xd1672698fea468a7ULL, 0x398ca3be948fe35eULL } },
+        { { 0x0772382206fc124eULL, 0x2072d143f676d4e4ULL, 0x19642255cbc34659ULL, 0xf94542a637260eaeULL }, { 0x78312ef5520a49b3ULL, 0x3127e5f14c89f1e7ULL, 0x88ae06b995c11918ULL, 0xbef471e116ea53bfULL } },
+        { { 0x24d6f33af48c02a0ULL, 0x38fa7d939a6b055dULL, 0xd71eb4495b7699f8ULL, 0xef56b91d50db0390ULL }, { 0x8925a9d4de66789cULL, 0x0466f30a7cf94e94ULL, 0x229a97c5309b9776ULL, 0xd18fded84d0efc80ULL } },
+        { { 0x083723ac6a132af9ULL, 0xd20d67b749464656ULL, 0xd2da033f4cbd8c79ULL, 0x115354034e39bdbcULL }, { 0x374ca955d2493265ULL, 0x5596dbf65baa52a1ULL, 0x1f9ec6e2d7134f01ULL, 0x57e391327aad335fULL } },
+        { { 0xff9ba069f3c5a5aeULL, 0x477a8745983ef82fULL, 0x2c76ffbefc6dff89ULL, 0xa46d7ac0bc0581c9ULL }, { 0x330b695a3812e747ULL, 0x1127b1201ef269eaULL, 0x671abdc3268fc9eeULL, 0xb79b5cd6292c037dULL } },
+        { { 0xa8ad36555ecbbda2ULL, 0xd2dfe2626d02cbaaULL, 0xcc3adc4f0caa7d42ULL, 0xb7d4037b60c19a0eULL }, { 0xf348a376940f5e53ULL, 0x36af5ad4db28bfdaULL, 0xbccfa0820e1184f3ULL, 0x01b52933cd943161ULL } },
+    },
+    {
+        { { 0x8906b35938caee8dULL, 0x1361f201978659cdULL, 0xc3cdb311d3b2a63eULL, 0x4ca18196426f1eaeULL }, { 0x9fc1bb4223f6680bULL, 0x41341af13c7eced2ULL, 0x88285a2c7a68e765ULL, 0xaa750ed2b0d1d8f2ULL } },
+        { { 0x70082bfe92b19e2eULL, 0x1885861059bbcc7cULL, 0x0e5951245e4be779ULL, 0x5c3337d6265e61a3ULL }, { 0x991c276b0bbc7265ULL, 0x4f5363e112257611ULL, 0xfc84e2840ac9ca06ULL, 0x322debe0b554e5b3ULL } },
+        { { 0x5296fb6cfe7fc97bULL, 0x70129ca0769d949aULL, 0x54ca864591146f57ULL, 0x436846db3244b026ULL }, { 0x678472122e1e9467ULL, 0x6eef627d8566bc1cULL, 0x456264301f261530ULL, 0x57907f1da9b23161ULL } },
+        { { 0x60c5ef28a8c46e18ULL, 0xbdd078523400758eULL, 0x13c3796cc6066192ULL, 0x56ac699d5c131aa2ULL }, { 0x9eb3fa4aec5d028cULL, 0xdbd7486c1b30f5e0ULL, 0x0929ab49a82244a3ULL, 0xa6498df131a1d3d3ULL } },
+        { { 0xee1d6321d13174b7ULL, 0x5b0279697cd42b53ULL, 0xc23ae92a96937683ULL, 0xe4680034f364fb47ULL }, { 0x621a5fd5e1fea17aULL, 0x52a8c1df0bb943a5ULL, 0xdf0b7316b1bd7ad1ULL, 0x6159dd8b1d2fbb52ULL } },
+        { { 0x18aa5d1f871875caULL, 0x1ea0c3517b3fe97eULL, 0xf7fb4fa3a1e5587aULL, 0xcad10d661de0eea8ULL }, { 0x0150c180dbdf364bULL, 0x81fafdd1cda347e7ULL, 0xd8c7d93d916538a7ULL, 0x85176b6cf32c03f6ULL } },
+        { { 0x54679b5540c29d6fULL, 0x59a270ebe729423bULL, 0x31f68f4b8aabaae9ULL, 0x639fafc0339757e9ULL }, { 0x76a34f6705268c54ULL, 0x329d7cbe5d13f3f4ULL, 0x5e693a26e590dca7ULL, 0xb1f63479362aa355ULL } },
+        { { 0x4886cbe596198bc9ULL, 0x42d4373e7366aabfULL, 0xde65db0ab3204b5dULL, 0xcb3f63051a8cd005ULL }, { 0xdd738b59376af5deULL, 0x2265e993b4a71f08ULL, 0x73a4816f3785c519ULL, 0xc98eef27aa50fe89ULL } },
+    },
+    {
+        { { 0xd6903021ca8bd10eULL, 0x7c2c8213c6272451ULL, 0x067cc69da5b14d82ULL, 0x09bc62745779456eULL }, { 0x491003cf90e5beddULL, 0xf0272347ca2bc9d3ULL, 0x07dbe881f77b27f5ULL, 0xa7f8657ee1acc935ULL } },
+        { { 0xd48ee6e72fcc27dcULL, 0x9459b268a8f8a441ULL, 0x621709d51e0e6b59ULL, 0x767d2ab7a53f5c0fULL }, { 0x30c51859f7dae3ddULL, 0x79371372eb941438ULL, 0xfef0469d2a9e82a3ULL, 0xa901d3e43d3817bdULL } },
+        { { 0x57fb2f5c28e31933ULL, 0x4f941a25488f0307ULL, 0xce6521c1cffbd305ULL, 0xd6823f0bf98c249eULL }, { 0x5bc9ae16852bb3c2ULL, 0x4c0bf11d27e55cfbULL, 0x3ae61532af6b40c2ULL, 0x7cb8966dd556097dULL } },
+        { { 0x06359300f69f4a41ULL, 0xf6289d15365b855bULL, 0xcf892307f20caebfULL, 0x53050f46037867b0ULL }, { 0xcd9f8831bc01018dULL, 0x9f5a7cff0c764963ULL, 0x896bc119ccc8c6dbULL, 0x3aeaa17e87266395ULL } },
+        { { 0xae4db078d7f02d26ULL, 0xc65f85baac26d942ULL, 0x70877b6f6f87f2a5ULL, 0x267d15bc94e6606fULL }, { 0xb15671344a99bbd5ULL, 0x6e1378ce1fb1dab6ULL, 0xb1bdca31f7bdc295ULL, 0x8ccec147d557a617ULL } },
+        { { 0x545cc067a023701fULL, 0x73c0795b5db8696aULL, 0xb6782e7463513fb1ULL, 0xb803a3d1ced829daULL }, { 0xe41f645262ad7df8ULL, 0x28f7c9bb4820b510ULL, 0x53fb148e51bb26edULL, 0x060a3a0f7379da10ULL } },
+        { { 0x7e398389f773e8abULL, 0x16f66b2cdc861bf6ULL, 0xe790a84f0f4896d0ULL, 0xb622b3e7bfc0d884ULL }, { 0x45b873ed68b5a0dbULL, 0xf1489f00568e591eULL, 0x56c1ccc729ead459ULL, 0x413c29c3a9e27e80ULL } },
+        { { 0x34a74e3424d59b3bULL, 0xaaefcbd5dc8f7797ULL, 0x5c1a421b7ee6678eULL, 0xdb0ff59f0a9009a4ULL }, { 0xd34b5f90ec8032b4ULL, 0xa18f977731f0fcc3ULL, 0xa261f6f3284db8dfULL, 0xa2424c986e792bb2ULL } },
+    },
+    {
+        { { 0x69d5655ffb74773eULL, 0x6080c2cb1b650072ULL, 0x87eb0a1d7c124c10ULL, 0xb98c157dd0a53741ULL }, { 0x8236452d2dd5e610ULL, 0x4ff17b1579ac2691ULL, 0x6480c758a8d2c252ULL, 0x99e48336bf5a070bULL } },
+        { { 0x0122b6faae718ee3ULL, 0xfbd125de0953c76aULL, 0x228dad14acc8df2bULL, 0x194624803b6a34d1ULL }, { 0x101d6700a6dada25ULL, 0xa9d7f08bb2ace072ULL, 0xa3890cf028c9e6d3ULL, 0x75441fd9ff0ec046ULL } },
+        { { 0xa052f7a3b0467630ULL, 0xb34aec57b3e85c7aULL, 0xd453e9c08e4983edULL, 0x59b94f7c747d8153ULL }, { 0x574b89e34935f9f5ULL, 0x29f53fdb168605adULL, 0xc687eb4e417b773dULL, 0x5e136b3d13f2ebd9ULL } },
+        { { 0xf441a4d5e7e99abeULL, 0x613b633ccffebd31ULL, 0x38f79232c9225e84ULL, 0x77e71551a8d50c76ULL }, { 0x4eaaa476adb6dbc9ULL, 0x0c05d4d6e874dfffULL, 0xe90b60842a79f78cULL, 0xfc2440eae5b044efULL } },
+        { { 0x0ca7d2dbac33b4dcULL, 0x2275c7cd66970a62ULL, 0x5eeb53b6ed3e1570ULL, 0xd42cea4362b6c1b0ULL }, { 0x28c35398b6293d0fULL, 0xe82c76d315f4621fULL, 0x9ba32c86a901b3e0ULL, 0xc4fd1666d4d4a581ULL } },
+        { { 0x0bfe00991f7791b2ULL, 0x824319b6ec7118c0ULL, 0x5488021a26ff0e91ULL, 0x4b99be59e519662cULL }, { 0x5664279861454f0eULL, 0xe3d52fc5f8964409ULL, 0x803474b5cfa269e8ULL, 0x440988329dca4b46ULL } },
+        { { 0xa755fa8f67b53abcULL, 0x3170e3aadd5efe0eULL, 0xbb57ef60bcebfbc1ULL, 0x0ae27966af119f1bULL }, { 0x7367d50ee3442fffULL, 0x5b00d0efbd1428c0ULL, 0x368f7f3fa6ef1590ULL, 0xbf7239cc15b0ca61ULL } },
+        { { 0x0d8d30149d5489faULL, 0x7e6ea0c173075ec5ULL, 0x690b57339915c0c5ULL, 0xeb43bd659b1b8d24ULL }, { 0x0f314caadb8c3a67ULL, 0xf4b15edb0c43866cULL, 0x8a449724da747467ULL, 0x1db819879b6aa0a7ULL } },
+    },
+    {
+        { { 0xbe0b2578f8023127ULL, 0xa95ccd098a8b68deULL, 0x0dc602351925e578ULL, 0xb2153f53004fca40ULL }, { 0xb025456b72665f8eULL, 0xa5327909a0246beeULL, 0xfcfc4ef6f075a443ULL, 0xb013b77bfbf58688ULL } },
+        { { 0x0cee8957f3b482ccULL, 0x3944f9e5f65ccbabULL, 0x3270f90a66c91c05ULL, 0x74116505d1db396fULL }, { 0xb862a96db20c1646ULL, 0x35b467d8a3b158f9ULL, 0xd41b157b1e52b2cdULL, 0x638d24c5a774015fULL } },
+        { { 0x7dc23489e31d4659ULL, 0xa9e52e03cb43db1cULL, 0xc0ea0d9fefff5157ULL, 0x39049ef851c0fc54ULL }, { 0xce36f42f87926762ULL, 0x9592667aba4686f9ULL, 0xc10ac0af2e18e003ULL, 0xd8331f211d5b8020ULL } },
+        { { 0xffe0dfed77805fffULL, 0x5fa794be31e71c1aULL, 0xc4aaf9dc9c96d5d3ULL, 0x1d61fad6321904c5ULL }, { 0x219a652405a93813ULL, 0x7e1fd96e570ba1d3ULL, 0x9010f1829c1da550ULL, 0xedc0e2f1b7e78a0fULL } },
+        { { 0x9da2838d27ab3b85ULL, 0x28cb26b3a5619978ULL, 0x83856b951c50fc16ULL, 0xfbaefd9066b521a6ULL }, { 0xea3368d4b120ca34ULL, 0x035416c27a2fd88dULL, 0xc5138982682644b8ULL, 0xfcab1a3b402255f2ULL } },
+        { { 0xece9fe9c8ad2d673ULL, 0x415e5d82f6bb7e34ULL, 0x60f58fe475890270ULL, 0x45ce114b75167d2bULL }, { 0xf8b2d5e0d0aef54bULL, 0xdd88e616a7f615b2ULL, 0x8ae85e4971dcb6deULL, 0x05bf0c2e6058688fULL } },
+        { { 0x84e0dcd6aeabbaf7ULL, 0x50d114cd7cfd0130ULL, 0x08d645a7160841fcULL, 0x0b3484d484787649ULL }, { 0x887546e0b36d4cd3ULL, 0x3ea2dcbfe57d6c61ULL, 0x5ac69355ccf12537ULL, 0x2c0738718d9ea7e8ULL } },
+        { { 0x654b904b38a2f85bULL, 0x29c45d0695d9900dULL, 0xc735fc201b8c060cULL, 0x0c1ae127ac2f427bULL }, { 0xc8ef4afaed135b93ULL, 0xe67e9e310eb1664fULL, 0x7b37a5ef62585591ULL, 0x749f646a59ea850cULL } },
+    },
+    {
+        { { 0xfb5b141a44c39c8eULL, 0xd655b14e47fefa01ULL, 0x13486a950061cf3aULL, 0x502abd039449df46ULL }, { 0xc7b8ea6efcafda35ULL, 0x21f47a9b2794ab12ULL, 0xcb745d746cd72bf9ULL, 0x7e7e2382eb6d9157ULL } },
+        { { 0xd073880dc1f69662ULL, 0xfc612134a33914a9ULL, 0xc89c449c188d13e7ULL, 0xa0ba1305ef6c3c44ULL }, { 0x2aad7b739e20febeULL, 0x870828aae44e4ed3ULL, 0x20de0c62e1f50810ULL, 0x8c3d0f2edb549828ULL } },
+        { { 0xf64eaef7ddaa15daULL, 0x0f51c82117ca284aULL, 0xa5e39406e921b63aULL, 0xc8d46bc5b0033a00ULL }, { 0x2776e63581595010ULL, 0xbaf9990bec850f7fULL, 0xb9d9b6ad00d52ffeULL, 0xc0ee70c21618b2aeULL } },
+        { { 0x3669804a6c6617feULL, 0x40accf21880aaabdULL, 0x9b50ee21d60ef870ULL, 0xf515a660e05e7cfcULL }, { 0xa8a0f63356fc218aULL, 0xfa4a50cf38f949acULL, 0xdf340f723f2dff04ULL, 0xc4de8964f3dbb6ffULL } },
+        { { 0xb5f066a6ce20f6faULL, 0x1d3412fc4519386cULL, 0xc7a567a4be777e31ULL, 0xe50763bd6bb8c48aULL }, { 0xfc5f123fe9ec4225ULL, 0xe3d4fa836fbc674fULL, 0xbe82bc9b12f046bdULL, 0x3fa463754540d099ULL } },
+        { { 0x71cb19f16bdb6cb9ULL, 0xc4dc2bfd4d3bbc75ULL, 0x1e6189714dff7a52ULL, 0x50418b1a4dcfc02eULL }, { 0x87c1b9603f450b5cULL, 0xb98290c2d6b40b2bULL, 0x09c471d193cac03cULL, 0x237866687b893f24ULL } },
+        { { 0x7ea2cea246ce0310ULL, 0x63f33c18e0f2b29aULL, 0xaaa381ca49e533f3ULL, 0x626bfea285f9675fULL }, { 0xeb24e2c7dbe236eeULL, 0x52b928571cbce751ULL, 0x5fdec6b66eba8b03ULL, 0xaa502258bdd16591ULL } },
+        { { 0x2204dc49bd72b510ULL, 0x7294b18121ff1030ULL, 0x562447d234887455ULL, 0x4d950690d755a273ULL }, { 0x5ae7245c22123177ULL, 0x793b9c068739e6b3ULL, 0x3c546f47ac40622eULL, 0x72834781f22f4e26ULL } },
+    },
+    {
+        { { 0xc75fed65ee77b584ULL, 0xca523f5334696a94ULL, 0xd0aa44b2d1d46db1ULL, 0x34a51ef6a4e00e0fULL }, { 0x2d9a298b01dd25adULL, 0xb2677993d9612c49ULL, 0xdf72f6017cfbea50ULL, 0x3875caa651aee201ULL } },
+        { { 0x373614fbaf315be9ULL, 0x652c421b3cfe5b5bULL, 0x6393a17f86c0b714ULL, 0x76b51b91e9f04024ULL }, { 0x7983229abafa3f5fULL, 0x8bd01fbc257b708fULL, 0xfbac8e5d738e1e9fULL, 0xc7e657c40475a25fULL } },
+        { { 0xc77a9c6b624659ceULL, 0x4cfa45ddc11c66edULL, 0x6cd2f0abf721fa98ULL, 0xc319d2a105773a00ULL }, { 0x7b529c2b03780ee8ULL, 0x39d800dc53fcd20aULL, 0x95cbe5b727bb1801ULL, 0x7cf7b69bfd2baff9ULL } },
+        { { 0xd8c2b1740daf895dULL, 0x73d108a66ff59370ULL, 0xfd0bfceffc35a5c0ULL, 0xbf3c7a7e72534cb1ULL }, { 0x87848d09214c9cfcULL, 0xadf4bb553c07f690ULL, 0x5e0ab41c85b373fdULL, 0x7d70b14681f666daULL } },
+        { { 0xa550a0a2fc87d410ULL, 0x48019c7d5acbf6d3ULL, 0xaf32aa39c93622b0ULL, 0xab6589ed59d6edcaULL }, { 0xe86eedc88727b261ULL, 0xc3cb4218aa9a2ae1ULL, 0x57dbb2f52c522a86ULL, 0x4f56615cd3c40d35ULL } },
+        { { 0x9bfb8f5a320336dcULL, 0xe1fbfc73921df07dULL, 0xa9995b8cd8620a99ULL, 0x39b7ce65398fe11aULL }, { 0x3272bb2aadc4739dULL, 0x27f5075b4771092cULL, 0xaf03aedb8380e6e5ULL, 0xa62264c761f85788ULL } },
+        { { 0x90ca72ea4e7eb613ULL, 0xa068b04e98bd5c24ULL, 0x1779efc7898da088ULL, 0x9e8f97d8408a4fd2ULL }, { 0xe3b7965ecbd997d0ULL, 0x94bae95406d9755aULL, 0xa536f68ce8d351c2ULL, 0x4484bc1814e695afULL } },
+        { { 0xc2fdd8ed4307832dULL, 0xf9224c4eca47906fULL, 0x4f27eac0017cbd0dULL, 0x4541317b21d17bcbULL }, { 0x4917023b3ad282d7ULL, 0x22428dedddf12ac2ULL, 0xeda22a3ea8a0aacdULL, 0x26a134d357d24e9bULL } },
+    },
+    {
+        { { 0x52e23a0ad0eeba32ULL, 0x25d126e5221d753fULL, 0x8e1ed8f091e24d08ULL, 0x02c62c6dcd9be21dULL }, { 0xbca978019532a9c5ULL, 0xaf2fa26481a6c714ULL, 0xc9aa988de1b7e65cULL, 0xf0a62b0d64c72a93ULL } },
+        { { 0x78945abfdf286b2aULL, 0xeb6d71757fa67e5fULL, 0x6375c396202f3505ULL, 0x2580efd26b0950f1ULL }, { 0x6b00f83cf29e4788ULL, 0x87919d890b14828fULL, 0xea5a49bcc7405444ULL, 0x016c63a02c32843dULL } },
+        { { 0xd3dc474e2b9273e7ULL, 0x61c1874fb1b23abdULL, 0xd5f8a93bf4d5e153ULL, 0xc6bbaacc86060309ULL }, { 0x8b2695aa0e88984bULL, 0x7ac50027de72f96fULL, 0x677e0f8c7465f84fULL, 0x82a918365ae1aff7ULL } },
+        { { 0x572866930d221223ULL, 0xf86063c3c4e1ac66ULL, 0x300bb0767ed8dac6ULL, 0x316d94219df22d27ULL }, { 0xf057605d1e931ca3ULL, 0xeb8fc052a44243a9ULL, 0x0052ca94258bdee7ULL, 0x641a364a3b41de91ULL } },
+        { { 0x7a39f2907a3dcb16ULL, 0x839da77ae47879d3ULL, 0x56b02f74e1fc739bULL, 0xa9383776a82334a6ULL }, { 0x4d21266657987dd1ULL, 0x29adcc7195fce842ULL, 0x14267589595782c6ULL, 0x510e9d3b85e654e6ULL } },
+        { { 0x3ae6c701bf34e8b0ULL, 0x0bf3a93422847064ULL, 0xe1e0e74c8ea2de26ULL, 0x86c2f8bbfeaac5a4ULL }, { 0x2a480d20e3bef03cULL, 0x52cb289d5e46b6ddULL, 0xde8249787fc4e6ceULL, 0x5efd6cc3efe0e9e4ULL } },
+        { { 0xde285cf64e6d130fULL, 0x167651d4ed016125ULL, 0x2ed14ab9844b0dd4ULL, 0x0828637701af3bccULL }, { 0x3452c1a99a1249c4ULL, 0xe2dca2b51988564aULL, 0xc39b0bc45ea96643ULL, 0x9263c877c77a9547ULL } },
+        { { 0x08288caff10e80bfULL, 0x4a8b3c0600eadbebULL, 0x9b6f29e51c980713ULL, 0x4c18fab47f841d75ULL }, { 0x2a00bcabff139676ULL, 0xc1b37d3acdcdb20eULL, 0x5793df5594ff5b39ULL, 0x2e7903dd0d803ccdULL } },
+    },
+    {
+        { { 0x0f65f52adb12a1efULL, 0xd9fc7c9e500a563fULL, 0x0dd2b85686ed4060ULL, 0x9af924bef72c1af9ULL }, { 0x3fdab0955c6b1f4eULL, 0xe2efbf13a963708bULL, 0xb54ab5de579f69b4ULL, 0x7db04144323a9634ULL } },
+        { { 0x0a3018af436f2a16ULL, 0xd5770b8da078c184ULL, 0x1e65799b83cda41eULL, 0xe3118dff45dc5163ULL }, { 0xe18d705df3b464b8ULL, 0xf3b38f0a86665941ULL, 0xd2472de2cf9f0b18ULL, 0xa30756e323d6f219ULL } },
+        { { 0x5a75dcaf2ef3ab9cULL, 0xe3eb3970c9f8fea2ULL, 0x888298f4275ef099ULL, 0x39b5629a3919b926ULL }, { 0xd1a85310132a7427ULL, 0x67db8173e961db2fULL, 0x21ae8020a5f83d89ULL, 0x65d14eac095ad814ULL } },
+        { { 0xeceaf1b70a3259f7ULL, 0xda8fd3b8227c64b6ULL, 0x0a3b75b370092b54ULL, 0x9d36569d63730368ULL }, { 0xf9985c2d63101412ULL, 0x2138ce37bfc61362ULL, 0xadd1bc16975e576eULL, 0x47414e463067353fULL } },
+        { { 0x9e8d5543464bbe95ULL, 0xc99b0f4186c44436ULL, 0x73460bd9d3806666ULL, 0x0af5b4800db32b4dULL }, { 0xd99f0a3f1fbf96d0ULL, 0x6f2e66dffdac684fULL, 0xf8e795df0d9b9303ULL, 0xecf4204fb6ccf56cULL } },
+        { { 0x5c7969b5ad27043dULL, 0xc783c146b0820d0cULL, 0x312e489a5db6a8a9ULL, 0xce74dd3ef328cd18ULL }, { 0x612c839a9634cf4eULL, 0x34e1d9417d616f90ULL, 0xe39c32412d00bbc4ULL, 0xf2f9e6e3593b7803ULL } },
+        { { 0xa07c36c55dc2426cULL, 0x6f3615ed5263a34dULL, 0x1c63d414f7633eb5ULL, 0x4950a79dd19ae4cbULL }, { 0x96a299ae672ae1f3ULL, 0xcc6482be5aeace07ULL, 0xa3b5b0fc8d1550adULL, 0x76e77f688d9feaceULL } },
+        { { 0x91ee3f95f718b957ULL, 0x1b48c768c393de8fULL, 0xc5844342f0442712ULL, 0x9bbdb56f09f55c62ULL }, { 0xacd5821fb04eff9aULL, 0xd28455a84c3833afULL, 0xe434d5f8fd2accceULL, 0x17b5475d1f338db2ULL } },
+    },
+    {
+        { { 0x5e0570b6606235b2ULL, 0xe340c4ae29207af9ULL, 0xd527a2c607bdef0dULL, 0xbb362c3dafdf8bbaULL }, { 0x7b4fc2a9bd5f0beeULL, 0x147ce7591a2956b1ULL, 0xba7a6b7334124a7dULL, 0x3c40c279d15a2323ULL } },
+        { { 0x3f2f49141cd40e31ULL, 0x90642c13a80c38d0ULL, 0xd59b1b55c689dc73ULL, 0x1e39c20628722591ULL }, { 0x3044180f75b5c993ULL, 0x1c107c2720d89f98ULL, 0x132eb88f8aa0f8d4ULL, 0x7514b4d76462c2e0ULL } },
+        { { 0x033f132c7ccee136ULL, 0xd7d54ca5101e7655ULL, 0xae7ede54697b4bd0ULL, 0x74da46f914b44112ULL }, { 0x2fc256607e4cbb3aULL, 0x3672acd242e4cc85ULL, 0xa6660e0279c09849ULL, 0x9185150c485fb022ULL } },
+        { { 0xdd15e68a45daf470ULL, 0x28b9929d3e223774ULL, 0xd1b0fcfeabd465ccULL, 0x4396df4f311cee67ULL }, { 0xecb3aff369325ad4ULL, 0x8a90bd15b33b5d1fULL, 0x8fe2c6bce68a4d52ULL, 0xac51e8b48edf3a99ULL } },
+        { { 0x0fa5c09e956ce121ULL, 0x833695baa6e78e8bULL, 0xce82270fde600687ULL, 0x6e390c25ad9331c3ULL }, { 0xb05d89da246a3d4fULL, 0xae711914838c1eefULL, 0xd8cae58cf1d67085ULL, 0x325a0777fdade743ULL } },
+        { { 0x5696e8c7523ef0cfULL, 0xa4430e1205a39fccULL, 0x8bcef6a8fa2f40a3ULL, 0x79f892540dda969bULL }, { 0xac525965de97dd75ULL, 0x9d0344ccd23737e3ULL, 0x1d7b9481cdb0dbabULL, 0x572e9e094afd6e49ULL } },
+        { { 0x5854321e4fa3e53aULL, 0x2763474348595cfeULL, 0x86ad6ff764ee4cbeULL, 0xa1ba68170a265250ULL }, { 0xd2b611926bcae29dULL, 0x6c25bfd44e251346ULL, 0x9c3684cb2e7169abULL, 0xd32f1f6e44563d91ULL } },
+        { { 0x6368c53afa1ab835ULL, 0xcdbe7bae9c37e6d8ULL, 0x712d06cc258387e7ULL, 0xf4fd477a7c975ea7ULL }, { 0xee2e034badd2c656ULL, 0xf75a9d1b5a77b165ULL, 0x78677aec9096a77eULL, 0x97454f467baa67e3ULL } },
+    },
+    {
+        { { 0xf1b75df774302334ULL, 0x7a5774f4ddc19852ULL, 0x75512520360fd321ULL, 0x535c194b050a14d1ULL }, { 0x2c3ec10ed2e00af7ULL, 0x56af0fd3fb80ae6eULL, 0x0d232cdcc9ecc58bULL, 0x613e63848ace3fd8ULL } },
+        { { 0x9446ad09cf8508efULL, 0x9f3d8f0837e532eaULL, 0x83ac877e0a93983dULL, 0xfe6d31426bfc58eaULL }, { 0x8ce87afbf24093f6ULL, 0x7f9f78281fdb0ceeULL, 0xc7cc8678449327e3ULL, 0xc037dc1eed053decULL } },
+        { { 0x7c9cdfddd1e14785ULL, 0x1734ff74eda6d15cULL, 0xd2598eda4ec17f82ULL, 0xa7b6290e24847d08ULL }, { 0x20029789888b8374ULL, 0x8ba68bba60793982ULL, 0x5f2b4a1f28c7ed7fULL, 0x6eaca9dfe4788952ULL } },
+        { { 0x648a1ff57f556fb4ULL, 0x572b70b9b594c351ULL, 0x626ccdb80144de37ULL, 0x1fdcf48dc2535365ULL }, { 0x27b7119979e3898bULL, 0xebbd6857df5f36b0ULL, 0xfac3bee45d6a2534ULL, 0xdc3afd8d641e93adULL } },
+        { { 0x6d3ba179f587a2d1ULL, 0xf8271d796751654eULL, 0x45eb84409e7e469dULL, 0x278da075eda5bbaaULL }, { 0xdfe234132f838e96ULL, 0x1b8c3a067d48204dULL, 0xa256ffcbe44a15b5ULL, 0xadf9ca81957539c6ULL } },
+        { { 0x16c1b01fc60f3afbULL, 0xbb27fdd3831def7fULL, 0x9486213acbdd9bdeULL, 0x7476902c02e3d553ULL }, { 0x753b903efec8f10dULL, 0x2dd38f3525630ccaULL, 0xdae709e3de02aa03ULL, 0x086fe69b8b105ef7ULL } },
+        { { 0x775d5a99b815e649ULL, 0x2731a85463d814f8ULL, 0xeba3db5762b86a4fULL, 0xbc4f225f0c54b865ULL }, { 0x8ab6f7eec121c635ULL, 0x8fd78ae4ff0b7903ULL, 0x3b9d5c6ab9664272ULL, 0x80bef78a7a38b38dULL } },
+        { { 0x5397bda4808ebc1fULL, 0xf9729be33ce8a2f9ULL, 0x729dcc0533db00fcULL, 0x4b78d0dced390630ULL }, { 0xa136eeef2cf2137fULL, 0x9c502dd58b4d49cbULL, 0xaf4a7dbfcf029110ULL, 0xdaa35ce16cbe8a02ULL } },
+    },
+    {
+        { { 0xfa7a7ca447e0830aULL, 0x10ca4982bf923c8cULL, 0x7f341b264eb89fa7ULL, 0xdad2e00c62580214ULL }, { 0xf4431edc05dc8064ULL, 0x9cadff5b3572b257ULL, 0x4ba505d1846d4e4aULL, 0x2c352204d3ee3dcbULL } },
+        { { 0xaabac3a01ae81229ULL, 0x090dbd12148e1882ULL, 0xa85ecbe331cb7aa0ULL, 0x609b647a128bb31fULL }, { 0xbac0683a6630df86ULL, 0x6464115f1b018227ULL, 0x3656bcbc355a4889ULL, 0x016544e2bf83cfa9ULL } },
+        { { 0x1695386addaf95d7ULL, 0x1c987ab7809ae02fULL, 0x891cf742c451d3e7ULL, 0x86849e365768b696ULL }, { 0x0696cd51cbbfd204ULL, 0xbb53a371fed897b8ULL, 0xe0fe223d8aa620e3ULL, 0x1b5ee8d952a8f25bULL } },
+        { { 0x66f8ab1f49b34898ULL, 0x8abcdb14639542c2ULL, 0x2bb1c7d369f1d26fULL, 0x5f81d57eb38a33dfULL }, { 0x09ac2fe3b93b7f35ULL, 0x04fb8aa50495e23aULL, 0x1eee24aa827c7e3fULL, 0x7abea15264764e0fULL } },
+        { { 0xcb0aaa027fb566cbULL, 0x1a6619850a7ce78fULL, 0x4da4e27ff37c5adfULL, 0x7681e6730cc939f3ULL }, { 0xc7f2e4f0c454574eULL, 0x9de8a32aa8537580ULL, 0xe6a9c10210def8aeULL, 0xae78232c464719e0ULL } },
+        { { 0xbb1be472ca60070bULL, 0xda7cb863e8528806ULL, 0x1db15b4c118e6553ULL, 0xa025fdbb65c5d88cULL }, { 0xa39d8ef43a386e61ULL, 0x6d3ec0acdfcfdddfULL, 0x2796b244b71d31e6ULL, 0x2573307ccf115f67ULL } },
+        { { 0xa11cf832253844a2ULL, 0xdf87f03b693d4fd2ULL, 0xb61f06996b0eb704ULL, 0x080a5bd3ac59d2a2ULL }, { 0x73f596981643cbbeULL, 0x10a57d7f4b7ba290ULL, 0xe4b82c9bd0447972ULL, 0x404dd6842f43f859ULL } },
+        { { 0xdc0933f40f154082ULL, 0x827e9dc538f58e69ULL, 0x2a0d7f9268dec2a0ULL, 0xd63fb894bd1ad785ULL }, { 0x98514af51f28a56aULL, 0x2da1b2527bc9a0dcULL, 0xa9ac1d6954e93581ULL, 0xc88393292baaaa7aULL } },
+    },
+    {
+        { { 0xf18e7aed83f43b77ULL, 0x920f9627c2aa04daULL, 0x6cdbef514a82737dULL, 0xa4c4552e6f73484cULL }, { 0xd5746e8131d71064ULL, 0xd3dc3b6a879a4556ULL, 0xfe97658c8195822dULL, 0x029f23dbb5487724ULL } },
+        { { 0x930cc9f740cd9210ULL, 0x2503f6ab850d3b04ULL, 0xec506ec3a7ae15b3ULL, 0xbbc07d6dea31b3d7ULL }, { 0x7a3b5c0928537f3aULL, 0x422e43faf88fc051ULL, 0xe3124491719b38faULL, 0xceb14c768d876920ULL } },
+        { { 0x38d4bbc00e9a20f3ULL, 0x894e9aacfd2e38f0ULL, 0x2da01f5ecd9b4b2aULL, 0x16a3865f318c4485ULL }, { 0xaf5b433bbfa19d23ULL, 0x25a7b72f4364d1fbULL, 0xc95fb6617560aff9ULL, 0x45f88a2f46c4ad73ULL } },
+        { { 0xa6e7de7cbff4117aULL, 0x76f3b8206a0a77d1ULL, 0xc5d05f86c7a61f94ULL, 0x203e53eec43c20e1ULL }, { 0xa0cfb1f92b3123e3ULL, 0xb9df4a57cd1e0306ULL, 0xe16f372a0ecfc4e5ULL, 0x7a4890e1fe4b90f2ULL } },
+        { { 0x06215553f63ab511ULL, 0x33aa9936bf0024f2ULL, 0xa6976aa3fe9443deULL, 0xbb3a3f6b9cfd96c8ULL }, { 0x07685d1a5a01db04ULL, 0x719b19431aff9ee0ULL, 0x78b18d3336b9d144ULL, 0xe053504883314c11ULL } },
+        { { 0x7ac6f818ab46baa1ULL, 0x1a7e6e33612e7294ULL, 0xe75d4bd784f7970aULL, 0x01f7477d109b6bc8ULL }, { 0x6eaa6485f4f82041ULL, 0x15bcf8e47253a748ULL, 0xbdf0ff850e25199fULL, 0x7c04d155d38a3a51ULL } },
+        { { 0x4d42e7cade493b9eULL, 0x20d44d8bd50a2e6fULL, 0x776744dda136cacfULL, 0x7076da71b7c9a92bULL }, { 0xabbf894e623f74a4ULL, 0x97a82645198a20d0ULL, 0xe7cf94a93afc2cbcULL, 0x321d0eaeaf78625cULL } },
+        { { 0x087707925c3cc91dULL, 0x046988d7a90cc9caULL, 0xeffafc6704b7b23cULL, 0x40bd30de5442d455ULL }, { 0x0fb45dd1894fa50fULL, 0x21d1d9d41d94ffa0ULL, 0xe173942e9b86eaa8ULL, 0xce014737fd5c7b97ULL } },
+    },
+    {
+        { { 0xf39b64b8d7ddf9c6ULL, 0xd45385b45d569f45ULL, 0x664a3cc47bee2c10ULL, 0xe8dc0a927a85dcf2ULL }, { 0xc52cb3b7fb9f2d66ULL, 0xbdbfd7c69b383fd9ULL, 0x2e68030445354223ULL, 0xd28024a20f793d28ULL } },
+        { { 0xb3b41b05ea3c920cULL, 0xd89b5c9779d9852fULL, 0x9d28072a5b5e3864ULL, 0x42da1975f844faa6ULL }, { 0xe79c488fcb8fddbaULL, 0x1f657cd648a7736bULL, 0x886b0cf6f97fb64fULL, 0x5149b5a476a28a3cULL } },
+        { { 0x2d5227d97ae039d4ULL, 0x568b6907cf8809feULL, 0x8aad94e4c236afe2ULL, 0x6425f1df73349590ULL }, { 0x651576fa705c1877ULL, 0xbd33cd65a5863955ULL, 0xad74a1422da96aa8ULL, 0xf6b257b859cfe828ULL } },
+        { { 0xdb79ed3709e7162cULL, 0x44616839210d92c6ULL, 0x5b031f2263dcb460ULL, 0x3973c3a21f0a91f9ULL }, { 0xe3a171c34fd105a2ULL, 0x90e8b6d77415e7baULL, 0x85b1245085cb608fULL, 0x1c34558c6cef3a42ULL } },
+        { { 0x0b3517a5c0818eb0ULL, 0xb2542758494eacb4ULL, 0x29e41540cfe65976ULL, 0xef748f19e9e754e0ULL }, { 0x408c7c005404417dULL, 0xe9e1e58324a02cfbULL, 0xdf4d2a8c389b9621ULL, 0xb0567d0c5aedafdbULL } },
+        { { 0xa51a11b8209724edULL, 0x00a8bff0e207e04eULL, 0x638f380782fa05aaULL, 0x9b4c5fc6d78566daULL }, { 0x0cc03a3846eeca00ULL, 0x9fa888d2fbb8afd2ULL, 0xeb5fb433c79f1b26ULL, 0x6d14808f9e129651ULL } },
+        { { 0x4094addea105287bULL, 0x9e6c509d8357e768ULL, 0x1aca32cf66b37f54ULL, 0xe9d461b68101b4bbULL }, { 0xf7872c9e5c20b957ULL, 0x9c3b467f7c9a4e10ULL, 0xff264216a2f3f3b2ULL, 0x543fb55a685cb72eULL } },
+        { { 0xba072db16bfb7d2bULL, 0x47d37598cd530741ULL, 0x436511603c42d1f7ULL, 0x56246f5ddf7ad0f0ULL }, { 0x8fb015ac61e482bcULL, 0x0d85d7a7349deadcULL, 0xd1c9cb04dbe87257ULL, 0x7fafce4d991f4753ULL } },
+    },
+    {
+        { { 0xb37b0a32788ddfa9ULL, 0x195e96ff22de8830ULL, 0x6746a7a8e9970a54ULL, 0xf831020432c3b8e3ULL }, { 0x8f88c4e569d78b56ULL, 0x552d969932e19cb5ULL, 0x0992234575856adbULL, 0x8d8e9c907f98d51eULL } },
+        { { 0xf71b570de7d2dd53ULL, 0x1b3f2bfae66c00b0ULL, 0x79966be0e0035164ULL, 0x34973c74f446dc7dULL }, { 0xf5d6eb2511f54954ULL, 0xbf2b50ccfa3d438fULL, 0xb2ec85c56c64c70fULL, 0xf393648b48be0622ULL } },
+        { { 0x9d6900342e08da84ULL, 0xf5b19b0f5910338bULL, 0x3fc4466e1fa0bc39ULL, 0xca53dc42f1112f63ULL }, { 0x92aca6d663a3dc0aULL, 0x8dcedb909419064cULL, 0xf9fa275d3a91d432ULL, 0x7e0a58c7eaa0d1d8ULL } },
+        { { 0xddd3edb4b676803bULL, 0xdb1c89891f133225ULL, 0xd126568de0d8bab5ULL, 0xb5ac5b4fecdc8566ULL }, { 0x722ff7a08f3d8f23ULL, 0x36c915e9f10be28cULL, 0x2fbb05c2aafa221fULL, 0x68ff90a1023ccb2aULL } },
+        { { 0x0ad176718b8e24e8ULL, 0xe32d77d002b1cea8ULL, 0xe0d299e160bd4d38ULL, 0x1bfba2ba6c91ec2eULL }, { 0xc088dd8b70d20a36ULL, 0xfdbf6f481229f50bULL, 0x92c76498be6c6296ULL, 0xe683842b9dc37f91ULL } },
+        { { 0x8afc20fc4d476783ULL, 0x9d537b0c4f4a4105ULL, 0x2777c5b3d4909288ULL, 0x4c171ecbd86b966dULL }, { 0x78434d758aecd3b1ULL, 0x42ff5d513c3c750fULL, 0x694d185fd09948b7ULL, 0xf04ac838f3b49daeULL } },
+        { { 0xd22f6193557c6f06ULL, 0x1e63aab135632c35ULL, 0xe29bf3051937f1c0ULL, 0x0b4663637a50026aULL }, { 0x366f11b217981c5aULL, 0xd6ee7b2f519754dcULL, 0x5a97284a307d0e67ULL, 0xa557ad4464b277a0ULL } },
+        { { 0x5eb45bc6bd99aa45ULL, 0xa6d3f368897f9d2fULL, 0xb0d510790ef0a6d5ULL, 0x61824a1596060347ULL }, { 0xca274dc3f4aafaadULL, 0x18f0d11430c72081ULL, 0xc5655c7887c9b89cULL, 0x1aa6ec7c35cd57c7ULL } },
+    },
+    {
+        { { 0x3fec6c68362051dfULL, 0xa47f4d3c459344fcULL, 0x2b2dce3d4600aeaeULL, 0xb011fb6752b87527ULL }, { 0x32935ec3038a287cULL, 0x3a4d78bdb04b4e6eULL, 0xea091adecf457bd2ULL, 0xc1c5eaf4400262a9ULL } },
+        { { 0x2c44142027bd7f11ULL, 0x6a81357ffb60b0c4ULL, 0x9aec5c76435c0494ULL, 0x81de8d9b6c5a26e0ULL }, { 0x4ee94721c0994fd6ULL, 0x0a064d0834a8f772ULL, 0xce0a4697d0d19c37ULL, 0x17e69edf17fee1a0ULL } },
+        { { 0x8cef90eaaa0712c8ULL, 0x63f22ec88a21e8a1ULL, 0xf91ecb5e6d353500ULL, 0x71ca73c87c42683dULL }, { 0x75137bac9f32ee95ULL, 0x41ffd6176513060fULL, 0x7262be928ede1944ULL, 0x828d85ece00a0f74ULL } },
+        { { 0x607d9ff50d97e720ULL, 0xb2f45187d58ded63ULL, 0xc3c9a473cebddda5ULL, 0x158c5ffa9f2a826aULL }, { 0xb013c632c9926a4cULL, 0xb77ff183fd9cdcdfULL, 0x10522cf960f2a870ULL, 0xec9cb27b8b785dd2ULL } },
+        { { 0xd2b1abd0725375f2ULL, 0x1fa635f446c867b1ULL, 0xb3304871863a1ceaULL, 0xa265d18509b7d3abULL }, { 0x0fa39fb356664e8dULL, 0x43d06fec9e0f7724ULL, 0x1b37713b04fe4f51ULL, 0x50577d0658b84388ULL } },
+        { { 0x31acbe45d6454f35ULL, 0x1960fc7c612f9278ULL, 0xbc92c2e18787406fULL, 0xb7a68eefbb7fd664ULL }, { 0x0310bf1eccd10dadULL, 0x9cbbaeaa8dcfcd2dULL, 0xf0a24cc778d1cb8fULL, 0x52d8544bb29ae8dcULL } },
+        { { 0x734b6f6dca73317bULL, 0x12cb5e5ba4babd91ULL, 0xa91030a54a88b5edULL, 0x72cc58e9f88e727eULL }, { 0x2c7212c27360895aULL, 0x0d9342f2dc9680f5ULL, 0x666f125b8d92b570ULL, 0x7ed1dcb3c8b4ccedULL } },
+        { { 0xb61c560c093e7b88ULL, 0x1a071d2c7836b6afULL, 0xefff0cb78744e2baULL, 0x64e682411d98c1b4ULL }, { 0xcd6960eb255b2058ULL, 0x49ab8da44fbea5d6ULL, 0x187e10633be9fc79ULL, 0x8a1b1e05608c2ed2ULL } },
+    },
+    {
+        { { 0x0f9d275d3b9955d0ULL, 0xf1d4a4e11c8821fbULL, 0xa68b3db0772fff7dULL, 0x44e88d514ad0157eULL }, { 0x30215fb5b2cd6a45ULL, 0xbe06c395cc8b83a3ULL, 0x65939879278783b8ULL, 0xa2afb709cfdf1c78ULL } },
+        { { 0x59e0e25e9f786bbaULL, 0x84ccee5ef569f776ULL, 0xdb3cfdd8c65e8e91ULL, 0x6e8356b1204b9083ULL }, { 0x542586a51d352666ULL, 0x85dffa611efe1b23ULL, 0x55cb76cd08e848aeULL, 0xc0a2e3458cdf60c7ULL } },
+        { { 0x03b3ed03d60ac5eeULL, 0xd7ff1d19774f226bULL, 0xf3023f78974fce02ULL, 0xbc7a21f14d58863aULL }, { 0x11f20287afa49904ULL, 0x38eeb5cacb652fc9ULL, 0x36f83dba60968927ULL, 0xa277fb42b1f816e3ULL } },
+        { { 0x4ded7eea33fa7cc4ULL, 0x46d343384878a57eULL, 0x3886e71d3ca03752ULL, 0x89b88f81fb64fd08ULL }, { 0x63b59d57d01cfcc7ULL, 0x59b5489f92395b98ULL, 0xfac7723385f9b49cULL, 0xfafc41aa5278f731ULL } },
+        { { 0xf15ee76e586fdd0cULL, 0x0312aad9c3e7e467ULL, 0xade1974dc8f701b0ULL, 0x0ed28eb1ed1cd6f5ULL }, { 0x38294a8eae84c01dULL, 0xf92455fed18640deULL, 0xbcbb94b2012248ddULL, 0x1501fcac56144cf7ULL } },
+        { { 0x3b5f167b0998809fULL, 0xc3e839432a2f571dULL, 0x8549ba82e7b0d324ULL, 0x7b06a63a696a7f38ULL }, { 0xced578da35449b93ULL, 0x4ea9415e3cc159faULL, 0xc3ddbda557b90f18ULL, 0x24fdf0788700badcULL } },
+        { { 0x2f290b5f6b36ad4fULL, 0xe6f761905cb095e2ULL, 0x293954833b554ff7ULL, 0x8554594099764874ULL }, { 0xff1214b87450a88fULL, 0xbc9cb6de59e88b1aULL, 0xa9e067ad8bfdd7a8ULL, 0x78aa457fb28f7d79ULL } },
+        { { 0xbca63e99d1b71f70ULL, 0xc32ead3445b80826ULL, 0x40cdb35ef22ca374ULL, 0xf3345d52e3eca583ULL }, { 0xb7ac8953eec9a46eULL, 0xa53937d5f9e6d29eULL, 0x6f368183e1f8a6fbULL, 0x9d8c3243806a8abfULL } },
+    },
+    {
+        { { 0x8143df731033b53cULL, 0x68a707c066e26976ULL, 0x6137bbb39f632135ULL, 0x3dd0766c53d7671dULL }, { 0x5911dd901ae41b8aULL, 0xf03b9577d36dda61ULL, 0x54b05a758124e895ULL, 0xca3d029377ae9102ULL } },
+        { { 0x7ebb859b31374f15ULL, 0xa0c99e14ef252dadULL, 0x1e7986cf67ece5e9ULL, 0x5da0ead591977b66ULL }, { 0xa649c74409327227ULL, 0x872a712d54749258ULL, 0x726afe793200c5f4ULL, 0x0e2bb0c1afc17f8cULL } },
+        { { 0x0a7aadacaee278cdULL, 0x0bd37337e72ce5b4ULL, 0x35c08cbd8d21921dULL, 0x7d701cd28d87ed78ULL }, { 0xd5c6546c0d2a3e10ULL, 0x37a50ed407beebb1ULL, 0x00da46ca081d9414ULL, 0xd36cb2d608750cc1ULL } },
+        { { 0x9cd93b4fa7c105f2ULL, 0x3f726d9dda99164aULL, 0xc712c46bbf4a949cULL, 0xe59e6eacc37256b6ULL }, { 0x15cd9bb1690f6301ULL, 0x4651e3ee12731855ULL, 0x1b89ff18afef0287ULL, 0x828f05f38cf8ef33ULL } },
+        { { 0x6d751750a19f5eccULL, 0xf746551a2ffb4cd5ULL, 0x5575864fdb08923fULL, 0x3f2f7c398665e82fULL }, { 0x65043ac6442974f8ULL, 0x0391f9f5bcb68cadULL, 0xda680e7fba87e2b8ULL, 0x2afd930342e930baULL } },
+        { { 0x99581231d6a50dfdULL, 0x04685a7ce0417fb3ULL, 0xa008475d208b5fe3ULL, 0x2c4c429b6410c058ULL }, { 0x79e4fd13310092c3ULL, 0x7427d01f6d1a521eULL, 0x147eccdc3df97d1aULL, 0x47855f0183dfbd77ULL } },
+        { { 0x1152001b9e88441bULL, 0x30591910c44d3b26ULL, 0xcfc94cb496a352e1ULL, 0x2cc7dec2bd6c3797ULL }, { 0x54a07dc35e2ff1c4ULL, 0x49a8ee2dc85cca42ULL, 0x697ef96d7193b71dULL, 0x9d45f02afe87cd2aULL } },
+        { { 0xe94fe04233a02c72ULL, 0xdae4fcc28fae1141ULL, 0xe72a038a3f2e6273ULL, 0x9a1ce36d6a25d515ULL }, { 0x8153e8a1fd073863ULL, 0xf2211bd25172d501ULL, 0xc124656ac53b5a95ULL, 0xc8053ff736f92d75ULL } },
+    },
+    {
+        { { 0x627d47f0f02f3c7fULL, 0x90ef4f98de1836bdULL, 0xbc213bc1037ab96cULL, 0x68a85d1c081136bbULL }, { 0x118d9406b2416e55ULL, 0xa141225e9cc314d0ULL, 0x789a1ba17b11b196ULL, 0x913dc0847e118e33ULL } },
+        { { 0x72b4f8211fc992a2ULL, 0x978e8dffa6b4a84aULL, 0x5675e4b46c376e65ULL, 0xea7ecdd912adfa1cULL }, { 0x2716fbfa015c63caULL, 0x5cf2d9d8ffc2525dULL, 0x0486116b65982e03ULL, 0xb1efea6ea4391e19ULL } },
+        { { 0x0cc5027987732723ULL, 0xb9c6bb3e558feefaULL, 0x1bcc46caff0b193aULL, 0xcdc0a8c8cbd69b3eULL }, { 0x41eed8caea79f2daULL, 0xe8ace5f3255e53b7ULL, 0x395a8fe488ccf86bULL, 0xd216328b20ed30efULL } },
+        { { 0x6182edd77bb8f7ebULL, 0x0c8ff597fd42abaaULL, 0x5a70613f2509587dULL, 0xf1021c86c3065d12ULL }, { 0xc2f6f6f1a4400c71ULL, 0xc223cd9bb1534643ULL, 0xeb80c17347a2a271ULL, 0x819f5c66085c5509ULL } },
+        { { 0xbcc615ec0f9ab359ULL, 0x1aa2882db2c6164bULL, 0xfb149a32f655391cULL, 0x7ca3089ff65236d5ULL }, { 0x7c4cfe2716c28f40ULL, 0xf79da06c0fa0b7c2ULL, 0x94f42fa6034e0a16ULL, 0x7ab3f95fe38de64bULL } },
+        { { 0xe12cd1411ae39054ULL, 0xfa03dec7ec48169bULL, 0x9a7e5f54ffd4e32fULL, 0x9fca095195d1e91dULL }, { 0x4926b7f3e9d89d35ULL, 0x8482378f78d87706ULL, 0x01fbb845037c6654ULL, 0xdf0a2f7c23e2f8e9ULL } },
+        { { 0xd78c87b6eb8cbf0aULL, 0x58159265f83dab15ULL, 0x9514e9e33151f64aULL, 0x1c88c3f00f1b5bb6ULL }, { 0xdc4aca8597b858c7ULL, 0x10ae8cd30edd4865ULL, 0x1936de9d1bc6cc91ULL, 0x00e1ce30e20418f8ULL } },
+        { { 0xe389017f4f09f267ULL, 0x486a41c6685428b5ULL, 0x41b004a9df51c763ULL, 0xf870a9d5d14d921dULL }, { 0xca0b73a41a697050ULL, 0xdc946697782140cdULL, 0x9d1b51dd70307904ULL, 0x6a63bc331d479e44ULL } },
+    },
+    {
+        { { 0x196be23c6a975d8bULL, 0x6d7848f8de2aef07ULL, 0x880e9c1b88971bdfULL, 0xa0b61ebf9617507cULL }, { 0x7881e1ccb558d193ULL, 0x8e3eb39e27efe5dbULL, 0x78bc5008a94fbc74ULL, 0x1a4b3db705b737b4ULL } },
+        { { 0x7c5160a69495b5d5ULL, 0xdcacde01f28742c9ULL, 0xecb43151c36ab664ULL, 0x0f12d8b71c4951b8ULL }, { 0x074e467a6cf69608ULL, 0xc1fca494e511db0cULL, 0x9e7f32d75e9d0611ULL, 0xe175a733bfeb842eULL } },
+        { { 0xf131a5b1fa650f2eULL, 0x3caa49a520da5a45ULL, 0x24fed3b9c2438f2bULL, 0x2cc1dd26da6b04efULL }, { 0x2a127b3bf4e712baULL, 0x0b70938a68312cb3ULL, 0x6ad2ea017b0fbdeeULL, 0x3acad928be454e4dULL } },
+        { { 0x311570c20073091fULL, 0x647e3c94424de0f4ULL, 0xde2d71b08c1a63a2ULL, 0xdf945b97f86636edULL }, { 0x0baf127b03e3fe9bULL, 0x92f831226b52aae3ULL, 0xd9ee0e78153e74abULL, 0x9dc9515440be2c16ULL } },
+        { { 0x439ee637ff55ee27ULL, 0x4582af544197b103ULL, 0x9eb0314aa4f51df0ULL, 0xc36d22488ea0aff9ULL }, { 0xced232862fb634dbULL, 0x7e6dc894717de21dULL, 0x26790435bddeaa23ULL, 0x85e9b4c1c60f5f3dULL } },
+        { { 0x682cbf3ccdde20bbULL, 0xa47c3fba6a732b9cULL, 0xacec43170ce1c418ULL, 0x01918f433590c160ULL }, { 0x75b33494c9a8e4b8ULL, 0x2eeeb35e768b6247ULL, 0x7cd0c3cd4bc33c58ULL, 0x3bcf455ba7072e53ULL } },
+        { { 0xa711ef88d5636ab2ULL, 0xffb5a3a829744971ULL, 0x771631a07367f41dULL, 0xbfb67bfa6406b576ULL }, { 0x131d115927651342ULL, 0xac7e214a46e3f66aULL, 0x0aac82c63eb4550eULL, 0x8559e605223b5174ULL } },
+        { { 0x4edab17198a9bc05ULL, 0x595ab16187f2da64ULL, 0x979ec870a2f9ed58ULL, 0x86d5088e821939e4ULL }, { 0x3ef8e783a7e275edULL, 0xd3ee8fa2597b7d0eULL, 0xfa9feacae37c7a09ULL, 0x5c99fe2a1bf492b4ULL } },
+    },
+    {
+        { { 0x2ea0d0e07801a3c5ULL, 0xc83d3ba418b8af1cULL, 0x60f8e2afd51c0a1dULL, 0x8316659aab2dcd2cULL }, { 0xb17fe8ddad4913eaULL, 0xfaa00a431ebaf2b4ULL, 0xd9b384153f6b097eULL, 0xc834b7856a966271ULL } },
+        { { 0x0e56c67b932f4e0dULL, 0x5f679c3e13ec96e5ULL, 0x4ce06b7e2b0f5e32ULL, 0x0a533bb6fedc75e4ULL }, { 0xa0dd19b0b380df09ULL, 0xf4929faf3a6ddb00ULL, 0x1915c83409f7c1a0ULL, 0x472b336b851c1a2bULL } },
+        { { 0x5b22d4d6bf331b58ULL, 0x06be0082db31aff6ULL, 0x045ed6353d46956cULL, 0xb2d277ea2295f501ULL }, { 0x782075e70fb9bba2ULL, 0xa9b510b085282daaULL, 0x047c7ccce55149a5ULL, 0xc4c8909dfce1fc7bULL } },
+        { { 0x1b28f46c8d196a53ULL, 0xcbbf4f19cdbd9fe4ULL, 0x8f50d741659aec4aULL, 0x7a3f13c4a1fe4731ULL }, { 0x8b08f67d9c48ea03ULL, 0xb6b1f23a30bfbbc2ULL, 0x506bcd04be1922caULL, 0x776a01d887d25258ULL } },
+        { { 0x3b849b79b3d4a304ULL, 0xdc5f46bbdac38135ULL, 0xad6202bba079ffa2ULL, 0xe64eff16bbf8a18fULL }, { 0x62fee364edc489a5ULL, 0x7b03a27ec8dc8966ULL, 0x7532af3af2a6bb96ULL, 0xa3ab2011e2367625ULL } },
+        { { 0x14a5ff03eb8df1e9ULL, 0x874ca421bb0729d6ULL, 0x21056f6e031a01f9ULL, 0x56b6f8f7851b754dULL }, { 0x739ec41beb81b5fbULL, 0x86d5f3687ed84d45ULL, 0x3a38b5b3af1f7071ULL, 0xb04778c01ae4348fULL } },
+        { { 0xeadb25c68f9cd24eULL, 0x3624fcb55d2510f7ULL, 0x7b5eb00b73a7f8f9ULL, 0x9c9b025297c891e2ULL }, { 0x24f93b39ccd9c707ULL, 0x040c35615c2dd795ULL, 0xc03216bb232b47cbULL, 0xb83559bdc1248bdcULL } },
+        { { 0x5e18dec9ea7b5d4cULL, 0xdf68b68a54824cabULL, 0x95e83fd319b979a4ULL, 0xae23018b47583451ULL }, { 0x6d542ccee4b1ada0ULL, 0xda343eaaea7dd7f3ULL, 0xeb3f361051c6410fULL, 0x07b1d023c31d99f5ULL } },
+    },
+    {
+        { { 0x9e286677f15dd582ULL, 0xd38c0a2e76af5d63ULL, 0x9a2a033020458bc9ULL, 0xeea134214dec62b8ULL }, { 0xe3a33849844ebf75ULL, 0xfa8ab7e4293f553eULL, 0x62645cb5251f1165ULL, 0xd4b950a4f5129f90ULL } },
+        { { 0x50f96b2981faa9d2ULL, 0x64012727d6f02f65ULL, 0x2cd2e3facdb1d3ccULL, 0xbdfad5a529c0a50eULL }, { 0x39985ce152aaf132ULL, 0x5b4af6d8e85b9cefULL, 0x77e7be862cdd9e5cULL, 0x571f80ae6900c97aULL } },
+        { { 0xf94e72a6013d56f2ULL, 0x773009fbdd7b9d90ULL, 0xa91e3a3b4bf59897ULL, 0x6e933bcfe142e1acULL }, { 0xda3d9e96b87e1ab1ULL, 0xe11afcf988f9e836ULL, 0x5e6a5f0e0375c534ULL, 0x51e6f8e1b6ffb25dULL } },
+        { { 0xf3282b6ac9740c53ULL, 0x03eacc2d41dbe39fULL, 0xe8b03a5067a8efcdULL, 0xffbd4db75ae21e0cULL }, { 0x54cf603d44d0d734ULL, 0x0f18661e6cb67a47ULL, 0x2c0fab457b5ee4a9ULL, 0x6b1e81db39e2058dULL } },
+        { { 0x43829b93c83f6068ULL, 0xbff91371af0dde53ULL, 0xa32c2616b855c3b4ULL, 0x02d833da93d815cfULL }, { 0x1572834608c13120ULL, 0x7f3066d09585e921ULL, 0x75bb92674a82ab0aULL, 0x9e2a57bda49befd9ULL } },
+        { { 0x146c53c684b84724ULL, 0x3a2c632f31e1ed23ULL, 0x81b05b752945924bULL, 0x467d88eef18e1eb1ULL }, { 0x48b2094135217d7aULL, 0x44c0d0e6889300e1ULL, 0xfe5ac61d6ddf17e2ULL, 0x7463b946bc48c8c1ULL } },
+        { { 0x9b34abbc1bf71499ULL, 0x54ad175d396a8d2fULL, 0xd24c5d09c21e26e3ULL, 0xac40d8502459a577ULL }, { 0xc39c86d9c44333c6ULL, 0xa8611e31fd90ecc9ULL, 0x0b0b75b48c4c4c53ULL, 0xe7cb9387e63d2143ULL } },
+        { { 0x3a5c3e5ba14022a8ULL, 0x767f663bbd4408d9ULL, 0xbb9e99f2e3dd2388ULL, 0xb74aa12bcdd212fcULL }, { 0x0fa6c246f1a3e558ULL, 0x3438d0006ab750b0ULL, 0x3ecbcddfa8878152ULL, 0xb7cfd45e4a0c9ae0ULL } },
+    },
+    {
+        { { 0x6fc1807f6cfe66baULL, 0x30916eab29707210ULL, 0xca1f8047f86680a6ULL, 0xe650ddfb89e17f8eULL }, { 0x24d3b7f8b7f54f4bULL, 0x660582f137aecea1ULL, 0xd5fbc8dd1844b7ebULL, 0x282f82f45c3dc6baULL } },
+        { { 0xaeb3ade54f815779ULL, 0xd9e995a72017c755ULL, 0x55e3665c327b5f6cULL, 0x744b60ec1388c7bfULL }, { 0x121ecdca5044e755ULL, 0xc400e8ef4d345685ULL, 0xc82145145f33d488ULL, 0xca13189759d03f59ULL } },
+        { { 0x54cb632ea4c7c464ULL, 0x85d2e1139a1d5930ULL, 0xa00f9f106c28c7e9ULL, 0xb1589cdbcf5c0853ULL }, { 0x915b865ee8098217ULL, 0x2f0bc5b4cccc11d2ULL, 0x4750d394a41ec418ULL, 0xa973399f58fdf73eULL } },
+        { { 0x501fc8eb25bdaaa0ULL, 0x7c8a5680c87a9bb4ULL, 0x853bbeb02f062926ULL, 0xb3c57893b9eeda56ULL }, { 0x68cd4a7e9bca1c9fULL, 0x59048816f5cc222cULL, 0x2536745e215d6d0cULL, 0xe5877a3a1bbb6a21ULL } },
+        { { 0x5ed591d9f6eecd8bULL, 0x4c097a281e41f37bULL, 0x7e265be21a42797dULL, 0x8e25d3c9d71325a6ULL }, { 0x40b64461415c693eULL, 0x7cb31dd96bf67744ULL, 0x31fb79264659ecd4ULL, 0xdb2e3702cc9455d9ULL } },
+        { { 0x5e774c72a34d501fULL, 0x71fe9ad757d141a3ULL, 0x36504add9ea8ab37ULL, 0x5b2b9fdb40107294ULL }, { 0x2eb43994d4d62ae5ULL, 0x6f28b3714e6dd33eULL, 0x8b0934312382bfd8ULL, 0x27bede11a1b95fd8ULL } },
+        { { 0x6aecc846ab7406cfULL, 0x52fadb5899fd9d5fULL, 0x187b3be746d9c5f3ULL, 0x79011cc53c1f4a64ULL }, { 0x055fc1c290e3ad74ULL, 0x8d1fc64508aa819eULL, 0xfd7137ebdfb275a7ULL, 0xad980bf3bf5dd11bULL } },
+        { { 0xadf5f9e66f848fa9ULL, 0xa71c274738cde737ULL, 0x4393cae367cb8c57ULL, 0xbd92c017d7b63131ULL }, { 0xa0a5af5dfb22fe46ULL, 0xb583899cf50a93baULL, 0x6d0c15bc9faccd59ULL, 0xf6523175538403eeULL } },
+    },
+    {
+        { { 0x4ea10dda37685d88ULL, 0xe3230237d731c69cULL, 0x1b763c15b08f5466ULL, 0xaff88e1ae81d1dccULL }, { 0x80727f9ad59ee10eULL, 0xb4874044fd0a4b08ULL, 0x73341f148080c797ULL, 0xd6f8686c0bca447dULL } },
+        { { 0xc120e21c6024b146ULL, 0x6ec12670897c7c4cULL, 0x93d66405cdc3bfd9ULL, 0x11a4bf0951291a43ULL }, { 0xe03be947c1d3f866ULL, 0xe8fb0d9b0b8e9b95ULL, 0x086e8f4381a53ce3ULL, 0x31638c025dbc7df2ULL } },
+        { { 0xd35b1e984b309591ULL, 0x42b1807b5ee94c5fULL, 0x83956e4ce0047093ULL, 0x8085ee1554694578ULL }, { 0x3c90c78881783d8cULL, 0x8a90901de0237c6fULL, 0x0c99ffffbaff3de1ULL, 0x2137ceaf02fe131eULL } },
+        { { 0x46b86f3e48333fcdULL, 0xf599454e879bafd4ULL, 0xb66f9bbbb1032834ULL, 0x35e2b02ad88eddbbULL }, { 0xae5260e67577639fULL, 0x717980e5c6833313ULL, 0x8810257b76486e82ULL, 0x341eabd8e2be33f0ULL } },
+        { { 0xf45195a635acc43eULL, 0x98f0e92a278df575ULL, 0xac58e78cf9c913c9ULL, 0x87f366413c2f5603ULL }, { 0x4cbfca59fdc7ba99ULL, 0x38cea97bb414b408ULL, 0x8866af438e9a95c8ULL, 0x002826f26e89f54cULL } },
+        { { 0x49f11dd054e913c5ULL, 0x7ffa161d20a72d19ULL, 0x95ffbf1d009c1e3bULL, 0x4b1b21d7629d0eadULL }, { 0x13c8ce43fe044400ULL, 0xbc674bb97a2aa524ULL, 0x4b24e77b05ee2f53ULL, 0x932c88e00b0e6b0bULL } },
+        { { 0x247c0c4baedd8467ULL, 0xa5461b8d13cbeddcULL, 0x5534be46769c62a9ULL, 0x233a8a3fe48d8c1fULL }, { 0xc36b4212ec479241ULL, 0x05d56e03032c47ccULL, 0x550734e93535933eULL, 0xd15e49f8d72acafcULL } },
+        { { 0xacd537a1907a0923ULL, 0x5d02cd7db0d1bce9ULL, 0x36039ed5e9be2652ULL, 0x87c4e3514fb0ff86ULL }, { 0x9a081ba8a7751b13ULL, 0x3458a46204f13df9ULL, 0x46766072b55e569aULL, 0x13aff2f4ef1d851dULL } },
+    },
+    {
+        { { 0xc75f9df61a89f319ULL, 0x07fdf0458db72e5bULL, 0xc1545deb23496830ULL, 0x803233b474f901c9ULL }, { 0xb2f97be80384551aULL, 0x39bc7f2b6b2116a1ULL, 0xf7f04c199421e72fULL, 0x76b396b1eb78bea3ULL } },
+        { { 0xb503d27b46a2512eULL, 0x305bb293ddc1d56cULL, 0xff6e7a8cf18ee2baULL, 0xd565ad5853e08dcfULL }, { 0x865c7f6a7a3b543fULL, 0x65ba01fa6c260230ULL, 0x48893aaace8ac62fULL, 0xdf701299d0b136daULL } },
+        { { 0xdbeed2ee54a54506ULL, 0x1cc37b4aed654872ULL, 0xcabde41c05725001ULL, 0x07998d888e15ff9dULL }, { 0x4a7ee1b54c8ea30fULL, 0x35b50e88c81206a0ULL, 0xc8d752c148d21bb4ULL, 0xe2dd8ebb054153bfULL } },
+        { { 0x1f6ffbf4b9334e9bULL, 0xf3dd5292b8fab993ULL, 0xa009aa6f5e22e2beULL, 0x98917cac1f4c264dULL }, { 0xfe34e303fdbcead8ULL, 0xa9894e9c5df57243ULL, 0xe471e05925d35b50ULL, 0x337f6278c1b1805aULL } },
+        { { 0x3fda8bf81a6e9ecbULL, 0xe8b7627b8c8afeb4ULL, 0x4f3738bd352045abULL, 0xba146059883837afULL }, { 0xcca601548a65c868ULL, 0x98aa1b1c5c236043ULL, 0xe86b595e1753be75ULL, 0x17860787df64426aULL } },
+        { { 0x5daf6d7097b49209ULL, 0xdd2d9b9281974bdeULL, 0xe91e4a38ab548f82ULL, 0x53c3424251121eeeULL }, { 0x115fbb265e963f61ULL, 0xe988b4ca0520ca29ULL, 0xe16ec5e1254ad17bULL, 0xa3651c70003b6214ULL } },
+        { { 0x5da07c157bb4c52fULL, 0x1f3c67520970789bULL, 0x18e074bf99d8f959ULL, 0x93c81fa3fccaac3eULL }, { 0xf9a197da9503412aULL, 0x62455a7601155a83ULL, 0x9392808b994227b2ULL, 0x1e9928db8301d617ULL } },
+        { { 0xaf9463c23e10d4acULL, 0x7d476867fd36f051ULL, 0xff605874da6dec1bULL, 0xf767bf939d3f6d97ULL }, { 0x9996d4bae0a9bcc9ULL, 0xda0189436ca4de3bULL, 0xbc7ed87e251d0394ULL, 0xb50387503bbfd259ULL } },
+    },
+    {
+        { { 0x79c7aa3c52b47c8fULL, 0x485a4d3b01ae5805ULL, 0x92d92ed45ce8fb12ULL, 0xca30214c59381354ULL }, { 0x7060e77cb1db1e86ULL, 0x9b3f0cd1e63f4f80ULL, 0x72b4780b5f9b5bcaULL, 0x8b3ae0efcd768829ULL } },
+        { { 0xcd5ea3b9ba7eecaeULL, 0x5a181aae98fb3e01ULL, 0xeef18e17ebae2976ULL, 0x4dfcf8557bde6ebbULL }, { 0x3bd9233a67efcb7bULL, 0xe239f907508636c5ULL, 0x55fa5bd0fc7d80d0ULL, 0x7dff3697add84e62ULL } },
+        { { 0xce4c98cf764e7cfaULL, 0xe092319c737681adULL, 0xcad0dfab076aa02dULL, 0x9b3fef504aba2cabULL }, { 0x0e5be68ec335cc06ULL, 0xe9b4a0be2df69968ULL, 0x99a6281d9b6aac31ULL, 0x8ad6fcbf9fbea2d5ULL } },
+        { { 0xb9ef2df192216e10ULL, 0x41617a46544c138eULL, 0x3c18dc9e6146ffa7ULL, 0x65971a58a123f0a7ULL }, { 0x8742256cb7236fbcULL, 0xb6b01d5d89e7d9faULL, 0xb89fc499591520f9ULL, 0x8b7e518e868d093aULL } },
+        { { 0x24406c10569acd7eULL, 0x848f9239a43a1a15ULL, 0x0ed7507ab59cb0f7ULL, 0xb1cae5e3db5d2780ULL }, { 0x8498b35de36b3d8aULL, 0xa70017acb0e03087ULL, 0xa30085ce5dd40f22ULL, 0x9cabbb995e9f036eULL } },
+        { { 0x1059d04edc26e82eULL, 0x555d746358883851ULL, 0x587d2fa7bcc8c9b8ULL, 0xccd249e9a70f9438ULL }, { 0xecd1410f3f042899ULL, 0xab2197cbd7b60032ULL, 0x7a882b686e13fcc8ULL, 0x2b254e906069d3c6ULL } },
+        { { 0x3a0a5e80744273a9ULL, 0xb90f0618f8aebce0ULL, 0x26097e15719925fdULL, 0x1dec5b447a3558f4ULL }, { 0xdf2b0d02fa7716f5ULL, 0x694c2162135ffdfeULL, 0x4c4326d0924109b5ULL, 0x015ed4fbb70e0343ULL } },
+        { { 0x0b3b54a2c8de583dULL, 0xab82996e18eb3ab1ULL, 0xb3c54da2ab894b9aULL, 0x8461043c282f693eULL }, { 0x76fdff0a2144fe99ULL, 0xdcd2cf19ee262747ULL, 0x7d5d465450aa1526ULL, 0xd51f0acb18a7ec6aULL } },
+    },
+    {
+        { { 0x8ef75e07e9bafc5bULL, 0x3d9a8f7e350ded97ULL, 0x80bd9f33be5a617fULL, 0x9e4bb18739ac3f81ULL }, { 0x862f676d16d6010fULL, 0x57e26af2431fad0cULL, 0xa4eabe7751b31194ULL, 0xa3c5ad45e6688201ULL } },
+        { { 0x98578a3e0a870b65ULL, 0x4c3c18627bf17a8eULL, 0x91d83ced4c3c451aULL, 0x53345fce55e87cf3ULL }, { 0x9fc74ceb07bfc06eULL, 0x98f43f1963c9c166ULL, 0xd0323a57064a11a9ULL, 0x062daf419f9ab838ULL } },
+        { { 0x78f3382ec79e075aULL, 0x513fa60d18a421c7ULL, 0xcc3072f29c5819afULL, 0xd7e13b43fa1bb510ULL }, { 0x9fcde704fa5a4c87ULL, 0x8abcd0ea1b99a2a3ULL, 0x475f27a99bd447bdULL, 0xd76a8d293e59c3d9ULL } },
+        { { 0x816a7516053928d8ULL, 0x7e94f13642ae7264ULL, 0x23232c2fce07ce23ULL, 0x01e4a0f24817d6ecULL }, { 0x441a9b63cc20ad14ULL, 0xfb48322f0d21eceeULL, 0x3731da85e18282f9ULL, 0xc8b9bce3bebac026ULL } },
+        { { 0xaf8cc1eafb40f6ebULL, 0x6323b09e46da720bULL, 0x88ffe8de1d38f39cULL, 0xe83c64778130b24aULL }, { 0x742c9a22eb2d34f5ULL, 0x1e6d6cedb5a748ccULL, 0xd404e103fd9beb10ULL, 0x2961fe889afe95beULL } },
+        { { 0xeaebea1b715ec3d8ULL, 0x041b6a8f0a12419cULL, 0x62dc7c817c938a34ULL, 0x82487751cdc5fff7ULL }, { 0xa6b66a49e1af59ecULL, 0xc3a4bcd39477d26eULL, 0xf1a11d023814db8cULL, 0x54eee4f868db15d3ULL } },
+        { { 0x6bf7ca4cbd1e9747ULL, 0xb1b6ad5443ccc4bcULL, 0xc69f28848da84a61ULL, 0x0091c7f7f9711542ULL }, { 0xc4e6f225453047f6ULL, 0xc596da1b97c7e3e9ULL, 0xfb13d165a8f52b67ULL, 0x196372851a9c488fULL } },
+        { { 0xbc71da828f55569fULL, 0x994f22aafcfa8eacULL, 0x7898ca3ed125a428ULL, 0x515a1546d0b7b7a6ULL }, { 0x5a2683b5b69bf491ULL, 0x6ba81619a42a807fULL, 0xc0fd26c3c94d5215ULL, 0x62a45aa718530846ULL } },
+    },
+    {
+        { { 0xb7ff1e3c63ec25d5ULL, 0x34eb853ddb0e0ecdULL, 0x6abf274e8585f678ULL, 0x1c5631cb042f940fULL }, { 0x9316062ed878876eULL, 0xe33fb504f646f4daULL, 0xbe768e51e8325e17ULL, 0xa149fd9f34669720ULL } },
+        { { 0xcca2d240253fc4d8ULL, 0x665bd37c6bbce9fdULL, 0x068259351894ef09ULL, 0xb778698de1e94d49ULL }, { 0xf7375453d000ae5bULL, 0xff480ab33cf25ac5ULL, 0x7e9c73cd5bd55565ULL, 0x8b94ccdb9e93c4ddULL } },
+        { { 0x9d14350691113ddeULL, 0x96cf601ffaa36cd3ULL, 0x5c3e3e3484c9ad57ULL, 0x23bfe8fa40d2a664ULL }, { 0x6aa979c80b0e3449ULL, 0xd6826281512709f7ULL, 0x0b325140dddcf6f8ULL, 0xfe84573c3b96457cULL } },
+        { { 0xc41f39152bc3aae2ULL, 0x647c4281b3e50c95ULL, 0xad4c2ad6f96fb010ULL, 0x7226aecf177625fcULL }, { 0x37ba555d84607f8cULL, 0xa03071cbb543a91dULL, 0x3d211ac9053d0710ULL, 0x164fa46a5c2a1d89ULL } },
+        { { 0x6ba16f01aab60c4aULL, 0x6a49482b30fc6d9eULL, 0xdb8b259e2c53529eULL, 0x8b7c86ff2d84e640ULL }, { 0xe00db5ab172d799bULL, 0x757c12d8515f7b43ULL, 0xb4cb0db24f670d61ULL, 0xd3d0ce6cdb7851efULL } },
+        { { 0x901148b82601a0f9ULL, 0xd159b7b51c2f6728ULL, 0x5e68fc11cc954a0aULL, 0x41ae292b39fb7506ULL }, { 0x22cd6ac6d3f431e6ULL, 0xbffb87b485600b52ULL, 0xdccd3777df10ecafULL, 0xbf2802da49156937ULL } },
+        { { 0xad138ad6ac56a0ecULL, 0x91c0ff9d3e323ab2ULL, 0x1bf49907010cd90eULL, 0x06c2f2da79984b29ULL }, { 0x853bbd616f121efbULL, 0x9de9a724af023e33ULL, 0x2d68acbee264e3f7ULL, 0x5bcea7a453567079ULL } },
+        { { 0xc04700aa4e52ea93ULL, 0xfabef0f2045fc580ULL, 0x5dc7a6697576a121ULL, 0xc9fb39cb4199b106ULL }, { 0xd32e50b582a264e5ULL, 0x74602584bfb73909ULL, 0x302beabc5a6d6668ULL, 0x36a212c71d9d4cb8ULL } },
+    },
+    {
+        { { 0x1e41e6c6161994bdULL, 0x826e3e7d3bbe1a5aULL, 0x96eef1a91959a233ULL, 0xda19b770fddbccd2ULL }, { 0x4ef2d04b043ecc44ULL, 0xfe0a70e2717959f3ULL, 0x9cb08894e4d35aceULL, 0xe7f33491e624edd2ULL } },
+        { { 0x30050eab22a925abULL, 0x04ca1b18c17fa9c3ULL, 0x65cefeab2e78c658ULL, 0xc41fad727438db43ULL }, { 0x325ed5fdd4e767c2ULL, 0xf8f234322f231c8cULL, 0x4113b363461be3baULL, 0xdb7f3ed1f05d9065ULL } },
+        { { 0x48f3da8261a84855ULL, 0xaba0fd9e0f833d73ULL, 0xb394fc65ca2a4697ULL, 0x6d1396d7235b671bULL }, { 0xd0e4f469d30eadfcULL, 0x7793c845bbba35d9ULL, 0x8a1df169e6720c17ULL, 0x61a6ad6c692513d6ULL } },
+        { { 0x11a6c189db30b8e4ULL, 0x05c8c37f86e86078ULL, 0x49e7b2a2c1d86e41ULL, 0xe2d5caf25b7ec203ULL }, { 0x9b2d14c86e0bc3f6ULL, 0xbccfc175fb1996c3ULL, 0x656d73419146034dULL, 0x1b52695f4ee15b9eULL } },
+        { { 0xb5f6d463806b9289ULL, 0x3ea598cc3a6b0c34ULL, 0x15f45b42584f7281ULL, 0xe1d5c601bc7ae6a1ULL }, { 0x54e77c12c047baf7ULL, 0x8a28dacd8d094856ULL, 0xf97a4708c966a377ULL, 0xab6d968d1194bcb1ULL } },
+        { { 0xa1a419c0dd66df72ULL, 0x3d6163e1220d437bULL, 0x66f4ab9648f65b65ULL, 0x7bf2e16624c1b07aULL }, { 0xa5f752daf7d59ed7ULL, 0x822a36a7397002b2ULL, 0x2217d8ba95a0eef2ULL, 0xc638e2ff112130cfULL } },
+        { { 0xf54e8f53fee7400aULL, 0xcbf23a535440ecb8ULL, 0x671454fee144a499ULL, 0xe4271d4cc2f2417bULL }, { 0x9959256a1192e312ULL, 0xb6047a30f136183bULL, 0xdab5ac051401c327ULL, 0x6e6be56ef2165db9ULL } },
+        { { 0x129991cc8d50f5e5ULL, 0x8bd33e4c9bb3eb63ULL, 0x265d11e855237dc7ULL, 0x1b18a622097c7dd8ULL }, { 0xa70c971bdc82b2f0ULL, 0x8a327174b46475ddULL, 0xc691c628a02937bfULL, 0xe0116a1ab25bf0c1ULL } },
+    },
+    {
+        { { 0x4ce5f7dfbe92a7b3ULL, 0x47b3ae5b73b3343eULL, 0x50f4f84e5b420387ULL, 0x9f0ab1f288310928ULL }, { 0x74ebb140b12d1d1cULL, 0x0ae6cedd31ac2cbaULL, 0x32723384c21bdd1eULL, 0x6f96281ad5c6c2caULL } },
+        { { 0x8abe2721439eb333ULL, 0xa25898fb5ef06c04ULL, 0xc0457e1209e8a2b3ULL, 0x42a82291d3db51aeULL }, { 0xfa5694d6bb8b6574ULL, 0x96c9d0d7821a7c54ULL, 0x6ca9c8709c7307f1ULL, 0xdf986b010b61315bULL } },
+        { { 0x6803bfa3dcd19554ULL, 0x4234c6c0bf57cdb0ULL, 0xc945ec0c997d12feULL, 0xa17edb0e9c54da30ULL }, { 0x5cc6ef69fc237636ULL, 0xe62ba95836b02a53ULL, 0x4432e65a132e449aULL, 0xecff6fe025c1d9fcULL } },
+        { { 0x00956ae72414cc1fULL, 0xddcca61c9269a256ULL, 0xb6b0b7a898debc25ULL, 0x8d22f26d6219098cULL }, { 0xe6886816155b0f5aULL, 0x98bf1dcaa6bbf8abULL, 0xad753cfba7a5125cULL, 0x2776abcbd035cdd4ULL } },
+        { { 0xe810f115a340af20ULL, 0x43bfba7d89260e53ULL, 0x0476496ee1e0f019ULL, 0xa348f9d5d2180fd0ULL }, { 0x0dd877a0aaa7d4acULL, 0xd423cc00f2fdff1bULL, 0xe389d8f487fa9ca9ULL, 0xb7632e789b779eebULL } },
+        { { 0xc0035bff51e4cf6fULL, 0xe0d8236c65a85cffULL, 0x63c065c989908d00ULL, 0xb0c43bcef6e3d3faULL }, { 0xf341bec461495900ULL, 0x8f433c32addd4456ULL, 0x2c72bc13b2438297ULL, 0xd87de714a2792ad3ULL } },
+        { { 0xfa966958c2beeeaaULL, 0x0c86aebb7dca9eabULL, 0xf9fe0d01dec1e2edULL, 0x52b056f464a2c031ULL }, { 0xef9c4fca3265fef6ULL, 0x2b72b0cd399397bbULL, 0xaebab534bdf4f8daULL, 0xfe2ff212d912b515ULL } },
+        { { 0x7ca7b84653dec3c7ULL, 0x687e1823f496bdbaULL, 0xc80b3eb2c3dcb9e2ULL, 0xacc353e384225ce8ULL }, { 0xe05e65dc0d095866ULL, 0xf0e672bbad3cabcbULL, 0xd41d56846418c792ULL, 0xbf3a93c17e054eaeULL } },
+    },
+    {
+        { { 0x43f65311b9849d3aULL, 0xcf67262bf1c8ddd6ULL, 0xaa685dfc0bd30c3eULL, 0x6b3e8009982c272eULL }, { 0x5f17349c58c77cadULL, 0xedff544c6bae8b87ULL, 0xa4f3c6167756877fULL, 0x773e0a1e1c1efc86ULL } },
+        { { 0xad976b8287b9fb99ULL, 0x3573fd74da3bee6bULL, 0x45918654903689fdULL, 0xcb9f0686d7972b58ULL }, { 0x650da92bde558c9bULL, 0xd1952ba06ec49cc0ULL, 0x8c0d5c2035f28ce4ULL, 0x9dcfe8e11ec23e29ULL } },
+        { { 0x3cf0e50a7dcf8453ULL, 0x04f6ec5156d291c0ULL, 0xa661543cf0f18428ULL, 0xf97d4d621accb2b7ULL }, { 0xf1761c6be61d301dULL, 0x596e5601e448c129ULL, 0xcb03c52272a0f666ULL, 0xa7e1472725e7a1f3ULL } },
+        { { 0x6db16b9f52976cf3ULL, 0xe529ce99619d4735ULL, 0xca300a12e78d3b8bULL, 0x0102c5de950758deULL }, { 0xf5c942ad2d07d024ULL, 0x39845b0864391219ULL, 0x903010b3a3a15feaULL, 0xc43a27b3e4a6ee10ULL } },
+        { { 0xb1d944fe97c20835ULL, 0x491c326683dcc0a5ULL, 0x05844f68ffcbae26ULL, 0xed986ff4df3dddf1ULL }, { 0xf43354536e99c870ULL, 0x1bdac226504d4bd8ULL, 0x83d0daac0c6f81f5ULL, 0x38a38b11e8bc390aULL } },
+        { { 0xe0ea95e93707a48eULL, 0x92dce89f25b9ce83ULL, 0x50f98c4598fddec9ULL, 0xf855c25e9611499cULL }, { 0xa2ac4b6e6bc5c7e1ULL, 0x1d785c06eac603dcULL, 0xf1ea511dbcd0f392ULL, 0xe65e53d0a3d9c63bULL } },
+        { { 0x278d5506694b252bULL, 0xcf1f2fa2a19b908bULL, 0xd7017566593f6309ULL, 0xb59db87a94446be7ULL }, { 0xefb133555dabd5a1ULL, 0xdb181ec13ad29b54ULL, 0x9c922273493660a1ULL, 0x6417e2ddaee2937dULL } },
+        { { 0x8cfefdef55aad0c0ULL, 0x7333fdd0abd08b50ULL, 0xf7a4cba66cc6cbbeULL, 0x33d19dd74b6cab8fULL }, { 0xa68ae7fb251a53d9ULL, 0x899359f8cb4027a0ULL, 0xebb3b4fa51545d57ULL, 0xaf9911070c22d827ULL } },
+    },
+    {
+        { { 0xa9ac0ba8cd18f7c7ULL, 0x2f247995f810659fULL, 0x5237e1a8ef7b847fULL, 0xbb6494b59726b24eULL }, { 0x409fe17bd6365612ULL, 0xe6b1746962524003ULL, 0x96d999ebfbeae701ULL, 0x1e07052422a68973ULL } },
+        { { 0x8804d814bd6f5691ULL, 0x87d7cbf247626e7aULL, 0xa306c2a10cae3517ULL, 0x28db9e3945bd18c1ULL }, { 0xa5fea55121ef3e76ULL, 0x25be281aab15c554ULL, 0x142afa423a800191ULL, 0x3423e674c00648a8ULL } },
+        { { 0x1c928fa4c0ddffc6ULL, 0x919ca89dd9d3114eULL, 0xb325bd1ff9b68b1aULL, 0x3a728dc4b541c336ULL }, { 0x91106d3900a2090bULL, 0xb436f896ee24897dULL, 0x875f54e5cc998753ULL, 0x12c516e344100fedULL } },
+        { { 0xb924c20953187aa5ULL, 0xf48b71be71fef056ULL, 0x6dbe2bb164d96d4eULL, 0x39431f9dd6243d76ULL }, { 0xa16ad31970b0fb54ULL, 0xe0dbfa7e24947691ULL, 0x79f5e35026fa488cULL, 0x1d4bef31cb7bbfc3ULL } },
+        { { 0x51eaa60284884068ULL, 0x0f131d01ccbe805aULL, 0xc59453570eaf545dULL, 0x8a956a593e013664ULL }, { 0xb988b97eebc31ec2ULL, 0x0c605e1b663721b0ULL, 0x61ceedc7fd67f2e0ULL, 0xa492935643185618ULL } },
+        { { 0x6b48dad85ce13b46ULL, 0xccf1d742b24cf98cULL, 0xd23cb1e2cb13352aULL, 0xcf631d5fd6afe639ULL }, { 0x4efc3e7f3eaff993ULL, 0x6d964ec95b696cbaULL, 0xcd83e6d8c084c309ULL, 0x6dd4d00f83222c44ULL } },
+        { { 0xe877b9cf36a6cfc8ULL, 0x550b377a0e2c810aULL, 0x6002de3991c3d04cULL, 0x846fcbfa2cbdac05ULL }, { 0x53bd87abdaad1910ULL, 0x33b0d12eb2f1e5f3ULL, 0x838b0f7b9747569aULL, 0x9b222ecad49fcc87ULL } },
+        { { 0xb578242b66dd92a2ULL, 0x1dc43436f7c1d9ccULL, 0x19de13396209be19ULL, 0x8345aaab0f752c70ULL }, { 0x321363554bef76ebULL, 0x14d1bf6f5027b622ULL, 0x6e02958c49589ecfULL, 0xaa815119e8204c6dULL } },
+    },
+    {
+        { { 0x9d45c63bf32eb964ULL, 0x6ce89abe40eb2caaULL, 0xba22b299f7897292ULL, 0xa3f1f2c46eb36131ULL }, { 0x5f6431b213653600ULL, 0x3e890c6787cb87daULL, 0x8c1fdf17e9f9dae6ULL, 0x3a5f0315dde61148ULL } },
+        { { 0x6453ec21f0e363fcULL, 0x32d9097d2f563f00ULL, 0xd9138da021c6c3c2ULL, 0x5ede72e9a4af14d8ULL }, { 0xf28778075f7e0f3aULL, 0x902a6718a1d8cb76ULL, 0x3f5995b00aa1055bULL, 0xc042ae09bd39ac08ULL } },
+        { { 0x875a1a800f385e25ULL, 0xc9af3f656c64cefbULL, 0xf04533d4940d0d3dULL, 0xf4ba7908ed037857ULL }, { 0x87c8d282e0a65f64ULL, 0x330d4fce8d36e063ULL, 0x63be53d3e7d8a190ULL, 0x21d8b8eda50f4421ULL } },
+        { { 0xe4560927384f7eacULL, 0xbd99f62269c875ffULL, 0x7410097328964fdcULL, 0x50cbf1258054bceaULL }, { 0x353f31b706a058acULL, 0xd3b877ff26a946c9ULL, 0x498a5c1f5eb0be15ULL, 0x05b58fe0eb747a39ULL } },
+        { { 0x4114da9c2ff08571ULL, 0x9e6efc68f77f1ec6ULL, 0xc743c435626d49b7ULL, 0x222a8f20d72e683eULL }, { 0xf864ad6f986cfcb9ULL, 0x52eeb7d21fbe2e80ULL, 0xb337c8e52f6e6e3bULL, 0xe3b1fae9194b512fULL } },
+        { { 0x8803a02945bd053bULL, 0x74ac8dbed710ab22ULL, 0x85ec80192decdf50ULL, 0x5dbd78f27cfcaff8ULL }, { 0xe1cf9cfe9cd975f5ULL, 0x877f64f7f3c8cb17ULL, 0x7f4a8e85e2af3650ULL, 0xa9f64e73db0df0b4ULL } },
+        { { 0xd97a96f108daebe5ULL, 0xd922cf879d8999ddULL, 0x897c7d847936f3f9ULL, 0x27b549ab4e7b7181ULL }, { 0xed0ee3614e5b0ad7ULL, 0xbdff6d60da8f8e55ULL, 0xe956c0944c048c02ULL, 0xd24779a03143822aULL } },
+        { { 0xfd2ee3a75c85a96dULL, 0xd2522a65500a7de4ULL, 0xf8fd6e88302acaabULL, 0x7650501b5091d4dbULL }, { 0xed696481bece48fcULL, 0xed0f758f7c607061ULL, 0xa50c5f12777a784eULL, 0x277930ac644bb580ULL } },
+    },
+    {
+        { { 0xc3e688615a345febULL, 0x947326319e673ee1ULL, 0x1ca9e16a919dd1e0ULL, 0x5c5fd6437ee72eceULL }, { 0x6cb9289e44132d93ULL, 0x13ce88849e412dd2ULL, 0xc591ca98e5575763ULL, 0x54d16b233d95dba6ULL } },
+        { { 0x5d14b945cd23150dULL, 0x4c629bdd7073aca6ULL, 0x8b490f102ae90a54ULL, 0x90ac92731b954905ULL }, { 0x60d66e57cc859916ULL, 0x8efc0c934623ec12ULL, 0x7cf43e52ee6446d9ULL, 0x52f0ed703b876c0eULL } },
+        { { 0x8e2f513b408b21aaULL, 0xc032914949c93f2bULL, 0x3fa20bb801763c25ULL, 0x79a4e37244f03ae8ULL }, { 0x62c001669e656f07ULL, 0xf60e4ef8d4f7d001ULL, 0x53f418362fb833e1ULL, 0xebd0505344306f46ULL } },
+        { { 0x7e129f0cbabc0cedULL, 0xdc3779d2387a00e5ULL, 0x565b9104fd877781ULL, 0xbd0a82a0b9b0b6cdULL }, { 0x8d3441c17100e5f6ULL, 0xacb6ff06ac644c87ULL, 0x3c225d8b53338b8eULL, 0xceb3d5a18c1af351ULL } },
+        { { 0xc1d3bb339a5a0468ULL, 0xc03b516e61982d21ULL, 0xa9048cd2b291fef9ULL, 0x980ad516a8804afdULL }, { 0x70f6be8cd0e79a72ULL, 0xb6d54735f4732024ULL, 0x806a101883e1ab7bULL, 0x9778043e3990d8c7ULL } },
+        { { 0x077699bf93866048ULL, 0x65f55949ff9227d9ULL, 0x16fb1b59cfcda703ULL, 0x2e6c84dd21900a7dULL }, { 0x64e516ee135d0e83ULL, 0x0b23f59a3468b0c5ULL, 0x82c7503f28ab03cfULL, 0x996c402c16e205fcULL } },
+        { { 0x50df5a9a419e91beULL, 0xe87107c6de5e495aULL, 0xe97947445d5e19e0ULL, 0x4dafa96a72da213eULL }, { 0x0e6e8b4fc3fa8e86ULL, 0x1b8f7cd1b6d77ca7ULL, 0xf8d828b3706df6a6ULL, 0xcdf6af0e53d87715ULL } },
+        { { 0x6cf10c241a9c897eULL, 0x0dd8e724916a1205ULL, 0xcc7064c5fa0d3140ULL, 0x6c86ed3684dfd5aaULL }, { 0x76dce975577c7929ULL, 0x52f906bc5bd6ed9dULL, 0xf3ea668d7c6192a4ULL, 0xe17f070a6029320aULL } },
+    },
+    {
+        { { 0xb173531f2f5fdc0dULL, 0x8e20f42294545d45ULL, 0x93670135f89feb01ULL, 0xaf918dc69ab69a17ULL }, { 0xf51bc727506fefffULL, 0x422f1da2a4265311ULL, 0xe51daab5e7bc3d42ULL, 0xf84e403f18c5efa9ULL } },
+        { { 0xd42fcabc0252bb27ULL, 0xd31640b0232d58c7ULL, 0x8ed36735d668bec1ULL, 0xda05206ec9ffdbb3ULL }, { 0x74a5690dc2cc7511ULL, 0xd9f700b79307e6c6ULL, 0x4314cbbfddd1f6c5ULL, 0x684e5fe3f6a56335ULL } },
+        { { 0x8fabb8b58d74d480ULL, 0x5d5e811fa79780e4ULL, 0xab5d60561a913e41ULL, 0x25752259c20fe5f7ULL }, { 0x90e0ae01cc886df1ULL, 0x6ae21693a9b62a8cULL, 0x8b0916178eb63740ULL, 0xf606d236fa4582e1ULL } },
+        { { 0xb8f9172790e060dcULL, 0x851f6196af6c0a26ULL, 0x6d263d0a41f539adULL, 0xdce679ec6f4d2c1aULL }, { 0x7fc664e2e2b72cc9ULL, 0x615b7e94d3b330cfULL, 0x2b34720a203bea7fULL, 0xa8b5b403b60243e3ULL } },
+        { { 0x7685371112a7274dULL, 0x5dd7d95c7d831725ULL, 0xdbc498e2f83f65daULL, 0xe323328632c7c02cULL }, { 0x9de9f6df663c0e96ULL, 0x1add83b5090a516eULL, 0xa5e6f88227746833ULL, 0x97eb65ef35c40f7eULL } },
+        { { 0x2db9a12ebb9f4c25ULL, 0x009bff073203989bULL, 0xf5d1a8e76515cf07ULL, 0x078b67184158ebceULL }, { 0x399b1ca68d9d196bULL, 0xedb679ec6ba0e82eULL, 0xaf937a447aff2e61ULL, 0xa090a90d76bc5ac9ULL } },
+        { { 0xb86cfbfcd8c7aca5ULL, 0xccba70366f3aca13ULL, 0x09270e7b773eded2ULL, 0x9c43b38f9a23bc52ULL }, { 0x3e17e2578521005cULL, 0xa42903e290627f29ULL, 0x507af91ed9399bccULL, 0x017720184e4c7b9cULL } },
+        { { 0x73e4881f43948fd9ULL, 0x59a9232030366891ULL, 0x4bbabbc84ba4834aULL, 0x1c497968c82c07abULL }, { 0xd0cd7131071532efULL, 0x98cc656baf7707f8ULL, 0x215b5613e243b3b6ULL, 0x934a9326e6768fb1ULL } },
+    },
+    {
+        { { 0xbceffd5c86981a47ULL, 0x73f3fba7fd7b3c8aULL, 0x68e7c94ceb8dbfffULL, 0xeeb9498c5ef58c7fULL }, { 0x6a3030c54682cc17ULL, 0xe489153411fa7606ULL, 0xee5f63177f67ec7cULL, 0xb54667fac1044c1eULL } },
+        { { 0x5a4eac4a4de9a577ULL, 0x90cc24f8f6fe9c02ULL, 0x8a0f6f18f8a905cbULL, 0xbe9e8262e4f1762bULL }, { 0x35576bfdecdf087aULL, 0xba3e03880a6bc78cULL, 0xb4e8192fa17c0a34ULL, 0x4570ba905a880efbULL } },
+        { { 0x83a1d51ae1a62a2aULL, 0xe87e402c7e853d0bULL, 0xfe9a6035c4e90530ULL, 0x54b5cebc4abefacaULL }, { 0x156199491d5169b5ULL, 0xc0f00556d73c1c4aULL, 0x18e43a453cbecf5fULL, 0xeb01b421166de9cdULL } },
+        { { 0x90dc63e2aaf92685ULL, 0x3e04d9725dbb9cb4ULL, 0xce4fc96831e8c6eeULL, 0x1e97a81aa0c59074ULL }, { 0xb01552343c304572ULL, 0xebb53fa6f8eb4b73ULL, 0x7215aa0e9805090aULL, 0xda3638f689850a7cULL } },
+        { { 0x19a86a03234e22aeULL, 0xf68ea83728df8a46ULL, 0x084906506963bccfULL, 0x6456066c7b0290d9ULL }, { 0xe88db82346499926ULL, 0x89286a637f1dee4bULL, 0xc7c89dc492056fe8ULL, 0xf2199a1559305ba7ULL } },
+        { { 0x9abdd2e0ed296c83ULL, 0xfd1b5fb505520143ULL, 0x41fdc147081b3399ULL, 0x1857f5435f1513b7ULL }, { 0x3c8336ed9660f655ULL, 0xfce431ac0f10bfdbULL, 0x0ea84745ca805a94ULL, 0x6b90c9a51028dc9eULL } },
+        { { 0xc2b356691e8dfc9cULL, 0x6821eccd0c63dd17ULL, 0x04ac5aa75d08af0eULL, 0x205d4f2ff22bb6d8ULL }, { 0x410f9432150b9f08ULL, 0x030a14aa438ba36cULL, 0x877bdbd322d085c4ULL, 0x73fca18fe57bdbc0ULL } },
+        { { 0x4036f60a99436a93ULL, 0xb8345c33d6fc4c47ULL, 0xd92e66ad6bf5efa3ULL, 0x93ff4e742f182c67ULL }, { 0x99ff20f6a2cafa21ULL, 0xd3fd11ac27c3cc55ULL, 0x2db290d6495f26f8ULL, 0x6f5230bd7308f762ULL } },
+    },
+    {
+        { { 0xedaaadeb3b4eabcaULL, 0xb76de7e3c2e27942ULL, 0xd90f73232b75c3ecULL, 0x6b535135b06a598cULL }, { 0x734cecd5f2d7d8cdULL, 0xf12326b5bfe66081ULL, 0x34911c450f34c8a5ULL, 0x7951bf638df7353bULL } },
+        { { 0x17c0461e8e8a4752ULL, 0x61b2514bd3bb4e8eULL, 0xffb211a0027b825aULL, 0x7233b0a2d04f4da7ULL }, { 0x5a916ae05d790a25ULL, 0x6ae299b066164ce8ULL, 0x38d3eb339253f696ULL, 0x367499360c8ff333ULL } },
+        { { 0x56aec67d7b6f885eULL, 0x0297e9bc9cdf6760ULL, 0x05cfd2dd710f055eULL, 0x1c7a571951cee715ULL }, { 0x7a6db1593df0b3efULL, 0x64b1c4f9b19599adULL, 0xad40d544e0eff64aULL, 0x222e8bacec90ea28ULL } },
+        { { 0xdc325eb780cdc998ULL, 0xeaeb3ea4451072d2ULL, 0xfbe4a77a63f4814eULL, 0xaf7196535cf7300bULL }, { 0xa5961c0caf79157bULL, 0xd6bd64fac1b1eff8ULL, 0xd53c7278209c1192ULL, 0xd49a6edf11867896ULL } },
+        { { 0x009c08d04ab178f7ULL, 0xcd2fb91260452e7cULL, 0xd6c4a2e06a857014ULL, 0x00da08a2300446d4ULL }, { 0x267da3453782dcdeULL, 0x0bfa97618a01163dULL, 0x2b5cae32874c63ffULL, 0xd272ece363f28714ULL } },
+        { { 0x5c7a2d5aec53361dULL, 0x1bf3cb4ebf7ef20cULL, 0x04796bc056f2c73bULL, 0x8f6a2541f81cf5c4ULL }, { 0xbf5e88bb42e45f66ULL, 0x7cc17bed95498b23ULL, 0xfce87f10ce9ae644ULL, 0xea9eddb50c643b92ULL } },
+        { { 0x6be140a00ee83c6dULL, 0xa9628d8a0cd734beULL, 0xeed633c30fb50b9dULL, 0x2991c3d2a3e39c2fULL }, { 0x2bea88ef0e53351eULL, 0x81a0b9e78ecb4b51ULL, 0x5de33066262b937cULL, 0x72875741a9ba3577ULL } },
+        { { 0x1ba0afe653b69982ULL, 0x457c5a6154894dccULL, 0xe9c42a0ac615ab9cULL, 0x22d4f20138499dbfULL }, { 0xb1ec2a6d58d094a6ULL, 0x25d12924866be1baULL, 0x1417e1e6a5513025ULL, 0x46a7be0eab039206ULL } },
+    },
+    {
+        { { 0xe70ccf9911f87843ULL, 0xaa750516bf750a24ULL, 0x7718717c31a6eefbULL, 0x349467e64f1b3cf2ULL }, { 0x7e8543cc13e06789ULL, 0x96a8b796a7d9be3cULL, 0x094ce7cf9733549aULL, 0x1d488ec1fe62445eULL } },
+        { { 0xd0f1da3b48f7b419ULL, 0xe49b74861ab412f4ULL, 0x2b86b881b18ada64ULL, 0x83b6cf6d33a6e0cfULL }, { 0x3a954c94b21355f1ULL, 0x6fc89f6ce49a6dd9ULL, 0xbac706ffc059f9efULL, 0x23b21e1bae2685a0ULL } },
+        { { 0x3d9da6d921a372f5ULL, 0x6f1ae40b64d7385dULL, 0x7cda6a9208a21016ULL, 0x2f70ed61fba7e2edULL }, { 0x7e00445192f2ed9aULL, 0x5eabaf90e155958aULL, 0xb2ccd9f27dc71ee2ULL, 0x5b451f60619586abULL } },
+        { { 0xb23f24e47b8ff683ULL, 0x04c77af98427bfe0ULL, 0x478310bc3a5735c6ULL, 0x7779bd08eb1d4e91ULL }, { 0x549b94f484d65c69ULL, 0x061b9beb214867a7ULL, 0xbfdbf8ae6b043b58ULL, 0x43a4a64dcf6e237cULL } },
+        { { 0x040ff0809441342bULL, 0x2f0905c1edff16ffULL, 0xb58b665b3cc77b3eULL, 0x332f2daee03f98e8ULL }, { 0xf6533e4878f9bb87ULL, 0xb4ea475837255bbaULL, 0xd8360086e594b600ULL, 0x5b4c0c9c808b7682ULL } },
+        { { 0x5eee3ca4f4b0761cULL, 0x90622c9b49c05683ULL, 0x1d767ea57b96cab1ULL, 0x29c2c08fb0283e92ULL }, { 0x496d62603c2764c5ULL, 0x3d1f37e2c11ee301ULL, 0x9b1f652deb3f2c9cULL, 0xbba690976c171becULL } },
+        { { 0x93045d9eee5f9472ULL, 0x34b36e9dfd721f98ULL, 0x51ea1d879dc0f7ecULL, 0x6bd8f9770c11eddaULL }, { 0xfe8c621c94c4b895ULL, 0x0eb93181d53b731eULL, 0x378fa7d410d82811ULL, 0x6e82fdb28e39bcb2ULL } },
+        { { 0xe18c97feec5dd4f1ULL, 0xe7db08e9728cdf90ULL, 0x49e3bdd1313b1e13ULL, 0x1bd415283339d502ULL }, { 0x7da926deb1e8de3aULL, 0x9e0e414d05d4cd42ULL, 0x171040895828d725ULL, 0xa81d3b0adcee4df2ULL } },
+    },
+    {
+        { { 0xb96cf87d3d8f7f76ULL, 0x24e222eb568545e9ULL, 0x4ef1b7f743b7b477ULL, 0x950cf5ef7e760cdcULL }, { 0x712b377a77589caeULL, 0x574113a96c0055fdULL, 0xb5f5aae063eec85aULL, 0x7dcabe71879e8025ULL } },
+        { { 0x44c0d48453e5b6eeULL, 0x6bb8f04b30b7b45eULL, 0x1e86f74d28e9ea10ULL, 0xc3c4b5c334d18744ULL }, { 0xbf544b3b21b9b77dULL, 0x2fc9c9243d1fe201ULL, 0xf579e7ec06f9e225ULL, 0xb315d26f594d6567ULL } },
+        { { 0x9317122245430c83ULL, 0x5b4a5f2acb721733ULL, 0x972be7c19e8331a4ULL, 0x5d8d8c491c907b76ULL }, { 0xf955e3fd3044ac6fULL, 0x76d4416b7cbc51d0ULL, 0x84e7aa3e25925da1ULL, 0x433332c09664131bULL } },
+        { { 0x58eff1160bd15805ULL, 0x68297f87875e499fULL, 0xd35eae635ea5a87bULL, 0x0a971eba12c4e5abULL }, { 0x42881be9e74578d6ULL, 0xebc94b224f2f393bULL, 0x2c050b87970992ebULL, 0x8d161987d76aeab3ULL } },
+        { { 0x3bfa418b0aeef189ULL, 0x9f6e61f76d827a91ULL, 0xe845258a17d815daULL, 0x86185a478f922c5bULL }, { 0x7ad8d7b15b3466c5ULL, 0xd249bc4b999c8380ULL, 0x81cb0c5edba2c922ULL, 0x8cc4ac4242d870ecULL } },
+        { { 0xf70303cdf5aa086bULL, 0xd08a96b9eace7f47ULL, 0xc2d80ba5a3d9fbe8ULL, 0x92ae00b4dd0d65abULL }, { 0x47343b4e92720eb7ULL, 0x7d02d6cbb11bb102ULL, 0x108463dfdff8e215ULL, 0x337ed8ee34932c5eULL } },
+        { { 0x04244873d5a1af63ULL, 0xfbb26c61edc20d5eULL, 0xda370b0eaa8c09a8ULL, 0x2ba84cf24c9fc539ULL }, { 0x686b19a7866aba73ULL, 0x6d2f5b97457e7fdeULL, 0x11bbab786b1a1324ULL, 0x1048ba5a85bfb04dULL } },
+        { { 0x9019c6cc38c91c7bULL, 0x53a4b37ea8b7191bULL, 0x32def0137cda3696ULL, 0xff7560d80b1b1951ULL }, { 0xda8812672fca0e94ULL, 0x4fa496b7f3de6f3aULL, 0x55d3bb737df69264ULL, 0x13a3375cac528da8ULL } },
+    },
+    {
+        { { 0xfdba1119362c4aeeULL, 0x9475450fd149e823ULL, 0x0308651061e240dfULL, 0xac4c0d91b2797e52ULL }, { 0x07a9f04e94e2e738ULL, 0xc9f2500993dfaa57ULL, 0xe28d8a1e631bf262ULL, 0x3a5e0c8db6c3c6a3ULL } },
+        { { 0x995172ec89e9fd58ULL, 0xdcaadeb5d4b6b6bcULL, 0x194b5bbc58f8274eULL, 0x27bc618bdd36196fULL }, { 0x2bf616d091f96509ULL, 0x042750f110369df1ULL, 0x2deb4dd4cc6235cbULL, 0x2827be701a87b1ecULL } },
+        { { 0x1f89310dbad34d69ULL, 0x90164c592d46c9a7ULL, 0x9da649c290bea726ULL, 0xf9e3c93f712b3c99ULL }, { 0x567997209595fcbdULL, 0x9df889af7ff73c8aULL, 0xb84ab58821d4b858ULL, 0xc4d8d79275f8d5edULL } },
+        { { 0xf307596774d0d696ULL, 0x4b5d7ec5f93bccb7ULL, 0xaffebff2c634df50ULL, 0xf5f106769e4de7ecULL }, { 0x0d7283b839e65a52ULL, 0x7cdeb6b7340b7891ULL, 0xc0f088fd430f523aULL, 0x230d7f4ce56c557eULL } },
+        { { 0x9eec2896172273ddULL, 0xd9884cba970c1d17ULL, 0xe5c167dc18301645ULL, 0xe5dda586530e5772ULL }, { 0xdeeaf7092dd0f27bULL, 0xc601f20a41dfb251ULL, 0x5f480c1d42217e9bULL, 0x0d75797db337bfb1ULL } },
+        { { 0xbd1f51166037a8adULL, 0xd9fc3a2ab87116abULL, 0xa8453cffe7d895a1ULL, 0x16cfa41cfddb9459ULL }, { 0x0ec95efeb58e8adaULL, 0x75ada3cbc5babbeaULL, 0xf5b7d0f700c666eaULL, 0x76ae31649f7d801bULL } },
+        { { 0xacb8abcaab76ef88ULL, 0x34ab9ab60d715487ULL, 0x75d466b09fad30d7ULL, 0x626eb0d470d43609ULL }, { 0x5e7f91f7ca4f4152ULL, 0x0cd7bf19180b857bULL, 0x1f02dd96888784e5ULL, 0xd814b697179f78daULL } },
+        { { 0x7121a1bcf9e1028cULL, 0xc73d0d0f7d0d8fb9ULL, 0xced27f1438308151ULL, 0xc3a91403e806a5e9ULL }, { 0x61f97d94591e02d5ULL, 0x560bdc675660a6acULL, 0x48e5d2d78daa09b3ULL, 0x11a532856d060cfdULL } },
+    },
+    {
+        { { 0x62def7ed6d8c664cULL, 0xa18cdcd5d7c445c6ULL, 0xafef1fffeb247a53ULL, 0xf18532d4a7bcaff3ULL }, { 0x9d6b98be8228f8b6ULL, 0xa6d78326df5bae09ULL, 0x2a14242f2df3ef7dULL, 0xf8e6318f7c9186ecULL } },
+        { { 0x24e7be564195ea3bULL, 0xc83ca2fbe9004927ULL, 0x1f714602fe22b55dULL, 0x46a812c11300d585ULL }, { 0x6d1c150949a4326fULL, 0x809cd7eb0ed826f8ULL, 0xd7bfc2088af9df29ULL, 0xa2de76ad255a91bdULL } },
+        { { 0x0f8239b316fd9964ULL, 0xf665d70cf2610a4cULL, 0x171cbd7297d2ea7eULL, 0x73b4471861abaab8ULL }, { 0x7cf5112759fe8da0ULL, 0x0f4f41e5b07df47eULL, 0xffa8f0274a372433ULL, 0xd81f30a627f74cbdULL } },
+        { { 0xeead2ca76c1f0a26ULL, 0x2e01d56c13682a88ULL, 0xc8a80826a462087bULL, 0xfc58f34328cba4b2ULL }, { 0x8dd7c9f6f29a3c5eULL, 0x850dbfa79ad618d8ULL, 0xf50863c39b6b61a2ULL, 0x002a661a7d05ee45ULL } },
+        { { 0x14010c4e27d3b8beULL, 0xedbeaaf5e3a443f4ULL, 0x490345b0b8292acbULL, 0xc7e668d325ba42a7ULL }, { 0xc19660d1e0537626ULL, 0xd66fd1cd18fae412ULL, 0x9fcd223a6da0faffULL, 0xd7ce345098936cecULL } },
+        { { 0xf034f9aea560c149ULL, 0xe5890a29989c20ebULL, 0x458f2ae45b53f4cdULL, 0xef29ced5ee3acab9ULL }, { 0x76ccef1d3b955c96ULL, 0x962e7cc3b56b6ec7ULL, 0x875d647d07d6bce5ULL, 0x8c23b3bf74c21890ULL } },
+        { { 0xcedb11ede03cb9d5ULL, 0x47738de304764b76ULL, 0x6f7ce6e850bb6dedULL, 0x5e608149f8ed3511ULL }, { 0x356e84cdb59509faULL, 0x5bf4f3164380a777ULL, 0xc01ee4584b247fc2ULL, 0x78f1f2bb21904864ULL } },
+        { { 0x1238b582d5f746f5ULL, 0xc57efeb9cb88cc2bULL, 0xf68eca6d745003a1ULL, 0x07a970b0bfc8f384ULL }, { 0x0bee944d22cc2470ULL, 0x3443464d8b1f2c1cULL, 0x4994b3e813feac55ULL, 0x4b765986f3956a55ULL } },
+    },
+    {
+        { { 0x5110960e0c373dd5ULL, 0x473288436a66bc95ULL, 0xfacc5c9636fe8309ULL, 0x9aa4ac3fd8f96a7cULL }, { 0x25f9d0eb667a4056ULL, 0x8682792202dc4791ULL, 0x439c22a22fd413a8ULL, 0x7a042220fdd26609ULL } },
+        { { 0x5eb13209141575ffULL, 0xbddd09757eb9e721ULL, 0x65663fa76831b938ULL, 0xd4b7c42755f6cb48ULL }, { 0x4b49a85d96d2060fULL, 0x3ed79c3ada925c2eULL, 0x1d4451f68e82d785ULL, 0x6d98f3a7ba6a5e46ULL } },
+        { { 0x7ea7f2679ceb342dULL, 0xb0aeba904f7050c2ULL, 0x1975255c36a48ee4ULL, 0x51e8f00afb0cbbcbULL }, { 0x4db8c88372cd1726ULL, 0xb7cefa6e21884b56ULL, 0xb3d992165a8b51e6ULL, 0xe8874be817432c34ULL } },
+        { { 0x31997616b4d7985cULL, 0x179ce767ec57c2a4ULL, 0x5f0cf0323f526d15ULL, 0x264738dedb4bfa47ULL }, { 0x25f639cd9f8ded60ULL, 0xdf159b4bb5d53ef3ULL, 0x03d62f07af518a12ULL, 0x6555dc2e31b4f561ULL } },
+        { { 0xbcf70c6180f8cec9ULL, 0x5a1cb8ee7fdbc85cULL, 0x63b4e05baf124288ULL, 0xe1194240d8dae0dfULL }, { 0xb5a18a21addbe46cULL, 0xe90fbfffa40cad66ULL, 0xa66ec75c3e5ed63eULL, 0x95190b6733bc24ecULL } },
+        { { 0x4b2926c235e9bdeaULL, 0x93765a1566ea67d6ULL, 0xbecb7f0ddb1e8b45ULL, 0x92da4ab9fe438cd3ULL }, { 0x3b26a5850e616cb6ULL, 0xb839d504412b5c02ULL, 0x913335d8b0a1106aULL, 0x24281c27ba76ccd2ULL } },
+        { { 0xcde4440c6698fed0ULL, 0xdf0621e5ef201badULL, 0xc2c8fde2bcdf274dULL, 0x62b01cbd1aaa4904ULL }, { 0x900ade529c61e404ULL, 0xc8ccc9968a3c2467ULL, 0xbc42abda7d124d52ULL, 0x544a1e20a4daa07cULL } },
+        { { 0xd2e9b318d21a8cc9ULL, 0xdd1451322ca3021cULL, 0x50809c23662a1d49ULL, 0xd2d88e2edb9a43a7ULL }, { 0xfcb9c78dd8f5ae76ULL, 0x43c24579cc9eaa64ULL, 0x0ec952544c77b841ULL, 0x81bf40c79fd1a16bULL } },
+    },
+    {
+        { { 0x003f5ad086deb025ULL, 0x2679509ec67cd0e7ULL, 0xf5ea14340bf55abeULL, 0x2b008316e55ab6f7ULL }, { 0xf024a0faf74f6d2dULL, 0x6a6aee85bc0354d2ULL, 0x9585855763655ba8ULL, 0x4a498fa22e5ae080ULL } },
+        { { 0x50a1938b6c5ad1deULL, 0x582af3d3bbbcfbb2ULL, 0x52d4caa6616dc98cULL, 0x0358ee8f6436993fULL }, { 0x1726fb3fa8a225daULL, 0x19963274ba153234ULL, 0x2faa07b27dd63a79ULL, 0xfa61479103af0155ULL } },
+        { { 0xb64cc68f38d649c9ULL, 0xba386af2eb0b32b3ULL, 0x46203d6bc7e04a43ULL, 0xe7119d35ac933a18ULL }, { 0xb49945b82d8e2319ULL, 0x50803fb2ebc198c1ULL, 0xbba9b72254e1965fULL, 0xef99e5556a2f6ce3ULL } },
+        { { 0x1b67ab9fa76e0551ULL, 0x9cd8980380103930ULL, 0xa44ada9e1e3f0b7dULL, 0xd8b9e12dab068051ULL }, { 0x4b173f876c9b9264ULL, 0xf690324aed83fcccULL, 0xbcf11c37cbf26ab6ULL, 0x756e686cbb5a5124ULL } },
+        { { 0x6e7438ad72201d51ULL, 0x21575ff72f9c5f1eULL, 0xa79e730de9e69ca5ULL, 0x8c4b76ef181dc1e6ULL }, { 0xee49b48136fd5dcdULL, 0xe2b0abbf9b98a9e7ULL, 0x158bf19f56d73e2fULL, 0x57f48600171dbdafULL } },
+        { { 0x52be199a4c06054cULL, 0xfb672e766bc131feULL, 0x18456f9875727a3dULL, 0x582bb4310b54e514ULL }, { 0x423b2d26342db765ULL, 0xb9f61c88410dd3afULL, 0x982ed8e5591372c6ULL, 0x164d3dcfa254d7deULL } },
+        { { 0xd002c66947aaf362ULL, 0x2c617eeabe3d6cf1ULL, 0xc675e4722696c156ULL, 0x30a327a9300de521ULL }, { 0x4c302013b2c1271fULL, 0x1e33aefc9f200a8dULL, 0x96b0439d570430d1ULL, 0x81f0a2a7a3b38fdaULL } },
+        { { 0xc733bd99649297e4ULL, 0x05838cadabce43a2ULL, 0xfa436f8ce4e80fe3ULL, 0xb96752300d5f0144ULL }, { 0x2e032b531623b566ULL, 0xeaa63a6b474d46f4ULL, 0x5fb45d1d5d26c59dULL, 0x42bb533dc33009a6ULL } },
+    },
+    {
+        { { 0xc282d4de2ae9a2d2ULL, 0x29f78296ac52c9e0ULL, 0x7f0d2cb23df2f4c6ULL, 0x980a7fcf41039d16ULL }, { 0x4db1b8c45b06b724ULL, 0xe320e3fe1a1b85bcULL, 0xcc8d9f847360d0d3ULL, 0x007988f09f48ed5aULL } },
+        { { 0xfc5b776fbdc5ad71ULL, 0x65542b91985eb32aULL, 0xcacf2e0c0572e1ceULL, 0xd22452adc36bab49ULL }, { 0x26cd44db4fe83e32ULL, 0xf3e0468c310d6ee6ULL, 0xc3bd373ceeff57ddULL, 0xfd62daae90b4bba6ULL } },
+        { { 0x6d7e41987ebba3afULL, 0x31b82b57b9594c53ULL, 0x202472e5f7e90a67ULL, 0xbae47c177ecd9d60ULL }, { 0x8b00deb97afa5a52ULL, 0x33cf329fb7baa490ULL, 0xc238e1aa5eab4c84ULL, 0x30e7aa2e47f854e8ULL } },
+        { { 0xf864e88b532a6ea6ULL, 0xfee47ad73b673480ULL, 0xb04a05b54df42da4ULL, 0x37b535107da26163ULL }, { 0x012aa5dcbdd06aefULL, 0x70a2fa71142e67aeULL, 0x3600dc14ea7ddb62ULL, 0x014f4f019a751d6cULL } },
+        { { 0xebaa0c848f2803fbULL, 0x037062a411063d6bULL, 0xac6f4632067b1edbULL, 0x5405ce0b8c4780f5ULL }, { 0xed5b2284b5aee22cULL, 0x5779e1a903e5ce17ULL, 0x19ab0c2421ae0f74ULL, 0xc0fd201ee6fdf6a8ULL } },
+        { { 0x3917737f2522c787ULL, 0x7ae68169cd5a286dULL, 0xe113a3484734b0ffULL, 0xf5515a258e2a7e2cULL }, { 0x1ca9c156adcc3054ULL, 0x824e49f002e3142eULL, 0x5701bb3bec044d6dULL, 0x69cca7f0a2800195ULL } },
+        { { 0x5606a38c967e1348ULL, 0x9fd57b0c6120b33aULL, 0x985ccf77e070661bULL, 0x79192e40c9d1cd73ULL }, { 0x363b83865950129fULL, 0x7ebff26d86776532ULL, 0x862fd966f85915d1ULL, 0x3184a214e27e9295ULL } },
+        { { 0xc1dbd304adb5844fULL, 0xe262b782f6d15bb7ULL, 0xa0f75234f56a39fdULL, 0x21f4b899d1952cd7ULL }, { 0xa39cc4e795bb73ecULL, 0xf970466be5531d05ULL, 0x54bcd9baac6f43ceULL, 0xdb6a18bbc9d0eaf8ULL } },
+    },
+    {
+        { { 0x2d63d36358a8aeccULL, 0x393a5462676a1840ULL, 0xa2f08a934368ae8fULL, 0x36c2bb30a611c3ddULL }, { 0x701f8653e44f6d6aULL, 0x846ec4780fa19833ULL, 0x54ab2b7e1921b4a8ULL, 0x92d19021a6b88446ULL } },
+        { { 0xb97f1163dd09da64ULL, 0x22a4e399855f07e6ULL, 0x4810731cf028904aULL, 0xf5d6732748a80513ULL }, { 0xec9ac3e0f139875eULL, 0x92011af04d56af2fULL, 0x6db7c2d15e3b93deULL, 0x30763ea7455bebe0ULL } },
+        { { 0x5551b17cdbc895f4ULL, 0x7f5ecb2f8a21f081ULL, 0x520715fae2b4f569ULL, 0xc7051b37f7dcd9d2ULL }, { 0x76181b8827c8e319ULL, 0xfb6baad8e4fc1a12ULL, 0x8f81106c61cfce76ULL, 0xa021837d35008866ULL } },
+        { { 0x65a09e59c4f8fcf1ULL, 0xffbd761d272ecd9cULL, 0x6a5115a1452e0fc2ULL, 0xf069fcc756818b68ULL }, { 0xd59b3e61899fe72dULL, 0x0435d4fe3a361043ULL, 0xdc258d16e6ef01a6ULL, 0x2630d853c6e9e195ULL } },
+        { { 0x1cdf62df302513daULL, 0x64605506e4dc1668ULL, 0xdee53189972be654ULL, 0x1519d30a948afbf7ULL }, { 0x5b6cb34a423acbe9ULL, 0xcbd96d42495866f3ULL, 0x8af8c97eb27a8c3fULL, 0xf4b8706502405022ULL } },
+        { { 0x96106aaacb98810eULL, 0x40ba6754f5e4b4b3ULL, 0x5c711b3ee92ec5a1ULL, 0xb78ce790441a876eULL }, { 0x1f0544b6a49c603dULL, 0x3715dcecf545894fULL, 0x243454e354ba6c95ULL, 0x2342ae4f54895e73ULL } },
+        { { 0x31e248108e0376ecULL, 0x3abd9b67e5d7a816ULL, 0xa7fc938a5e189d01ULL, 0xeee2e9f62fe13886ULL }, { 0x9d96c9e34bc5b96cULL, 0x11b750f4a5b490d2ULL, 0x63366b8b3b718de7ULL, 0x3b2921b67b2b7291ULL } },
+        { { 0x5e6469a5a87b66ceULL, 0x75a2f4b1946d2536ULL, 0x71ef918327b5e5a1ULL, 0xc2f01d4629e52df0ULL }, { 0x0f28729f19f3e19fULL, 0xa5e2d300058097f7ULL, 0xfefc21c624c2a91fULL, 0xe57907eb62ea2c7fULL } },
+    },
+    {
+        { { 0x14a623434d63744aULL, 0xee299d67ea69d91cULL, 0x173ca9800a87b7b8ULL, 0x4fd8d4ee4e3c52e9ULL }, { 0x3f63f285cb5e964dULL, 0xf84535bd33c29892ULL, 0x871517ad9796c762ULL, 0xeac1b195d1906b6aULL } },
+        { { 0x25682ef122e6d938ULL, 0x930697aacdaf0c39ULL, 0xfab5a955cee93bc7ULL, 0x0c6c00c2a20132b1ULL }, { 0x9eec6ca49b7cf9cfULL, 0x4a111c6231ce8ad6ULL, 0xe04520c3a987713eULL, 0x8d0700f390518566ULL } },
+        { { 0x76244513acdb1996ULL, 0x28534c94f854401aULL, 0xe607908c0de6deb8ULL, 0x518180d7947515fbULL }, { 0xef95a29375d618ffULL, 0x76133680ea691683ULL, 0xf7d9db72228f229fULL, 0x4571f5c2c21652b9ULL } },
+        { { 0x41c22ed6792ce794ULL, 0xdc1a8163e2df1d86ULL, 0xc8dfe2a5effd19e7ULL, 0xd1852be6cd7f0d80ULL }, { 0xa1d23f5449f4005bULL, 0xb5a8237a4c6b2d55ULL, 0xd5e6c50632d62effULL, 0x661f40955be6c80eULL } },
+        { { 0xe381ef40d205c729ULL, 0x84951bc4e1d5ea8aULL, 0x5fc6a8f17adae535ULL, 0xf110ff498d5f9698ULL }, { 0xc0d8c71097809982ULL, 0x6e79c46c14a30d86ULL, 0x030dbff4d10250d1ULL, 0xddbc7a97db917c3aULL } },
+        { { 0x48fe1bcbcab64f0aULL, 0xdcfca529ada33f60ULL, 0x232f18b884ff9455ULL, 0xc095688e5d06a595ULL }, { 0x186b93778b935dafULL, 0x0fee16e44e0b7932ULL, 0x8827fdd64d5e5305ULL, 0xaf507d126288a7cbULL } },
+        { { 0x6a24e08102283142ULL, 0x14f6d967c4f2d47dULL, 0xe8c2518f9a0e70bcULL, 0x03a2b4206c062aacULL }, { 0xe57579e4f6978ba1ULL, 0xdd58e46ef1aae477ULL, 0x78dd32ccfdbceb6aULL, 0x380235dcdb4279d2ULL } },
+        { { 0x2a5f69e9f47de484ULL, 0x7aba671efbb82355ULL, 0x3c06b9436f252895ULL, 0xa6c3e44fa0cd8361ULL }, { 0xc6f187be73fff468ULL, 0x0b11ad5682f838d0ULL, 0x75e9f54eadcfaeb8ULL, 0x654296a00a4a149dULL } },
+    },
+    {
+        { { 0x337059fc9c2d5cfcULL, 0xe3544a1ef5d4355dULL, 0xf137ac1878ac2a02ULL, 0xdf585ddee8cbe756ULL }, { 0xbd1cf0bffb7d309cULL, 0x52af123d6110ef25ULL, 0x2bc7ddc6a603c7a0ULL, 0x515411d502f740caULL } },
+        { { 0xcc9237949b4306d6ULL, 0x6f09b405b6570363ULL, 0x52cc6c39f0f61a26ULL, 0x2b5537c9b8e4b1a6ULL }, { 0x20c368bccc3d02f1ULL, 0x77717d8f13658089ULL, 0x9e9fae855878301bULL, 0x5af0fcfbe1e19026ULL } },
+        { { 0x331f8e671eed0ac1ULL, 0x3aa82b930a3ae515ULL, 0xd35f3448b60277d6ULL, 0x16c4f000f7caaa28ULL }, { 0x93c754e13a9ac023ULL, 0x291d518230543f9fULL, 0x7bf2bc2d7842c791ULL, 0xa76c303441224319ULL } },
+        { { 0xa5ce7fe8f441ac64ULL, 0xce4b9a6ff8cbe95bULL, 0x1a2bd334b4cf46a4ULL, 0x125ea7171204ca96ULL }, { 0x4b514210251c6124ULL, 0x60bc1ca40639deb7ULL, 0x716c7eb1d4951a8aULL, 0xf052592f46c9f47aULL } },
+        { { 0xbf40d0a04b2ee342ULL, 0x3ad10b433444890bULL, 0x8c121e4445f9d798ULL, 0xacc46a050500fe8eULL }, { 0xe4d0a241be33f5b8ULL, 0xdea400e9ac35dd20ULL, 0x10f7698c587d8930ULL, 0xc332c0a12a7bed84ULL } },
+        { { 0x6d713a08734323f3ULL, 0xfc73ff28593efbc0ULL, 0xae2a6b564d774a67ULL, 0x3dd5bdf896682f80ULL }, { 0x698fb54321bd018bULL, 0x64e57462a6527853ULL, 0x6e06421960f4399dULL, 0x4cc6c512d11d2a9fULL } },
+        { { 0x70c1ab626da23d4fULL, 0x59b0ecd7fecdf2e8ULL, 0xe648e7cc26d72b4fULL, 0x390c880a9ac57eafULL }, { 0x2b264f03a3320960ULL, 0xe08a1b3cb4bc6ed3ULL, 0x6c4f448c5f74a2d9ULL, 0x512ba20c02a5d6dfULL } },
+        { { 0xfbb2e41682e814fdULL, 0x6ffeb2aca380f2ecULL, 0xa8a674c2e61dfa89ULL, 0x18ec5df2808e4168ULL }, { 0x180fe9f2f26b9adeULL, 0x981de86cb8222fe2ULL, 0x38393ffb008395c5ULL, 0xc79260276af46d92ULL } },
+    },
+    {
+        { { 0xdf617ce3e9babde8ULL, 0x6991275be3abb00dULL, 0x2dac072dd6bba665ULL, 0x1add23397e19efdaULL }, { 0x7219993721f58b27ULL, 0x9e4ec35e49552723ULL, 0xa91d33635c4f8e12ULL, 0x04190e2cb733468eULL } },
+        { { 0xd73c1384675ce6d9ULL, 0x8e4b2cc114885193ULL, 0xf37f3a36cf8d48c2ULL, 0x442c90ddcb9979bdULL }, { 0xa2287ab00b286749ULL, 0x26e48da7765ffe2bULL, 0x76b296fde82ed040ULL, 0xfda3336af807aab9ULL } },
+        { { 0x01eae63744045c30ULL, 0x7bdfec375439aa4aULL, 0x1b01503ed1cf4fb6ULL, 0x83cc4aa31a5d2286ULL }, { 0x107653f1e5ca2320ULL, 0xd0fbf683ca8f71ecULL, 0xf033315afb588b56ULL, 0x7099c199d412ab93ULL } },
+        { { 0x8e3f45354392a7d1ULL, 0xd44a38a7262757f6ULL, 0xe7e34de04ac50c17ULL, 0xe3ea52f14e4bc0b3ULL }, { 0x3d0a8a548cac974fULL, 0xdcf1b089238cb42cULL, 0x34b7f17cd2bc7851ULL, 0xe9085ab6f117a3c5ULL } },
+        { { 0xe563669dbcb24585ULL, 0x838ec0b8d378e8bcULL, 0x0a621868f4781453ULL, 0xfc88da2a21ca7890ULL }, { 0xe6b0e6c731781b8bULL, 0x8ef44a5641f9cbb3ULL, 0xc1f1f5548f49b992ULL, 0xe194c930a07ea702ULL } },
+        { { 0x3eed7556f5290f0cULL, 0x86196f2faedd3748ULL, 0xfa01beca698a1d1dULL, 0xa6571d2b56e44533ULL }, { 0x36224aac73505201ULL, 0xcb2871405c2388c6ULL, 0x2a173c5fee50c656ULL, 0xc7f071d72e008dc4ULL } },
+        { { 0x0388d7f65d673b40ULL, 0xe27359e970261ca1ULL, 0xe824439e04484dbeULL, 0xd21998355bad7a6fULL }, { 0x69d07609e6352079ULL, 0x104a00b9dfb14a4eULL, 0x78f9f1fde6d4e000ULL, 0xbaa5f28a188d7b77ULL } },
+        { { 0x2bcf5baeaaf86fd0ULL, 0x68f2776f6d23b3b0ULL, 0xeb4ca6bc43bfaf72ULL, 0x51f540a6aecddc61ULL }, { 0xafbedc2b926b683aULL, 0x6fa1b2db83105534ULL, 0x3fa241d7d1f855a4ULL, 0x6fc22ed7802414ccULL } },
+    },
+    {
+        { { 0xab16dfa164afd22eULL, 0x06f7c22691decd76ULL, 0xf75a16505bccf2acULL, 0x2b02930bf115a732ULL }, { 0xd44d58aea3be8b68ULL, 0x4a4baf0bd4c46a7fULL, 0x75de6aac24d967b7ULL, 0x49ca5f208a027f8aULL } },
+        { { 0x7a15ca9caf93525eULL, 0xa4c275c74baeb655ULL, 0x66cc56704fb6a3d5ULL, 0x00e475d4c7715ec7ULL }, { 0x762e1416eb1ee413ULL, 0x37d71458529669b3ULL, 0xbd21887633bc086aULL, 0x30fb48d0fffb762bULL } },
+        { { 0x7cc74171bd61026eULL, 0xfca1c17b66478b41ULL, 0x20360187775c1a86ULL, 0x3f7016a597f2aae4ULL }, { 0x27f3dbee1f202b1fULL, 0x39bd5c200d959d45ULL, 0x1cb20f12ed81b019ULL, 0x210837c600f58a22ULL } },
+        { { 0x68f04f9c8ac43533ULL, 0x8c25092bdc71601fULL, 0x6159b02950f6a62fULL, 0x74f1e62e2642d8baULL }, { 0x141b486f0114b537ULL, 0x6276903845370c40ULL, 0x6135b74f21052edaULL, 0x5e3949a711962c1eULL } },
+        { { 0xa2da649b6dd02956ULL, 0x3486aec593af548cULL, 0x637c591e9b67b5e9ULL, 0x71cfdcf90c38b410ULL }, { 0x1190ff59e138f6f0ULL, 0x409af49246781f59ULL, 0x342032309d87eed6ULL, 0x336e71f1976a7f94ULL } },
+        { { 0x0ff60310c72a33daULL, 0x09e11d8135179a1dULL, 0x559e46c8ff7f7d43ULL, 0x00fdac1de14e65e1ULL }, { 0xc15b26b131c47074ULL, 0x7d34cfbcd0880892ULL, 0x1207282680dd1242ULL, 0xcecbf6f8b9b35c5fULL } },
+        { { 0xfeec1d1f893068dfULL, 0x727d24e071f0f59cULL, 0x4b75d66705dfd344ULL, 0xa3f31aa81671178bULL }, { 0x5f971d19e9d3e03fULL, 0x400ac9337f15fe61ULL, 0xa1127883de08d59dULL, 0x222e827e59f6e758ULL } },
+        { { 0xc215a5a5bbecbfa0ULL, 0x46d8aacaa7dafd51ULL, 0xd04b708d2896d043ULL, 0x9395cf109140b160ULL }, { 0xfcbea159151c4d40ULL, 0x4961c01c8c9b7cbfULL, 0x8b215d383cc12793ULL, 0x9261e83c6c7ccad1ULL } },
+    },
+};
+
+/* Generated: l8w8jwt_secp256k1_base_odd[i] = (2i + 1) * G (affine, Montgomery form), for the width-8 wNAF of u1 * G when verifying. */
+static const struct secp256k1_affine l8w8jwt_secp256k1_base_odd[64] = {
+    { { 0xd7362e5a487e2097ULL, 0x231e295329bc66dbULL, 0x979f48c033fd129cULL, 0x9981e643e9089f48ULL }, { 0xb15ea6d2d3dbabe2ULL, 0x8dfc5d5d1f1dc64dULL, 0x70b6b59aac19c136ULL, 0xcf3f851fd4a582d6ULL } },
+    { { 0x2379d4bbd5fea781ULL, 0x066ceafb22eb7bc4ULL, 0x5940d07385985972ULL, 0x9497730fcdf4c0adULL }, { 0xaf18b0b0613f55a9ULL, 0xac4964cdc5a1f91fULL, 0xcc6048bd84885650ULL, 0x3ec28dcd9215ec76ULL } },
+    { { 0x212347fcbea19bc6ULL, 0x58d7334ddc284cdaULL, 0x20ce358572dd41ddULL, 0x8ed284d3aae7f96fULL }, { 0x9e5e784800dfd9e7ULL, 0x59aaa8d8aad35cc5ULL, 0x011d0b107f8dbfd2ULL, 0x1fd437ae583630c0ULL } },
+    { { 0x07ece566caa4cb22ULL, 0xca934f8716c087c4ULL, 0x4da362224e1d6bd5ULL, 0x5f402433d73866e0ULL }, { 0x4777d1124a77d752ULL, 0x879d7639f1097263ULL, 0xf2fd13d87291ab04ULL, 0xc8043a670ba1a73bULL } },
+    { { 0x46cc6d26eafd5a74ULL, 0x6edd9e7f1ed7f74cULL, 0x8cec72c7f64b253dULL, 0x87d71c6bf4d02a72ULL }, { 0xb2a0d4ae268d25a4ULL, 0xaec108c659794d80ULL, 0xf0176bede6793574ULL, 0x0156339094cef97cULL } },
+    { { 0x04f0c78f94a7a0aaULL, 0x349ebdf993493bb8ULL, 0xd28558b5bb49a3c1ULL, 0x9d888be8bce5a953ULL }, { 0x434322e37beacf4cULL, 0x755db980f899acaaULL, 0x7cb76bd27b41572aULL, 0x0e92c06d7705fac8ULL } },
+    { { 0xd59a06c4f5989088ULL, 0xd35438e646aec93fULL, 0x5b370e50a02a9988ULL, 0x7065f32baff18f7bULL }, { 0x14817536a5d44558ULL, 0x0f73d052948a3b41ULL, 0xdb37e3a6c013f5afULL, 0x595e4c3399b24984ULL } },
+    { { 0xd51e8da318620cd4ULL, 0xa9b174243ff3bffdULL, 0x8fe0d087f9180a0eULL, 0x329cf6f36a78a2b1ULL }, { 0x364e94e68cf9083aULL, 0xd97359fb5ca29845ULL, 0x1442e0ed9e703fc8ULL, 0xf384d03b4965bc3eULL } },
+    { { 0xd90bb8e11df00c43ULL, 0x9b182865f3b25560ULL, 0x69d7a2a822b91922ULL, 0xe272a6a1f9ff59aaULL }, { 0x85352ea76f2a14c9ULL, 0x99dc58b3753707e5ULL, 0x4e936ddcc6b65cc3ULL, 0xb9d1058538a1624eULL } },
+    { { 0xd78ee564d62a7a38ULL, 0x5f8bf03a727df8f4ULL, 0xd8d133ada3023a4aULL, 0xdeb7636c4dd633a5ULL }, { 0xdf15c738e0d36289ULL, 0x91a29c6198b88bdcULL, 0x7ceef09600dda4f2ULL, 0x444ec627d07c28eaULL } },
+    { { 0x7287d563f76ce60aULL, 0x6ddb2dc674eacc1dULL, 0xe0a1107e6cb12ea3ULL, 0x38d21ce5a746f598ULL }, { 0xead831a434cae6f2ULL, 0x439ddfdc4c4c0573ULL, 0xd69265aeb8025098ULL, 0x9a760529af0be6c8ULL } },
+    { { 0x710c24917d7868e2ULL, 0xb7018dcca66fa9a0ULL, 0xb2bb768f928ba6aaULL, 0x34b9089136060918ULL }, { 0x1bb37e7d5a765cfaULL, 0x04e41eb805d5c130ULL, 0xfabc5a81934fc6c9ULL, 0x1ada75eb956c455fULL } },
+    { { 0x43a8673a528eab6dULL, 0xcc7c3aff84257eeeULL, 0x826674bbf7fb2c09ULL, 0x4f13fd3db6487c5aULL }, { 0x1af88d5c37027b74ULL, 0xd788f352bb5bb569ULL, 0x315a735beaaa2d4cULL, 0xdaaf22e5b81ac1bdULL } },
+    { { 0x4065de4bdf096d18ULL, 0xf732d13664c270e8ULL, 0x4a77f053b730aebaULL, 0x6753e5a765719926ULL }, { 0xca06688145d3e40bULL, 0x5987c3f8ac9dcfb6ULL, 0xfbfcc60cd3304a23ULL, 0x5dace33180153d3bULL } },
+    { { 0x78393cc1bc66aebfULL, 0x66de27b31124aa09ULL, 0x8c4c7f2072cecebeULL, 0x30822abdd5a92b77ULL }, { 0xa8c8e083f7cbcb31ULL, 0xcb952fa172bd2977ULL, 0x0cdb3ab31afa8c27ULL, 0x210ec24f6535ce88ULL } },
+    { { 0x3eeec4b21af2746fULL, 0x016f76f7b2686256ULL, 0x730d41a484012e67ULL, 0xf12c7e23f74ec811ULL }, { 0xe5694678a89357dcULL, 0x10ac2b51ca2335ddULL, 0x5e0eda4ce149b499ULL, 0x27964839bfa868aaULL } },
+    { { 0xc789b0d904462042ULL, 0x83266b6f7948d55cULL, 0x87e088c16ce63ae1ULL, 0x37b49275a8134188ULL }, { 0x55856bfe2b18110cULL, 0xf698b243c499bb93ULL, 0x03dbb3810cef8e10ULL, 0x79fb211f777f178aULL } },
+    { { 0x8cc030b523eacd0aULL, 0xaf885b4de6947cc4ULL, 0xa06b283acf667258ULL, 0x581042a66f6f64c8ULL }, { 0x3a31e3d79265f180ULL, 0x4dc9de4c5eab6ebeULL, 0xbd0a4fadaeabe161ULL, 0xc7ec3e2d5b411868ULL } },
+    { { 0x574d374d611e5431ULL, 0x85755869ed7e7a80ULL, 0x198bd86cd6081a8fULL, 0x621a29ddb92d0518ULL }, { 0xf231989edd9866d8ULL, 0xc1be6826da9fddb4ULL, 0x8985db78e11526faULL, 0xce9b6976d67d796dULL } },
+    { { 0x0abb6b74931ab84aULL, 0x8c686ce20af3d47aULL, 0x5e723a3d524477f9ULL, 0x77de6bba5c326551ULL }, { 0xfc5b9ec5929b6f64ULL, 0xaeb7c6cde49d0496ULL, 0xf5482095c7aafa37ULL, 0xcf35e3ebf5a3d880ULL } },
+    { { 0x0ae480b9f53d193cULL, 0x86f719df0dc5b44eULL, 0x146dbbc189c1812dULL, 0x2e2bc80567214653ULL }, { 0xfcbb7632be39d872ULL, 0x4ba332cb7d576c11ULL, 0x18e6c1b219f23c9bULL, 0xc00969e9383240eaULL } },
+    { { 0x5f294ba4f83f38d0ULL, 0x3cc9b7d466f160b7ULL, 0xa93c93521597f957ULL, 0x37c6a02e65a48803ULL }, { 0xbe0809ba4c8dde97ULL, 0xd90d585c5b5ad049ULL, 0xf3df54f6d45360dcULL, 0x962e84ea6bea9faaULL } },
+    { { 0xba3684679efa4969ULL, 0xc20713edd5081d8fULL, 0x83c92f9d42552668ULL, 0x2ca518ad5320b144ULL }, { 0x5afa94ed90e0c05cULL, 0x3b30690ebe289c86ULL, 0x854ec8102c544b3dULL, 0x578756f29e6ffca5ULL } },
+    { { 0x16a6d6de472adca1ULL, 0x86ae5c96ae5cb8cfULL, 0x49cb06514d1fb544ULL, 0x3233ef661cbf1211ULL }, { 0x3b47757649e7e82bULL, 0x4fc6f53994c7e45aULL, 0xe4bc5f988ae74268ULL, 0x3f188c560425b0d4ULL } },
+    { { 0xdef9f1d0d939d060ULL, 0x7ee70afdde7df977ULL, 0x6c08f60d4e310ef5ULL, 0xa1482a269bb97205ULL }, { 0xcdd9f40c80d483ecULL, 0xba1f50ed769367abULL, 0x33364421d8a95257ULL, 0x6db77a1a2e1da593ULL } },
+    { { 0x4fba1057d6d499e6ULL, 0xc36b65f01919ed5fULL, 0xead948d305d0d2e9ULL, 0x6e3c4f4ff2d3984eULL }, { 0x02b72b3fd133daefULL, 0xc22c7b5f8a4f8771ULL, 0xd266f00b330ddbf7ULL, 0x73f7d2d32d273a4bULL } },
+    { { 0x29aba0f99b4ad7c2ULL, 0xe5fd9e62f139f8c5ULL, 0xde7b34cf7d19e5a2ULL, 0xaf6ceb12f4eb9bb7ULL }, { 0x980e43acd79eb786ULL, 0x55c8772e06865b9bULL, 0x83dadee963e0338dULL, 0xf2edddf9b0e45726ULL } },
+    { { 0x51666ffc2e9be15eULL, 0x2483921e02fad43dULL, 0x8f1c07dc6c8c357eULL, 0xc7b06ee96985fcedULL }, { 0xcc6e1536c6b46c3eULL, 0x5528e849bbb2db21ULL, 0xf26df73f7be3572aULL, 0xba398de3910b0743ULL } },
+    { { 0x117a547cc70c9cbcULL, 0xb47a5180e1e6e3e4ULL, 0xe4be3476e040dc88ULL, 0x3130c25b4b0d1b30ULL }, { 0x040d4f07cf2a1cefULL, 0x1bdbea3650d3fb9aULL, 0x877f57ddfe4216bcULL, 0xc6ea984d4b832e71ULL } },
+    { { 0x8fefc57423cf448aULL, 0xa154e2bd7761b2b0ULL, 0x9500ddd625037408ULL, 0xfb31e37630f720edULL }, { 0xd1b658150b2b3069ULL, 0x9c4d7e1a6b6d0049ULL, 0x4c8df8bb5b38bc15ULL, 0xcad37dfaab3dfe73ULL } },
+    { { 0x3b75bb5de9b540e1ULL, 0x7f125440b549b012ULL, 0x83f9faf08450e538ULL, 0xa2930635cd40829aULL }, { 0x73f89d79daed83c2ULL, 0x398e268e4889b425ULL, 0x367fdcf5e6112ff9ULL, 0x866090e27c885dc0ULL } },
+    { { 0xa4d44416639300beULL, 0xdea61ae4b9f7c408ULL, 0xffda5b3f839c0518ULL, 0x3539752caa4356f4ULL }, { 0x037c0abf13bb54b7ULL, 0xb3c48ffee367f08fULL, 0x56e45762d943dd47ULL, 0x4f07938a8c07e9eeULL } },
+    { { 0x02a1ea133e571a95ULL, 0x3cd68054d7432e3dULL, 0x2f3b47013b4e2977ULL, 0x36d8b419d044bd24ULL }, { 0x0db0b2a21cddfc71ULL, 0x3a26e050b3a10161ULL, 0x070da8f43bf78dadULL, 0x2ace7645b103ccfcULL } },
+    { { 0x5af0b2c7cd050b2bULL, 0x4a8ac3f656a949f1ULL, 0x79d45a495e901a26ULL, 0x2162592f52a01c5dULL }, { 0xd0cabb103ef1f86eULL, 0xee78f4f6ca315bf9ULL, 0xeccf83a888e26c35ULL, 0xbed6c8e5df026741ULL } },
+    { { 0xef95483192b2a69fULL, 0x59d66d12801eedaeULL, 0x4a9a5c4ddb48ea55ULL, 0x4720e9c27e14e2c8ULL }, { 0xb7d8c06ee6dccf08ULL, 0x48fe4ee540fd95d2ULL, 0xda45a64aeed33d72ULL, 0x75778bf12a856a1bULL } },
+    { { 0x6bf4b50dcd619869ULL, 0xcf2905d4ec378a7dULL, 0x6afa04b405dec19cULL, 0x4c45674a8097a072ULL }, { 0x23030d37b66b5b0cULL, 0xc5821b2cd8d01bf2ULL, 0x29bac38a5180b6ddULL, 0x3ce0002df92866f4ULL } },
+    { { 0xfba2d68a0cf9eadcULL, 0xde1e413624cecc2bULL, 0xc68bd2c0720a9dc7ULL, 0x5ad2b748ea1a0526ULL }, { 0x760527a416a9f536ULL, 0xbf584a933ae7420dULL, 0xe1031ca78ea83ce4ULL, 0x8a88d38b1d1488e8ULL } },
+    { { 0x22da94d0491da122ULL, 0x1f0287d4a2765a7bULL, 0x2b1581dfc9405465ULL, 0xc9fc1ec837b143efULL }, { 0x5a5930b01f459de4ULL, 0x91fabe0c608dc9afULL, 0xaa6f106d582ac2dfULL, 0xbd490355a1f4e1e9ULL } },
+    { { 0xd1980100bf850344ULL, 0x72b08d754fd1c352ULL, 0xc000041d285f3d50ULL, 0x7d04535324a74eb8ULL }, { 0xcea2c0d9c12ac942ULL, 0x6f00aa15029703f2ULL, 0xcfada34ddae63039ULL, 0xb568fd0d43abda38ULL } },
+    { { 0xc2e91568b53cdef5ULL, 0x071c74e32c4544b5ULL, 0x0d38d1e50d11e6e6ULL, 0xb1d8781a266290beULL }, { 0x3e1ff57629dc100cULL, 0x3d6da92752e2efc0ULL, 0xb5445599b834f17eULL, 0xd5f3c5076d99980aULL } },
+    { { 0x96a35fdeec8f107dULL, 0xc5e6771cdfb516acULL, 0xbc394e810578790cULL, 0x78d17d21ed00b113ULL }, { 0x0ff26c9bb087a082ULL, 0x9c153535d1a0f801ULL, 0x129a08ee3a004269ULL, 0xf88e3c1357eab421ULL } },
+    { { 0xeeee8bae04bf455fULL, 0xad393cc8cdfdc187ULL, 0x0c34d882645d0d22ULL, 0x4ab41ead7c206a26ULL }, { 0xb95e05bf250636fbULL, 0xf6d418c3cbe3122aULL, 0x2d332583e9e06179ULL, 0x87ca57a26b14c2a9ULL } },
+    { { 0xe7c17621e806af1eULL, 0x19f3afab09e7f65bULL, 0x552b03e72849ce9bULL, 0x90c281ced2db3693ULL }, { 0xac1af46c276d98f3ULL, 0x042659e2c1855f2aULL, 0x30849fc24718b1a6ULL, 0x006d1dd3e13bd64aULL } },
+    { { 0x688d0fccfe354eccULL, 0xf5f07f1da60ea45fULL, 0x217823351a90d091ULL, 0xc60a9e1562f0943fULL }, { 0x8893c0d324340ec3ULL, 0x52bea81a88b310ffULL, 0xd1b308203b2381a7ULL, 0x4e4c97ab192c6d66ULL } },
+    { { 0x66dc74f1f42749c4ULL, 0x0b4301ad10412432ULL, 0xab4949b0165535b9ULL, 0xb98e04223652a1feULL }, { 0x6570ecca88d46bfaULL, 0x2faa12590bf86d7fULL, 0x5be618f033f0f556ULL, 0x271d56887733dce9ULL } },
+    { { 0x54f465e4b0253e6cULL, 0x727e03d88ea4a784ULL, 0x5a999d23ada1755dULL, 0x031091420599926fULL }, { 0x12b3997eca9dd88dULL, 0x8fe184671b8b04f7ULL, 0x133370b5f4bd91ebULL, 0x20be2540e134c14dULL } },
+    { { 0x815cc34b4e8c2de9ULL, 0xaa341e7083a7ad9bULL, 0xf7888c9462fad69aULL, 0x74c744c5a8eb5d28ULL }, { 0xf4e8fc85a66b8af0ULL, 0x345214d358cd95a5ULL, 0xae5bee6620ecc7fbULL, 0xd8c600bc83893aacULL } },
+    { { 0x7c4822ed051aa891ULL, 0x82a7de7292d69f74ULL, 0x1e79560f5c5b19e4ULL, 0xb6c11a599920eceeULL }, { 0x5606e84110c45826ULL, 0x948a8f75061c6142ULL, 0x8f079b9be579d8e2ULL, 0xf4bf8cfefa096557ULL } },
+    { { 0x28c35b0a0fae4b5cULL, 0xf816773e7f3fbaf5ULL, 0x37e33557a9ea73beULL, 0x7b33418ebcae9aaaULL }, { 0x970cc5fc873b8c15ULL, 0x323d6c800833bd7fULL, 0xfbeaf192d21716b5ULL, 0x702286eae41f1fcbULL } },
+    { { 0x799fd863c0f6ed34ULL, 0x677d88baba8d6d14ULL, 0x51e35439319c0197ULL, 0xf8e3fdd0b579184dULL }, { 0x949e5265f2348129ULL, 0x4e91a3d8fcb122c9ULL, 0x57014d8db1ae79dcULL, 0xd44fb03d2801167cULL } },
+    { { 0xdb4114d67ec61a3bULL, 0x7b3f833f49cccd6dULL, 0x8a8e8d234bf4595aULL, 0xd89d979498b9fb2eULL }, { 0xc85f800fd546a62cULL, 0xfc5f363ccc3eb519ULL, 0xd8f669316d6c66d9ULL, 0x13200ef558081196ULL } },
+    { { 0x87c574bbce02bd3dULL, 0x3cb798c5c460de78ULL, 0x61d2ef2f3b902020ULL, 0x2b585df2fcc42fc7ULL }, { 0x57e3d988e591d247ULL, 0x7ea4af3cbd6d8815ULL, 0x967316955e3eff33ULL, 0x3b9940696390a6e3ULL } },
+    { { 0x2467d5648a9bca1cULL, 0x25f57d6b640cd8a6ULL, 0x81234ebbd5a18a10ULL, 0x603bdea2b954b9a2ULL }, { 0xcb5fd9b02ba1b6ddULL, 0xdd7d81d238fc069dULL, 0xd4cb6c6b0eea0a62ULL, 0xb79b392e48fed7b3ULL } },
+    { { 0x23991abc654f38eeULL, 0x2f42e36868518861ULL, 0xbd1317141ddf24d8ULL, 0xbb9beaa6eadefa4cULL }, { 0x68a5bdd85fac2cf8ULL, 0x562a7e9961f74832ULL, 0x2fdf74f6c3db010aULL, 0x0b3f2c1bc829db1cULL } },
+    { { 0x85c4a823b3657f13ULL, 0x4737b28a88874213ULL, 0xf51db69e5f32d986ULL, 0x273dcd867ad654baULL }, { 0xa0ca5f701cdb4a91ULL, 0x9fb6b207450dc02cULL, 0x81017cf618d49e49ULL, 0xd013d1f3f509d822ULL } },
+    { { 0xe526ae3bafdd5a82ULL, 0x40cef62f53e4a596ULL, 0xaf33fd74b96a578cULL, 0xbb1cc791ef1a0fcaULL }, { 0xc2f393887c9e895aULL, 0x276064dbc55691e7ULL, 0x145b768acbcf433cULL, 0x591d2068862bda78ULL } },
+    { { 0x325735da9c1009cdULL, 0xec4149175095d723ULL, 0x2a123a290da52157ULL, 0x88f7843dbaf5d1e1ULL }, { 0xe096a6d01b558075ULL, 0xe1b8b574fee10332ULL, 0x642a3b5e43d58ee3ULL, 0xb23e72459088b620ULL } },
+    { { 0xb416f805b08aedf0ULL, 0xb39cadcc8763ab35ULL, 0x2aad70dae2a1b547ULL, 0xc4ccee26c41ea02dULL }, { 0x8cc4e0aea020e819ULL, 0xce19c4d24e8b094eULL, 0x12a6e6fed741ccd5ULL, 0xd8444c9cb8a9a505ULL } },
+    { { 0x1856a2bb3d3521e9ULL, 0x4e7286a3e2cb5e49ULL, 0xa9e0559a3507ef2dULL, 0x45b32b55a59aed58ULL }, { 0xafb3864137badba6ULL, 0xff34658f35c9ae57ULL, 0xfbe7c81afc793937ULL, 0x6b1f08433b40d522ULL } },
+    { { 0xd37d07b988c56185ULL, 0xe1707d162054717fULL, 0x75ed1e208b5200c2ULL, 0x23cbb12b1a7a32f4ULL }, { 0x42dc3583000c2768ULL, 0xcf27eae176c2ddcfULL, 0x2deb8f4d0a420bfaULL, 0x2488c77b116cd158ULL } },
+    { { 0x4eb9db8ad19b3efeULL, 0x5ccaa869b6fa2796ULL, 0x83f018b81b84d2b5ULL, 0xe1424153e8ccdaffULL }, { 0xd505efc2a6f0261eULL, 0xb0afd5d46995d247ULL, 0xaef5854988024c31ULL, 0xfe8a2e986226d446ULL } },
+    { { 0x13389b4d916d8b30ULL, 0xbb61066c53e3adafULL, 0x6a64de9c52a6e0a6ULL, 0x09400c138587e8bcULL }, { 0x67167bcafd32b065ULL, 0xb16e835c28fb7a84ULL, 0x3dca95231cb482ebULL, 0xc421c2c93315ef83ULL } },
+    { { 0xc294ff9490c7d409ULL, 0x541de59d4be862ffULL, 0xe6dc7a29b54c6637ULL, 0xbe78f0cd4d69ad6eULL }, { 0x325caf3871246227ULL, 0xfad6104ff566b8b4ULL, 0xe4144a47c2fba04dULL, 0xacca6a353a3edee6ULL } },
+    { { 0xb4e72b874372f19cULL, 0x803f6f9b3471ddbdULL, 0x0820f4df9ae4ba4dULL, 0xd9a3d69212937055ULL }, { 0x287c1dc5e3d59a75ULL, 0xc8fa4b0ebe05bab0ULL, 0x4350e9029e89c05cULL, 0x2a4b1a408d421869ULL } },
+};
+
+#endif // L8W8JWT_SECP256K1_PRECOMP_H
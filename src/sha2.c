@@ -0,0 +1,449 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "sha2.h"
+
+#include <string.h>
+#include <mbedtls/platform_util.h>
+
+size_t l8w8jwt_sha2_length(const mbedtls_md_type_t md_type)
+{
+    switch (md_type)
+    {
+        case MBEDTLS_MD_SHA256:
+            return 32;
+        case MBEDTLS_MD_SHA384:
+            return 48;
+        case MBEDTLS_MD_SHA512:
+            return 64;
+        default:
+            return 0;
+    }
+}
+
+size_t l8w8jwt_sha2_block_size(const mbedtls_md_type_t md_type)
+{
+    switch (md_type)
+    {
+        case MBEDTLS_MD_SHA256:
+            return 64;
+        case MBEDTLS_MD_SHA384:
+        case MBEDTLS_MD_SHA512:
+            return 128;
+        default:
+            return 0;
+    }
+}
+
+#if L8W8JWT_SHA2_X86
+
+static const uint32_t SHA256_IV[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+static const uint64_t SHA384_IV[8] = { 0xcbbb9d5dc1059ed8, 0x629a292a367cd507, 0x9159015a3070dd17, 0x152fecd8f70e5939, 0x67332667ffc00b31, 0x8eb44a8768581511, 0xdb0c2e0d64f98fa7, 0x47b5481dbefa4fa4 };
+
+static const uint64_t SHA512_IV[8] = { 0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1, 0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179 };
+
+static inline void compress(struct l8w8jwt_sha2_context* ctx, const unsigned char* data, const size_t blocks)
+{
+    if (ctx->md_type == MBEDTLS_MD_SHA256)
+    {
+        l8w8jwt_sha256_blocks(ctx->state.sha256, data, blocks);
+    }
+    else
+    {
+        l8w8jwt_sha512_blocks(ctx->state.sha512, data, blocks);
+    }
+}
+
+static inline void store_be64(unsigned char* out, const uint64_t x)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        out[i] = (unsigned char)(x >> (56 - 8 * i));
+    }
+}
+
+int l8w8jwt_sha2_starts(struct l8w8jwt_sha2_context* ctx, const mbedtls_md_type_t md_type)
+{
+    ctx->md_type = md_type;
+    ctx->total = 0;
+
+    switch (md_type)
+    {
+        case MBEDTLS_MD_SHA256:
+            memcpy(ctx->state.sha256, SHA256_IV, sizeof(SHA256_IV));
+            return 0;
+        case MBEDTLS_MD_SHA384:
+            memcpy(ctx->state.sha512, SHA384_IV, sizeof(SHA384_IV));
+            return 0;
+        case MBEDTLS_MD_SHA512:
+            memcpy(ctx->state.sha512, SHA512_IV, sizeof(SHA512_IV));
+            return 0;
+        default:
+            return -1;
+    }
+}
+
+int l8w8jwt_sha2_update(struct l8w8jwt_sha2_context* ctx, const unsigned char* data, size_t data_length)
+{
+    const size_t block_size = l8w8jwt_sha2_block_size(ctx->md_type);
+    size_t buffered = (size_t)(ctx->total % block_size);
+
+    ctx->total += data_length;
+
+    if (buffered != 0)
+    {
+        const size_t fill = block_size - buffered;
+
+        if (data_length < fill)
+        {
+            memcpy(ctx->buffer + buffered, data, data_length);
+            return 0;
+        }
+
+        memcpy(ctx->buffer + buffered, data, fill);
+        compress(ctx, ctx->buffer, 1);
+
+        data += fill;
+        data_length -= fill;
+    }
+
+    /* Full blocks are compressed straight out of the input, without going through the buffer. */
+    const size_t blocks = data_length / block_size;
+    if (blocks != 0)
+    {
+        compress(ctx, data, blocks);
+
+        data += blocks * block_size;
+        data_length -= blocks * block_size;
+    }
+
+    if (data_length != 0)
+    {
+        memcpy(ctx->buffer, data, data_length);
+    }
+
+    return 0;
+}
+
+int l8w8jwt_sha2_finish(struct l8w8jwt_sha2_context* ctx, unsigned char* out)
+{
+    const size_t block_size = l8w8jwt_sha2_block_size(ctx->md_type);
+    const size_t length_field_size = block_size / 8; /* 64-bit length for SHA-256, 128-bit for SHA-384/512. */
+
+    size_t buffered = (size_t)(ctx->total % block_size);
+    ctx->buffer[buffered++] = 0x80;
+
+    if (buffered > block_size - length_field_size)
+    {
+        memset(ctx->buffer + buffered, 0x00, block_size - buffered);
+        compress(ctx, ctx->buffer, 1);
+        buffered = 0;
+    }
+
+    memset(ctx->buffer + buffered, 0x00, block_size - buffered);
+    store_be64(ctx->buffer + block_size - 8, ctx->total << 3);
+
+    if (length_field_size == 16)
+    {
+        store_be64(ctx->buffer + block_size - 16, ctx->total >> 61);
+    }
+
+    compress(ctx, ctx->buffer, 1);
+
+    if (ctx->md_type == MBEDTLS_MD_SHA256)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            const uint32_t x = ctx->state.sha256[i];
+            out[4 * i + 0] = (unsigned char)(x >> 24);
+            out[4 * i + 1] = (unsigned char)(x >> 16);
+            out[4 * i + 2] = (unsigned char)(x >> 8);
+            out[4 * i + 3] = (unsigned char)(x);
+        }
+
+        return 0;
+    }
+
+    const int words = ctx->md_type == MBEDTLS_MD_SHA384 ? 6 : 8;
+
+    for (int i = 0; i < words; ++i)
+    {
+        store_be64(out + 8 * i, ctx->state.sha512[i]);
+    }
+
+    return 0;
+}
+
+void l8w8jwt_sha2_free(struct l8w8jwt_sha2_context* ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+
+    mbedtls_platform_zeroize(ctx, sizeof(struct l8w8jwt_sha2_context));
+}
+
+#else
+
+int l8w8jwt_sha2_starts(struct l8w8jwt_sha2_context* ctx, const mbedtls_md_type_t md_type)
+{
+    ctx->md_type = md_type;
+
+    switch (md_type)
+    {
+        case MBEDTLS_MD_SHA256:
+            mbedtls_sha256_init(&ctx->ctx.sha256);
+            return mbedtls_sha256_starts(&ctx->ctx.sha256, 0);
+        case MBEDTLS_MD_SHA384:
+        case MBEDTLS_MD_SHA512:
+            mbedtls_sha512_init(&ctx->ctx.sha512);
+            return mbedtls_sha512_starts(&ctx->ctx.sha512, md_type == MBEDTLS_MD_SHA384);
+        default:
+            return -1;
+    }
+}
+
+int l8w8jwt_sha2_update(struct l8w8jwt_sha2_context* ctx, const unsigned char* data, const size_t data_length)
+{
+    if (ctx->md_type == MBEDTLS_MD_SHA256)
+    {
+        return mbedtls_sha256_update(&ctx->ctx.sha256, data, data_length);
+    }
+
+    return mbedtls_sha512_update(&ctx->ctx.sha512, data, data_length);
+}
+
+int l8w8jwt_sha2_finish(struct l8w8jwt_sha2_context* ctx, unsigned char* out)
+{
+    if (ctx->md_type == MBEDTLS_MD_SHA256)
+    {
+        return mbedtls_sha256_finish(&ctx->ctx.sha256, out);
+    }
+
+    return mbedtls_sha512_finish(&ctx->ctx.sha512, out);
+}
+
+void l8w8jwt_sha2_free(struct l8w8jwt_sha2_context* ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+
+    if (ctx->md_type == MBEDTLS_MD_SHA256)
+    {
+        mbedtls_sha256_free(&ctx->ctx.sha256);
+    }
+    else
+    {
+        mbedtls_sha512_free(&ctx->ctx.sha512);
+    }
+
+    mbedtls_platform_zeroize(ctx, sizeof(struct l8w8jwt_sha2_context));
+}
+
+#endif // L8W8JWT_SHA2_X86
+
+int l8w8jwt_sha2(const mbedtls_md_type_t md_type, const unsigned char* data, const size_t data_length, unsigned char* out)
+{
+    struct l8w8jwt_sha2_context ctx;
+
+    int r = l8w8jwt_sha2_starts(&ctx, md_type);
+    if (r != 0)
+    {
+        return r;
+    }
+
+    r = l8w8jwt_sha2_update(&ctx, data, data_length);
+    if (r == 0)
+    {
+        r = l8w8jwt_sha2_finish(&ctx, out);
+    }
+
+    l8w8jwt_sha2_free(&ctx);
+    return r;
+}
+
+void l8w8jwt_sha2_clone(struct l8w8jwt_sha2_context* dst, const struct l8w8jwt_sha2_context* src)
+{
+#if L8W8JWT_SHA2_X86
+    memcpy(dst, src, sizeof(struct l8w8jwt_sha2_context));
+#else
+    dst->md_type = src->md_type;
+
+    if (src->md_type == MBEDTLS_MD_SHA256)
+    {
+        mbedtls_sha256_init(&dst->ctx.sha256);
+        mbedtls_sha256_clone(&dst->ctx.sha256, &src->ctx.sha256);
+    }
+    else
+    {
+        mbedtls_sha512_init(&dst->ctx.sha512);
+        mbedtls_sha512_clone(&dst->ctx.sha512, &src->ctx.sha512);
+    }
+#endif
+}
+
+int l8w8jwt_sha2_midstate_init(struct l8w8jwt_sha2_midstate* midstate, const mbedtls_md_type_t md_type, const unsigned char* hmac_key, const size_t hmac_key_length, const unsigned char* prefix, const size_t prefix_length)
+{
+    int r;
+
+    unsigned char k[128] = { 0x00 };
+
+    const size_t block_size = l8w8jwt_sha2_block_size(md_type);
+
+    memset(midstate, 0x00, sizeof(struct l8w8jwt_sha2_midstate));
+    midstate->hmac = hmac_key != NULL;
+
+    if (block_size == 0)
+    {
+        return -1;
+    }
+
+    if (midstate->hmac)
+    {
+        /* Keys longer than the block size are hashed first (RFC 2104, section 2). */
+        if (hmac_key_length > block_size)
+        {
+            r = l8w8jwt_sha2(md_type, hmac_key, hmac_key_length, k);
+            if (r != 0)
+            {
+                goto exit;
+            }
+        }
+        else if (hmac_key_length != 0)
+        {
+            memcpy(k, hmac_key, hmac_key_length);
+        }
+
+        for (size_t i = 0; i < block_size; ++i)
+        {
+            k[i] ^= 0x5c;
+        }
+
+        r = l8w8jwt_sha2_starts(&midstate->outer, md_type);
+        if (r != 0 || (r = l8w8jwt_sha2_update(&midstate->outer, k, block_size)) != 0)
+        {
+            goto exit;
+        }
+
+        /* Flip from opad to ipad in one go: 0x5c ^ 0x36 == 0x6a */
+        for (size_t i = 0; i < block_size; ++i)
+        {
+            k[i] ^= 0x6a;
+        }
+    }
+
+    r = l8w8jwt_sha2_starts(&midstate->inner, md_type);
+    if (r != 0)
+    {
+        goto exit;
+    }
+
+    if (midstate->hmac && (r = l8w8jwt_sha2_update(&midstate->inner, k, block_size)) != 0)
+    {
+        goto exit;
+    }
+
+    if (prefix_length != 0)
+    {
+        r = l8w8jwt_sha2_update(&midstate->inner, prefix, prefix_length);
+    }
+
+exit:
+    mbedtls_platform_zeroize(k, sizeof(k));
+
+    if (r != 0)
+    {
+        l8w8jwt_sha2_midstate_free(midstate);
+    }
+
+    return r;
+}
+
+int l8w8jwt_sha2_midstate_finish(const struct l8w8jwt_sha2_midstate* midstate, const unsigned char* data, const size_t data_length, unsigned char* out)
+{
+    int r;
+    struct l8w8jwt_sha2_context ctx;
+    unsigned char inner[64] = { 0x00 };
+
+    l8w8jwt_sha2_clone(&ctx, &midstate->inner);
+
+    if ((r = l8w8jwt_sha2_update(&ctx, data, data_length)) != 0 || (r = l8w8jwt_sha2_finish(&ctx, midstate->hmac ? inner : out)) != 0)
+    {
+        goto exit;
+    }
+
+    if (midstate->hmac)
+    {
+        l8w8jwt_sha2_free(&ctx);
+        l8w8jwt_sha2_clone(&ctx, &midstate->outer);
+
+        if ((r = l8w8jwt_sha2_update(&ctx, inner, l8w8jwt_sha2_length(ctx.md_type))) == 0)
+        {
+            r = l8w8jwt_sha2_finish(&ctx, out);
+        }
+    }
+
+exit:
+    l8w8jwt_sha2_free(&ctx);
+    mbedtls_platform_zeroize(inner, sizeof(inner));
+    return r;
+}
+
+void l8w8jwt_sha2_midstate_free(struct l8w8jwt_sha2_midstate* midstate)
+{
+    if (midstate == NULL)
+    {
+        return;
+    }
+
+    l8w8jwt_sha2_free(&midstate->inner);
+
+    if (midstate->hmac)
+    {
+        l8w8jwt_sha2_free(&midstate->outer);
+    }
+
+    mbedtls_platform_zeroize(midstate, sizeof(struct l8w8jwt_sha2_midstate));
+}
+
+int l8w8jwt_hmac_sha2(const mbedtls_md_type_t md_type, const unsigned char* key, const size_t key_length, const unsigned char* data, const size_t data_length, unsigned char* out)
+{
+    struct l8w8jwt_sha2_midstate midstate;
+
+    /* An HMAC without a prefix is just a midstate that absorbed nothing but the key pads. */
+    int r = l8w8jwt_sha2_midstate_init(&midstate, md_type, key != NULL ? key : (const unsigned char*)"", key_length, NULL, 0);
+    if (r != 0)
+    {
+        return r;
+    }
+
+    r = l8w8jwt_sha2_midstate_finish(&midstate, data, data_length, out);
+
+    l8w8jwt_sha2_midstate_free(&midstate);
+    return r;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,316 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file sha2.h
+ *  @author Raphael Beck
+ *  @brief Internal SHA-2 and HMAC-SHA-2 helpers that operate on stack contexts only (no heap allocations, unlike <code>mbedtls_md_hmac</code>). NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_SHA2_H
+#define L8W8JWT_SHA2_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <mbedtls/md.h>
+#include <mbedtls/sha256.h>
+#include <mbedtls/sha512.h>
+
+#ifndef L8W8JWT_ENABLE_SHA2_ACCELERATION
+/**
+ * Set this to \c 0 to always hash with MbedTLS' portable SHA-2 implementation. <p>
+ * Otherwise, on x86/x64 the SHA-2 block function is picked at runtime (CPUID): SHA-NI for SHA-256 and AVX2 for SHA-384/512, with a portable C fallback.
+ */
+#define L8W8JWT_ENABLE_SHA2_ACCELERATION 1
+#endif
+
+#if L8W8JWT_ENABLE_SHA2_ACCELERATION && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+#define L8W8JWT_SHA2_X86 1
+#else
+#define L8W8JWT_SHA2_X86 0
+#endif
+
+/**
+ * SHA-256, SHA-384 or SHA-512 context (whichever one was selected in {@link #l8w8jwt_sha2_starts}).
+ */
+struct l8w8jwt_sha2_context
+{
+    /**
+     * The selected hash function.
+     */
+    mbedtls_md_type_t md_type;
+
+#if L8W8JWT_SHA2_X86
+    /**
+     * How many bytes were fed into the context so far.
+     */
+    uint64_t total;
+
+    /**
+     * The chaining state (SHA-256 uses 32-bit words, SHA-384/512 64-bit ones).
+     */
+    union
+    {
+        uint32_t sha256[8];
+        uint64_t sha512[8];
+    } state;
+
+    /**
+     * The not-yet-compressed rest of the input (<code>total % block size</code> bytes).
+     */
+    unsigned char buffer[128];
+#else
+    /**
+     * The underlying MbedTLS context.
+     */
+    union
+    {
+        mbedtls_sha256_context sha256;
+        mbedtls_sha512_context sha512;
+    } ctx;
+#endif
+};
+
+#if L8W8JWT_SHA2_X86
+
+/**
+ * The CPU supports the SHA extensions (and SSSE3 and SSE4.1).
+ */
+#define L8W8JWT_SHA2_X86_SHA_NI 1
+
+/**
+ * The CPU supports AVX2 and BMI2 (and the OS saves the YMM registers).
+ */
+#define L8W8JWT_SHA2_X86_AVX2 2
+
+/**
+ * The CPU supports AVX-512F (and AVX2, and the OS saves the ZMM registers).
+ */
+#define L8W8JWT_SHA2_X86_AVX512 4
+
+/**
+ * Gets the SHA-2 relevant CPU features (detected once, on first use).
+ * @return Bitmask of <code>L8W8JWT_SHA2_X86_SHA_NI</code>, <code>L8W8JWT_SHA2_X86_AVX2</code> and <code>L8W8JWT_SHA2_X86_AVX512</code>.
+ */
+int l8w8jwt_sha2_x86_features(void);
+
+/**
+ * Compresses a number of consecutive 64-byte blocks into a SHA-256 state, using the fastest kernel the CPU supports.
+ * @param state The SHA-256 chaining state.
+ * @param data The blocks to compress.
+ * @param blocks How many blocks to compress.
+ */
+void l8w8jwt_sha256_blocks(uint32_t state[8], const unsigned char* data, size_t blocks);
+
+/**
+ * Compresses a number of consecutive 128-byte blocks into a SHA-384/512 state, using the fastest kernel the CPU supports.
+ * @param state The SHA-512 chaining state.
+ * @param data The blocks to compress.
+ * @param blocks How many blocks to compress.
+ */
+void l8w8jwt_sha512_blocks(uint64_t state[8], const unsigned char* data, size_t blocks);
+
+/* The individual kernels (only call the accelerated ones if l8w8jwt_sha2_x86_features() says so). */
+void l8w8jwt_sha256_blocks_generic(uint32_t state[8], const unsigned char* data, size_t blocks);
+void l8w8jwt_sha256_blocks_shani(uint32_t state[8], const unsigned char* data, size_t blocks);
+void l8w8jwt_sha512_blocks_generic(uint64_t state[8], const unsigned char* data, size_t blocks);
+void l8w8jwt_sha512_blocks_avx2(uint64_t state[8], const unsigned char* data, size_t blocks);
+
+/**
+ * Same as {@link #l8w8jwt_sha256_multi}, but always with the given multi-buffer kernel (e.g. for testing each one): only call this if l8w8jwt_sha2_x86_features() says that the CPU supports it.
+ * @param kernel <code>L8W8JWT_SHA2_X86_AVX512</code> for 16 lanes, or <code>L8W8JWT_SHA2_X86_AVX2</code> for 8 lanes.
+ * @param data The messages to hash.
+ * @param lengths The message lengths.
+ * @param count How many messages there are.
+ * @param out Where to write the digests into (<code>32 * count</code> bytes).
+ * @return <code>0</code> on success; <code>1</code> if there's no such kernel.
+ */
+int l8w8jwt_sha256_multi_kernel(int kernel, const unsigned char* const* data, const size_t* lengths, size_t count, unsigned char* out);
+
+#endif // L8W8JWT_SHA2_X86
+
+/**
+ * Gets the digest length of a SHA-2 hash function.
+ * @param md_type <code>MBEDTLS_MD_SHA256</code>, <code>MBEDTLS_MD_SHA384</code> or <code>MBEDTLS_MD_SHA512</code>
+ * @return The digest length in bytes; <code>0</code> if the passed hash function is not supported.
+ */
+size_t l8w8jwt_sha2_length(mbedtls_md_type_t md_type);
+
+/**
+ * Gets the internal block size of a SHA-2 hash function (this is also the HMAC key block size).
+ * @param md_type <code>MBEDTLS_MD_SHA256</code>, <code>MBEDTLS_MD_SHA384</code> or <code>MBEDTLS_MD_SHA512</code>
+ * @return The block size in bytes; <code>0</code> if the passed hash function is not supported.
+ */
+size_t l8w8jwt_sha2_block_size(mbedtls_md_type_t md_type);
+
+/**
+ * Initializes a SHA-2 context and starts a new hash computation.
+ * @param ctx The context to start.
+ * @param md_type <code>MBEDTLS_MD_SHA256</code>, <code>MBEDTLS_MD_SHA384</code> or <code>MBEDTLS_MD_SHA512</code>
+ * @return <code>0</code> on success; anything else on failure.
+ */
+int l8w8jwt_sha2_starts(struct l8w8jwt_sha2_context* ctx, mbedtls_md_type_t md_type);
+
+/**
+ * Feeds data into a started SHA-2 context.
+ * @param ctx The context to update.
+ * @param data The data to hash.
+ * @param data_length Length of the data.
+ * @return <code>0</code> on success; anything else on failure.
+ */
+int l8w8jwt_sha2_update(struct l8w8jwt_sha2_context* ctx, const unsigned char* data, size_t data_length);
+
+/**
+ * Finishes a SHA-2 computation and writes the digest into the output buffer.
+ * @param ctx The context to finish.
+ * @param out Where to write the digest into (must be at least {@link #l8w8jwt_sha2_length} bytes big).
+ * @return <code>0</code> on success; anything else on failure.
+ */
+int l8w8jwt_sha2_finish(struct l8w8jwt_sha2_context* ctx, unsigned char* out);
+
+/**
+ * Frees and zeroizes a SHA-2 context.
+ * @param ctx The context to free.
+ */
+void l8w8jwt_sha2_free(struct l8w8jwt_sha2_context* ctx);
+
+/**
+ * One-shot SHA-2 digest.
+ * @param md_type <code>MBEDTLS_MD_SHA256</code>, <code>MBEDTLS_MD_SHA384</code> or <code>MBEDTLS_MD_SHA512</code>
+ * @param data The data to hash.
+ * @param data_length Length of the data.
+ * @param out Where to write the digest into (must be at least {@link #l8w8jwt_sha2_length} bytes big).
+ * @return <code>0</code> on success; anything else on failure.
+ */
+int l8w8jwt_sha2(mbedtls_md_type_t md_type, const unsigned char* data, size_t data_length, unsigned char* out);
+
+/**
+ * Copies the state of a started SHA-2 context into another one (e.g. for continuing from a cached midstate).
+ * @param dst The context to copy into (must not be started).
+ * @param src The context to copy.
+ */
+void l8w8jwt_sha2_clone(struct l8w8jwt_sha2_context* dst, const struct l8w8jwt_sha2_context* src);
+
+/**
+ * A (HMAC-)SHA-2 state that already absorbed a constant prefix (and for HMAC, the key pads). <p>
+ * Finishing it clones the cached state, so one midstate can be reused for any amount of messages that start with that prefix.
+ */
+struct l8w8jwt_sha2_midstate
+{
+    /**
+     * <code>1</code> for HMAC, <code>0</code> for plain SHA-2.
+     */
+    int hmac;
+
+    /**
+     * Hash state after absorbing the (ipad ^ key block +) prefix.
+     */
+    struct l8w8jwt_sha2_context inner;
+
+    /**
+     * HMAC only: hash state after absorbing the opad ^ key block.
+     */
+    struct l8w8jwt_sha2_context outer;
+};
+
+/**
+ * Absorbs a constant prefix into a new midstate.
+ * @param midstate The midstate to initialize.
+ * @param md_type <code>MBEDTLS_MD_SHA256</code>, <code>MBEDTLS_MD_SHA384</code> or <code>MBEDTLS_MD_SHA512</code>
+ * @param hmac_key [OPTIONAL] The HMAC secret: pass <code>NULL</code> for a plain SHA-2 midstate.
+ * @param hmac_key_length Length of the HMAC secret.
+ * @param prefix [OPTIONAL] The constant prefix to absorb.
+ * @param prefix_length Length of the prefix (can be <code>0</code>).
+ * @return <code>0</code> on success; anything else on failure.
+ */
+int l8w8jwt_sha2_midstate_init(struct l8w8jwt_sha2_midstate* midstate, mbedtls_md_type_t md_type, const unsigned char* hmac_key, size_t hmac_key_length, const unsigned char* prefix, size_t prefix_length);
+
+/**
+ * Computes the digest (or MAC) of <code>prefix || data</code> from a cached midstate (the midstate itself is left untouched).
+ * @param midstate The midstate to continue from.
+ * @param data The rest of the message (everything after the prefix).
+ * @param data_length Length of the data.
+ * @param out Where to write the digest into (must be at least {@link #l8w8jwt_sha2_length} bytes big).
+ * @return <code>0</code> on success; anything else on failure.
+ */
+int l8w8jwt_sha2_midstate_finish(const struct l8w8jwt_sha2_midstate* midstate, const unsigned char* data, size_t data_length, unsigned char* out);
+
+/**
+ * Zeroizes a midstate.
+ * @param midstate The midstate to free.
+ */
+void l8w8jwt_sha2_midstate_free(struct l8w8jwt_sha2_midstate* midstate);
+
+/**
+ * One-shot HMAC-SHA-2 (RFC 2104) that does not touch the heap.
+ * @param md_type <code>MBEDTLS_MD_SHA256</code>, <code>MBEDTLS_MD_SHA384</code> or <code>MBEDTLS_MD_SHA512</code>
+ * @param key The HMAC secret.
+ * @param key_length Length of the HMAC secret.
+ * @param data The data to authenticate.
+ * @param data_length Length of the data.
+ * @param out Where to write the MAC into (must be at least {@link #l8w8jwt_sha2_length} bytes big).
+ * @return <code>0</code> on success; anything else on failure.
+ */
+int l8w8jwt_hmac_sha2(mbedtls_md_type_t md_type, const unsigned char* key, size_t key_length, const unsigned char* data, size_t data_length, unsigned char* out);
+
+/**
+ * Hashes many messages with SHA-256 at once. <p>
+ * On x86 CPUs with AVX-512 (or with AVX2 but no SHA-NI), the messages are hashed 16 (8) at a time, one per SIMD lane; otherwise one after the other.
+ * @param data The messages to hash.
+ * @param lengths The message lengths.
+ * @param count How many messages there are.
+ * @param out Where to write the digests into (<code>32 * count</code> bytes; digest <code>i</code> starts at <code>out + 32 * i</code>).
+ * @return <code>0</code> on success; anything else on failure.
+ */
+int l8w8jwt_sha256_multi(const unsigned char* const* data, const size_t* lengths, size_t count, unsigned char* out);
+
+/**
+ * Computes the HMAC-SHA-256 of many messages under the same key at once (see {@link #l8w8jwt_sha256_multi}).
+ * @param key The HMAC secret.
+ * @param key_length Length of the HMAC secret.
+ * @param data The messages to authenticate.
+ * @param lengths The message lengths.
+ * @param count How many messages there are.
+ * @param out Where to write the MACs into (<code>32 * count</code> bytes).
+ * @return <code>0</code> on success; anything else on failure.
+ */
+int l8w8jwt_hmac_sha256_multi(const unsigned char* key, size_t key_length, const unsigned char* const* data, const size_t* lengths, size_t count, unsigned char* out);
+
+struct l8w8jwt_prefix_context;
+
+/**
+ * Computes the hash (or for the HS* algs, the HMAC) of a signing input from a prefix context's cached midstate. <p>
+ * This is only possible if the prefix context was created for the same alg (and HMAC key), and if \p data starts with its prefix.
+ * @param prefix_context [OPTIONAL] The prefix context to use.
+ * @param alg The JWT alg.
+ * @param hmac_key The HMAC secret (HS* algs only; without any trailing NUL-terminator).
+ * @param hmac_key_length Length of the HMAC secret.
+ * @param data The signing input (base64url header + '.' + base64url payload).
+ * @param data_length Length of the signing input.
+ * @param out Where to write the digest or MAC into.
+ * @return <code>0</code> on success; <code>1</code> if the prefix context is not applicable (hash the regular way instead); <code>-1</code> on failure.
+ */
+int l8w8jwt_prefix_context_digest(const struct l8w8jwt_prefix_context* prefix_context, int alg, const unsigned char* hmac_key, size_t hmac_key_length, const unsigned char* data, size_t data_length, unsigned char* out);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_SHA2_H
@@ -0,0 +1,383 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "sha2.h"
+
+#include <string.h>
+#include <mbedtls/platform_util.h>
+
+#if L8W8JWT_SHA2_X86
+
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#define L8W8JWT_TARGET(features)
+#else
+#define L8W8JWT_TARGET(features) __attribute__((target(features)))
+#endif
+
+static const uint32_t K256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5, //
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, //
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da, //
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, //
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, //
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, //
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3, //
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2, //
+};
+
+static const uint32_t SHA256_IV[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+static inline uint32_t load_be32(const unsigned char* p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+/*
+ * The kernels compress one 64-byte block per lane. The state is stored transposed
+ * (state[word * lanes + lane]), so that every state word of all lanes is one vector.
+ */
+typedef void (*sha256_multi_kernel)(uint32_t* state, const unsigned char* const* blocks);
+
+#define MB_ROTR(x, n) MB_OR(MB_SRLI(x, n), MB_SLLI(x, 32 - (n)))
+
+#define MB_ROUNDS()                                                                                                                                           \
+    for (int t = 0; t < 64; ++t)                                                                                                                              \
+    {                                                                                                                                                         \
+        if (t >= 16)                                                                                                                                          \
+        {                                                                                                                                                     \
+            const MB_VEC w15 = w[(t + 1) & 15];                                                                                                               \
+            const MB_VEC w2 = w[(t + 14) & 15];                                                                                                               \
+            const MB_VEC s0 = MB_XOR3(MB_ROTR(w15, 7), MB_ROTR(w15, 18), MB_SRLI(w15, 3));                                                                    \
+            const MB_VEC s1 = MB_XOR3(MB_ROTR(w2, 17), MB_ROTR(w2, 19), MB_SRLI(w2, 10));                                                                     \
+            w[t & 15] = MB_ADD(MB_ADD(w[t & 15], s0), MB_ADD(w[(t + 9) & 15], s1));                                                                           \
+        }                                                                                                                                                     \
+        const MB_VEC t1 = MB_ADD(MB_ADD(MB_ADD(h, MB_XOR3(MB_ROTR(e, 6), MB_ROTR(e, 11), MB_ROTR(e, 25))), MB_ADD(MB_CH(e, f, g), MB_SET1(K256[t]))), w[t & 15]); \
+        const MB_VEC t2 = MB_ADD(MB_XOR3(MB_ROTR(a, 2), MB_ROTR(a, 13), MB_ROTR(a, 22)), MB_MAJ(a, b, c));                                                   \
+        h = g;                                                                                                                                                \
+        g = f;                                                                                                                                                \
+        f = e;                                                                                                                                                \
+        e = MB_ADD(d, t1);                                                                                                                                    \
+        d = c;                                                                                                                                                \
+        c = b;                                                                                                                                                \
+        b = a;                                                                                                                                                \
+        a = MB_ADD(t1, t2);                                                                                                                                   \
+    }
+
+#define MB_KERNEL_BODY(LANES)                                                                    \
+    MB_VEC w[16];                                                                                \
+    for (int t = 0; t < 16; ++t)                                                                 \
+    {                                                                                            \
+        uint32_t x[LANES];                                                                       \
+        for (int i = 0; i < LANES; ++i)                                                          \
+        {                                                                                        \
+            x[i] = load_be32(blocks[i] + 4 * t);                                                 \
+        }                                                                                        \
+        w[t] = MB_LOADU(x);                                                                      \
+    }                                                                                            \
+    MB_VEC a = MB_LOADU(state + 0 * LANES), b = MB_LOADU(state + 1 * LANES);                     \
+    MB_VEC c = MB_LOADU(state + 2 * LANES), d = MB_LOADU(state + 3 * LANES);                     \
+    MB_VEC e = MB_LOADU(state + 4 * LANES), f = MB_LOADU(state + 5 * LANES);                     \
+    MB_VEC g = MB_LOADU(state + 6 * LANES), h = MB_LOADU(state + 7 * LANES);                     \
+    MB_ROUNDS()                                                                                  \
+    MB_STOREU(state + 0 * LANES, MB_ADD(a, MB_LOADU(state + 0 * LANES)));                        \
+    MB_STOREU(state + 1 * LANES, MB_ADD(b, MB_LOADU(state + 1 * LANES)));                        \
+    MB_STOREU(state + 2 * LANES, MB_ADD(c, MB_LOADU(state + 2 * LANES)));                        \
+    MB_STOREU(state + 3 * LANES, MB_ADD(d, MB_LOADU(state + 3 * LANES)));                        \
+    MB_STOREU(state + 4 * LANES, MB_ADD(e, MB_LOADU(state + 4 * LANES)));                        \
+    MB_STOREU(state + 5 * LANES, MB_ADD(f, MB_LOADU(state + 5 * LANES)));                        \
+    MB_STOREU(state + 6 * LANES, MB_ADD(g, MB_LOADU(state + 6 * LANES)));                        \
+    MB_STOREU(state + 7 * LANES, MB_ADD(h, MB_LOADU(state + 7 * LANES)));
+
+/* AVX2: 8 lanes of 32-bit words per YMM register. */
+#define MB_VEC __m256i
+#define MB_ADD _mm256_add_epi32
+#define MB_OR _mm256_or_si256
+#define MB_SRLI _mm256_srli_epi32
+#define MB_SLLI _mm256_slli_epi32
+#define MB_SET1(x) _mm256_set1_epi32((int)(x))
+#define MB_LOADU(p) _mm256_loadu_si256((const __m256i*)(p))
+#define MB_STOREU(p, x) _mm256_storeu_si256((__m256i*)(p), x)
+#define MB_XOR3(x, y, z) _mm256_xor_si256(_mm256_xor_si256(x, y), z)
+#define MB_CH(x, y, z) _mm256_xor_si256(_mm256_and_si256(x, y), _mm256_andnot_si256(x, z))
+#define MB_MAJ(x, y, z) _mm256_or_si256(_mm256_and_si256(x, y), _mm256_and_si256(z, _mm256_or_si256(x, y)))
+
+L8W8JWT_TARGET("avx2")
+static void sha256_x8_avx2(uint32_t* state, const unsigned char* const* blocks)
+{
+    MB_KERNEL_BODY(8)
+}
+
+#undef MB_VEC
+#undef MB_ADD
+#undef MB_OR
+#undef MB_SRLI
+#undef MB_SLLI
+#undef MB_SET1
+#undef MB_LOADU
+#undef MB_STOREU
+#undef MB_XOR3
+#undef MB_CH
+#undef MB_MAJ
+#undef MB_ROTR
+
+/* AVX-512: 16 lanes per ZMM register, with native rotations and three-input logic. */
+#define MB_VEC __m512i
+#define MB_ADD _mm512_add_epi32
+#define MB_SRLI _mm512_srli_epi32
+#define MB_ROTR(x, n) _mm512_ror_epi32(x, n)
+#define MB_SET1(x) _mm512_set1_epi32((int)(x))
+#define MB_LOADU(p) _mm512_loadu_si512((const void*)(p))
+#define MB_STOREU(p, x) _mm512_storeu_si512((void*)(p), x)
+#define MB_XOR3(x, y, z) _mm512_ternarylogic_epi32(x, y, z, 0x96)
+#define MB_CH(x, y, z) _mm512_ternarylogic_epi32(x, y, z, 0xCA)
+#define MB_MAJ(x, y, z) _mm512_ternarylogic_epi32(x, y, z, 0xE8)
+
+L8W8JWT_TARGET("avx512f")
+static void sha256_x16_avx512(uint32_t* state, const unsigned char* const* blocks)
+{
+    MB_KERNEL_BODY(16)
+}
+
+#define L8W8JWT_SHA256_MULTI_MAX_LANES 16
+
+/*
+ * Hashes the messages in groups of one lane each. Every lane walks through its own message's blocks
+ * (the last one or two taken from a padded copy of the tail), so messages of different lengths can share a group:
+ * a lane that runs out of blocks keeps compressing a dummy block until the longest message in its group is done,
+ * but its digest was already extracted right after its own last block.
+ */
+static void sha256_multi(const int lanes, const sha256_multi_kernel kernel, const uint32_t iv[8], const uint64_t prefix_length, const unsigned char* const* data, const size_t* lengths, const size_t count, unsigned char* out)
+{
+    static const unsigned char dummy[64] = { 0x00 };
+
+    uint32_t state[8 * L8W8JWT_SHA256_MULTI_MAX_LANES];
+    unsigned char tails[L8W8JWT_SHA256_MULTI_MAX_LANES][128];
+    const unsigned char* blocks[L8W8JWT_SHA256_MULTI_MAX_LANES];
+    size_t full_blocks[L8W8JWT_SHA256_MULTI_MAX_LANES];
+    size_t total_blocks[L8W8JWT_SHA256_MULTI_MAX_LANES];
+
+    for (size_t group = 0; group < count; group += lanes)
+    {
+        size_t max_blocks = 0;
+
+        for (int lane = 0; lane < lanes; ++lane)
+        {
+            const size_t i = group + lane;
+
+            for (int k = 0; k < 8; ++k)
+            {
+                state[k * lanes + lane] = iv[k];
+            }
+
+            if (i >= count)
+            {
+                full_blocks[lane] = total_blocks[lane] = 0;
+                continue;
+            }
+
+            const size_t length = lengths[i];
+            const size_t rest = length % 64;
+            const size_t tail_blocks = rest + 9 > 64 ? 2 : 1;
+            const uint64_t bit_length = (prefix_length + length) << 3;
+
+            full_blocks[lane] = length / 64;
+            total_blocks[lane] = full_blocks[lane] + tail_blocks;
+
+            unsigned char* tail = tails[lane];
+            memset(tail, 0x00, sizeof(tails[lane]));
+            memcpy(tail, data[i] + length - rest, rest);
+            tail[rest] = 0x80;
+
+            for (int b = 0; b < 8; ++b)
+            {
+                tail[64 * tail_blocks - 1 - b] = (unsigned char)(bit_length >> (8 * b));
+            }
+
+            if (total_blocks[lane] > max_blocks)
+            {
+                max_blocks = total_blocks[lane];
+            }
+        }
+
+        for (size_t j = 0; j < max_blocks; ++j)
+        {
+            for (int lane = 0; lane < lanes; ++lane)
+            {
+                if (j < full_blocks[lane])
+                {
+                    blocks[lane] = data[group + lane] + 64 * j;
+                }
+                else if (j < total_blocks[lane])
+                {
+                    blocks[lane] = tails[lane] + 64 * (j - full_blocks[lane]);
+                }
+                else
+                {
+                    blocks[lane] = dummy;
+                }
+            }
+
+            kernel(state, blocks);
+
+            for (int lane = 0; lane < lanes; ++lane)
+            {
+                if (j + 1 != total_blocks[lane])
+                {
+                    continue;
+                }
+
+                unsigned char* digest = out + 32 * (group + lane);
+
+                for (int k = 0; k < 8; ++k)
+                {
+                    const uint32_t x = state[k * lanes + lane];
+                    digest[4 * k + 0] = (unsigned char)(x >> 24);
+                    digest[4 * k + 1] = (unsigned char)(x >> 16);
+                    digest[4 * k + 2] = (unsigned char)(x >> 8);
+                    digest[4 * k + 3] = (unsigned char)(x);
+                }
+            }
+        }
+    }
+
+    mbedtls_platform_zeroize(state, sizeof(state));
+    mbedtls_platform_zeroize(tails, sizeof(tails));
+}
+
+/*
+ * Picks the engine: 16 AVX-512 lanes beat a single SHA-NI stream, but 8 AVX2 lanes don't,
+ * so CPUs with SHA-NI and no AVX-512 keep hashing one message after the other with SHA-NI.
+ */
+static int sha256_multi_dispatch(const uint32_t iv[8], const uint64_t prefix_length, const unsigned char* const* data, const size_t* lengths, const size_t count, unsigned char* out)
+{
+    const int features = l8w8jwt_sha2_x86_features();
+
+    if (count > 1 && (features & L8W8JWT_SHA2_X86_AVX512))
+    {
+        sha256_multi(16, &sha256_x16_avx512, iv, prefix_length, data, lengths, count, out);
+        return 1;
+    }
+
+    if (count > 1 && !(features & L8W8JWT_SHA2_X86_SHA_NI) && (features & L8W8JWT_SHA2_X86_AVX2))
+    {
+        sha256_multi(8, &sha256_x8_avx2, iv, prefix_length, data, lengths, count, out);
+        return 1;
+    }
+
+    return 0;
+}
+
+int l8w8jwt_sha256_multi_kernel(const int kernel, const unsigned char* const* data, const size_t* lengths, const size_t count, unsigned char* out)
+{
+    switch (kernel)
+    {
+        case L8W8JWT_SHA2_X86_AVX512:
+            sha256_multi(16, &sha256_x16_avx512, SHA256_IV, 0, data, lengths, count, out);
+            return 0;
+        case L8W8JWT_SHA2_X86_AVX2:
+            sha256_multi(8, &sha256_x8_avx2, SHA256_IV, 0, data, lengths, count, out);
+            return 0;
+        default:
+            return 1;
+    }
+}
+
+#endif // L8W8JWT_SHA2_X86
+
+int l8w8jwt_sha256_multi(const unsigned char* const* data, const size_t* lengths, const size_t count, unsigned char* out)
+{
+#if L8W8JWT_SHA2_X86
+    if (sha256_multi_dispatch(SHA256_IV, 0, data, lengths, count, out))
+    {
+        return 0;
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const int r = l8w8jwt_sha2(MBEDTLS_MD_SHA256, data[i], lengths[i], out + 32 * i);
+        if (r != 0)
+        {
+            return r;
+        }
+    }
+
+    return 0;
+}
+
+int l8w8jwt_hmac_sha256_multi(const unsigned char* key, const size_t key_length, const unsigned char* const* data, const size_t* lengths, const size_t count, unsigned char* out)
+{
+    struct l8w8jwt_sha2_midstate midstate;
+
+    int r = l8w8jwt_sha2_midstate_init(&midstate, MBEDTLS_MD_SHA256, key != NULL ? key : (const unsigned char*)"", key_length, NULL, 0);
+    if (r != 0)
+    {
+        return r;
+    }
+
+#if L8W8JWT_SHA2_X86
+    /* Inner hashes continue from the ipad midstate; the outer ones are a single block each, continuing from the opad midstate. */
+    if (sha256_multi_dispatch(midstate.inner.state.sha256, 64, data, lengths, count, out))
+    {
+        const unsigned char* inner[L8W8JWT_SHA256_MULTI_MAX_LANES];
+        const size_t inner_lengths[L8W8JWT_SHA256_MULTI_MAX_LANES] = { 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32 };
+
+        for (size_t group = 0; group < count; group += L8W8JWT_SHA256_MULTI_MAX_LANES)
+        {
+            const size_t n = count - group < L8W8JWT_SHA256_MULTI_MAX_LANES ? count - group : L8W8JWT_SHA256_MULTI_MAX_LANES;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                inner[i] = out + 32 * (group + i);
+            }
+
+            /* Every inner digest is fully read into its lane's tail block before its slot in out gets overwritten. */
+            if (!sha256_multi_dispatch(midstate.outer.state.sha256, 64, inner, inner_lengths, n, out + 32 * group))
+            {
+                for (size_t i = 0; i < n; ++i)
+                {
+                    struct l8w8jwt_sha2_context ctx;
+                    l8w8jwt_sha2_clone(&ctx, &midstate.outer);
+                    l8w8jwt_sha2_update(&ctx, inner[i], 32);
+                    l8w8jwt_sha2_finish(&ctx, out + 32 * (group + i));
+                    l8w8jwt_sha2_free(&ctx);
+                }
+            }
+        }
+
+        l8w8jwt_sha2_midstate_free(&midstate);
+        return 0;
+    }
+#endif
+
+    for (size_t i = 0; i < count && r == 0; ++i)
+    {
+        r = l8w8jwt_sha2_midstate_finish(&midstate, data[i], lengths[i], out + 32 * i);
+    }
+
+    l8w8jwt_sha2_midstate_free(&midstate);
+    return r;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,439 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "sha2.h"
+
+#if L8W8JWT_SHA2_X86
+
+#include <string.h>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define L8W8JWT_TARGET(features)
+#else
+#include <cpuid.h>
+#define L8W8JWT_TARGET(features) __attribute__((target(features)))
+#endif
+
+static const uint32_t K256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5, //
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, //
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da, //
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, //
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, //
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, //
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3, //
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2, //
+};
+
+static const uint64_t K512[80] = {
+    0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc, 0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118, //
+    0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2, 0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 0xc19bf174cf692694, //
+    0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65, 0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5, //
+    0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4, 0xc6e00bf33da88fc2, 0xd5a79147930aa725, 0x06ca6351e003826f, 0x142929670a0e6e70, //
+    0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df, 0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b, //
+    0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30, 0xd192e819d6ef5218, 0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8, //
+    0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3, //
+    0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec, 0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b, //
+    0xca273eceea26619c, 0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178, 0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b, //
+    0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817, //
+};
+
+#define ROTR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define ROTR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+static inline uint32_t load_be32(const unsigned char* p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static inline uint64_t load_be64(const unsigned char* p)
+{
+    return ((uint64_t)load_be32(p) << 32) | (uint64_t)load_be32(p + 4);
+}
+
+void l8w8jwt_sha256_blocks_generic(uint32_t state[8], const unsigned char* data, size_t blocks)
+{
+    uint32_t w[64];
+
+    while (blocks--)
+    {
+        for (int t = 0; t < 16; ++t)
+        {
+            w[t] = load_be32(data + 4 * t);
+        }
+
+        for (int t = 16; t < 64; ++t)
+        {
+            const uint32_t s0 = ROTR32(w[t - 15], 7) ^ ROTR32(w[t - 15], 18) ^ (w[t - 15] >> 3);
+            const uint32_t s1 = ROTR32(w[t - 2], 17) ^ ROTR32(w[t - 2], 19) ^ (w[t - 2] >> 10);
+            w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+        }
+
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        for (int t = 0; t < 64; ++t)
+        {
+            const uint32_t t1 = h + (ROTR32(e, 6) ^ ROTR32(e, 11) ^ ROTR32(e, 25)) + ((e & f) ^ (~e & g)) + K256[t] + w[t];
+            const uint32_t t2 = (ROTR32(a, 2) ^ ROTR32(a, 13) ^ ROTR32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+
+        data += 64;
+    }
+}
+
+#define SHA512_ROUNDS(wk)                                                                                           \
+    for (int t = 0; t < 80; ++t)                                                                                    \
+    {                                                                                                               \
+        const uint64_t t1 = h + (ROTR64(e, 14) ^ ROTR64(e, 18) ^ ROTR64(e, 41)) + ((e & f) ^ (~e & g)) + (wk)[t]; \
+        const uint64_t t2 = (ROTR64(a, 28) ^ ROTR64(a, 34) ^ ROTR64(a, 39)) + ((a & b) ^ (a & c) ^ (b & c));      \
+        h = g;                                                                                                      \
+        g = f;                                                                                                      \
+        f = e;                                                                                                      \
+        e = d + t1;                                                                                                 \
+        d = c;                                                                                                      \
+        c = b;                                                                                                      \
+        b = a;                                                                                                      \
+        a = t1 + t2;                                                                                                \
+    }
+
+void l8w8jwt_sha512_blocks_generic(uint64_t state[8], const unsigned char* data, size_t blocks)
+{
+    uint64_t w[80];
+
+    while (blocks--)
+    {
+        for (int t = 0; t < 16; ++t)
+        {
+            w[t] = load_be64(data + 8 * t);
+        }
+
+        for (int t = 16; t < 80; ++t)
+        {
+            const uint64_t s0 = ROTR64(w[t - 15], 1) ^ ROTR64(w[t - 15], 8) ^ (w[t - 15] >> 7);
+            const uint64_t s1 = ROTR64(w[t - 2], 19) ^ ROTR64(w[t - 2], 61) ^ (w[t - 2] >> 6);
+            w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+        }
+
+        for (int t = 0; t < 80; ++t)
+        {
+            w[t] += K512[t];
+        }
+
+        uint64_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint64_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        SHA512_ROUNDS(w)
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+
+        data += 128;
+    }
+}
+
+/*
+ * SHA-NI: each SHA256RNDS2 does two rounds on the state split into ABEF/CDGH halves,
+ * and SHA256MSG1/SHA256MSG2 expand the message schedule four words at a time.
+ */
+L8W8JWT_TARGET("sha,sse4.1,ssse3")
+void l8w8jwt_sha256_blocks_shani(uint32_t state[8], const unsigned char* data, size_t blocks)
+{
+    const __m128i shuffle_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    __m128i tmp = _mm_loadu_si128((const __m128i*)&state[0]);
+    __m128i state1 = _mm_loadu_si128((const __m128i*)&state[4]);
+
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);            /* CDAB */
+    state1 = _mm_shuffle_epi32(state1, 0x1B);      /* EFGH */
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8); /* ABEF */
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);   /* CDGH */
+
+    while (blocks--)
+    {
+        const __m128i abef = state0;
+        const __m128i cdgh = state1;
+
+        __m128i msg[4];
+
+        for (int i = 0; i < 16; ++i)
+        {
+            __m128i* w = &msg[i & 3];
+
+            if (i < 4)
+            {
+                *w = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 16 * i)), shuffle_mask);
+            }
+            else
+            {
+                const __m128i w1 = msg[(i - 1) & 3];
+                const __m128i w2 = msg[(i - 2) & 3];
+                *w = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(*w, msg[(i - 3) & 3]), _mm_alignr_epi8(w1, w2, 4)), w1);
+            }
+
+            __m128i wk = _mm_add_epi32(*w, _mm_loadu_si128((const __m128i*)&K256[4 * i]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+            wk = _mm_shuffle_epi32(wk, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, wk);
+        }
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+
+        data += 64;
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);         /* FEBA */
+    state1 = _mm_shuffle_epi32(state1, 0xB1);      /* DCHG */
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);   /* DCBA */
+    state1 = _mm_alignr_epi8(state1, tmp, 8);      /* HGFE */
+
+    _mm_storeu_si128((__m128i*)&state[0], state0);
+    _mm_storeu_si128((__m128i*)&state[4], state1);
+}
+
+L8W8JWT_TARGET("avx2")
+static inline __m256i sha512_sigma0_avx2(const __m256i x)
+{
+    return _mm256_xor_si256(_mm256_xor_si256(_mm256_or_si256(_mm256_srli_epi64(x, 1), _mm256_slli_epi64(x, 63)), _mm256_or_si256(_mm256_srli_epi64(x, 8), _mm256_slli_epi64(x, 56))), _mm256_srli_epi64(x, 7));
+}
+
+L8W8JWT_TARGET("avx2")
+static inline __m128i sha512_sigma1_sse(const __m128i x)
+{
+    return _mm_xor_si128(_mm_xor_si128(_mm_or_si128(_mm_srli_epi64(x, 19), _mm_slli_epi64(x, 45)), _mm_or_si128(_mm_srli_epi64(x, 61), _mm_slli_epi64(x, 3))), _mm_srli_epi64(x, 6));
+}
+
+/*
+ * AVX2 + BMI2: the message schedule (and the W + K additions) run four lanes wide,
+ * which leaves the (inherently serial) rounds to the scalar units, where BMI2 turns the rotations into RORX.
+ */
+L8W8JWT_TARGET("avx2,bmi2")
+void l8w8jwt_sha512_blocks_avx2(uint64_t state[8], const unsigned char* data, size_t blocks)
+{
+    const __m256i bswap_mask = _mm256_set_epi64x(0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL);
+
+    uint64_t w[80];
+    uint64_t wk[80];
+
+    while (blocks--)
+    {
+        for (int t = 0; t < 16; t += 4)
+        {
+            _mm256_storeu_si256((__m256i*)&w[t], _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(data + 8 * t)), bswap_mask));
+        }
+
+        for (int t = 16; t < 80; t += 4)
+        {
+            /* W[t-16] + sigma0(W[t-15]) + W[t-7] only depends on words that are already known for all four lanes... */
+            const __m256i x = _mm256_add_epi64(_mm256_add_epi64(_mm256_loadu_si256((const __m256i*)&w[t - 16]), sha512_sigma0_avx2(_mm256_loadu_si256((const __m256i*)&w[t - 15]))), _mm256_loadu_si256((const __m256i*)&w[t - 7]));
+
+            /* ...but sigma1(W[t-2]) for the upper two lanes needs the two words that the lower lanes produce. */
+            const __m128i lo = _mm_add_epi64(_mm256_castsi256_si128(x), sha512_sigma1_sse(_mm_loadu_si128((const __m128i*)&w[t - 2])));
+            const __m128i hi = _mm_add_epi64(_mm256_extracti128_si256(x, 1), sha512_sigma1_sse(lo));
+
+            _mm_storeu_si128((__m128i*)&w[t], lo);
+            _mm_storeu_si128((__m128i*)&w[t + 2], hi);
+        }
+
+        for (int t = 0; t < 80; t += 4)
+        {
+            _mm256_storeu_si256((__m256i*)&wk[t], _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)&w[t]), _mm256_loadu_si256((const __m256i*)&K512[t])));
+        }
+
+        uint64_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint64_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+        SHA512_ROUNDS(wk)
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+
+        data += 128;
+    }
+}
+
+static void cpuid(const unsigned int leaf, const unsigned int subleaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER)
+    int r[4];
+    __cpuidex(r, (int)leaf, (int)subleaf);
+    for (int i = 0; i < 4; ++i)
+    {
+        regs[i] = (unsigned int)r[i];
+    }
+#else
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static uint32_t xcr0(void)
+{
+#if defined(_MSC_VER)
+    return (uint32_t)_xgetbv(0);
+#else
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    (void)edx;
+    return eax;
+#endif
+}
+
+static int detect_features(void)
+{
+    unsigned int regs[4];
+    int features = 0;
+
+    cpuid(0, 0, regs);
+    const unsigned int max_leaf = regs[0];
+
+    if (max_leaf < 7)
+    {
+        return features;
+    }
+
+    cpuid(1, 0, regs);
+    const int ssse3 = (regs[2] >> 9) & 1;
+    const int sse41 = (regs[2] >> 19) & 1;
+    const int osxsave = (regs[2] >> 27) & 1;
+    const int avx = (regs[2] >> 28) & 1;
+
+    cpuid(7, 0, regs);
+    const int avx2 = (regs[1] >> 5) & 1;
+    const int bmi2 = (regs[1] >> 8) & 1;
+    const int avx512f = (regs[1] >> 16) & 1;
+    const int sha = (regs[1] >> 29) & 1;
+
+    const uint32_t os_state = osxsave ? xcr0() : 0;
+
+    if (sha && ssse3 && sse41)
+    {
+        features |= L8W8JWT_SHA2_X86_SHA_NI;
+    }
+
+    /* The OS must save the XMM and YMM state (and for AVX-512 also the opmask and ZMM state). */
+    if (avx && avx2 && bmi2 && (os_state & 0x06) == 0x06)
+    {
+        features |= L8W8JWT_SHA2_X86_AVX2;
+
+        if (avx512f && (os_state & 0xE6) == 0xE6)
+        {
+            features |= L8W8JWT_SHA2_X86_AVX512;
+        }
+    }
+
+    return features;
+}
+
+/*
+ * -1 means "not detected yet". Concurrent first calls all detect (and store) the same value,
+ * so relaxed atomics are enough: they only need to make the load and store themselves race-free.
+ */
+#if !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+static atomic_int cpu_features = -1;
+
+#define L8W8JWT_LOAD_CPU_FEATURES() atomic_load_explicit(&cpu_features, memory_order_relaxed)
+#define L8W8JWT_STORE_CPU_FEATURES(features) atomic_store_explicit(&cpu_features, (features), memory_order_relaxed)
+
+#else
+
+/* Without C11 atomics, fall back to a plain int-sized (and thus, on x86, untorn) volatile. */
+static volatile int cpu_features = -1;
+
+#define L8W8JWT_LOAD_CPU_FEATURES() cpu_features
+#define L8W8JWT_STORE_CPU_FEATURES(features) (cpu_features = (features))
+
+#endif
+
+int l8w8jwt_sha2_x86_features(void)
+{
+    int features = L8W8JWT_LOAD_CPU_FEATURES();
+
+    if (features == -1)
+    {
+        features = detect_features();
+        L8W8JWT_STORE_CPU_FEATURES(features);
+    }
+
+    return features;
+}
+
+void l8w8jwt_sha256_blocks(uint32_t state[8], const unsigned char* data, const size_t blocks)
+{
+    if (l8w8jwt_sha2_x86_features() & L8W8JWT_SHA2_X86_SHA_NI)
+    {
+        l8w8jwt_sha256_blocks_shani(state, data, blocks);
+        return;
+    }
+
+    l8w8jwt_sha256_blocks_generic(state, data, blocks);
+}
+
+void l8w8jwt_sha512_blocks(uint64_t state[8], const unsigned char* data, const size_t blocks)
+{
+    if (l8w8jwt_sha2_x86_features() & L8W8JWT_SHA2_X86_AVX2)
+    {
+        l8w8jwt_sha512_blocks_avx2(state, data, blocks);
+        return;
+    }
+
+    l8w8jwt_sha512_blocks_generic(state, data, blocks);
+}
+
+#endif // L8W8JWT_SHA2_X86
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,85 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file spinlock.h
+ *  @author Raphael Beck
+ *  @brief Internal <code>atomic_flag</code> spinlock with backoff. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_SPINLOCK_H
+#define L8W8JWT_SPINLOCK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define L8W8JWT_SPIN_PAUSE() _mm_pause()
+#elif defined(__aarch64__) || (defined(__arm__) && defined(__ARM_ARCH) && __ARM_ARCH >= 7)
+#define L8W8JWT_SPIN_PAUSE() __asm__ __volatile__("yield")
+#else
+#define L8W8JWT_SPIN_PAUSE() ((void)0)
+#endif
+
+#if defined(_WIN32)
+#include <windows.h>
+#define L8W8JWT_SPIN_YIELD() SwitchToThread()
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sched.h>
+#define L8W8JWT_SPIN_YIELD() sched_yield()
+#else
+#define L8W8JWT_SPIN_YIELD() ((void)0)
+#endif
+
+/* How many times to pause in a row before handing the core to another thread (e.g. when the lock holder got preempted). */
+#define L8W8JWT_SPIN_PAUSES 64
+
+static inline void l8w8jwt_spinlock_lock(atomic_flag* lock)
+{
+    unsigned int spins = 0;
+
+    while (atomic_flag_test_and_set_explicit(lock, memory_order_acquire))
+    {
+        if (spins < L8W8JWT_SPIN_PAUSES)
+        {
+            ++spins;
+            L8W8JWT_SPIN_PAUSE();
+        }
+        else
+        {
+            L8W8JWT_SPIN_YIELD();
+        }
+    }
+}
+
+static inline void l8w8jwt_spinlock_unlock(atomic_flag* lock)
+{
+    atomic_flag_clear_explicit(lock, memory_order_release);
+}
+
+#endif // !defined(__STDC_NO_ATOMICS__)
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_SPINLOCK_H
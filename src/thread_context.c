@@ -0,0 +1,325 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/util.h"
+#include "thread_context.h"
+
+#include <string.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/platform_util.h>
+
+#if L8W8JWT_THREAD_CONTEXTS && defined(L8W8JWT_THREAD_LOCAL)
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <pthread.h>
+#define L8W8JWT_THREAD_CONTEXT_FORK_CHECK 1
+#else
+#define L8W8JWT_THREAD_CONTEXT_FORK_CHECK 0
+#endif
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+struct l8w8jwt_thread_context
+{
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context ctr_drbg;
+    int ctr_drbg_seeded;
+
+#if L8W8JWT_THREAD_CONTEXT_FORK_CHECK
+    /* A forked child must not continue the parent's DRBG output (that would repeat ECDSA nonces): it reseeds once it notices that its pid changed. */
+    pid_t pid;
+#endif
+
+    mbedtls_mpi mpis[2];
+
+    void* tokens;
+    size_t tokens_size;
+};
+
+static L8W8JWT_THREAD_LOCAL struct l8w8jwt_thread_context* l8w8jwt_thread_context = NULL;
+
+static void l8w8jwt_thread_context_free_drbg(struct l8w8jwt_thread_context* ctx)
+{
+    mbedtls_ctr_drbg_free(&ctx->ctr_drbg);
+    mbedtls_entropy_free(&ctx->entropy);
+    ctx->ctr_drbg_seeded = 0;
+}
+
+static void l8w8jwt_thread_context_destroy(struct l8w8jwt_thread_context* ctx)
+{
+    if (ctx->ctr_drbg_seeded)
+    {
+        l8w8jwt_thread_context_free_drbg(ctx);
+    }
+
+    mbedtls_mpi_free(&ctx->mpis[0]);
+    mbedtls_mpi_free(&ctx->mpis[1]);
+
+    l8w8jwt_free(ctx->tokens);
+
+    mbedtls_platform_zeroize(ctx, sizeof(struct l8w8jwt_thread_context));
+    l8w8jwt_free(ctx);
+}
+
+/*
+ * Thread-local storage can't free heap memory by itself: every context is also registered under a pthread key (or a fiber-local storage index on Windows),
+ * whose destructor frees it when its thread exits. Where neither exists, contexts live until l8w8jwt_thread_cleanup() is called.
+ */
+
+#if defined(__unix__) || defined(__APPLE__)
+
+static pthread_key_t l8w8jwt_thread_context_key;
+static pthread_once_t l8w8jwt_thread_context_key_once = PTHREAD_ONCE_INIT;
+static int l8w8jwt_thread_context_key_created = 0;
+
+static void l8w8jwt_thread_context_exit(void* ptr)
+{
+    /* Runs at thread exit, while the thread-local pointer still refers to this same context. */
+    l8w8jwt_thread_context = NULL;
+    l8w8jwt_thread_context_destroy((struct l8w8jwt_thread_context*)ptr);
+}
+
+static void l8w8jwt_thread_context_create_key(void)
+{
+    l8w8jwt_thread_context_key_created = pthread_key_create(&l8w8jwt_thread_context_key, &l8w8jwt_thread_context_exit) == 0;
+}
+
+static int l8w8jwt_thread_context_register(struct l8w8jwt_thread_context* ctx)
+{
+    if (pthread_once(&l8w8jwt_thread_context_key_once, &l8w8jwt_thread_context_create_key) != 0 || !l8w8jwt_thread_context_key_created)
+    {
+        return 1;
+    }
+
+    return pthread_setspecific(l8w8jwt_thread_context_key, ctx) != 0;
+}
+
+static void l8w8jwt_thread_context_unregister(void)
+{
+    if (l8w8jwt_thread_context_key_created)
+    {
+        pthread_setspecific(l8w8jwt_thread_context_key, NULL);
+    }
+}
+
+#elif defined(_WIN32)
+
+static INIT_ONCE l8w8jwt_thread_context_index_once = INIT_ONCE_STATIC_INIT;
+static DWORD l8w8jwt_thread_context_index = FLS_OUT_OF_INDEXES;
+
+static VOID NTAPI l8w8jwt_thread_context_exit(PVOID ptr)
+{
+    if (ptr != NULL)
+    {
+        l8w8jwt_thread_context = NULL;
+        l8w8jwt_thread_context_destroy((struct l8w8jwt_thread_context*)ptr);
+    }
+}
+
+static BOOL CALLBACK l8w8jwt_thread_context_create_index(PINIT_ONCE once, PVOID parameter, PVOID* context)
+{
+    (void)once;
+    (void)parameter;
+    (void)context;
+
+    l8w8jwt_thread_context_index = FlsAlloc(&l8w8jwt_thread_context_exit);
+    return TRUE;
+}
+
+static int l8w8jwt_thread_context_register(struct l8w8jwt_thread_context* ctx)
+{
+    if (!InitOnceExecuteOnce(&l8w8jwt_thread_context_index_once, &l8w8jwt_thread_context_create_index, NULL, NULL) || l8w8jwt_thread_context_index == FLS_OUT_OF_INDEXES)
+    {
+        return 1;
+    }
+
+    return !FlsSetValue(l8w8jwt_thread_context_index, ctx);
+}
+
+static void l8w8jwt_thread_context_unregister(void)
+{
+    if (l8w8jwt_thread_context_index != FLS_OUT_OF_INDEXES)
+    {
+        FlsSetValue(l8w8jwt_thread_context_index, NULL);
+    }
+}
+
+#else
+
+static int l8w8jwt_thread_context_register(struct l8w8jwt_thread_context* ctx)
+{
+    (void)ctx;
+    return 0;
+}
+
+static void l8w8jwt_thread_context_unregister(void)
+{
+}
+
+#endif
+
+static struct l8w8jwt_thread_context* l8w8jwt_thread_context_get(void)
+{
+    struct l8w8jwt_thread_context* ctx = l8w8jwt_thread_context;
+
+    if (ctx != NULL)
+    {
+        return ctx;
+    }
+
+    ctx = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_thread_context));
+    if (ctx == NULL)
+    {
+        return NULL;
+    }
+
+    mbedtls_mpi_init(&ctx->mpis[0]);
+    mbedtls_mpi_init(&ctx->mpis[1]);
+
+    /* A context that nothing would free at thread exit isn't worth keeping: the callers set up their own scratch state instead. */
+    if (l8w8jwt_thread_context_register(ctx) != 0)
+    {
+        l8w8jwt_thread_context_destroy(ctx);
+        return NULL;
+    }
+
+    l8w8jwt_thread_context = ctx;
+    return ctx;
+}
+
+mbedtls_ctr_drbg_context* l8w8jwt_thread_ctr_drbg(void)
+{
+    struct l8w8jwt_thread_context* ctx = l8w8jwt_thread_context_get();
+    if (ctx == NULL)
+    {
+        return NULL;
+    }
+
+#if L8W8JWT_THREAD_CONTEXT_FORK_CHECK
+    const pid_t pid = getpid();
+
+    if (ctx->ctr_drbg_seeded && ctx->pid != pid)
+    {
+        l8w8jwt_thread_context_free_drbg(ctx);
+    }
+#endif
+
+    if (!ctx->ctr_drbg_seeded)
+    {
+        mbedtls_entropy_init(&ctx->entropy);
+        mbedtls_ctr_drbg_init(&ctx->ctr_drbg);
+
+        if (mbedtls_ctr_drbg_seed(&ctx->ctr_drbg, mbedtls_entropy_func, &ctx->entropy, (const unsigned char*)"l8w8jwt_thread_pers.!#@", 23) != 0)
+        {
+            mbedtls_ctr_drbg_free(&ctx->ctr_drbg);
+            mbedtls_entropy_free(&ctx->entropy);
+            return NULL;
+        }
+
+        ctx->ctr_drbg_seeded = 1;
+
+#if L8W8JWT_THREAD_CONTEXT_FORK_CHECK
+        ctx->pid = pid;
+#endif
+    }
+
+    return &ctx->ctr_drbg;
+}
+
+mbedtls_mpi* l8w8jwt_thread_mpis(void)
+{
+    struct l8w8jwt_thread_context* ctx = l8w8jwt_thread_context_get();
+    return ctx != NULL ? ctx->mpis : NULL;
+}
+
+void* l8w8jwt_thread_tokens(const size_t size)
+{
+    struct l8w8jwt_thread_context* ctx = l8w8jwt_thread_context_get();
+    if (ctx == NULL)
+    {
+        return NULL;
+    }
+
+    if (ctx->tokens_size < size)
+    {
+        /* Grow geometrically: claim counts vary from token to token. */
+        size_t new_size = ctx->tokens_size * 2;
+        if (new_size < size)
+        {
+            new_size = size;
+        }
+
+        void* tokens = l8w8jwt_realloc(ctx->tokens, new_size);
+        if (tokens == NULL)
+        {
+            return NULL;
+        }
+
+        ctx->tokens = tokens;
+        ctx->tokens_size = new_size;
+    }
+
+    return ctx->tokens;
+}
+
+void l8w8jwt_thread_cleanup(void)
+{
+    struct l8w8jwt_thread_context* ctx = l8w8jwt_thread_context;
+    if (ctx == NULL)
+    {
+        return;
+    }
+
+    l8w8jwt_thread_context = NULL;
+    l8w8jwt_thread_context_unregister();
+
+    l8w8jwt_thread_context_destroy(ctx);
+}
+
+#else
+
+mbedtls_ctr_drbg_context* l8w8jwt_thread_ctr_drbg(void)
+{
+    return NULL;
+}
+
+mbedtls_mpi* l8w8jwt_thread_mpis(void)
+{
+    return NULL;
+}
+
+void* l8w8jwt_thread_tokens(const size_t size)
+{
+    (void)size;
+    return NULL;
+}
+
+void l8w8jwt_thread_cleanup(void)
+{
+}
+
+#endif // L8W8JWT_THREAD_CONTEXTS && L8W8JWT_THREAD_LOCAL
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
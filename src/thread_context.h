@@ -0,0 +1,69 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file thread_context.h
+ *  @author Raphael Beck
+ *  @brief Internal per-thread scratch contexts (see l8w8jwt/thread.h). NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_THREAD_CONTEXT_H
+#define L8W8JWT_THREAD_CONTEXT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/thread.h"
+
+#include <stddef.h>
+#include <mbedtls/bignum.h>
+#include <mbedtls/ctr_drbg.h>
+
+#ifndef L8W8JWT_THREAD_LOCAL
+#if defined(_MSC_VER)
+#define L8W8JWT_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define L8W8JWT_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+#define L8W8JWT_THREAD_LOCAL __thread
+#endif
+#endif
+
+/**
+ * Gets the calling thread's CTR_DRBG, seeding it first if needed (pass it to MbedTLS along with <code>mbedtls_ctr_drbg_random</code>).
+ * @return The DRBG, or <code>NULL</code> if per-thread contexts are disabled or the context couldn't be set up (fall back to a DRBG of your own in that case).
+ */
+mbedtls_ctr_drbg_context* l8w8jwt_thread_ctr_drbg(void);
+
+/**
+ * Gets the calling thread's two bignum temporaries (e.g. for an ECDSA signature's r and s). Their values are left over from the last use.
+ * @return The temporaries, or <code>NULL</code> if per-thread contexts are disabled or the context couldn't be set up.
+ */
+mbedtls_mpi* l8w8jwt_thread_mpis(void);
+
+/**
+ * Gets the calling thread's scratch buffer for JSON tokens, growing it to at least \p size bytes.
+ * @param size The minimum buffer size in bytes.
+ * @return The buffer, or <code>NULL</code> if per-thread contexts are disabled or the buffer couldn't be grown.
+ */
+void* l8w8jwt_thread_tokens(size_t size);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_THREAD_CONTEXT_H
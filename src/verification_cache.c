@@ -0,0 +1,474 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/retcodes.h"
+#include "l8w8jwt/timehelper.h"
+#include "verification_cache_backend.h"
+#include "crypto_provider.h"
+#include "sha2.h"
+#include "digest_cache.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mbedtls/platform_util.h>
+
+int l8w8jwt_verification_cache_digest(const struct l8w8jwt_decoding_params* params, unsigned char out[32])
+{
+    if (params == NULL || params->jwt == NULL || out == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    /* alg, key kind, padding, and the key length (so that key and token can't be shifted into one another). */
+    unsigned char prefix[16] = { 0x00 };
+    unsigned char psa_key_id[4];
+
+    const unsigned char* key;
+    size_t key_length;
+
+    prefix[0] = (unsigned char)params->alg;
+
+    if (params->psa_key_id != 0)
+    {
+        psa_key_id[0] = (unsigned char)(params->psa_key_id >> 24);
+        psa_key_id[1] = (unsigned char)(params->psa_key_id >> 16);
+        psa_key_id[2] = (unsigned char)(params->psa_key_id >> 8);
+        psa_key_id[3] = (unsigned char)(params->psa_key_id);
+
+        prefix[1] = 1;
+        key = psa_key_id;
+        key_length = sizeof(psa_key_id);
+    }
+    else if (params->verification_key_object != NULL)
+    {
+        prefix[1] = 2;
+        key = params->verification_key_object->fingerprint;
+        key_length = sizeof(params->verification_key_object->fingerprint);
+    }
+    else
+    {
+        prefix[1] = 3;
+        key = params->verification_key;
+        key_length = key != NULL ? params->verification_key_length : 0;
+
+        if (key_length != 0 && key[key_length - 1] == '\0')
+        {
+            --key_length;
+        }
+    }
+
+    for (int i = 0; i < 8; ++i)
+    {
+        prefix[8 + i] = (unsigned char)((uint64_t)key_length >> (56 - 8 * i));
+    }
+
+    struct l8w8jwt_sha2_context ctx;
+
+    int r = l8w8jwt_sha2_starts(&ctx, MBEDTLS_MD_SHA256);
+    r = r != 0 ? r : l8w8jwt_sha2_update(&ctx, prefix, sizeof(prefix));
+    r = r != 0 || key_length == 0 ? r : l8w8jwt_sha2_update(&ctx, key, key_length);
+    r = r != 0 ? r : l8w8jwt_sha2_update(&ctx, (const unsigned char*)params->jwt, params->jwt_length);
+    r = r != 0 ? r : l8w8jwt_sha2_finish(&ctx, out);
+
+    l8w8jwt_sha2_free(&ctx);
+
+    return r != 0 ? L8W8JWT_SHA2_FAILURE : L8W8JWT_SUCCESS;
+}
+
+#if !defined(__STDC_NO_ATOMICS__)
+
+#include <stdatomic.h>
+
+/* Serialized claim: key length, value length and type (each as a native uint32_t), followed by the key and value bytes. */
+#define L8W8JWT_VERIFICATION_CACHE_CLAIM_HEADER_SIZE (3 * sizeof(uint32_t))
+
+struct l8w8jwt_verification_cache_entry
+{
+    unsigned char digest[32];
+
+    /* The token's exp claim: the entry is stale from then on. */
+    int64_t exp;
+
+    /* The cache generation that this entry was inserted in (0 means empty). */
+    uint64_t generation;
+
+    size_t claims_size;
+
+    /* Followed by max_claims_size bytes of serialized claims. */
+};
+
+struct l8w8jwt_verification_cache
+{
+    /* Critical sections copy at most one entry's serialized claims (up to max_claims_size bytes). */
+    struct l8w8jwt_digest_cache table;
+
+    size_t max_claims_size;
+
+    /* Bumped by l8w8jwt_verification_cache_clear(): entries from older generations are stale. */
+    atomic_uint_fast64_t generation;
+};
+
+static inline int l8w8jwt_verification_cache_entry_is_live(const struct l8w8jwt_verification_cache_entry* entry, const uint64_t generation, const int64_t now)
+{
+    return entry->generation == generation && entry->exp >= now;
+}
+
+/* Must be called with the bucket's lock held. */
+static struct l8w8jwt_verification_cache_entry* l8w8jwt_verification_cache_find(const struct l8w8jwt_verification_cache* cache, const size_t bucket, const unsigned char digest[32], const uint64_t generation, const int64_t now)
+{
+    for (size_t way = 0; way < L8W8JWT_DIGEST_CACHE_WAYS; ++way)
+    {
+        struct l8w8jwt_verification_cache_entry* entry = l8w8jwt_digest_cache_entry_at(&cache->table, bucket, way);
+
+        if (l8w8jwt_verification_cache_entry_is_live(entry, generation, now) && memcmp(entry->digest, digest, 32) == 0)
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+int l8w8jwt_verification_cache_create(const size_t max_entries, const size_t max_claims_size, struct l8w8jwt_verification_cache** out_verification_cache)
+{
+    if (out_verification_cache == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (max_entries == 0 || max_claims_size == 0 || max_claims_size > UINT32_MAX)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    const size_t entry_size = (sizeof(struct l8w8jwt_verification_cache_entry) + max_claims_size + 7) & ~(size_t)7;
+
+    if (entry_size < max_claims_size)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    struct l8w8jwt_verification_cache* cache = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_verification_cache));
+    if (cache == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    int r = l8w8jwt_digest_cache_init(&cache->table, max_entries, entry_size);
+    if (r != L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_free(cache);
+        return r;
+    }
+
+    cache->max_claims_size = max_claims_size;
+    atomic_init(&cache->generation, 1);
+
+    *out_verification_cache = cache;
+    return L8W8JWT_SUCCESS;
+}
+
+void l8w8jwt_verification_cache_clear(struct l8w8jwt_verification_cache* verification_cache)
+{
+    if (verification_cache == NULL)
+    {
+        return;
+    }
+
+    atomic_fetch_add_explicit(&verification_cache->generation, 1, memory_order_acq_rel);
+}
+
+int l8w8jwt_verification_cache_get_stats(const struct l8w8jwt_verification_cache* verification_cache, struct l8w8jwt_verification_cache_stats* out_stats)
+{
+    if (verification_cache == NULL || out_stats == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    struct l8w8jwt_verification_cache* cache = (struct l8w8jwt_verification_cache*)verification_cache;
+
+    out_stats->hits = atomic_load_explicit(&cache->table.hits, memory_order_relaxed);
+    out_stats->misses = atomic_load_explicit(&cache->table.misses, memory_order_relaxed);
+    out_stats->evictions = atomic_load_explicit(&cache->table.evictions, memory_order_relaxed);
+
+    return L8W8JWT_SUCCESS;
+}
+
+void l8w8jwt_verification_cache_free(struct l8w8jwt_verification_cache* verification_cache)
+{
+    if (verification_cache == NULL)
+    {
+        return;
+    }
+
+    l8w8jwt_digest_cache_destroy(&verification_cache->table);
+    l8w8jwt_free(verification_cache);
+}
+
+static int l8w8jwt_verification_cache_deserialize(const unsigned char* blob, const size_t blob_size, struct l8w8jwt_call_buffer* claims)
+{
+    const unsigned char* end = blob + blob_size;
+
+    while (blob < end)
+    {
+        uint32_t header[3];
+        memcpy(header, blob, sizeof(header));
+        blob += sizeof(header);
+
+        struct l8w8jwt_claim claim;
+        claim.key_length = header[0];
+        claim.value_length = header[1];
+        claim.type = (int)header[2];
+
+        claim.key = l8w8jwt_call_malloc(claim.key_length + 1);
+        claim.value = l8w8jwt_call_malloc(claim.value_length + 1);
+
+        if (claim.key == NULL || claim.value == NULL)
+        {
+            l8w8jwt_call_free(claim.key);
+            l8w8jwt_call_free(claim.value);
+            return L8W8JWT_OUT_OF_MEM;
+        }
+
+        memcpy(claim.key, blob, claim.key_length);
+        claim.key[claim.key_length] = '\0';
+        blob += claim.key_length;
+
+        memcpy(claim.value, blob, claim.value_length);
+        claim.value[claim.value_length] = '\0';
+        blob += claim.value_length;
+
+        const int r = l8w8jwt_call_buffer_push_back(claims, &claim, 1);
+        if (r != L8W8JWT_SUCCESS)
+        {
+            l8w8jwt_call_free(claim.key);
+            l8w8jwt_call_free(claim.value);
+            return r;
+        }
+    }
+
+    return L8W8JWT_SUCCESS;
+}
+
+int l8w8jwt_verification_cache_get(struct l8w8jwt_verification_cache* verification_cache, const unsigned char digest[32], struct l8w8jwt_call_buffer* claims)
+{
+    struct l8w8jwt_verification_cache* cache = verification_cache;
+
+    const int64_t now = (int64_t)l8w8jwt_time(NULL);
+    const uint64_t generation = atomic_load_explicit(&cache->generation, memory_order_acquire);
+    const size_t bucket = l8w8jwt_digest_cache_bucket(&cache->table, digest);
+
+    l8w8jwt_digest_cache_lock(&cache->table, bucket);
+    const struct l8w8jwt_verification_cache_entry* entry = l8w8jwt_verification_cache_find(cache, bucket, digest, generation, now);
+    const size_t claims_size = entry != NULL ? entry->claims_size : 0;
+    l8w8jwt_digest_cache_unlock(&cache->table, bucket);
+
+    if (entry == NULL)
+    {
+        l8w8jwt_digest_cache_count(&cache->table.misses);
+        return 1;
+    }
+
+    /* Don't allocate while holding the lock: find the entry again once the copy buffer is ready. */
+    unsigned char* blob = l8w8jwt_malloc(claims_size);
+    if (blob == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    l8w8jwt_digest_cache_lock(&cache->table, bucket);
+    entry = l8w8jwt_verification_cache_find(cache, bucket, digest, generation, now);
+    const int hit = entry != NULL && entry->claims_size == claims_size;
+    if (hit)
+    {
+        memcpy(blob, (const unsigned char*)(entry + 1), claims_size);
+    }
+    l8w8jwt_digest_cache_unlock(&cache->table, bucket);
+
+    int r = 1;
+
+    if (hit)
+    {
+        r = l8w8jwt_verification_cache_deserialize(blob, claims_size, claims);
+    }
+
+    mbedtls_platform_zeroize(blob, claims_size);
+    l8w8jwt_free(blob);
+
+    /* Only a complete copy of the claims counts as a hit (failures, e.g. running out of memory, don't count at all). */
+    if (r == L8W8JWT_SUCCESS || r == 1)
+    {
+        l8w8jwt_digest_cache_count(r == 1 ? &cache->table.misses : &cache->table.hits);
+    }
+
+    return r;
+}
+
+void l8w8jwt_verification_cache_put(struct l8w8jwt_verification_cache* verification_cache, const unsigned char digest[32], const struct l8w8jwt_claim* claims, const size_t claims_count)
+{
+    struct l8w8jwt_verification_cache* cache = verification_cache;
+
+    const int64_t now = (int64_t)l8w8jwt_time(NULL);
+
+    struct l8w8jwt_claim* exp_claim = l8w8jwt_get_claim((struct l8w8jwt_claim*)claims, claims_count, "exp", 3);
+    if (exp_claim == NULL || exp_claim->type != L8W8JWT_CLAIM_TYPE_INTEGER)
+    {
+        return;
+    }
+
+    const int64_t exp = (int64_t)strtoll(exp_claim->value, NULL, 10);
+    if (exp < now)
+    {
+        return;
+    }
+
+    size_t claims_size = 0;
+
+    for (size_t i = 0; i < claims_count; ++i)
+    {
+        if (claims[i].key_length > UINT32_MAX || claims[i].value_length > UINT32_MAX)
+        {
+            return;
+        }
+
+        claims_size += L8W8JWT_VERIFICATION_CACHE_CLAIM_HEADER_SIZE + claims[i].key_length + claims[i].value_length;
+
+        if (claims_size > cache->max_claims_size)
+        {
+            return;
+        }
+    }
+
+    const uint64_t generation = atomic_load_explicit(&cache->generation, memory_order_acquire);
+    const size_t bucket = l8w8jwt_digest_cache_bucket(&cache->table, digest);
+
+    l8w8jwt_digest_cache_lock(&cache->table, bucket);
+
+    /* Prefer the token's own entry, then a stale one, and otherwise evict the one that expires first. */
+    struct l8w8jwt_verification_cache_entry* victim = NULL;
+    int victim_is_live = 1;
+
+    for (size_t way = 0; way < L8W8JWT_DIGEST_CACHE_WAYS; ++way)
+    {
+        struct l8w8jwt_verification_cache_entry* entry = l8w8jwt_digest_cache_entry_at(&cache->table, bucket, way);
+        const int live = l8w8jwt_verification_cache_entry_is_live(entry, generation, now);
+
+        if (live && memcmp(entry->digest, digest, 32) == 0)
+        {
+            victim = entry;
+            victim_is_live = 0;
+            break;
+        }
+
+        if (!live)
+        {
+            if (victim_is_live)
+            {
+                victim = entry;
+                victim_is_live = 0;
+            }
+            continue;
+        }
+
+        if (victim_is_live && (victim == NULL || entry->exp < victim->exp))
+        {
+            victim = entry;
+        }
+    }
+
+    if (victim_is_live)
+    {
+        l8w8jwt_digest_cache_count(&cache->table.evictions);
+    }
+
+    unsigned char* blob = (unsigned char*)(victim + 1);
+
+    for (size_t i = 0; i < claims_count; ++i)
+    {
+        const uint32_t header[3] = { (uint32_t)claims[i].key_length, (uint32_t)claims[i].value_length, (uint32_t)claims[i].type };
+
+        memcpy(blob, header, sizeof(header));
+        blob += sizeof(header);
+
+        memcpy(blob, claims[i].key, claims[i].key_length);
+        blob += claims[i].key_length;
+
+        memcpy(blob, claims[i].value, claims[i].value_length);
+        blob += claims[i].value_length;
+    }
+
+    memcpy(victim->digest, digest, 32);
+    victim->exp = exp;
+    victim->generation = generation;
+    victim->claims_size = claims_size;
+
+    l8w8jwt_digest_cache_unlock(&cache->table, bucket);
+}
+
+#else
+
+int l8w8jwt_verification_cache_create(const size_t max_entries, const size_t max_claims_size, struct l8w8jwt_verification_cache** out_verification_cache)
+{
+    (void)max_entries;
+    (void)max_claims_size;
+    (void)out_verification_cache;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+void l8w8jwt_verification_cache_clear(struct l8w8jwt_verification_cache* verification_cache)
+{
+    (void)verification_cache;
+}
+
+int l8w8jwt_verification_cache_get_stats(const struct l8w8jwt_verification_cache* verification_cache, struct l8w8jwt_verification_cache_stats* out_stats)
+{
+    (void)verification_cache;
+    (void)out_stats;
+    return L8W8JWT_UNSUPPORTED_ALG;
+}
+
+void l8w8jwt_verification_cache_free(struct l8w8jwt_verification_cache* verification_cache)
+{
+    (void)verification_cache;
+}
+
+int l8w8jwt_verification_cache_get(struct l8w8jwt_verification_cache* verification_cache, const unsigned char digest[32], struct l8w8jwt_call_buffer* claims)
+{
+    (void)verification_cache;
+    (void)digest;
+    (void)claims;
+    return 1;
+}
+
+void l8w8jwt_verification_cache_put(struct l8w8jwt_verification_cache* verification_cache, const unsigned char digest[32], const struct l8w8jwt_claim* claims, const size_t claims_count)
+{
+    (void)verification_cache;
+    (void)digest;
+    (void)claims;
+    (void)claims_count;
+}
+
+#endif // !defined(__STDC_NO_ATOMICS__)
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
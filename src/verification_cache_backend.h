@@ -0,0 +1,83 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+/**
+ *  @file verification_cache_backend.h
+ *  @author Raphael Beck
+ *  @brief Internal lookup/insertion functions of the verification and rejection caches, used by decode.c. NOT part of the public API!
+ */
+
+#ifndef L8W8JWT_VERIFICATION_CACHE_BACKEND_H
+#define L8W8JWT_VERIFICATION_CACHE_BACKEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/claim.h"
+#include "l8w8jwt/decode.h"
+#include "l8w8jwt/verification_cache.h"
+#include "l8w8jwt/rejection_cache.h"
+
+#include <stddef.h>
+#include "allocator_backend.h"
+
+/**
+ * Computes the digest that a token is cached under: SHA-256 over the alg, the verification key (or its ID or fingerprint) and the full token string.
+ * @param params The decoding parameters (the token and key are taken from there).
+ * @param out Where to write the 32-byte digest into.
+ * @return Return code as defined in retcodes.h
+ */
+int l8w8jwt_verification_cache_digest(const struct l8w8jwt_decoding_params* params, unsigned char out[32]);
+
+/**
+ * Looks up a token.
+ * @param verification_cache The verification cache.
+ * @param digest The token's digest (see {@link #l8w8jwt_verification_cache_digest}).
+ * @param claims Where to append the cached claims to (only on a hit).
+ * @return <code>0</code> on a hit, <code>1</code> on a miss; any other return code as defined in retcodes.h on failure.
+ */
+int l8w8jwt_verification_cache_get(struct l8w8jwt_verification_cache* verification_cache, const unsigned char digest[32], struct l8w8jwt_call_buffer* claims);
+
+/**
+ * Inserts a token whose signature was verified successfully (tokens without a future <code>exp</code> claim, or with too many claims, are silently skipped).
+ * @param verification_cache The verification cache.
+ * @param digest The token's digest (see {@link #l8w8jwt_verification_cache_digest}).
+ * @param claims The token's decoded header and payload claims.
+ * @param claims_count How many claims there are.
+ */
+void l8w8jwt_verification_cache_put(struct l8w8jwt_verification_cache* verification_cache, const unsigned char digest[32], const struct l8w8jwt_claim* claims, size_t claims_count);
+
+/**
+ * Checks whether a token's signature was rejected recently.
+ * @param rejection_cache The rejection cache.
+ * @param digest The token's digest (see {@link #l8w8jwt_verification_cache_digest}).
+ * @return <code>1</code> if the token is in the cache (and not expired yet); <code>0</code> if it isn't.
+ */
+int l8w8jwt_rejection_cache_contains(struct l8w8jwt_rejection_cache* rejection_cache, const unsigned char digest[32]);
+
+/**
+ * Remembers a token whose signature failed to verify (for the cache's TTL).
+ * @param rejection_cache The rejection cache.
+ * @param digest The token's digest (see {@link #l8w8jwt_verification_cache_digest}).
+ */
+void l8w8jwt_rejection_cache_put(struct l8w8jwt_rejection_cache* rejection_cache, const unsigned char digest[32]);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // L8W8JWT_VERIFICATION_CACHE_BACKEND_H
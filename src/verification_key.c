@@ -0,0 +1,136 @@
+/*
+   Copyright 2020 Raphael Beck
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "l8w8jwt/algs.h"
+#include "l8w8jwt/util.h"
+#include "l8w8jwt/decode.h"
+#include "l8w8jwt/retcodes.h"
+#include "l8w8jwt/verification_key.h"
+#include "crypto_provider.h"
+#include "sha2.h"
+
+#include <string.h>
+#include <mbedtls/platform_util.h>
+
+int l8w8jwt_verification_key_create(const int alg, const unsigned char* key, size_t key_length, const size_t max_table_size, struct l8w8jwt_verification_key** out_verification_key)
+{
+    int r;
+
+    if (key == NULL || out_verification_key == NULL)
+    {
+        return L8W8JWT_NULL_ARG;
+    }
+
+    if (key_length == 0 || key_length > L8W8JWT_MAX_KEY_SIZE)
+    {
+        return L8W8JWT_INVALID_ARG;
+    }
+
+    switch (alg)
+    {
+        case L8W8JWT_ALG_RS256:
+        case L8W8JWT_ALG_RS384:
+        case L8W8JWT_ALG_RS512:
+        case L8W8JWT_ALG_PS256:
+        case L8W8JWT_ALG_PS384:
+        case L8W8JWT_ALG_PS512:
+        case L8W8JWT_ALG_ES256:
+        case L8W8JWT_ALG_ES384:
+        case L8W8JWT_ALG_ES512:
+        case L8W8JWT_ALG_ES256K:
+            break;
+        case L8W8JWT_ALG_HS256:
+        case L8W8JWT_ALG_HS384:
+        case L8W8JWT_ALG_HS512:
+        case L8W8JWT_ALG_ED25519:
+            return L8W8JWT_UNSUPPORTED_ALG;
+        default:
+            return L8W8JWT_INVALID_ARG;
+    }
+
+    struct l8w8jwt_verification_key* verification_key = l8w8jwt_calloc(1, sizeof(struct l8w8jwt_verification_key));
+    if (verification_key == NULL)
+    {
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    verification_key->alg = alg;
+    verification_key->provider = l8w8jwt_get_active_crypto_provider();
+
+    /* The providers want a NUL-terminated PEM (with the NUL-terminator included in the length). */
+    unsigned char* pem = l8w8jwt_calloc(sizeof(unsigned char), key_length + 1);
+    if (pem == NULL)
+    {
+        l8w8jwt_free(verification_key);
+        return L8W8JWT_OUT_OF_MEM;
+    }
+
+    memcpy(pem, key, key_length);
+
+    r = l8w8jwt_sha2(MBEDTLS_MD_SHA256, pem, key_length - (pem[key_length - 1] == '\0'), verification_key->fingerprint) != 0 ? L8W8JWT_SHA2_FAILURE : L8W8JWT_SUCCESS;
+
+    key_length += pem[key_length - 1] != '\0';
+
+    if (r == L8W8JWT_SUCCESS)
+    {
+        r = verification_key->provider->load_verification_key(alg, pem, key_length, &verification_key->key);
+    }
+
+    mbedtls_platform_zeroize(pem, key_length);
+    l8w8jwt_free(pem);
+
+    if (r == L8W8JWT_SUCCESS && max_table_size != 0 && verification_key->provider->precompute_verification_key != NULL)
+    {
+        r = verification_key->provider->precompute_verification_key(verification_key->key, alg, max_table_size, &verification_key->table_size);
+    }
+
+    if (r != L8W8JWT_SUCCESS)
+    {
+        l8w8jwt_verification_key_free(verification_key);
+        return r;
+    }
+
+    *out_verification_key = verification_key;
+    return L8W8JWT_SUCCESS;
+}
+
+size_t l8w8jwt_verification_key_get_table_size(const struct l8w8jwt_verification_key* verification_key)
+{
+    return verification_key != NULL ? verification_key->table_size : 0;
+}
+
+void l8w8jwt_verification_key_free(struct l8w8jwt_verification_key* verification_key)
+{
+    if (verification_key == NULL)
+    {
+        return;
+    }
+
+    if (verification_key->key != NULL)
+    {
+        verification_key->provider->free_key(verification_key->key);
+    }
+
+    l8w8jwt_free(verification_key);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif